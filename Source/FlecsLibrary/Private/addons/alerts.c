@@ -32,6 +32,12 @@ typedef struct EcsAlertTimeout {
 
 ECS_COMPONENT_DECLARE(EcsAlertTimeout);
 
+/* Name of timer entity that drives alert evaluation */
+#define FlecsAlertsTickName "Tick"
+
+/* Default interval at which alerts are evaluated */
+#define FlecsAlertsDefaultInterval ((ecs_ftime_t)0.5)
+
 static ECS_CTOR(EcsAlert, ptr, {
     ecs_os_zeromem(ptr);
     ecs_map_init(&ptr->instances, NULL);
@@ -229,6 +235,9 @@ static void MonitorAlerts(ecs_iter_t *it) {
     EcsAlert *alert = ecs_field(it, EcsAlert, 0);
     EcsPoly *poly = ecs_field(it, EcsPoly, 1);
 
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(world, &t_start);
+
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
         ecs_entity_t a = it->entities[i]; /* Alert entity */
@@ -331,9 +340,11 @@ static void MonitorAlerts(ecs_iter_t *it) {
             }
         }
     }
+
+    flecs_instrumentation_end(world, &t_start);
 }
 
-static void MonitorAlertInstances(ecs_iter_t *it) {
+static void flecs_alerts_monitor_instances(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     EcsAlertInstance *alert_instance = ecs_field(it, EcsAlertInstance, 0);
     EcsMetricSource *source = ecs_field(it, EcsMetricSource, 1);
@@ -478,6 +489,13 @@ static void MonitorAlertInstances(ecs_iter_t *it) {
     ecs_script_vars_fini(vars);
 }
 
+static void MonitorAlertInstances(ecs_iter_t *it) {
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(it->real_world, &t_start);
+    flecs_alerts_monitor_instances(it);
+    flecs_instrumentation_end(it->real_world, &t_start);
+}
+
 ecs_entity_t ecs_alert_init(
     ecs_world_t *world,
     const ecs_alert_desc_t *desc)
@@ -691,6 +709,31 @@ error:
     return 0;
 }
 
+void ecs_alerts_set_interval(
+    ecs_world_t *world,
+    ecs_ftime_t interval)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(interval >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_entity_t tick = ecs_lookup_child(
+        world, ecs_id(FlecsAlerts), FlecsAlertsTickName);
+    ecs_check(tick != 0, ECS_INVALID_OPERATION, 
+        "alerts module is not imported");
+
+    ecs_set_interval(world, tick, interval);
+error:
+    return;
+}
+
+ecs_ftime_t ecs_alerts_get_interval(
+    const ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    return ecs_get_interval(world, 
+        ecs_lookup_child(world, ecs_id(FlecsAlerts), FlecsAlertsTickName));
+}
+
 void FlecsAlertsImport(ecs_world_t *world) {
     ECS_MODULE_DEFINE(world, FlecsAlerts);
 
@@ -760,13 +803,19 @@ void FlecsAlertsImport(ecs_world_t *world) {
         ?Timeout,
         ?Disabled);
 
+    /* Shared timer so that alerts and alert instances are evaluated in the
+     * same frame. Interval can be changed with ecs_alerts_set_interval(). */
+    ecs_entity_t tick = ecs_set_interval(world, 
+        ecs_entity(world, { .name = FlecsAlertsTickName }), 
+        FlecsAlertsDefaultInterval);
+
     ecs_system_update(world, ecs_id(MonitorAlerts), &(ecs_system_desc_t){
         .immediate = true,
-        .interval = (ecs_ftime_t)0.5
+        .tick_source = tick
     });
 
     ecs_system_update(world, ecs_id(MonitorAlertInstances), &(ecs_system_desc_t){
-        .interval = (ecs_ftime_t)0.5
+        .tick_source = tick
     });
 }
 
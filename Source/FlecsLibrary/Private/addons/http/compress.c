@@ -0,0 +1,318 @@
+/**
+ * @file addons/http/compress.c
+ * @brief Compression of HTTP replies.
+ *
+ * Minimal deflate (RFC 1951) encoder that uses LZ77 with hash chains and the
+ * fixed Huffman code. This doesn't compress as well as zlib, but JSON replies
+ * are highly repetitive and still shrink by a large factor, without adding a
+ * dependency to the library.
+ */
+
+#include "../../private_api.h"
+
+#ifdef FLECS_HTTP
+
+#include "http.h"
+
+#define HTTP_DEFLATE_WINDOW (32768)
+#define HTTP_DEFLATE_HASH_BITS (15)
+#define HTTP_DEFLATE_HASH_SIZE (1 << HTTP_DEFLATE_HASH_BITS)
+#define HTTP_DEFLATE_MAX_CHAIN (32)
+#define HTTP_DEFLATE_MIN_MATCH (3)
+#define HTTP_DEFLATE_MAX_MATCH (258)
+
+static const uint16_t http_deflate_length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59,
+    67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+static const uint8_t http_deflate_length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4,
+    5, 5, 5, 5, 0
+};
+
+static const uint16_t http_deflate_dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513,
+    769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+
+static const uint8_t http_deflate_dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10,
+    11, 11, 12, 12, 13, 13
+};
+
+static const uint32_t http_crc32_table[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+    0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+    0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+typedef struct {
+    char *buf;
+    int32_t pos;
+    int32_t size;
+    uint64_t bits;
+    int32_t bit_count;
+} http_bit_writer_t;
+
+static void http_bits_put(
+    http_bit_writer_t *w,
+    uint32_t value,
+    int32_t count)
+{
+    w->bits |= (uint64_t)value << w->bit_count;
+    w->bit_count += count;
+    while (w->bit_count >= 8) {
+        if (w->pos < w->size) {
+            w->buf[w->pos] = (char)(w->bits & 0xFF);
+        }
+        w->pos ++;
+        w->bits >>= 8;
+        w->bit_count -= 8;
+    }
+}
+
+static void http_bits_flush(
+    http_bit_writer_t *w)
+{
+    if (w->bit_count) {
+        http_bits_put(w, 0, 8 - w->bit_count);
+    }
+}
+
+static void http_bytes_put(
+    http_bit_writer_t *w,
+    const uint8_t *bytes,
+    int32_t count)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        http_bits_put(w, bytes[i], 8);
+    }
+}
+
+/* Huffman codes are stored most significant bit first */
+static void http_bits_put_code(
+    http_bit_writer_t *w,
+    uint32_t code,
+    int32_t count)
+{
+    uint32_t reversed = 0;
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    http_bits_put(w, reversed, count);
+}
+
+static void http_deflate_put_symbol(
+    http_bit_writer_t *w,
+    int32_t symbol)
+{
+    if (symbol <= 143) {
+        http_bits_put_code(w, flecs_ito(uint32_t, 0x30 + symbol), 8);
+    } else if (symbol <= 255) {
+        http_bits_put_code(w, flecs_ito(uint32_t, 0x190 + symbol - 144), 9);
+    } else if (symbol <= 279) {
+        http_bits_put_code(w, flecs_ito(uint32_t, symbol - 256), 7);
+    } else {
+        http_bits_put_code(w, flecs_ito(uint32_t, 0xC0 + symbol - 280), 8);
+    }
+}
+
+static void http_deflate_put_match(
+    http_bit_writer_t *w,
+    int32_t length,
+    int32_t distance)
+{
+    int32_t code = 28;
+    while (http_deflate_length_base[code] > length) {
+        code --;
+    }
+
+    http_deflate_put_symbol(w, 257 + code);
+    http_bits_put(w, flecs_ito(uint32_t, length - http_deflate_length_base[code]),
+        http_deflate_length_extra[code]);
+
+    code = 29;
+    while (http_deflate_dist_base[code] > distance) {
+        code --;
+    }
+
+    http_bits_put_code(w, flecs_ito(uint32_t, code), 5);
+    http_bits_put(w, flecs_ito(uint32_t, distance - http_deflate_dist_base[code]),
+        http_deflate_dist_extra[code]);
+}
+
+static uint32_t http_deflate_hash(
+    const uint8_t *ptr)
+{
+    uint32_t v = ((uint32_t)ptr[0] << 16) | ((uint32_t)ptr[1] << 8) | ptr[2];
+    return (v * 2654435761u) >> (32 - HTTP_DEFLATE_HASH_BITS);
+}
+
+/* Writes a single final block with the fixed Huffman code */
+static void http_deflate(
+    http_bit_writer_t *w,
+    const uint8_t *data,
+    int32_t length)
+{
+    int32_t *head = ecs_os_malloc_n(int32_t, HTTP_DEFLATE_HASH_SIZE);
+    int32_t *prev = ecs_os_malloc_n(int32_t, HTTP_DEFLATE_WINDOW);
+    ecs_os_memset_n(head, 0xFF, int32_t, HTTP_DEFLATE_HASH_SIZE);
+
+    http_bits_put(w, 1, 1); /* BFINAL */
+    http_bits_put(w, 1, 2); /* BTYPE = fixed Huffman */
+
+    int32_t i = 0;
+    while (i < length && w->pos < w->size) {
+        int32_t best_length = 0, best_distance = 0;
+
+        if ((i + HTTP_DEFLATE_MIN_MATCH) <= length) {
+            uint32_t hash = http_deflate_hash(&data[i]);
+            int32_t max_length = length - i;
+            if (max_length > HTTP_DEFLATE_MAX_MATCH) {
+                max_length = HTTP_DEFLATE_MAX_MATCH;
+            }
+
+            int32_t candidate = head[hash];
+            int32_t chain = HTTP_DEFLATE_MAX_CHAIN;
+            while (candidate >= 0 && (i - candidate) <= HTTP_DEFLATE_WINDOW &&
+                chain --)
+            {
+                if (data[candidate + best_length] == data[i + best_length]) {
+                    int32_t l = 0;
+                    while (l < max_length && data[candidate + l] == data[i + l]) {
+                        l ++;
+                    }
+                    if (l > best_length) {
+                        best_length = l;
+                        best_distance = i - candidate;
+                        if (l == max_length) {
+                            break;
+                        }
+                    }
+                }
+                candidate = prev[candidate & (HTTP_DEFLATE_WINDOW - 1)];
+            }
+
+            prev[i & (HTTP_DEFLATE_WINDOW - 1)] = head[hash];
+            head[hash] = i;
+        }
+
+        if (best_length >= HTTP_DEFLATE_MIN_MATCH) {
+            http_deflate_put_match(w, best_length, best_distance);
+
+            int32_t j, end = i + best_length;
+            for (j = i + 1; j < end; j ++) {
+                if ((j + HTTP_DEFLATE_MIN_MATCH) <= length) {
+                    uint32_t hash = http_deflate_hash(&data[j]);
+                    prev[j & (HTTP_DEFLATE_WINDOW - 1)] = head[hash];
+                    head[hash] = j;
+                }
+            }
+            i = end;
+        } else {
+            http_deflate_put_symbol(w, data[i]);
+            i ++;
+        }
+    }
+
+    http_deflate_put_symbol(w, 256); /* End of block */
+    http_bits_flush(w);
+
+    ecs_os_free(head);
+    ecs_os_free(prev);
+}
+
+static uint32_t http_crc32(
+    const uint8_t *data,
+    int32_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    int32_t i;
+    for (i = 0; i < length; i ++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ http_crc32_table[crc & 15];
+        crc = (crc >> 4) ^ http_crc32_table[crc & 15];
+    }
+    return ~crc;
+}
+
+static uint32_t http_adler32(
+    const uint8_t *data,
+    int32_t length)
+{
+    uint32_t a = 1, b = 0;
+    while (length > 0) {
+        /* Largest block for which b can't overflow before the modulo */
+        int32_t i, block = length < 5552 ? length : 5552;
+        for (i = 0; i < block; i ++) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+        data += block;
+        length -= block;
+    }
+    return (b << 16) | a;
+}
+
+char* flecs_http_compress(
+    const char *data,
+    int32_t length,
+    int32_t encoding,
+    int32_t *length_out)
+{
+    ecs_assert(data != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(length_out != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    const uint8_t *bytes = (const uint8_t*)data;
+
+    /* Output that isn't smaller than the input is discarded */
+    http_bit_writer_t w = {0};
+    w.size = length;
+    w.buf = ecs_os_malloc(w.size);
+
+    if (encoding == ECS_HTTP_ENCODING_GZIP) {
+        const uint8_t header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+        http_bytes_put(&w, header, 10);
+    } else {
+        const uint8_t header[2] = { 0x78, 0x01 };
+        http_bytes_put(&w, header, 2);
+    }
+
+    http_deflate(&w, bytes, length);
+
+    if (encoding == ECS_HTTP_ENCODING_GZIP) {
+        uint32_t crc = http_crc32(bytes, length);
+        uint32_t size = flecs_ito(uint32_t, length);
+        const uint8_t trailer[8] = {
+            (uint8_t)crc, (uint8_t)(crc >> 8),
+            (uint8_t)(crc >> 16), (uint8_t)(crc >> 24),
+            (uint8_t)size, (uint8_t)(size >> 8),
+            (uint8_t)(size >> 16), (uint8_t)(size >> 24)
+        };
+        http_bytes_put(&w, trailer, 8);
+    } else {
+        uint32_t adler = http_adler32(bytes, length);
+        const uint8_t trailer[4] = {
+            (uint8_t)(adler >> 24), (uint8_t)(adler >> 16),
+            (uint8_t)(adler >> 8), (uint8_t)adler
+        };
+        http_bytes_put(&w, trailer, 4);
+    }
+
+    if (w.pos >= w.size) {
+        ecs_os_free(w.buf);
+        return NULL;
+    }
+
+    *length_out = w.pos;
+    return w.buf;
+}
+
+#endif
@@ -52,6 +52,8 @@ int64_t ecs_http_send_ok_count = 0;
 int64_t ecs_http_send_error_count = 0;
 int64_t ecs_http_busy_count = 0;
 
+static bool http_would_block(void);
+
 static ecs_size_t http_send(
     ecs_http_socket_t sock, 
     const void *buf, 
@@ -84,7 +86,9 @@ static ecs_size_t http_recv(
     ret = flecs_itoi32(recv_bytes);
 #endif
     if (ret == -1) {
-        ecs_dbg("recv failed: %s (sock = %d)", ecs_os_strerror(errno), sock);
+        if (!http_would_block()) {
+            ecs_dbg("recv failed: %s (sock = %d)", ecs_os_strerror(errno), sock);
+        }
     } else if (ret == 0) {
         ecs_dbg("recv: received 0 bytes (sock = %d)", sock);
     }
@@ -92,26 +96,6 @@ static ecs_size_t http_recv(
     return ret;
 }
 
-static void http_sock_set_timeout(
-    ecs_http_socket_t sock,
-    int32_t timeout_ms)
-{
-    int r;
-#ifdef ECS_TARGET_POSIX
-    struct timeval tv;
-    tv.tv_sec = timeout_ms / 1000;
-    tv.tv_usec = (timeout_ms % 1000) * 1000;
-    r = setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof tv);
-#else
-    DWORD t = (DWORD)timeout_ms;
-    r = setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&t, sizeof t);
-#endif
-    if (r) {
-        ecs_warn("http: failed to set socket timeout: %s", 
-            ecs_os_strerror(errno));
-    }
-}
-
 static void http_sock_keep_alive(
     ecs_http_socket_t sock)
 {
@@ -143,6 +127,12 @@ static void http_sock_nonblock(ecs_http_socket_t sock, bool enable) {
             ecs_os_strerror(errno));
         return;
     }
+#elif defined(ECS_TARGET_WINDOWS)
+    u_long mode = enable ? 1 : 0;
+    if (ioctlsocket(sock, FIONBIO, &mode)) {
+        ecs_warn("http: failed to set socket NONBLOCK: %d",
+            WSAGetLastError());
+    }
 #endif
 }
 
@@ -224,9 +214,114 @@ static ecs_http_socket_t http_accept(
     return result;
 }
 
+static bool http_would_block(void) {
+#if defined(ECS_TARGET_WINDOWS)
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+static int http_poll(
+    ecs_http_pollfd_t *fds,
+    int32_t count,
+    int32_t timeout_ms)
+{
+#if defined(ECS_TARGET_WINDOWS)
+    return WSAPoll(fds, (ULONG)count, timeout_ms);
+#else
+    return poll(fds, (nfds_t)count, timeout_ms);
+#endif
+}
+
+static void http_sock_nodelay(
+    ecs_http_socket_t sock)
+{
+    /* Replies are written as soon as they're ready, don't wait for more data */
+    int v = 1;
+    if (setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&v, sizeof v)) {
+        ecs_warn("http: failed to set socket NODELAY: %s",
+            ecs_os_strerror(errno));
+    }
+}
+
+static bool http_send_all(
+    ecs_http_socket_t sock,
+    const char *buf,
+    ecs_size_t size)
+{
+    while (size > 0) {
+        ecs_size_t written = http_send(sock, buf, size, 0);
+        if (written <= 0) {
+            return false;
+        }
+        buf += written;
+        size -= written;
+    }
+    return true;
+}
+
+static double http_now(void) {
+    ecs_time_t t = {0, 0};
+    return ecs_time_measure(&t);
+}
+
+/* The connection thread blocks in poll(). The wakeup socket is a loopback UDP
+ * socket connected to itself which is part of the poll set, so that other
+ * threads can interrupt the poll when a connection must be (re)added. */
+static void http_wakeup_init(
+    ecs_http_server_t *srv)
+{
+    srv->wakeup_sock = HTTP_SOCKET_INVALID;
+
+    ecs_http_socket_t sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (!http_socket_is_valid(sock)) {
+        goto error;
+    }
+
+    struct sockaddr_in addr;
+    ecs_os_zeromem(&addr);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t addr_len = (socklen_t)sizeof(addr);
+    if (bind(sock, (struct sockaddr*)&addr, addr_len) ||
+        getsockname(sock, (struct sockaddr*)&addr, &addr_len) ||
+        connect(sock, (struct sockaddr*)&addr, addr_len))
+    {
+        http_close(&sock);
+        goto error;
+    }
+
+    http_sock_nonblock(sock, true);
+    srv->wakeup_sock = sock;
+    return;
+error:
+    ecs_warn("http: failed to create wakeup socket, falling back to polling: %s",
+        ecs_os_strerror(errno));
+}
+
+static void http_wakeup(
+    ecs_http_server_t *srv)
+{
+    if (http_socket_is_valid(srv->wakeup_sock)) {
+        char ch = 0;
+        http_send(srv->wakeup_sock, &ch, 1, 0);
+    }
+}
+
+static void http_wakeup_drain(
+    ecs_http_server_t *srv)
+{
+    char buf[64];
+    while (http_recv(srv->wakeup_sock, buf, ECS_SIZEOF(buf), 0) > 0) { }
+}
+
 static void http_reply_fini(ecs_http_reply_t* reply) {
     ecs_assert(reply != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_os_free(reply->body.content);
+    ecs_strbuf_reset(&reply->body);
+    ecs_strbuf_reset(&reply->headers);
 }
 
 static void http_request_fini(ecs_http_request_impl_t *req) {
@@ -248,6 +343,8 @@ static void http_connection_free(ecs_http_connection_impl_t *conn) {
         http_close(&conn->sock);
     }
 
+    ecs_strbuf_reset(&conn->frag.buf);
+
     flecs_sparse_remove_t(&conn->pub.server->connections, 
         ecs_http_connection_impl_t, conn_id);
 }
@@ -374,13 +471,36 @@ static ecs_http_request_entry_t* http_find_request_entry(
     return NULL;
 }
 
+/* Cached replies can outlive the handler that produced them, so their content
+ * types are kept until the server is freed. Must be called with srv->lock. */
+static const char* http_intern_content_type(
+    ecs_http_server_t *srv,
+    const char *content_type)
+{
+    if (!content_type) {
+        return NULL;
+    }
+
+    int32_t i, count = ecs_vec_count(&srv->content_types);
+    char **types = ecs_vec_first(&srv->content_types);
+    for (i = 0; i < count; i ++) {
+        if (!ecs_os_strcmp(types[i], content_type)) {
+            return types[i];
+        }
+    }
+
+    char *result = ecs_os_strdup(content_type);
+    ecs_vec_append_t(NULL, &srv->content_types, char*)[0] = result;
+    return result;
+}
+
 static void http_insert_request_entry(
     ecs_http_server_t *srv,
     ecs_http_request_impl_t *req,
     ecs_http_reply_t *reply)
 {
     int32_t content_length = ecs_strbuf_written(&reply->body);
-    if (!content_length) {
+    if (!content_length || reply->no_cache) {
         return;
     }
 
@@ -403,6 +523,7 @@ static void http_insert_request_entry(
     entry->time = ecs_time_measure(&t);
     entry->content_length = ecs_strbuf_written(&reply->body);
     entry->content = ecs_strbuf_get(&reply->body);
+    entry->content_type = http_intern_content_type(srv, reply->content_type);
     entry->code = reply->code;
     ecs_strbuf_appendstrn(&reply->body, 
             entry->content, entry->content_length);
@@ -451,54 +572,72 @@ static char* http_decode_request(
     return res;
 }
 
-static ecs_http_request_entry_t* http_enqueue_request(
-    ecs_http_connection_impl_t *conn,
-    uint64_t conn_id,
-    ecs_http_fragment_t *frag)
+static bool http_str_equals_nocase(
+    const char *str_1,
+    const char *str_2)
 {
-    ecs_http_server_t *srv = conn->pub.server;
+    for (; str_1[0] && str_2[0]; str_1 ++, str_2 ++) {
+        char ch_1 = str_1[0], ch_2 = str_2[0];
+        if (ch_1 >= 'A' && ch_1 <= 'Z') ch_1 = (char)(ch_1 - 'A' + 'a');
+        if (ch_2 >= 'A' && ch_2 <= 'Z') ch_2 = (char)(ch_2 - 'A' + 'a');
+        if (ch_1 != ch_2) {
+            return false;
+        }
+    }
+    return str_1[0] == str_2[0];
+}
 
-    ecs_os_mutex_lock(srv->lock);
-    bool is_alive = conn->pub.id == conn_id;
+static const char* http_find_header_nocase(
+    const ecs_http_request_t *req,
+    const char *name)
+{
+    int32_t i;
+    for (i = 0; i < req->header_count; i ++) {
+        if (http_str_equals_nocase(req->headers[i].key, name)) {
+            return req->headers[i].value;
+        }
+    }
+    return NULL;
+}
 
-    if (!is_alive || frag->invalid) { 
-        /* Don't enqueue invalid requests or requests for purged connections */
-        ecs_strbuf_reset(&frag->buf);
+/* Determine whether the connection should be kept open and which encodings the
+ * client accepts for the reply. */
+static void http_request_parse_options(
+    ecs_http_request_impl_t *req,
+    bool http10)
+{
+    const char *connection = http_find_header_nocase(&req->pub, "Connection");
+    if (connection) {
+        if (http_str_equals_nocase(connection, "close")) {
+            req->close = true;
+        } else if (http_str_equals_nocase(connection, "keep-alive")) {
+            req->close = false;
+        } else {
+            req->close = http10;
+        }
     } else {
-        ecs_http_request_impl_t req;
-        char *res = http_decode_request(&req, frag);
-        if (res) {
-            req.pub.conn = (ecs_http_connection_t*)conn;
-
-            /* Check cache for GET requests */
-            if (frag->method == EcsHttpGet) {
-                ecs_http_request_entry_t *entry = 
-                    http_find_request_entry(srv, res, frag->header_offsets[0]);
-                if (entry) {
-                    /* If an entry is found, don't enqueue a request. Instead
-                     * return the cached response immediately. */
-                    ecs_os_free(res);
-                    return entry;
-                }
-            }
+        req->close = http10; /* HTTP/1.1 connections are persistent by default */
+    }
 
-            ecs_http_request_impl_t *req_ptr = flecs_sparse_add_t(
-                &srv->requests, ecs_http_request_impl_t);
-            *req_ptr = req;
-            req_ptr->pub.id = flecs_sparse_last_id(&srv->requests);
-            req_ptr->conn_id = conn->pub.id;
-            ecs_os_linc(&ecs_http_request_received_count);
+    const char *encoding = http_find_header_nocase(&req->pub, "Accept-Encoding");
+    if (encoding) {
+        if (strstr(encoding, "gzip")) {
+            req->encodings |= ECS_HTTP_ENCODING_GZIP;
+        }
+        if (strstr(encoding, "deflate")) {
+            req->encodings |= ECS_HTTP_ENCODING_DEFLATE;
         }
     }
-
-    ecs_os_mutex_unlock(srv->lock);
-    return NULL;
 }
 
+/* Parse (part of) a request. Returns true when a request is complete, in which
+ * case consumed is set to the number of bytes that belong to the request. Any
+ * remaining bytes belong to the next (pipelined) request. */
 static bool http_parse_request(
     ecs_http_fragment_t *frag,
     const char* req_frag, 
-    ecs_size_t req_frag_len) 
+    ecs_size_t req_frag_len,
+    ecs_size_t *consumed) 
 {
     int32_t i;
     for (i = 0; i < req_frag_len; i++) {
@@ -524,6 +663,7 @@ static bool http_parse_request(
             if (c == ' ') {
                 frag->state = HttpFragStateVersion;
                 ecs_strbuf_appendch(&frag->buf, '\0');
+                http_header_buf_reset(frag);
             } else {
                 if (c == '?' || c == '=' || c == '&') {
                     if (http_param_writable(frag)) {
@@ -545,8 +685,12 @@ static bool http_parse_request(
             break;
         case HttpFragStateVersion:
             if (c == '\r') {
+                http_header_buf_append(frag, '\0');
+                frag->http10 = !ecs_os_strcmp(frag->header_buf, "HTTP/1.0");
                 frag->state = HttpFragStateCR;
-            } /* version is not stored */
+            } else {
+                http_header_buf_append(frag, c);
+            }
             break;
         case HttpFragStateHeaderStart:
             if (http_header_writable(frag)) {
@@ -656,6 +800,15 @@ static bool http_parse_request(
         case HttpFragStateDone:
             break;
         }
+
+        if (frag->state == HttpFragStateDone) {
+            i ++;
+            break;
+        }
+    }
+
+    if (consumed) {
+        *consumed = i;
     }
 
     if (frag->state == HttpFragStateDone) {
@@ -665,116 +818,21 @@ static bool http_parse_request(
     }
 }
 
-static ecs_http_send_request_t* http_send_queue_post(
-    ecs_http_server_t *srv)
-{
-    /* This function should only be called while the server is locked. Before 
-     * the lock is released, the returned element should be populated. */
-    ecs_http_send_queue_t *sq = &srv->send_queue;
-    int32_t next = (sq->head + 1) % ECS_HTTP_SEND_QUEUE_MAX;
-    if (next == sq->tail) {
-        return NULL;
-    }
-
-    /* Don't enqueue new requests if server is shutting down */
-    if (!srv->should_run) {
-        return NULL;
-    }
-
-    /* Return element at end of the queue */
-    ecs_http_send_request_t *result = &sq->requests[sq->head];
-    sq->head = next;
-    return result;
-}
-
-static ecs_http_send_request_t* http_send_queue_get(
-    ecs_http_server_t *srv)
-{
-    ecs_os_mutex_lock(srv->lock);
-    ecs_http_send_queue_t *sq = &srv->send_queue;
-    if (sq->tail == sq->head) {
-        return NULL;
-    }
-
-    int32_t next = (sq->tail + 1) % ECS_HTTP_SEND_QUEUE_MAX;
-    ecs_http_send_request_t *result = &sq->requests[sq->tail];
-    sq->tail = next;
-    return result;
-}
-
-static void* http_server_send_queue(void* arg) {
-    ecs_http_server_t *srv = arg;
-    int32_t wait_ms = srv->send_queue.wait_ms;
-
-    /* Run for as long as the server is running or there are messages. When the
-     * server is stopping, no new messages will be enqueued */
-    while (srv->should_run || (srv->send_queue.head != srv->send_queue.tail)) {
-        ecs_http_send_request_t* r = http_send_queue_get(srv);
-        if (!r) {
-            ecs_os_mutex_unlock(srv->lock);
-            /* If the queue is empty, wait so we don't run too fast */
-            if (srv->should_run) {
-                ecs_os_sleep(0, wait_ms * 1000 * 1000);
-            }
-        } else {
-            ecs_http_socket_t sock = r->sock;
-            char *headers = r->headers;
-            int32_t headers_length = r->header_length;
-            char *content = r->content;
-            int32_t content_length = r->content_length;
-            ecs_os_mutex_unlock(srv->lock);
-
-            if (http_socket_is_valid(sock)) {
-                bool error = false;
-
-                http_sock_nonblock(sock, false);
-
-                /* Write headers */
-                ecs_size_t written = http_send(sock, headers, headers_length, 0);
-                if (written != headers_length) {
-                    ecs_err("http: failed to write HTTP response headers: %s",
-                        ecs_os_strerror(errno));
-                    ecs_os_linc(&ecs_http_send_error_count);
-                    error = true;
-                } else if (content_length >= 0) {
-                    /* Write content */
-                    written = http_send(sock, content, content_length, 0);
-                    if (written != content_length) {
-                        ecs_err("http: failed to write HTTP response body: %s",
-                            ecs_os_strerror(errno));
-                        ecs_os_linc(&ecs_http_send_error_count);
-                        error = true;
-                    }
-                }
-                if (!error) {
-                    ecs_os_linc(&ecs_http_send_ok_count);
-                }
-
-                http_close(&sock);
-            } else {
-                ecs_err("http: invalid socket\n");
-            }
-
-            ecs_os_free(content);
-            ecs_os_free(headers);
-        }
-    }
-    return NULL;
-}
-
 static void http_append_send_headers(
     ecs_strbuf_t *hdrs,
     int code, 
     const char* status, 
     const char* content_type,  
-    ecs_strbuf_t *extra_headers,
+    const char* content_encoding,
+    const char* extra_headers,
     ecs_size_t content_len,
-    bool preflight)
+    bool preflight,
+    bool close)
 {
     ecs_strbuf_appendlit(hdrs, "HTTP/1.1 ");
     ecs_strbuf_appendint(hdrs, code);
     ecs_strbuf_appendch(hdrs, ' ');
-    ecs_strbuf_appendstr(hdrs, status);
+    ecs_strbuf_appendstr(hdrs, status ? status : "OK");
     ecs_strbuf_appendlit(hdrs, "\r\n");
 
     if (content_type) {
@@ -783,12 +841,24 @@ static void http_append_send_headers(
         ecs_strbuf_appendlit(hdrs, "\r\n");
     }
 
+    if (content_encoding) {
+        ecs_strbuf_appendlit(hdrs, "Content-Encoding: ");
+        ecs_strbuf_appendstr(hdrs, content_encoding);
+        ecs_strbuf_appendlit(hdrs, "\r\nVary: Accept-Encoding\r\n");
+    }
+
     if (content_len >= 0) {
         ecs_strbuf_appendlit(hdrs, "Content-Length: ");
         ecs_strbuf_append(hdrs, "%d", content_len);
         ecs_strbuf_appendlit(hdrs, "\r\n");
     }
 
+    if (close) {
+        ecs_strbuf_appendlit(hdrs, "Connection: close\r\n");
+    } else {
+        ecs_strbuf_appendlit(hdrs, "Connection: keep-alive\r\n");
+    }
+
     ecs_strbuf_appendlit(hdrs, "Access-Control-Allow-Origin: *\r\n");
     if (preflight) {
         ecs_strbuf_appendlit(hdrs, "Access-Control-Allow-Private-Network: true\r\n");
@@ -796,350 +866,591 @@ static void http_append_send_headers(
         ecs_strbuf_appendlit(hdrs, "Access-Control-Max-Age: 600\r\n");
     }
 
-    ecs_strbuf_mergebuff(hdrs, extra_headers);
+    if (extra_headers) {
+        ecs_strbuf_appendstr(hdrs, extra_headers);
+    }
 
     ecs_strbuf_appendlit(hdrs, "\r\n");
 }
 
-static void http_send_reply(
-    ecs_http_connection_impl_t* conn, 
-    ecs_http_reply_t* reply,
-    bool preflight) 
+/* Create a send job from a reply. The job takes ownership of the reply body
+ * and headers, and copies everything else so that it can outlive the reply. */
+static ecs_http_job_t http_reply_to_job(
+    ecs_http_connection_impl_t *conn,
+    uint64_t conn_id,
+    ecs_http_reply_t *reply,
+    int32_t encodings,
+    bool preflight,
+    bool close)
 {
-    ecs_strbuf_t hdrs = ECS_STRBUF_INIT;
-    int32_t content_length = reply->body.length;
-    char *content = ecs_strbuf_get(&reply->body);
+    ecs_http_job_t job = {0};
+    job.kind = EcsHttpJobSend;
+    job.conn = conn;
+    job.conn_id = conn_id;
+    job.code = reply->code;
+    job.status = reply->status ? ecs_os_strdup(reply->status) : NULL;
+    job.content_type = reply->content_type ? 
+        ecs_os_strdup(reply->content_type) : NULL;
+    job.headers = ecs_strbuf_get(&reply->headers);
+    job.content_length = ecs_strbuf_written(&reply->body);
+    job.content = ecs_strbuf_get(&reply->body);
+    job.encodings = encodings;
+    job.preflight = preflight;
+    job.close = close;
+    return job;
+}
 
-    /* Use asynchronous send queue for outgoing data so send operations won't
-     * hold up main thread */
-    ecs_http_send_request_t *req = NULL;
+static void http_job_fini(
+    ecs_http_job_t *job)
+{
+    ecs_os_free(job->status);
+    ecs_os_free(job->content_type);
+    ecs_os_free(job->headers);
+    ecs_os_free(job->content);
+}
 
-    if (!preflight) {
-        req = http_send_queue_post(conn->pub.server);
-        if (!req) {
-            reply->code = 503; /* queue full, server is busy */
-            ecs_os_linc(&ecs_http_busy_count);
+static void http_worker_post(
+    ecs_http_worker_t *worker,
+    const ecs_http_job_t *job)
+{
+    ecs_os_mutex_lock(worker->lock);
+    ecs_vec_append_t(NULL, &worker->jobs, ecs_http_job_t)[0] = *job;
+    ecs_os_cond_signal(worker->cond);
+    ecs_os_mutex_unlock(worker->lock);
+}
+
+/* Runs on the worker that owns the connection */
+static void http_job_send(
+    ecs_http_server_t *srv,
+    ecs_http_job_t *job)
+{
+    ecs_http_connection_impl_t *conn = job->conn;
+    const char *content_encoding = NULL;
+    char *content = job->content;
+    int32_t content_length = job->content_length;
+
+    /* Compress large replies off the main thread */
+    if (content && srv->compression_threshold && job->encodings &&
+        content_length >= srv->compression_threshold) 
+    {
+        int32_t encoding = (job->encodings & ECS_HTTP_ENCODING_GZIP) ?
+            ECS_HTTP_ENCODING_GZIP : ECS_HTTP_ENCODING_DEFLATE;
+        int32_t compressed_length = 0;
+        char *compressed = flecs_http_compress(
+            content, content_length, encoding, &compressed_length);
+        if (compressed) {
+            ecs_os_free(content);
+            job->content = content = compressed;
+            content_length = compressed_length;
+            content_encoding = encoding == ECS_HTTP_ENCODING_GZIP ? 
+                "gzip" : "deflate";
         }
     }
 
-    http_append_send_headers(&hdrs, reply->code, reply->status, 
-        reply->content_type, &reply->headers, content_length, preflight);
+    ecs_strbuf_t hdrs = ECS_STRBUF_INIT;
+    http_append_send_headers(&hdrs, job->code, job->status, job->content_type,
+        content_encoding, job->headers, content_length, job->preflight, 
+        job->close);
+
+    /* Send small replies in a single packet */
+    if (content_length > 0 && 
+        content_length <= ECS_HTTP_SEND_RECV_BUFFER_SIZE) 
+    {
+        ecs_strbuf_appendstrn(&hdrs, content, content_length);
+        content_length = 0;
+    }
+
     ecs_size_t headers_length = ecs_strbuf_written(&hdrs);
     char *headers = ecs_strbuf_get(&hdrs);
 
-    if (!req) {
-        ecs_size_t written = http_send(conn->sock, headers, headers_length, 0);
-        if (written != headers_length) {
-            ecs_err("http: failed to send reply to '%s:%s': %s",
-                conn->pub.host, conn->pub.port, ecs_os_strerror(errno));
-            ecs_os_linc(&ecs_http_send_error_count);
-        }
-        ecs_os_free(content);
-        ecs_os_free(headers);
-        http_close(&conn->sock);
-        return;
+    http_sock_nonblock(conn->sock, false);
+    bool ok = http_send_all(conn->sock, headers, headers_length);
+    if (ok && content_length > 0) {
+        ok = http_send_all(conn->sock, content, content_length);
+    }
+    http_sock_nonblock(conn->sock, true);
+
+    if (ok) {
+        ecs_os_linc(&ecs_http_send_ok_count);
+        ecs_dbg_2("http: reply sent to '%s:%s'", 
+            conn->pub.host, conn->pub.port);
+    } else {
+        ecs_dbg("http: failed to send reply to '%s:%s': %s",
+            conn->pub.host, conn->pub.port, ecs_os_strerror(errno));
+        ecs_os_linc(&ecs_http_send_error_count);
     }
 
-    /* Enqueue send request for response */
-    req->sock = conn->sock;
-    req->headers = headers;
-    req->header_length = headers_length;
-    req->content = content;
-    req->content_length = content_length;
+    ecs_os_free(headers);
+
+    ecs_os_mutex_lock(srv->lock);
+    ecs_assert(conn->pub.id == job->conn_id, ECS_INTERNAL_ERROR, NULL);
+    bool wakeup = conn->outstanding == ECS_HTTP_PIPELINE_MAX;
+    conn->outstanding --;
+    if (job->close || !ok) {
+        conn->close = true;
+        wakeup = true;
+    }
+    conn->last_activity = http_now();
+    ecs_os_mutex_unlock(srv->lock);
 
-    /* Take ownership of values */
-    reply->body.content = NULL;
-    conn->sock = HTTP_SOCKET_INVALID;
+    if (wakeup) {
+        /* Connection can be read from again or must be closed */
+        http_wakeup(srv);
+    }
 }
 
-static void http_recv_connection(
+/* Handle a fully parsed request. Preflight requests and cached replies are sent
+ * directly from the worker, as long as this doesn't reorder replies. All other
+ * requests are enqueued for ecs_http_server_dequeue(). */
+static bool http_conn_dispatch(
     ecs_http_server_t *srv,
-    ecs_http_connection_impl_t *conn, 
-    uint64_t conn_id,
-    ecs_http_socket_t sock)
+    ecs_http_connection_impl_t *conn,
+    uint64_t conn_id)
 {
-    ecs_size_t bytes_read;
-    char *recv_buf = ecs_os_malloc(ECS_HTTP_SEND_RECV_BUFFER_SIZE);
-    ecs_http_fragment_t frag = {0};
-    int32_t retries = 0;
+    ecs_http_fragment_t *frag = &conn->frag;
+    bool http10 = frag->http10;
 
-    ecs_os_sleep(0, 10 * 1000 * 1000);
+    if (frag->invalid) {
+        ecs_strbuf_reset(&frag->buf);
+        frag->state = HttpFragStateBegin;
+        ecs_os_linc(&ecs_http_request_invalid_count);
+        return false;
+    }
 
-    do {
-        if ((bytes_read = http_recv(
-            sock, recv_buf, ECS_HTTP_SEND_RECV_BUFFER_SIZE, 0)) > 0) 
-        {
-            bool is_alive = conn->pub.id == conn_id;
-            if (!is_alive) {
-                /* Connection has been purged by main thread */
-                goto done;
-            }
+    ecs_http_request_impl_t req;
+    char *res = http_decode_request(&req, frag);
+    frag->state = HttpFragStateBegin;
+    if (!res) {
+        return true;
+    }
 
-            if (http_parse_request(&frag, recv_buf, bytes_read)) {
-                if (frag.method == EcsHttpOptions) {
-                    ecs_http_reply_t reply;
-                    reply.body = ECS_STRBUF_INIT;
-                    reply.code = 200;
-                    reply.content_type = NULL;
-                    reply.headers = ECS_STRBUF_INIT;
-                    reply.status = "OK";
-                    http_send_reply(conn, &reply, true);
-                    ecs_os_linc(&ecs_http_request_preflight_count);
-                } else {
-                    ecs_http_request_entry_t *entry =
-                        http_enqueue_request(conn, conn_id, &frag);
-                    if (entry) {
-                        ecs_http_reply_t reply;
-                        reply.body = ECS_STRBUF_INIT;
-                        reply.code = entry->code;
-                        reply.content_type = "application/json";
-                        reply.headers = ECS_STRBUF_INIT;
-                        reply.status = "OK";
-                        ecs_strbuf_appendstrn(&reply.body, 
-                            entry->content, entry->content_length);
-                        http_send_reply(conn, &reply, false);
-                        http_connection_free(conn);
-
-                        /* Lock was transferred from enqueue_request */
-                        ecs_os_mutex_unlock(srv->lock);
-                    }
-                }
-            } else {
-                ecs_os_linc(&ecs_http_request_invalid_count);
-            }
-        }
+    req.pub.conn = (ecs_http_connection_t*)conn;
+    req.conn_id = conn_id;
+    http_request_parse_options(&req, http10);
 
-        ecs_os_sleep(0, 10 * 1000 * 1000);
-    } while ((bytes_read == -1) && (++retries < ECS_HTTP_REQUEST_RECV_RETRY));
+    ecs_http_job_t job;
+    bool send_now = false;
 
-    if (bytes_read == ECS_HTTP_SEND_RECV_BUFFER_SIZE) {
-        ecs_warn("request exceeded receive buffer size (%d)",
-            ECS_HTTP_SEND_RECV_BUFFER_SIZE);
+    ecs_os_mutex_lock(srv->lock);
+    if (!conn->outstanding) {
+        if (req.pub.method == EcsHttpOptions) {
+            ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+            reply.content_type = NULL;
+            job = http_reply_to_job(conn, conn_id, &reply, 0, true, req.close);
+            ecs_os_linc(&ecs_http_request_preflight_count);
+            send_now = true;
+        } else if (req.pub.method == EcsHttpGet) {
+            ecs_http_request_entry_t *entry = 
+                http_find_request_entry(srv, res, req.req_len);
+            if (entry) {
+                /* If an entry is found, don't enqueue a request. Instead
+                 * return the cached response immediately. */
+                ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+                reply.code = entry->code;
+                reply.content_type = entry->content_type;
+                ecs_strbuf_appendstrn(&reply.body, 
+                    entry->content, entry->content_length);
+                job = http_reply_to_job(conn, conn_id, &reply, 
+                    req.encodings, false, req.close);
+                send_now = true;
+            }
+        }
     }
 
-    if (retries == ECS_HTTP_REQUEST_RECV_RETRY) {
-        ecs_os_mutex_lock(srv->lock);
-        bool still_owns_sock = conn->pub.id == conn_id;
-        if (still_owns_sock) {
-            conn->sock = HTTP_SOCKET_INVALID;
-        }
+    if (send_now) {
+        conn->outstanding ++;
         ecs_os_mutex_unlock(srv->lock);
-        if (still_owns_sock) {
-            http_close(&sock);
-        } else {
-            sock = HTTP_SOCKET_INVALID;
-        }
+        ecs_os_free(res);
+        http_job_send(srv, &job);
+        http_job_fini(&job);
+        return true;
     }
 
-done:
-    ecs_os_free(recv_buf);
-    ecs_strbuf_reset(&frag.buf);
-}
+    ecs_http_request_impl_t *req_ptr = flecs_sparse_add_t(
+        &srv->requests, ecs_http_request_impl_t);
+    *req_ptr = req;
+    req_ptr->pub.id = flecs_sparse_last_id(&srv->requests);
+    req_ptr->seq = ++ srv->request_seq;
+    conn->outstanding ++;
+    ecs_os_linc(&ecs_http_request_received_count);
+    ecs_os_mutex_unlock(srv->lock);
 
-typedef struct {
-    ecs_http_connection_impl_t *conn;
-    uint64_t id;
-} http_conn_res_t;
+    return true;
+}
 
-static http_conn_res_t http_init_connection(
-    ecs_http_server_t *srv, 
-    ecs_http_socket_t sock_conn,
-    struct sockaddr_storage *remote_addr, 
-    ecs_size_t remote_addr_len) 
+/* Runs on the worker that owns the connection. Reads all data that is currently
+ * available, which can contain multiple (pipelined) requests. */
+static void http_job_recv(
+    ecs_http_server_t *srv,
+    ecs_http_worker_t *worker,
+    ecs_http_job_t *job)
 {
-    http_sock_set_timeout(sock_conn, 100);
-    http_sock_keep_alive(sock_conn);
-    http_sock_nonblock(sock_conn, true);
-
-    /* Create new connection */
-    ecs_os_mutex_lock(srv->lock);
-    ecs_http_connection_impl_t *conn = flecs_sparse_add_t(
-        &srv->connections, ecs_http_connection_impl_t);
-    uint64_t conn_id = conn->pub.id = flecs_sparse_last_id(&srv->connections);
-    conn->pub.server = srv;
-    conn->sock = sock_conn;
-    ecs_os_mutex_unlock(srv->lock);
+    ecs_http_connection_impl_t *conn = job->conn;
+    uint64_t conn_id = job->conn_id;
+    bool close = false;
 
-    char *remote_host = conn->pub.host;
-    char *remote_port = conn->pub.port;
+    for (;;) {
+        ecs_os_mutex_lock(srv->lock);
+        bool full = conn->outstanding >= ECS_HTTP_PIPELINE_MAX;
+        ecs_os_mutex_unlock(srv->lock);
+        if (full) {
+            /* Continue reading once replies have been sent */
+            break;
+        }
 
-    /* Fetch name & port info */
-    if (http_getnameinfo((struct sockaddr*) remote_addr, remote_addr_len,
-        remote_host, ECS_SIZEOF(conn->pub.host),
-        remote_port, ECS_SIZEOF(conn->pub.port),
-            NI_NUMERICHOST | NI_NUMERICSERV))
-    {
-        ecs_os_strcpy(remote_host, "unknown");
-        ecs_os_strcpy(remote_port, "unknown");
-    }
+        ecs_size_t bytes_read = http_recv(conn->sock, worker->recv_buf, 
+            ECS_HTTP_SEND_RECV_BUFFER_SIZE, 0);
+        if (bytes_read < 0 && http_would_block()) {
+            break;
+        }
 
-    ecs_dbg_2("http: connection established from '%s:%s' (socket %u)", 
-        remote_host, remote_port, sock_conn);
-    
-    return (http_conn_res_t){ .conn = conn, .id = conn_id };
-}
-
-static int http_accept_connections(
-    ecs_http_server_t* srv, 
-    const struct sockaddr* addr, 
-    ecs_size_t addr_len) 
-{
-#ifdef ECS_TARGET_WINDOWS
-    /* If on Windows, test if winsock needs to be initialized */
-    SOCKET testsocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (INVALID_SOCKET == testsocket && WSANOTINITIALISED == WSAGetLastError()){
-        WSADATA data = { 0 };
-        int result = WSAStartup(MAKEWORD(2, 2), &data);
-        if (result) {
-            ecs_warn("http: WSAStartup failed with GetLastError = %d\n", 
-                GetLastError());
-            return 0;
+        if (bytes_read <= 0) {
+            /* Remote closed the connection or error */
+            close = true;
+            break;
         }
-    } else {
-        http_close(&testsocket);
-    }
-#endif
-
-    /* Resolve name + port (used for logging) */
-    char addr_host[256];
-    char addr_port[20];
 
-    int ret = 0; /* 0 = ok, 1 = port occupied */
+        const char *ptr = worker->recv_buf;
+        while (bytes_read) {
+            ecs_size_t consumed = 0;
+            bool done = http_parse_request(
+                &conn->frag, ptr, bytes_read, &consumed);
+            ptr += consumed;
+            bytes_read -= consumed;
+
+            if (!done) {
+                if (ecs_strbuf_written(&conn->frag.buf) > 
+                    ECS_HTTP_REQUEST_LEN_MAX) 
+                {
+                    ecs_warn("http: request from '%s:%s' exceeded max length",
+                        conn->pub.host, conn->pub.port);
+                    ecs_os_linc(&ecs_http_request_invalid_count);
+                    close = true;
+                }
+                break;
+            }
 
-    ecs_http_socket_t sock = HTTP_SOCKET_INVALID;
-    ecs_assert(srv->sock == HTTP_SOCKET_INVALID, ECS_INTERNAL_ERROR, NULL);
+            if (!http_conn_dispatch(srv, conn, conn_id)) {
+                close = true;
+                break;
+            }
+        }
 
-    if (http_getnameinfo(
-        addr, addr_len, addr_host, ECS_SIZEOF(addr_host), addr_port, 
-        ECS_SIZEOF(addr_port), NI_NUMERICHOST | NI_NUMERICSERV))
-    {
-        ecs_os_strcpy(addr_host, "unknown");
-        ecs_os_strcpy(addr_port, "unknown");
+        if (close) {
+            break;
+        }
     }
 
     ecs_os_mutex_lock(srv->lock);
-    if (srv->should_run) {
-        ecs_dbg_2("http: initializing connection socket");
+    ecs_assert(conn->pub.id == conn_id, ECS_INTERNAL_ERROR, NULL);
+    conn->state = EcsHttpConnIdle;
+    conn->last_activity = http_now();
+    if (close) {
+        conn->close = true;
+    }
+    ecs_os_mutex_unlock(srv->lock);
 
-        sock = socket(addr->sa_family, SOCK_STREAM, IPPROTO_TCP);
-        if (!http_socket_is_valid(sock)) {
-            ecs_err("http: unable to create new connection socket: %s", 
-                ecs_os_strerror(errno));
-            ecs_os_mutex_unlock(srv->lock);
-            goto done;
-        }
+    /* Add connection back to the poll set */
+    http_wakeup(srv);
+}
 
-        int reuse = 1, result;
-        result = setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, 
-            (char*)&reuse, ECS_SIZEOF(reuse)); 
-        if (result) {
-            ecs_warn("http: failed to setsockopt: %s", ecs_os_strerror(errno));
+static void* http_worker_thread(void* arg) {
+    ecs_http_worker_t *worker = arg;
+    ecs_http_server_t *srv = worker->srv;
+    ecs_vec_t jobs;
+    ecs_vec_init_t(NULL, &jobs, ecs_http_job_t, 0);
+
+    ecs_os_mutex_lock(worker->lock);
+    for (;;) {
+        while (!ecs_vec_count(&worker->jobs) && !worker->stop) {
+            ecs_os_cond_wait(worker->cond, worker->lock);
         }
 
-        if (addr->sa_family == AF_INET6) {
-            int ipv6only = 0;
-            if (setsockopt(sock, IPPROTO_IPV6, IPV6_V6ONLY, 
-                (char*)&ipv6only, ECS_SIZEOF(ipv6only)))
-            {
-                ecs_warn("http: failed to setsockopt: %s", 
-                    ecs_os_strerror(errno));
-            }
+        if (!ecs_vec_count(&worker->jobs)) {
+            /* Server is stopping and all jobs have been processed */
+            break;
         }
 
-        result = http_bind(sock, addr, addr_len);
-        if (result) {
-            if (errno == EADDRINUSE) {
-                ret = 1;
-                ecs_warn("http: address '%s:%s' in use, retrying with port %u", 
-                    addr_host, addr_port, srv->port + 1);
+        /* Take all jobs so other threads can keep posting while we work */
+        ecs_vec_t tmp = worker->jobs;
+        worker->jobs = jobs;
+        jobs = tmp;
+        ecs_os_mutex_unlock(worker->lock);
+
+        int32_t i, count = ecs_vec_count(&jobs);
+        ecs_http_job_t *job_array = ecs_vec_first(&jobs);
+        for (i = 0; i < count; i ++) {
+            ecs_http_job_t *job = &job_array[i];
+            if (job->kind == EcsHttpJobRecv) {
+                http_job_recv(srv, worker, job);
             } else {
-                ecs_err("http: failed to bind to '%s:%s': %s", 
-                    addr_host, addr_port, ecs_os_strerror(errno));
+                http_job_send(srv, job);
+                http_job_fini(job);
             }
-
-            ecs_os_mutex_unlock(srv->lock);
-            goto done;
         }
 
-        http_sock_set_timeout(sock, 1000);
+        ecs_vec_clear(&jobs);
+        ecs_os_mutex_lock(worker->lock);
+    }
+    ecs_os_mutex_unlock(worker->lock);
 
-        srv->sock = sock;
+    ecs_vec_fini_t(NULL, &jobs, ecs_http_job_t);
+    return NULL;
+}
 
-        result = listen(srv->sock, SOMAXCONN);
-        if (result) {
-            ecs_warn("http: could not listen for SOMAXCONN (%d) connections: %s", 
-                SOMAXCONN, ecs_os_strerror(errno));
-        }
+static void http_init_connection(
+    ecs_http_server_t *srv, 
+    ecs_http_socket_t sock_conn,
+    struct sockaddr_storage *remote_addr, 
+    ecs_size_t remote_addr_len) 
+{
+    http_sock_keep_alive(sock_conn);
+    http_sock_nodelay(sock_conn);
+    http_sock_nonblock(sock_conn, true);
 
-        ecs_trace("http: listening for incoming connections on '%s:%s'",
-            addr_host, addr_port);
-    } else {
-        ecs_dbg_2("http: server shut down while initializing");
+    /* Create new connection */
+    ecs_os_mutex_lock(srv->lock);
+    ecs_http_connection_impl_t *conn = flecs_sparse_add_t(
+        &srv->connections, ecs_http_connection_impl_t);
+    ecs_os_zeromem(conn);
+    uint64_t conn_id = conn->pub.id = flecs_sparse_last_id(&srv->connections);
+    conn->pub.server = srv;
+    conn->sock = sock_conn;
+    conn->worker = &srv->workers[conn_id % flecs_ito(uint64_t, srv->worker_count)];
+    conn->state = EcsHttpConnIdle;
+    conn->last_activity = http_now();
+
+    char *remote_host = conn->pub.host;
+    char *remote_port = conn->pub.port;
+
+    /* Fetch name & port info */
+    if (http_getnameinfo((struct sockaddr*) remote_addr, remote_addr_len,
+        remote_host, ECS_SIZEOF(conn->pub.host),
+        remote_port, ECS_SIZEOF(conn->pub.port),
+            NI_NUMERICHOST | NI_NUMERICSERV))
+    {
+        ecs_os_strcpy(remote_host, "unknown");
+        ecs_os_strcpy(remote_port, "unknown");
     }
     ecs_os_mutex_unlock(srv->lock);
 
+    ecs_dbg_2("http: connection established from '%s:%s' (socket %u)", 
+        remote_host, remote_port, sock_conn);
+}
+
+/* should_run is written by the thread that stops the server */
+static bool http_server_should_run(
+    ecs_http_server_t* srv)
+{
+    ecs_os_mutex_lock(srv->lock);
+    bool result = srv->should_run;
+    ecs_os_mutex_unlock(srv->lock);
+    return result;
+}
+
+static void http_accept_connections(
+    ecs_http_server_t* srv)
+{
     struct sockaddr_storage remote_addr;
     ecs_size_t remote_addr_len = 0;
 
-    while (srv->should_run) {
+    /* Listen socket is non-blocking, accept until there are no more pending
+     * connections. */
+    for (;;) {
         remote_addr_len = ECS_SIZEOF(remote_addr);
-        ecs_http_socket_t sock_conn = http_accept(srv->sock, (struct sockaddr*) &remote_addr, 
-            &remote_addr_len);
+        ecs_http_socket_t sock_conn = http_accept(srv->sock, 
+            (struct sockaddr*) &remote_addr, &remote_addr_len);
 
         if (!http_socket_is_valid(sock_conn)) {
-            if (srv->should_run) {
+            if (http_server_should_run(srv) && !http_would_block()) {
                 ecs_dbg("http: connection attempt failed: %s", 
                     ecs_os_strerror(errno));
             }
-            continue;
+            break;
         }
 
-        http_conn_res_t conn = http_init_connection(srv, sock_conn, &remote_addr, remote_addr_len);
-        http_recv_connection(srv, conn.conn, conn.id, sock_conn);
+        http_init_connection(srv, sock_conn, &remote_addr, remote_addr_len);
     }
+}
 
-done:
-    ecs_os_mutex_lock(srv->lock);
-    if (http_socket_is_valid(sock) && errno != EBADF) {
+static int http_listen(
+    ecs_http_server_t* srv, 
+    const struct sockaddr* addr, 
+    ecs_size_t addr_len) 
+{
+    /* Resolve name + port (used for logging) */
+    char addr_host[256];
+    char addr_port[20];
+
+    int ret = -1; /* 0 = ok, 1 = port occupied */
+
+    ecs_http_socket_t sock = HTTP_SOCKET_INVALID;
+    ecs_assert(srv->sock == HTTP_SOCKET_INVALID, ECS_INTERNAL_ERROR, NULL);
+
+    if (http_getnameinfo(
+        addr, addr_len, addr_host, ECS_SIZEOF(addr_host), addr_port, 
+        ECS_SIZEOF(addr_port), NI_NUMERICHOST | NI_NUMERICSERV))
+    {
+        ecs_os_strcpy(addr_host, "unknown");
+        ecs_os_strcpy(addr_port, "unknown");
+    }
+
+    ecs_dbg_2("http: initializing connection socket");
+
+    sock = socket(addr->sa_family, SOCK_STREAM, IPPROTO_TCP);
+    if (!http_socket_is_valid(sock)) {
+        ecs_err("http: unable to create new connection socket: %s", 
+            ecs_os_strerror(errno));
+        goto done;
+    }
+
+    int reuse = 1, result;
+    result = setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, 
+        (char*)&reuse, ECS_SIZEOF(reuse)); 
+    if (result) {
+        ecs_warn("http: failed to setsockopt: %s", ecs_os_strerror(errno));
+    }
+
+    if (addr->sa_family == AF_INET6) {
+        int ipv6only = 0;
+        if (setsockopt(sock, IPPROTO_IPV6, IPV6_V6ONLY, 
+            (char*)&ipv6only, ECS_SIZEOF(ipv6only)))
+        {
+            ecs_warn("http: failed to setsockopt: %s", 
+                ecs_os_strerror(errno));
+        }
+    }
+
+    result = http_bind(sock, addr, addr_len);
+    if (result) {
+        if (errno == EADDRINUSE) {
+            ret = 1;
+            ecs_warn("http: address '%s:%s' in use, retrying with port %u", 
+                addr_host, addr_port, srv->port + 1);
+        } else {
+            ecs_err("http: failed to bind to '%s:%s': %s", 
+                addr_host, addr_port, ecs_os_strerror(errno));
+        }
         http_close(&sock);
-        srv->sock = sock;
+        goto done;
     }
-    ecs_os_mutex_unlock(srv->lock);
 
-    ecs_trace("http: no longer accepting connections on '%s:%s'",
-        addr_host, addr_port);
+    result = listen(sock, SOMAXCONN);
+    if (result) {
+        ecs_warn("http: could not listen for SOMAXCONN (%d) connections: %s", 
+            SOMAXCONN, ecs_os_strerror(errno));
+    }
 
+    http_sock_nonblock(sock, true);
+    srv->sock = sock;
+    ret = 0;
+
+    ecs_trace("http: listening for incoming connections on '%s:%s'",
+        addr_host, addr_port);
+done:
     return ret;
 }
 
+/* Connection thread. Accepts new connections and waits for data on idle
+ * connections, which is then read by the worker that owns the connection. */
 static void* http_server_thread(void* arg) {
     ecs_http_server_t *srv = arg;
-    struct sockaddr_in addr;
-    ecs_os_zeromem(&addr);
-    addr.sin_family = AF_INET;
+    ecs_vec_t fds, conns;
+    ecs_vec_init_t(NULL, &fds, ecs_http_pollfd_t, 0);
+    ecs_vec_init_t(NULL, &conns, ecs_http_connection_impl_t*, 0);
+
+    while (http_server_should_run(srv)) {
+        ecs_vec_clear(&fds);
+        ecs_vec_clear(&conns);
+
+        ecs_http_pollfd_t *fd = ecs_vec_append_t(NULL, &fds, ecs_http_pollfd_t);
+        ecs_os_zeromem(fd);
+        fd->fd = srv->sock;
+        fd->events = POLLIN;
+
+        fd = ecs_vec_append_t(NULL, &fds, ecs_http_pollfd_t);
+        ecs_os_zeromem(fd);
+        fd->fd = srv->wakeup_sock;
+        fd->events = POLLIN;
+        if (!http_socket_is_valid(srv->wakeup_sock)) {
+            ecs_vec_remove_last(&fds);
+        }
+        int32_t conn_fd_offset = ecs_vec_count(&fds);
 
-    int retries = 0;
-retry:
-    addr.sin_port = htons(srv->port);
+        double now = http_now();
 
-    if (!srv->ipaddr) {
-        addr.sin_addr.s_addr = htonl(INADDR_ANY);
-    } else {
-        inet_pton(AF_INET, srv->ipaddr, &(addr.sin_addr));
-    }
+        ecs_os_mutex_lock(srv->lock);
+        int32_t i, count = flecs_sparse_count(&srv->connections);
+        for (i = count - 1; i >= 1; i --) {
+            ecs_http_connection_impl_t *conn = flecs_sparse_get_dense_t(
+                &srv->connections, ecs_http_connection_impl_t, i);
+            if (conn->state != EcsHttpConnIdle) {
+                continue;
+            }
 
-    if (http_accept_connections(
-        srv, (struct sockaddr*)&addr, ECS_SIZEOF(addr)) == 1) 
-    {
-        srv->port ++;
-        retries ++;
-        if (retries < 10) {
-            goto retry;
-        } else {
-            ecs_err("http: failed to connect (retried 10 times)");
+            if (!conn->outstanding) {
+                if (conn->close || 
+                    ((now - conn->last_activity) > srv->keep_alive_timeout)) 
+                {
+                    ecs_dbg_2("http: closing connection '%s:%s' (sock = %d)", 
+                        conn->pub.host, conn->pub.port, conn->sock);
+                    http_connection_free(conn);
+                    continue;
+                }
+            }
+
+            if (conn->close || conn->outstanding >= ECS_HTTP_PIPELINE_MAX) {
+                continue;
+            }
+
+            fd = ecs_vec_append_t(NULL, &fds, ecs_http_pollfd_t);
+            ecs_os_zeromem(fd);
+            fd->fd = conn->sock;
+            fd->events = POLLIN;
+            ecs_vec_append_t(NULL, &conns, ecs_http_connection_impl_t*)[0] = 
+                conn;
+        }
+        ecs_os_mutex_unlock(srv->lock);
+
+        ecs_http_pollfd_t *fd_array = ecs_vec_first(&fds);
+        int32_t fd_count = ecs_vec_count(&fds);
+        int ready = http_poll(fd_array, fd_count, srv->poll_interval_ms);
+        if (ready <= 0 || !http_server_should_run(srv)) {
+            continue;
+        }
+
+        if (fd_array[0].revents & POLLIN) {
+            http_accept_connections(srv);
+        }
+
+        if (conn_fd_offset > 1 && fd_array[1].revents) {
+            http_wakeup_drain(srv);
         }
+
+        ecs_http_connection_impl_t **conn_array = ecs_vec_first(&conns);
+        ecs_os_mutex_lock(srv->lock);
+        for (i = conn_fd_offset; i < fd_count; i ++) {
+            if (!fd_array[i].revents) {
+                continue;
+            }
+
+            /* Connections are only freed by this thread, so pointer is valid */
+            ecs_http_connection_impl_t *conn = conn_array[i - conn_fd_offset];
+            ecs_assert(conn->state == EcsHttpConnIdle, 
+                ECS_INTERNAL_ERROR, NULL);
+            conn->state = EcsHttpConnBusy;
+
+            ecs_http_job_t job = {0};
+            job.kind = EcsHttpJobRecv;
+            job.conn = conn;
+            job.conn_id = conn->pub.id;
+            http_worker_post(conn->worker, &job);
+        }
+        ecs_os_mutex_unlock(srv->lock);
     }
 
+    ecs_vec_fini_t(NULL, &fds, ecs_http_pollfd_t);
+    ecs_vec_fini_t(NULL, &conns, ecs_http_connection_impl_t*);
     return NULL;
 }
 
@@ -1175,8 +1486,9 @@ static void http_handle_request(
     ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
     ecs_http_connection_impl_t *conn = 
         (ecs_http_connection_impl_t*)req->pub.conn;
+    bool preflight = req->pub.method == EcsHttpOptions;
 
-    if (req->pub.method != EcsHttpOptions) {
+    if (!preflight) {
         if (srv->callback((ecs_http_request_t*)req, &reply, srv->ctx) == false) {
             reply.code = 404;
             reply.status = "Resource not found";
@@ -1190,18 +1502,23 @@ static void http_handle_request(
         }
 
         if (req->pub.method == EcsHttpGet) {
+            ecs_os_mutex_lock(srv->lock);
             http_insert_request_entry(srv, req, &reply);
+            ecs_os_mutex_unlock(srv->lock);
         }
-
-        http_send_reply(conn, &reply, false);
-        ecs_dbg_2("http: reply sent to '%s:%s'", conn->pub.host, conn->pub.port);
     } else {
-        /* Already taken care of */
+        /* Preflight that was pipelined behind another request */
+        reply.content_type = NULL;
+        ecs_os_linc(&ecs_http_request_preflight_count);
     }
 
+    /* Serializing & sending the reply happens on the connection's worker */
+    ecs_http_job_t job = http_reply_to_job(conn, req->conn_id, &reply,
+        req->encodings, preflight, req->close);
+    http_worker_post(conn->worker, &job);
+
     http_reply_fini(&reply);
-    http_request_fini(req);
-    http_connection_free(conn);
+    ecs_os_free(req->res);
 }
 
 static void http_purge_request_cache(
@@ -1231,44 +1548,61 @@ static void http_purge_request_cache(
 
     if (fini) {
         flecs_hashmap_fini(&srv->request_cache);
+
+        int32_t i, count = ecs_vec_count(&srv->content_types);
+        char **types = ecs_vec_first(&srv->content_types);
+        for (i = 0; i < count; i ++) {
+            ecs_os_free(types[i]);
+        }
+        ecs_vec_fini_t(NULL, &srv->content_types, char*);
     }
 }
 
+static int http_request_compare_seq(
+    const void *ptr_1,
+    const void *ptr_2)
+{
+    const ecs_http_request_impl_t *req_1 = ptr_1;
+    const ecs_http_request_impl_t *req_2 = ptr_2;
+    return (req_1->seq > req_2->seq) - (req_1->seq < req_2->seq);
+}
+
 static int32_t http_dequeue_requests(
-    ecs_http_server_t *srv,
-    double delta_time)
+    ecs_http_server_t *srv)
 {
+    /* Take requests out of the queue so that workers can keep receiving
+     * while the request callbacks run. */
     ecs_os_mutex_lock(srv->lock);
-
-    int32_t i, request_count = flecs_sparse_count(&srv->requests);
-    for (i = request_count - 1; i >= 1; i --) {
-        ecs_http_request_impl_t *req = flecs_sparse_get_dense_t(
-            &srv->requests, ecs_http_request_impl_t, i);
-        http_handle_request(srv, req);
-    }
-
-    int32_t connections_count = flecs_sparse_count(&srv->connections);
-    for (i = connections_count - 1; i >= 1; i --) {
-        ecs_http_connection_impl_t *conn = flecs_sparse_get_dense_t(
-            &srv->connections, ecs_http_connection_impl_t, i);
-
-        conn->dequeue_timeout += delta_time;
-        conn->dequeue_retries ++;
-        
-        if ((conn->dequeue_timeout > 
-            (double)ECS_HTTP_CONNECTION_PURGE_TIMEOUT) &&
-             (conn->dequeue_retries > ECS_HTTP_CONNECTION_PURGE_RETRY_COUNT)) 
-        {
-            ecs_dbg("http: purging connection '%s:%s' (sock = %d)", 
-                conn->pub.host, conn->pub.port, conn->sock);
-            http_connection_free(conn);
+    int32_t i, request_count = flecs_sparse_count(&srv->requests) - 1;
+    ecs_http_request_impl_t *requests = NULL;
+    if (request_count) {
+        requests = ecs_os_malloc_n(ecs_http_request_impl_t, request_count);
+        for (i = 0; i < request_count; i ++) {
+            requests[i] = *flecs_sparse_get_dense_t(
+                &srv->requests, ecs_http_request_impl_t, i + 1);
+        }
+        for (i = 0; i < request_count; i ++) {
+            flecs_sparse_remove_t(&srv->requests, 
+                ecs_http_request_impl_t, requests[i].pub.id);
         }
     }
 
     http_purge_request_cache(srv, false);
     ecs_os_mutex_unlock(srv->lock);
 
-    return request_count - 1;
+    if (request_count) {
+        /* Replies must be sent in the order requests were received */
+        qsort(requests, flecs_ito(size_t, request_count), 
+            sizeof(ecs_http_request_impl_t), http_request_compare_seq);
+
+        for (i = 0; i < request_count; i ++) {
+            http_handle_request(srv, &requests[i]);
+        }
+
+        ecs_os_free(requests);
+    }
+
+    return request_count;
 }
 
 const char* ecs_http_get_header(
@@ -1303,6 +1637,7 @@ ecs_http_server_t* ecs_http_server_init(
         srv->lock = ecs_os_mutex_new();
     }
     srv->sock = HTTP_SOCKET_INVALID;
+    srv->wakeup_sock = HTTP_SOCKET_INVALID;
 
     srv->should_run = false;
     srv->initialized = true;
@@ -1320,11 +1655,27 @@ ecs_http_server_t* ecs_http_server_init(
     srv->ctx = desc->ctx;
     srv->port = desc->port;
     srv->ipaddr = desc->ipaddr;
-    srv->send_queue.wait_ms = desc->send_queue_wait_ms;
-    if (!srv->send_queue.wait_ms) {
-        srv->send_queue.wait_ms = 1;
+
+    srv->poll_interval_ms = desc->send_queue_wait_ms;
+    if (!srv->poll_interval_ms) {
+        srv->poll_interval_ms = ECS_HTTP_POLL_INTERVAL_DEFAULT;
+    }
+
+    srv->worker_count = desc->worker_count;
+    if (!srv->worker_count) {
+        srv->worker_count = ECS_HTTP_WORKER_COUNT_DEFAULT;
+    }
+    if (srv->worker_count > ECS_HTTP_WORKER_COUNT_MAX) {
+        srv->worker_count = ECS_HTTP_WORKER_COUNT_MAX;
+    }
+
+    srv->keep_alive_timeout = desc->keep_alive_timeout;
+    if (ECS_EQZERO(srv->keep_alive_timeout)) {
+        srv->keep_alive_timeout = ECS_HTTP_KEEP_ALIVE_TIMEOUT_DEFAULT;
     }
 
+    srv->compression_threshold = desc->compression_threshold;
+
     flecs_sparse_init_t(&srv->connections, NULL, NULL, ecs_http_connection_impl_t);
     flecs_sparse_init_t(&srv->requests, NULL, NULL, ecs_http_request_impl_t);
 
@@ -1336,6 +1687,7 @@ ecs_http_server_t* ecs_http_server_init(
     flecs_hashmap_init(&srv->request_cache, 
         ecs_http_request_key_t, ecs_http_request_entry_t,
         http_request_key_hash, http_request_key_compare, NULL);
+    ecs_vec_init_t(NULL, &srv->content_types, char*, 0);
 
 #ifndef ECS_TARGET_WINDOWS
     /* Ignore pipe signal. SIGPIPE can occur when a message is sent to a client
@@ -1361,6 +1713,98 @@ void ecs_http_server_fini(
     ecs_os_free(srv);
 }
 
+static int http_server_bind(
+    ecs_http_server_t *srv)
+{
+#ifdef ECS_TARGET_WINDOWS
+    /* If on Windows, test if winsock needs to be initialized */
+    SOCKET testsocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (INVALID_SOCKET == testsocket && WSANOTINITIALISED == WSAGetLastError()){
+        WSADATA data = { 0 };
+        int result = WSAStartup(MAKEWORD(2, 2), &data);
+        if (result) {
+            ecs_warn("http: WSAStartup failed with GetLastError = %d\n", 
+                GetLastError());
+            return -1;
+        }
+    } else {
+        http_close(&testsocket);
+    }
+#endif
+
+    struct sockaddr_in addr;
+    ecs_os_zeromem(&addr);
+    addr.sin_family = AF_INET;
+
+    int retries = 0;
+    for (;;) {
+        addr.sin_port = htons(srv->port);
+
+        if (!srv->ipaddr) {
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        } else {
+            inet_pton(AF_INET, srv->ipaddr, &(addr.sin_addr));
+        }
+
+        int result = http_listen(
+            srv, (struct sockaddr*)&addr, ECS_SIZEOF(addr));
+        if (result != 1) {
+            return result;
+        }
+
+        srv->port ++;
+        retries ++;
+        if (retries == 10) {
+            ecs_err("http: failed to connect (retried 10 times)");
+            return -1;
+        }
+    }
+}
+
+/* Stops the first count workers after their outstanding jobs and frees them */
+static void http_workers_fini(
+    ecs_http_server_t *srv,
+    int32_t count)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        ecs_http_worker_t *worker = &srv->workers[i];
+        if (worker->thread) {
+            ecs_os_mutex_lock(worker->lock);
+            worker->stop = true;
+            ecs_os_cond_broadcast(worker->cond);
+            ecs_os_mutex_unlock(worker->lock);
+            ecs_os_thread_join(worker->thread);
+        }
+
+        ecs_vec_fini_t(NULL, &worker->jobs, ecs_http_job_t);
+        ecs_os_free(worker->recv_buf);
+        ecs_os_cond_free(worker->cond);
+        ecs_os_mutex_free(worker->lock);
+    }
+    ecs_os_free(srv->workers);
+    srv->workers = NULL;
+}
+
+/* Undoes a partial start, count is the number of initialized workers */
+static void http_server_start_fail(
+    ecs_http_server_t *srv,
+    int32_t count)
+{
+    ecs_os_mutex_lock(srv->lock);
+    srv->should_run = false;
+    ecs_os_mutex_unlock(srv->lock);
+
+    http_workers_fini(srv, count);
+
+    if (http_socket_is_valid(srv->sock)) {
+        http_close(&srv->sock);
+    }
+    if (http_socket_is_valid(srv->wakeup_sock)) {
+        http_close(&srv->wakeup_sock);
+    }
+}
+
 int ecs_http_server_start(
     ecs_http_server_t *srv)
 {
@@ -1371,17 +1815,39 @@ int ecs_http_server_start(
     ecs_check(ecs_os_has_threading(), ECS_UNSUPPORTED,
         "missing OS API implementation");
 
+    if (http_server_bind(srv)) {
+        goto error;
+    }
+
+    http_wakeup_init(srv);
+
     srv->should_run = true;
 
+    ecs_dbg("http: starting %d worker threads", srv->worker_count);
+
+    srv->workers = ecs_os_calloc_n(ecs_http_worker_t, srv->worker_count);
+    int32_t i;
+    for (i = 0; i < srv->worker_count; i ++) {
+        ecs_http_worker_t *worker = &srv->workers[i];
+        worker->srv = srv;
+        worker->lock = ecs_os_mutex_new();
+        worker->cond = ecs_os_cond_new();
+        worker->recv_buf = ecs_os_malloc(ECS_HTTP_SEND_RECV_BUFFER_SIZE);
+        ecs_vec_init_t(NULL, &worker->jobs, ecs_http_job_t, 0);
+        worker->thread = ecs_os_thread_new(http_worker_thread, worker);
+        if (!worker->thread) {
+            ecs_err("http: failed to start worker thread");
+            http_server_start_fail(srv, i + 1);
+            goto error;
+        }
+    }
+
     ecs_dbg("http: starting server thread");
 
     srv->thread = ecs_os_thread_new(http_server_thread, srv);
     if (!srv->thread) {
-        goto error;
-    }
-
-    srv->send_queue.thread = ecs_os_thread_new(http_server_send_queue, srv);
-    if (!srv->send_queue.thread) {
+        ecs_err("http: failed to start server thread");
+        http_server_start_fail(srv, srv->worker_count);
         goto error;
     }
 
@@ -1406,15 +1872,23 @@ void ecs_http_server_stop(
 
     ecs_os_mutex_lock(srv->lock);
     srv->should_run = false;
-    if (http_socket_is_valid(srv->sock)) {
-        http_close(&srv->sock);
-    }
     ecs_os_mutex_unlock(srv->lock);
 
+    http_wakeup(srv);
     ecs_os_thread_join(srv->thread);
-    ecs_os_thread_join(srv->send_queue.thread);
+
+    /* Workers finish outstanding jobs before exiting */
+    http_workers_fini(srv, srv->worker_count);
+
     ecs_trace("http: server threads shut down");
 
+    if (http_socket_is_valid(srv->sock)) {
+        http_close(&srv->sock);
+    }
+    if (http_socket_is_valid(srv->wakeup_sock)) {
+        http_close(&srv->wakeup_sock);
+    }
+
     /* Cleanup all outstanding requests */
     int i, count = flecs_sparse_count(&srv->requests);
     for (i = count - 1; i >= 1; i --) {
@@ -1439,6 +1913,15 @@ error:
     return;
 }
 
+uint16_t ecs_http_server_get_port(
+    const ecs_http_server_t *srv)
+{
+    ecs_check(srv != NULL, ECS_INVALID_PARAMETER, NULL);
+    return srv->port;
+error:
+    return 0;
+}
+
 void ecs_http_server_dequeue(
     ecs_http_server_t* srv,
     ecs_ftime_t delta_time)
@@ -1451,12 +1934,11 @@ void ecs_http_server_dequeue(
     srv->stats_timeout += (double)delta_time;
 
     if ((1000 * srv->dequeue_timeout) > (double)ECS_HTTP_MIN_DEQUEUE_INTERVAL) {
-        double elapsed = srv->dequeue_timeout;
         srv->dequeue_timeout = 0;
 
         ecs_time_t t = {0};
         ecs_time_measure(&t);
-        int32_t request_count = http_dequeue_requests(srv, elapsed);
+        int32_t request_count = http_dequeue_requests(srv);
         srv->requests_processed += request_count;
         srv->requests_processed_total += request_count;
         double time_spent = ecs_time_measure(&t);
@@ -1479,6 +1961,23 @@ error:
     return;
 }
 
+/* Emulated requests can be made without threading support */
+static void http_server_lock(
+    ecs_http_server_t *srv)
+{
+    if (srv->lock) {
+        ecs_os_mutex_lock(srv->lock);
+    }
+}
+
+static void http_server_unlock(
+    ecs_http_server_t *srv)
+{
+    if (srv->lock) {
+        ecs_os_mutex_unlock(srv->lock);
+    }
+}
+
 int ecs_http_server_http_request(
     ecs_http_server_t* srv,
     const char *req,
@@ -1490,7 +1989,7 @@ int ecs_http_server_http_request(
     }
 
     ecs_http_fragment_t frag = {0};
-    if (!http_parse_request(&frag, req, len)) {
+    if (!http_parse_request(&frag, req, len, NULL)) {
         ecs_strbuf_reset(&frag.buf);
         reply_out->code = 400;
         return -1;
@@ -1503,27 +2002,34 @@ int ecs_http_server_http_request(
         return -1;
     }
 
+    http_server_lock(srv);
     ecs_http_request_entry_t *entry = 
         http_find_request_entry(srv, request.res, request.req_len);
     if (entry) {
         reply_out->body = ECS_STRBUF_INIT;
         reply_out->code = entry->code;
-        reply_out->content_type = "application/json";
+        reply_out->content_type = entry->content_type;
         reply_out->headers = ECS_STRBUF_INIT;
         reply_out->status = "OK";
         ecs_strbuf_appendstrn(&reply_out->body, 
             entry->content, entry->content_length);
+        http_server_unlock(srv);
     } else {
+        http_server_unlock(srv);
         http_do_request(srv, reply_out, &request);
 
         if (request.pub.method == EcsHttpGet) {
+            http_server_lock(srv);
             http_insert_request_entry(srv, &request, reply_out);
+            http_server_unlock(srv);
         }
     }
 
     ecs_os_free(res);
 
+    http_server_lock(srv);
     http_purge_request_cache(srv, false);
+    http_server_unlock(srv);
 
     return (reply_out->code >= 400) ? -1 : 0;
 }
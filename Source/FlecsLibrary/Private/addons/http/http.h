@@ -13,6 +13,7 @@
 #if defined(ECS_TARGET_WINDOWS)
 #include <ws2tcpip.h>
 typedef SOCKET ecs_http_socket_t;
+typedef WSAPOLLFD ecs_http_pollfd_t;
 #else
 #include <unistd.h>
 #include <arpa/inet.h>
@@ -22,10 +23,14 @@ typedef SOCKET ecs_http_socket_t;
 #include <strings.h>
 #include <signal.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #ifdef __FreeBSD__
 #include <netinet/in.h>
 #endif
 typedef int ecs_http_socket_t;
+typedef struct pollfd ecs_http_pollfd_t;
 
 #if !defined(MSG_NOSIGNAL)
 #define MSG_NOSIGNAL (0)
@@ -57,25 +62,63 @@ typedef int ecs_http_socket_t;
 /* Max length of request (path + query + headers + body) */
 #define ECS_HTTP_REQUEST_LEN_MAX (10 * 1024 * 1024)
 
-/* Total number of outstanding send requests */
-#define ECS_HTTP_SEND_QUEUE_MAX (256)
+/* Number of worker threads if not set in the server descriptor */
+#define ECS_HTTP_WORKER_COUNT_DEFAULT (4)
 
-/* Send request queue */
-typedef struct ecs_http_send_request_t {
-    ecs_http_socket_t sock;
+/* Maximum number of worker threads */
+#define ECS_HTTP_WORKER_COUNT_MAX (32)
+
+/* Time (s) an idle keep-alive connection is kept open if not set in the
+ * server descriptor */
+#define ECS_HTTP_KEEP_ALIVE_TIMEOUT_DEFAULT (5.0)
+
+/* Max number of pipelined requests per connection that have not been replied
+ * to. The connection is not read from while it has this many requests. */
+#define ECS_HTTP_PIPELINE_MAX (32)
+
+/* Interval (ms) at which the connection thread wakes up when idle if not set in
+ * the server descriptor */
+#define ECS_HTTP_POLL_INTERVAL_DEFAULT (50)
+
+/* Accept-Encoding flags */
+#define ECS_HTTP_ENCODING_GZIP (1 << 0)
+#define ECS_HTTP_ENCODING_DEFLATE (1 << 1)
+
+typedef struct ecs_http_connection_impl_t ecs_http_connection_impl_t;
+
+/* Work item for a worker thread. All jobs for a connection are executed by the
+ * same worker, which guarantees that replies are sent in request order. */
+typedef enum ecs_http_job_kind_t {
+    EcsHttpJobRecv,         /* Read & parse available data from connection */
+    EcsHttpJobSend          /* Compress & send a reply */
+} ecs_http_job_kind_t;
+
+typedef struct ecs_http_job_t {
+    ecs_http_job_kind_t kind;
+    ecs_http_connection_impl_t *conn;
+    uint64_t conn_id;
+
+    /* Reply data for send jobs, owned by the job */
+    int code;
+    char *status;
+    char *content_type;
     char *headers;
-    int32_t header_length;
     char *content;
     int32_t content_length;
-} ecs_http_send_request_t;
+    int32_t encodings;      /* Encodings accepted by client */
+    bool preflight;
+    bool close;             /* Close connection after sending reply */
+} ecs_http_job_t;
 
-typedef struct ecs_http_send_queue_t {
-    ecs_http_send_request_t requests[ECS_HTTP_SEND_QUEUE_MAX];
-    int32_t head;
-    int32_t tail;
+typedef struct ecs_http_worker_t {
+    ecs_http_server_t *srv;
     ecs_os_thread_t thread;
-    int32_t wait_ms;
-} ecs_http_send_queue_t;
+    ecs_os_mutex_t lock;
+    ecs_os_cond_t cond;
+    ecs_vec_t jobs;         /* vec<ecs_http_job_t> */
+    char *recv_buf;
+    bool stop;              /* Set under lock, worker exits once jobs are done */
+} ecs_http_worker_t;
 
 typedef struct ecs_http_request_key_t {
     const char *array;
@@ -85,6 +128,7 @@ typedef struct ecs_http_request_key_t {
 typedef struct ecs_http_request_entry_t {
     char *content;
     int32_t content_length;
+    const char *content_type; /* Interned, owned by the server */
     int code;
     double time;
 } ecs_http_request_entry_t;
@@ -96,7 +140,14 @@ struct ecs_http_server_t {
 
     ecs_http_socket_t sock;
     ecs_os_mutex_t lock;
-    ecs_os_thread_t thread;
+    ecs_os_thread_t thread; /* accepts & polls connections */
+    ecs_http_socket_t wakeup_sock; /* interrupts poll of connection thread */
+
+    ecs_http_worker_t *workers;
+    int32_t worker_count;
+    int32_t poll_interval_ms;
+    double keep_alive_timeout;
+    int32_t compression_threshold;
 
     ecs_http_reply_action_t callback;
     void *ctx;
@@ -120,9 +171,10 @@ struct ecs_http_server_t {
     int32_t requests_processed; /* requests processed in last stats interval */
     int32_t requests_processed_total; /* total requests processed */
     int32_t dequeue_count; /* number of dequeues in last stats interval */ 
-    ecs_http_send_queue_t send_queue;
+    uint64_t request_seq; /* used to handle requests in order of arrival */
 
     ecs_hashmap_t request_cache;
+    ecs_vec_t content_types; /* vec<char*>, interned content types of cached replies */
 };
 
 /** Fragment state, used by HTTP request parser */
@@ -159,26 +211,46 @@ typedef struct {
     char *header_buf_ptr;
     char header_buf[32];
     bool parse_content_length;
+    bool http10;
     bool invalid;
 } ecs_http_fragment_t;
 
+/* Connection is waiting for data in the connection thread */
+#define EcsHttpConnIdle (0)
+
+/* Connection is being read from by a worker */
+#define EcsHttpConnBusy (1)
+
 /** Extend public connection type with fragment data */
-typedef struct {
+struct ecs_http_connection_impl_t {
     ecs_http_connection_t pub;
     ecs_http_socket_t sock;
-
-    /* Connection is purged after both the timeout expires and the connection has
-     * exceeded the retry count. This ensures that a connection does not
-     * immediately timeout when a frame takes longer than usual */
-    double dequeue_timeout;
-    int32_t dequeue_retries;    
-} ecs_http_connection_impl_t;
+    ecs_http_fragment_t frag; /* partially received request */
+    ecs_http_worker_t *worker;
+
+    /* Members below are protected by the server lock */
+    int32_t state;
+    int32_t outstanding; /* requests received but not yet replied to */
+    bool close; /* close connection once outstanding reaches zero */
+    double last_activity; /* used to close idle keep-alive connections */
+};
 
 typedef struct {
     ecs_http_request_t pub;
     uint64_t conn_id; /* for sanity check */
+    uint64_t seq; /* order in which request was received */
     char *res;
     int32_t req_len;
+    int32_t encodings; /* encodings accepted by client */
+    bool close; /* client requested to close connection after reply */
 } ecs_http_request_impl_t;
 
+/* Compress data for the Content-Encoding with the specified encoding flag.
+ * Returns NULL if the compressed data is not smaller than the input. */
+char* flecs_http_compress(
+    const char *data,
+    int32_t length,
+    int32_t encoding,
+    int32_t *length_out);
+
 #endif
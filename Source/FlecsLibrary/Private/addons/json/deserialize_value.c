@@ -5,10 +5,351 @@
 
 #include "../../private_api.h"
 #include "json.h"
+#include "../meta/meta.h"
 #include "../script/script.h"
 
 #ifdef FLECS_JSON
 
+/* Deserialize with a compiled plan. Members are matched against the plan in
+ * declaration order first, which avoids a name lookup for JSON that was created
+ * by the serializer. Input that the plan doesn't handle (dot members, unknown
+ * members, out of bounds elements) sets fallback, after which the value is
+ * deserialized again with a cursor, which also takes care of reporting errors. */
+typedef struct flecs_json_plan_ctx_t {
+    const ecs_world_t *world;
+    const ecs_meta_plan_op_t *ops;
+    void *base;
+    const ecs_from_json_desc_t *desc;
+    char *token;
+    bool fallback;
+} flecs_json_plan_ctx_t;
+
+static const char* flecs_json_plan_parse_value(
+    flecs_json_plan_ctx_t *ctx,
+    int32_t index,
+    ecs_json_token_t token_kind,
+    const char *json);
+
+/* Assign value with a cursor for the member type, for tokens that require a
+ * conversion (enum constants, entity paths, strings) or a bounds check. */
+static int flecs_json_plan_assign_w_cursor(
+    flecs_json_plan_ctx_t *ctx,
+    const ecs_meta_plan_op_t *op,
+    void *ptr,
+    ecs_json_token_t token_kind)
+{
+    ecs_meta_cursor_t cur = ecs_meta_cursor(ctx->world, op->op->type, ptr);
+    if (!cur.valid) {
+        return -1;
+    }
+
+    if (ctx->desc) {
+        cur.lookup_action = ctx->desc->lookup_action;
+        cur.lookup_ctx = ctx->desc->lookup_ctx;
+    }
+
+    switch(token_kind) {
+    case JsonString:
+        return ecs_meta_set_string(&cur, ctx->token);
+    case JsonNumber:
+        return ecs_meta_set_float(&cur, atof(ctx->token));
+    case JsonLargeInt:
+        return ecs_meta_set_int(&cur, flecs_ito(int64_t, atoll(ctx->token)));
+    case JsonTrue:
+        return ecs_meta_set_bool(&cur, true);
+    case JsonFalse:
+        return ecs_meta_set_bool(&cur, false);
+    case JsonNull:
+        return ecs_meta_set_null(&cur);
+    case JsonObjectOpen:
+    case JsonObjectClose:
+    case JsonArrayOpen:
+    case JsonArrayClose:
+    case JsonColon:
+    case JsonComma:
+    case JsonBoolean:
+    case JsonLargeString:
+    case JsonInvalid:
+    default:
+        ctx->fallback = true;
+        return -1;
+    }
+}
+
+#define flecs_json_plan_set_checked(T, ptr, value, min, max)\
+    if ((value) >= (min) && (value) <= (max)) {\
+        flecs_meta_set_t(T, ptr, value);\
+        return 0;\
+    }\
+    break
+
+static int flecs_json_plan_assign(
+    flecs_json_plan_ctx_t *ctx,
+    const ecs_meta_plan_op_t *op,
+    ecs_json_token_t token_kind)
+{
+    void *ptr = ECS_OFFSET(ctx->base, op->offset);
+
+    if (token_kind == JsonNumber) {
+        double value = atof(ctx->token);
+        switch(op->value_kind) {
+        case EcsOpF32:
+            flecs_meta_set_t(ecs_f32_t, ptr, value);
+            return 0;
+        case EcsOpF64:
+            flecs_meta_set_t(ecs_f64_t, ptr, value);
+            return 0;
+        case EcsOpI8:
+            flecs_json_plan_set_checked(ecs_i8_t, ptr, value, INT8_MIN, INT8_MAX);
+        case EcsOpI16:
+            flecs_json_plan_set_checked(ecs_i16_t, ptr, value, INT16_MIN, INT16_MAX);
+        case EcsOpI32:
+            flecs_json_plan_set_checked(ecs_i32_t, ptr, value, INT32_MIN, INT32_MAX);
+        case EcsOpI64:
+            flecs_json_plan_set_checked(ecs_i64_t, ptr, value, 
+                (double)INT64_MIN, (double)INT64_MAX);
+        case EcsOpByte:
+        case EcsOpU8:
+            flecs_json_plan_set_checked(ecs_u8_t, ptr, value, 0, UINT8_MAX);
+        case EcsOpU16:
+            flecs_json_plan_set_checked(ecs_u16_t, ptr, value, 0, UINT16_MAX);
+        case EcsOpU32:
+            flecs_json_plan_set_checked(ecs_u32_t, ptr, value, 0, UINT32_MAX);
+        case EcsOpU64:
+            flecs_json_plan_set_checked(ecs_u64_t, ptr, value, 
+                0, (double)UINT64_MAX);
+        case EcsOpEnum:
+        case EcsOpBitmask:
+        case EcsOpBool:
+        case EcsOpChar:
+        case EcsOpUPtr:
+        case EcsOpIPtr:
+        case EcsOpString:
+        case EcsOpEntity:
+        case EcsOpId:
+        case EcsOpPushStruct:
+        case EcsOpPushArray:
+        case EcsOpPushVector:
+        case EcsOpPushMap:
+        case EcsOpPushValue:
+        case EcsOpPop:
+        case EcsOpOpaqueStruct:
+        case EcsOpOpaqueArray:
+        case EcsOpOpaqueVector:
+        case EcsOpOpaqueValue:
+        case EcsOpForward:
+        case EcsOpScope:
+        case EcsOpPrimitive:
+        default:
+            break;
+        }
+    } else if (token_kind == JsonTrue || token_kind == JsonFalse) {
+        if (op->value_kind == EcsOpBool) {
+            flecs_meta_set_t(ecs_bool_t, ptr, (token_kind == JsonTrue));
+            return 0;
+        }
+    }
+
+    return flecs_json_plan_assign_w_cursor(ctx, op, ptr, token_kind);
+}
+
+#undef flecs_json_plan_set_checked
+
+static int32_t flecs_json_plan_find_member(
+    const flecs_json_plan_ctx_t *ctx,
+    int32_t object,
+    int32_t expect,
+    const char *name)
+{
+    const ecs_meta_plan_op_t *ops = ctx->ops;
+    int32_t first = object + 1, last = ops[object].next - 1;
+    int32_t i, len = ecs_os_strlen(name);
+
+    /* Members are most likely in declaration order, so start at the member
+     * after the previously deserialized member. */
+    for (i = expect; i < last; i = ops[i].next) {
+        if (ops[i].name_len == len && !ecs_os_memcmp(ops[i].name, name, len)) {
+            return i;
+        }
+    }
+
+    for (i = first; i < expect; i = ops[i].next) {
+        if (ops[i].name_len == len && !ecs_os_memcmp(ops[i].name, name, len)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static const char* flecs_json_plan_parse_object(
+    flecs_json_plan_ctx_t *ctx,
+    int32_t index,
+    const char *json)
+{
+    ecs_json_token_t token_kind = 0;
+    int32_t expect = index + 1;
+
+    while ((json = flecs_json_parse(json, &token_kind, ctx->token))) {
+        if (token_kind == JsonObjectClose) {
+            return json;
+        }
+
+        if (token_kind != JsonString) {
+            break;
+        }
+
+        int32_t member = flecs_json_plan_find_member(
+            ctx, index, expect, ctx->token);
+        if (member == -1) {
+            break;
+        }
+
+        json = flecs_json_parse(json, &token_kind, ctx->token);
+        if (!json || token_kind != JsonColon) {
+            break;
+        }
+
+        json = flecs_json_parse(json, &token_kind, ctx->token);
+        if (!json) {
+            break;
+        }
+
+        json = flecs_json_plan_parse_value(ctx, member, token_kind, json);
+        if (!json) {
+            return NULL;
+        }
+
+        expect = ctx->ops[member].next;
+
+        json = flecs_json_parse(json, &token_kind, ctx->token);
+        if (!json) {
+            break;
+        }
+
+        if (token_kind == JsonObjectClose) {
+            return json;
+        }
+
+        if (token_kind != JsonComma) {
+            break;
+        }
+    }
+
+    ctx->fallback = true;
+    return NULL;
+}
+
+static const char* flecs_json_plan_parse_array(
+    flecs_json_plan_ctx_t *ctx,
+    int32_t index,
+    const char *json)
+{
+    const ecs_meta_plan_op_t *op = &ctx->ops[index];
+    ecs_json_token_t token_kind = 0;
+    int32_t elem = 0;
+
+    while ((json = flecs_json_parse(json, &token_kind, ctx->token))) {
+        if (token_kind == JsonArrayClose) {
+            return json;
+        }
+
+        if (elem == op->elem_count) {
+            break;
+        }
+
+        /* Skip the element op, which only exists for serializing */
+        int32_t elem_index = index + 1 + elem * op->elem_op_count + 1;
+        json = flecs_json_plan_parse_value(ctx, elem_index, token_kind, json);
+        if (!json) {
+            return NULL;
+        }
+
+        elem ++;
+
+        json = flecs_json_parse(json, &token_kind, ctx->token);
+        if (!json) {
+            break;
+        }
+
+        if (token_kind == JsonArrayClose) {
+            return json;
+        }
+
+        if (token_kind != JsonComma) {
+            break;
+        }
+    }
+
+    ctx->fallback = true;
+    return NULL;
+}
+
+static const char* flecs_json_plan_parse_value(
+    flecs_json_plan_ctx_t *ctx,
+    int32_t index,
+    ecs_json_token_t token_kind,
+    const char *json)
+{
+    const ecs_meta_plan_op_t *op = &ctx->ops[index];
+
+    switch(op->kind) {
+    case EcsPlanObjectPush:
+        if (token_kind == JsonObjectOpen) {
+            return flecs_json_plan_parse_object(ctx, index, json);
+        }
+        break;
+    case EcsPlanArrayPush:
+        if (token_kind == JsonArrayOpen) {
+            return flecs_json_plan_parse_array(ctx, index, json);
+        }
+        break;
+    case EcsPlanValue:
+        if (flecs_json_plan_assign(ctx, op, token_kind)) {
+            return NULL;
+        }
+        return json;
+    case EcsPlanObjectPop:
+    case EcsPlanArrayPop:
+    case EcsPlanElement:
+    default:
+        ecs_abort(ECS_INTERNAL_ERROR, NULL);
+    }
+
+    ctx->fallback = true;
+    return NULL;
+}
+
+static const char* flecs_json_plan_deserialize(
+    const ecs_world_t *world,
+    const ecs_meta_plan_t *plan,
+    void *ptr,
+    const char *json,
+    const ecs_from_json_desc_t *desc,
+    bool *fallback)
+{
+    char token[ECS_MAX_TOKEN_SIZE];
+    ecs_json_token_t token_kind = 0;
+
+    flecs_json_plan_ctx_t ctx = {
+        .world = world,
+        .ops = ecs_vec_first(&plan->ops),
+        .base = ptr,
+        .desc = desc,
+        .token = token
+    };
+
+    const char *result = flecs_json_parse(json, &token_kind, token);
+    if (result) {
+        result = flecs_json_plan_parse_value(&ctx, 0, token_kind, result);
+    } else {
+        ctx.fallback = true;
+    }
+
+    *fallback = ctx.fallback;
+    return result;
+}
+
 const char* ecs_ptr_from_json(
     const ecs_world_t *world,
     ecs_entity_t type,
@@ -21,6 +362,16 @@ const char* ecs_ptr_from_json(
     char *token = token_buffer;
     int depth = 0;
 
+    const EcsTypeSerializer *ts = ecs_get(world, type, EcsTypeSerializer);
+    if (ts && ts->plan) {
+        bool fallback = false;
+        const char *result = flecs_json_plan_deserialize(
+            world, ts->plan, ptr, json, desc, &fallback);
+        if (!fallback) {
+            return result;
+        }
+    }
+
     bool strict = desc ? desc->strict : false;
     bool skip = false;
     int skip_depth = 0;
@@ -331,8 +331,7 @@ static int flecs_json_serialize_component_value(
 
     if (has_reflection && (!desc || desc->serialize_values)) {
         ecs_assert(type_ser != NULL, ECS_INTERNAL_ERROR, NULL);
-        if (flecs_json_ser_type(
-            world, &type_ser->ops, ptr, buf) != 0)
+        if (flecs_json_ser_type(world, type_ser, ptr, buf) != 0)
         {
             return -1;
         }
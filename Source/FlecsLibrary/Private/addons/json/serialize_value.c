@@ -242,8 +242,119 @@ static int flecs_json_ser_forward(
         return -1;
     }
 
-    return flecs_json_ser_type_slice(world, ecs_vec_first(&ts->ops), 
-        ecs_vec_count(&ts->ops), base, str);
+    return flecs_json_ser_type(world, ts, base, str);
+}
+
+/* Serialize a value that doesn't open a scope */
+static int flecs_json_ser_leaf(
+    const ecs_world_t *world,
+    ecs_meta_op_t *op,
+    ecs_meta_op_kind_t kind,
+    const void *ptr,
+    ecs_strbuf_t *str)
+{
+    bool large_int = false;
+    if (kind == EcsOpI64) {
+        if (*(const int64_t*)ptr >= 2147483648) {
+            large_int = true;
+        }
+    } else if (kind == EcsOpU64) {
+        if (*(const uint64_t*)ptr >= 2147483648) {
+            large_int = true;
+        }
+    }
+
+    if (large_int) {
+        ecs_strbuf_appendch(str, '"');
+    }
+
+    switch(kind) {
+    case EcsOpF32:
+        ecs_strbuf_appendflt(str, 
+            (ecs_f64_t)*(const ecs_f32_t*)ptr, '"');
+        break;
+    case EcsOpF64:
+        ecs_strbuf_appendflt(str, *(const ecs_f64_t*)ptr, '"');
+        break;
+    case EcsOpEnum:
+        if (flecs_json_ser_enum(world, op, ptr, str)) {
+            goto error;
+        }
+        break;
+    case EcsOpBitmask:
+        if (flecs_json_ser_bitmask(world, op, ptr, str)) {
+            goto error;
+        }
+        break;
+    case EcsOpOpaqueStruct:
+    case EcsOpOpaqueArray:
+    case EcsOpOpaqueVector:
+    case EcsOpOpaqueValue:
+        if (flecs_json_ser_opaque(world, op, ptr, str, kind)) {
+            goto error;
+        }
+        break;
+    case EcsOpEntity: {
+        ecs_entity_t e = *(const ecs_entity_t*)ptr;
+        if (!e) {
+            ecs_strbuf_appendlit(str, "\"#0\"");
+        } else {
+            flecs_json_path(str, world, e);
+        }
+        break;
+    }
+    case EcsOpId: {
+        ecs_id_t id = *(const ecs_id_t*)ptr;
+        if (!id) {
+            ecs_strbuf_appendlit(str, "\"#0\"");
+        } else {
+            flecs_json_id(str, world, id);
+        }
+        break;
+    }
+    case EcsOpU64:
+    case EcsOpI64:
+    case EcsOpBool:
+    case EcsOpChar:
+    case EcsOpByte:
+    case EcsOpU8:
+    case EcsOpU16:
+    case EcsOpU32:
+    case EcsOpI8:
+    case EcsOpI16:
+    case EcsOpI32:
+    case EcsOpUPtr:
+    case EcsOpIPtr:
+        if (flecs_meta_ser_primitive(world,
+            flecs_json_op_to_primitive_kind(kind), ptr, str, true))
+        {
+            ecs_throw(ECS_INTERNAL_ERROR, NULL);
+        }
+        break;
+    case EcsOpString:
+        flecs_json_string_escape_ctrl(str, *ECS_CONST_CAST(const char**, ptr));
+        break;
+    case EcsOpPushStruct:
+    case EcsOpPushArray:
+    case EcsOpPushVector:
+    case EcsOpPushMap:
+    case EcsOpPushValue:
+    case EcsOpForward:
+    case EcsOpPrimitive:
+    case EcsOpScope:
+    case EcsOpPop:
+    default:
+        ecs_throw(ECS_INTERNAL_ERROR, 
+            "unexpected serializer operation");
+    }
+
+    if (large_int) {
+        ecs_strbuf_appendch(str, '"');
+    }
+
+    return 0;
+error:
+    return -1;
 }
 
 /* Iterate over a slice of the type ops array */
@@ -262,21 +373,6 @@ static int flecs_json_ser_type_slice(
             flecs_json_member(str, op->name);
         }
 
-        bool large_int = false;
-        if (op->kind == EcsOpI64) {
-            if (*(const int64_t*)ptr >= 2147483648) {
-                large_int = true;
-            }
-        } else if (op->kind == EcsOpU64) {
-            if (*(const uint64_t*)ptr >= 2147483648) {
-                large_int = true;
-            }
-        }
-
-        if (large_int) {
-            ecs_strbuf_appendch(str, '"');
-        }
-
         switch(op->kind) {
         case EcsOpPushStruct: {
             flecs_json_object_push(str);
@@ -333,70 +429,33 @@ static int flecs_json_ser_type_slice(
             }
             break;
         }
-        case EcsOpF32:
-            ecs_strbuf_appendflt(str, 
-                (ecs_f64_t)*(const ecs_f32_t*)ptr, '"');
-            break;
-        case EcsOpF64:
-            ecs_strbuf_appendflt(str, *(const ecs_f64_t*)ptr, '"');
-            break;
-        case EcsOpEnum:
-            if (flecs_json_ser_enum(world, op, ptr, str)) {
-                goto error;
-            }
-            break;
-        case EcsOpBitmask:
-            if (flecs_json_ser_bitmask(world, op, ptr, str)) {
-                goto error;
-            }
-            break;
         case EcsOpOpaqueStruct:
         case EcsOpOpaqueArray:
         case EcsOpOpaqueVector:
         case EcsOpOpaqueValue:
-            if (flecs_json_ser_opaque(world, op, ptr, str, op->kind)) {
-                goto error;
-            }
-            break;
-        case EcsOpEntity: {
-            ecs_entity_t e = *(const ecs_entity_t*)ptr;
-            if (!e) {
-                ecs_strbuf_appendlit(str, "\"#0\"");
-            } else {
-                flecs_json_path(str, world, e);
-            }
-            break;
-        }
-        case EcsOpId: {
-            ecs_id_t id = *(const ecs_id_t*)ptr;
-            if (!id) {
-                ecs_strbuf_appendlit(str, "\"#0\"");
-            } else {
-                flecs_json_id(str, world, id);
-            }
-            break;
-        }
-        case EcsOpU64:
-        case EcsOpI64:
+        case EcsOpEnum:
+        case EcsOpBitmask:
         case EcsOpBool:
         case EcsOpChar:
         case EcsOpByte:
         case EcsOpU8:
         case EcsOpU16:
         case EcsOpU32:
+        case EcsOpU64:
         case EcsOpI8:
         case EcsOpI16:
         case EcsOpI32:
+        case EcsOpI64:
+        case EcsOpF32:
+        case EcsOpF64:
         case EcsOpUPtr:
         case EcsOpIPtr:
-            if (flecs_meta_ser_primitive(world,
-                flecs_json_op_to_primitive_kind(op->kind), ptr, str, true))
-            {
-                ecs_throw(ECS_INTERNAL_ERROR, NULL);
-            }
-            break;
         case EcsOpString:
-            flecs_json_string_escape_ctrl(str, *ECS_CONST_CAST(const char**, ptr));
+        case EcsOpEntity:
+        case EcsOpId:
+            if (flecs_json_ser_leaf(world, op, op->kind, ptr, str)) {
+                goto error;
+            }
             break;
         case EcsOpPrimitive:
         case EcsOpScope:
@@ -405,10 +464,6 @@ static int flecs_json_ser_type_slice(
             ecs_throw(ECS_INTERNAL_ERROR, 
                 "unexpected serializer operation");
         }
-
-        if (large_int) {
-            ecs_strbuf_appendch(str, '"');
-        }
     }
 
     return 0;
@@ -416,15 +471,68 @@ error:
     return -1;
 }
 
+/* Serialize a value with a compiled plan. Does the same as iterating the type
+ * ops, without recursing into nested structs and arrays. */
+static int flecs_json_ser_plan(
+    const ecs_world_t *world,
+    const ecs_meta_plan_t *plan,
+    const void *base,
+    ecs_strbuf_t *str)
+{
+    const ecs_meta_plan_op_t *ops = ecs_vec_first(&plan->ops);
+    int32_t i, count = ecs_vec_count(&plan->ops);
+
+    for (i = 0; i < count; i ++) {
+        const ecs_meta_plan_op_t *op = &ops[i];
+
+        if (op->name) {
+            flecs_json_membern(str, op->name, op->name_len);
+        }
+
+        switch(op->kind) {
+        case EcsPlanObjectPush:
+            flecs_json_object_push(str);
+            break;
+        case EcsPlanObjectPop:
+            flecs_json_object_pop(str);
+            break;
+        case EcsPlanArrayPush:
+            flecs_json_array_push(str);
+            break;
+        case EcsPlanArrayPop:
+            flecs_json_array_pop(str);
+            break;
+        case EcsPlanElement:
+            ecs_strbuf_list_next(str);
+            break;
+        case EcsPlanValue:
+            if (flecs_json_ser_leaf(world, ECS_CONST_CAST(ecs_meta_op_t*, op->op),
+                op->value_kind, ECS_OFFSET(base, op->offset), str))
+            {
+                return -1;
+            }
+            break;
+        default:
+            ecs_abort(ECS_INTERNAL_ERROR, NULL);
+        }
+    }
+
+    return 0;
+}
+
 /* Iterate over the type ops of a type */
 int flecs_json_ser_type(
     const ecs_world_t *world,
-    const ecs_vec_t *v_ops,
+    const EcsTypeSerializer *ser,
     const void *base, 
     ecs_strbuf_t *str) 
 {
-    ecs_meta_op_t *ops = ecs_vec_first_t(v_ops, ecs_meta_op_t);
-    int32_t count = ecs_vec_count(v_ops);
+    if (ser->plan) {
+        return flecs_json_ser_plan(world, ser->plan, base, str);
+    }
+
+    ecs_meta_op_t *ops = ecs_vec_first_t(&ser->ops, ecs_meta_op_t);
+    int32_t count = ecs_vec_count(&ser->ops);
     return flecs_json_ser_type_slice(world, ops, count, base, str);
 }
 
@@ -443,7 +551,7 @@ static int flecs_array_to_json_buf_w_type_data(
 
         do {
             ecs_strbuf_list_next(buf);
-            if (flecs_json_ser_type(world, &ser->ops, ptr, buf)) {
+            if (flecs_json_ser_type(world, ser, ptr, buf)) {
                 return -1;
             }
 
@@ -452,7 +560,7 @@ static int flecs_array_to_json_buf_w_type_data(
 
         flecs_json_array_pop(buf);
     } else {
-        if (flecs_json_ser_type(world, &ser->ops, ptr, buf)) {
+        if (flecs_json_ser_type(world, ser, ptr, buf)) {
             return -1;
         }
     }
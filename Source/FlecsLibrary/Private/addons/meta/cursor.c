@@ -767,6 +767,15 @@ static int flecs_meta_member(
         return -1;
     }
 
+    /* Members are usually assigned in declaration order, in which case the
+     * cursor already points to the member after ecs_meta_next(). */
+    if (!scope->opaque && scope->ops_cur < scope->ops_count) {
+        const char *cur_name = scope->ops[scope->ops_cur].name;
+        if (cur_name && !ecs_os_strcmp(cur_name, name)) {
+            return 0;
+        }
+    }
+
     const uint64_t *cur_ptr = flecs_name_index_find_ptr(members, name, 0, 0);
     if (!cur_ptr) {
         if (!try) ecs_err("unknown member '%s' for type '%s'", 
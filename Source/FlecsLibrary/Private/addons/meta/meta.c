@@ -25,6 +25,8 @@ void flecs_type_serializer_dtor(
     }
 
     ecs_vec_fini_t(NULL, &ptr->ops, ecs_meta_op_t);
+    flecs_meta_plan_fini(ptr->plan);
+    ptr->plan = NULL;
 }
 
 static ECS_COPY(EcsTypeSerializer, dst, src, {
@@ -65,12 +67,19 @@ static ECS_COPY(EcsTypeSerializer, dst, src, {
             }
         }
     }
+
+    /* The plan points to the ops of the serializer, so it can't be shared */
+    if (src->plan) {
+        dst->plan = flecs_meta_plan_init(&dst->ops, src->plan->size);
+    }
 })
 
 static ECS_MOVE(EcsTypeSerializer, dst, src, {
     flecs_type_serializer_dtor(dst);
     dst->ops = src->ops;
+    dst->plan = src->plan;
     src->ops = (ecs_vec_t){0};
+    src->plan = NULL;
 })
 
 static ECS_DTOR(EcsTypeSerializer, ptr, {
@@ -112,6 +112,61 @@ int flecs_meta_value_type_str(
 void flecs_meta_import_definitions(
     ecs_world_t *world);
 
+/* Compiled serialization plans.
+ * A plan flattens the (nested) serializer ops of a type into a single list with
+ * offsets relative to the start of the value, and unrolls fixed size arrays. A
+ * plan is only created for types that don't contain vectors, maps, opaque or
+ * forwarded types, as those require a serializer to recurse anyway. */
+
+/* Maximum number of ops in a plan, larger types use the serializer ops */
+#define ECS_META_PLAN_MAX_OPS (1024)
+
+typedef enum ecs_meta_plan_op_kind_t {
+    EcsPlanObjectPush,
+    EcsPlanObjectPop,
+    EcsPlanArrayPush,
+    EcsPlanArrayPop,
+    EcsPlanElement,
+    EcsPlanValue
+} ecs_meta_plan_op_kind_t;
+
+typedef struct ecs_meta_plan_op_t {
+    ecs_meta_plan_op_kind_t kind;
+    ecs_meta_op_kind_t value_kind;    /* Primitive, enum or bitmask kind (EcsPlanValue) */
+    ecs_size_t offset;                /* Offset from the start of the value */
+    const char *name;                 /* Member name (owned by serializer ops) */
+    int16_t name_len;
+    int16_t next;                     /* Index of next sibling op */
+    int16_t elem_count;               /* Number of elements (EcsPlanArrayPush) */
+    int16_t elem_op_count;            /* Ops per element incl. EcsPlanElement */
+    const ecs_meta_op_t *op;          /* Serializer op (EcsPlanValue) */
+} ecs_meta_plan_op_t;
+
+/* Contiguous range of plain data members */
+typedef struct ecs_meta_plan_run_t {
+    ecs_size_t offset;
+    ecs_size_t size;
+} ecs_meta_plan_run_t;
+
+struct ecs_meta_plan_t {
+    ecs_vec_t ops;                    /* vector<ecs_meta_plan_op_t> */
+    ecs_vec_t runs;                   /* vector<ecs_meta_plan_run_t>, empty if !is_pod */
+    ecs_size_t size;                  /* Size of the type */
+    ecs_size_t packed_size;           /* Sum of run sizes */
+    bool is_pod;                      /* Only numeric, bool, enum & bitmask members */
+};
+
+/* Create plan from serializer ops. Returns NULL if type can't be flattened. */
+ecs_meta_plan_t* flecs_meta_plan_init(
+    const ecs_vec_t *ops,
+    ecs_size_t size);
+
+void flecs_meta_plan_fini(
+    ecs_meta_plan_t *plan);
+
+ecs_size_t flecs_meta_plan_memory_get(
+    const ecs_meta_plan_t *plan);
+
 #endif
 
 #endif
@@ -0,0 +1,426 @@
+/**
+ * @file addons/meta/plan.c
+ * @brief Compile serializer ops into flat serialization plans.
+ *
+ * Serializer ops are nested: the ops of a struct member are relative to the
+ * member, and the ops of an array element are relative to the element. Code
+ * that walks the ops has to push and pop scopes for every nested value. A plan
+ * resolves the nesting upfront, so that (de)serializing a value becomes a
+ * single loop over ops with offsets relative to the start of the value.
+ */
+
+#include "meta.h"
+
+#ifdef FLECS_META
+
+static int32_t flecs_meta_plan_add(
+    ecs_meta_plan_t *plan,
+    ecs_meta_plan_op_kind_t kind,
+    const ecs_meta_op_t *op,
+    ecs_size_t offset)
+{
+    int32_t index = ecs_vec_count(&plan->ops);
+    ecs_meta_plan_op_t *pop = ecs_vec_append_t(
+        NULL, &plan->ops, ecs_meta_plan_op_t);
+    ecs_os_zeromem(pop);
+    pop->kind = kind;
+    pop->offset = offset;
+    pop->next = flecs_ito(int16_t, index + 1);
+
+    if (op && op->name && kind != EcsPlanObjectPop && kind != EcsPlanArrayPop) {
+        pop->name = op->name;
+        pop->name_len = flecs_ito(int16_t, ecs_os_strlen(op->name));
+    }
+
+    if (kind == EcsPlanValue) {
+        pop->value_kind = op->kind;
+        pop->op = op;
+    }
+
+    return index;
+}
+
+static ecs_meta_plan_op_t* flecs_meta_plan_get(
+    ecs_meta_plan_t *plan,
+    int32_t index)
+{
+    return ecs_vec_get_t(&plan->ops, ecs_meta_plan_op_t, index);
+}
+
+static int flecs_meta_plan_compile(
+    ecs_meta_plan_t *plan,
+    const ecs_meta_op_t *ops,
+    int32_t op_count,
+    ecs_size_t offset)
+{
+    int32_t i;
+    for (i = 0; i < op_count; i ++) {
+        const ecs_meta_op_t *op = &ops[i];
+        ecs_size_t op_offset = offset + op->offset;
+
+        if (ecs_vec_count(&plan->ops) >= ECS_META_PLAN_MAX_OPS) {
+            return -1;
+        }
+
+        switch(op->kind) {
+        case EcsOpPushStruct: {
+            int32_t push = flecs_meta_plan_add(
+                plan, EcsPlanObjectPush, op, op_offset);
+            if (flecs_meta_plan_compile(
+                plan, &op[1], op->op_count - 2, op_offset))
+            {
+                return -1;
+            }
+
+            flecs_meta_plan_add(plan, EcsPlanObjectPop, op, op_offset);
+            flecs_meta_plan_get(plan, push)->next =
+                flecs_ito(int16_t, ecs_vec_count(&plan->ops));
+            i += op->op_count - 1;
+            break;
+        }
+        case EcsOpPushArray: {
+            int32_t e, count = ecs_meta_op_get_elem_count(op, NULL);
+            if ((ecs_vec_count(&plan->ops) + count) >= ECS_META_PLAN_MAX_OPS) {
+                return -1;
+            }
+
+            int32_t push = flecs_meta_plan_add(
+                plan, EcsPlanArrayPush, op, op_offset);
+
+            for (e = 0; e < count; e ++) {
+                ecs_size_t elem_offset = op_offset + e * op->elem_size;
+                int32_t elem = flecs_meta_plan_add(
+                    plan, EcsPlanElement, NULL, elem_offset);
+                if (flecs_meta_plan_compile(
+                    plan, &op[1], op->op_count - 2, elem_offset))
+                {
+                    return -1;
+                }
+
+                flecs_meta_plan_get(plan, elem)->next =
+                    flecs_ito(int16_t, ecs_vec_count(&plan->ops));
+            }
+
+            ecs_meta_plan_op_t *push_op = flecs_meta_plan_get(plan, push);
+            push_op->elem_count = flecs_ito(int16_t, count);
+            if (count) {
+                push_op->elem_op_count = flecs_ito(int16_t,
+                    (ecs_vec_count(&plan->ops) - push - 1) / count);
+            }
+
+            flecs_meta_plan_add(plan, EcsPlanArrayPop, op, op_offset);
+            flecs_meta_plan_get(plan, push)->next =
+                flecs_ito(int16_t, ecs_vec_count(&plan->ops));
+            i += op->op_count - 1;
+            break;
+        }
+        case EcsOpEnum:
+        case EcsOpBitmask:
+        case EcsOpBool:
+        case EcsOpChar:
+        case EcsOpByte:
+        case EcsOpU8:
+        case EcsOpU16:
+        case EcsOpU32:
+        case EcsOpU64:
+        case EcsOpI8:
+        case EcsOpI16:
+        case EcsOpI32:
+        case EcsOpI64:
+        case EcsOpF32:
+        case EcsOpF64:
+        case EcsOpUPtr:
+        case EcsOpIPtr:
+        case EcsOpString:
+        case EcsOpEntity:
+        case EcsOpId:
+            flecs_meta_plan_add(plan, EcsPlanValue, op, op_offset);
+            break;
+        case EcsOpPushVector:
+        case EcsOpPushMap:
+        case EcsOpPushValue:
+        case EcsOpPop:
+        case EcsOpOpaqueStruct:
+        case EcsOpOpaqueArray:
+        case EcsOpOpaqueVector:
+        case EcsOpOpaqueValue:
+        case EcsOpForward:
+        case EcsOpScope:
+        case EcsOpPrimitive:
+        default:
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static bool flecs_meta_plan_is_pod_kind(
+    ecs_meta_op_kind_t kind)
+{
+    switch(kind) {
+    case EcsOpEnum:
+    case EcsOpBitmask:
+    case EcsOpBool:
+    case EcsOpChar:
+    case EcsOpByte:
+    case EcsOpU8:
+    case EcsOpU16:
+    case EcsOpU32:
+    case EcsOpU64:
+    case EcsOpI8:
+    case EcsOpI16:
+    case EcsOpI32:
+    case EcsOpI64:
+    case EcsOpF32:
+    case EcsOpF64:
+    case EcsOpUPtr:
+    case EcsOpIPtr:
+        return true;
+    case EcsOpString:
+    case EcsOpEntity:
+    case EcsOpId:
+    case EcsOpPushStruct:
+    case EcsOpPushArray:
+    case EcsOpPushVector:
+    case EcsOpPushMap:
+    case EcsOpPushValue:
+    case EcsOpPop:
+    case EcsOpOpaqueStruct:
+    case EcsOpOpaqueArray:
+    case EcsOpOpaqueVector:
+    case EcsOpOpaqueValue:
+    case EcsOpForward:
+    case EcsOpScope:
+    case EcsOpPrimitive:
+    default:
+        return false;
+    }
+}
+
+static int flecs_meta_plan_run_compare(
+    const void *a,
+    const void *b)
+{
+    const ecs_meta_plan_run_t *run_a = a, *run_b = b;
+    return (run_a->offset > run_b->offset) - (run_a->offset < run_b->offset);
+}
+
+/* Merge the plain data members of a value into as few contiguous runs as
+ * possible. For types without padding this results in a single run that covers
+ * the entire value, which can be copied with a single memcpy. */
+static void flecs_meta_plan_init_runs(
+    ecs_meta_plan_t *plan)
+{
+    ecs_meta_plan_op_t *ops = ecs_vec_first(&plan->ops);
+    int32_t i, count = ecs_vec_count(&plan->ops);
+
+    for (i = 0; i < count; i ++) {
+        ecs_meta_plan_op_t *op = &ops[i];
+        if (op->kind != EcsPlanValue) {
+            continue;
+        }
+
+        if (!flecs_meta_plan_is_pod_kind(op->value_kind) || !op->op->type_info) {
+            ecs_vec_fini_t(NULL, &plan->runs, ecs_meta_plan_run_t);
+            return;
+        }
+
+        ecs_meta_plan_run_t *run = ecs_vec_append_t(
+            NULL, &plan->runs, ecs_meta_plan_run_t);
+        run->offset = op->offset;
+        run->size = op->op->type_info->size;
+    }
+
+    ecs_meta_plan_run_t *runs = ecs_vec_first(&plan->runs);
+    int32_t run_count = ecs_vec_count(&plan->runs);
+    if (!run_count) {
+        return;
+    }
+
+    qsort(runs, flecs_ito(size_t, run_count), sizeof(ecs_meta_plan_run_t),
+        flecs_meta_plan_run_compare);
+
+    int32_t merged = 0;
+    for (i = 1; i < run_count; i ++) {
+        ecs_meta_plan_run_t *last = &runs[merged];
+        ecs_size_t last_end = last->offset + last->size;
+        if (runs[i].offset < last_end) {
+            /* Overlapping members (unions) can't be packed */
+            ecs_vec_fini_t(NULL, &plan->runs, ecs_meta_plan_run_t);
+            return;
+        }
+
+        if (runs[i].offset == last_end) {
+            last->size += runs[i].size;
+        } else {
+            runs[++ merged] = runs[i];
+        }
+    }
+
+    ecs_vec_set_count_t(NULL, &plan->runs, ecs_meta_plan_run_t, merged + 1);
+
+    for (i = 0; i <= merged; i ++) {
+        plan->packed_size += runs[i].size;
+    }
+
+    plan->is_pod = true;
+}
+
+ecs_meta_plan_t* flecs_meta_plan_init(
+    const ecs_vec_t *ops,
+    ecs_size_t size)
+{
+    ecs_meta_plan_t *plan = ecs_os_calloc_t(ecs_meta_plan_t);
+    plan->size = size;
+
+    if (flecs_meta_plan_compile(plan, ecs_vec_first(ops),
+        ecs_vec_count(ops), 0))
+    {
+        flecs_meta_plan_fini(plan);
+        return NULL;
+    }
+
+    flecs_meta_plan_init_runs(plan);
+
+    return plan;
+}
+
+void flecs_meta_plan_fini(
+    ecs_meta_plan_t *plan)
+{
+    if (!plan) {
+        return;
+    }
+
+    ecs_vec_fini_t(NULL, &plan->ops, ecs_meta_plan_op_t);
+    ecs_vec_fini_t(NULL, &plan->runs, ecs_meta_plan_run_t);
+    ecs_os_free(plan);
+}
+
+ecs_size_t flecs_meta_plan_memory_get(
+    const ecs_meta_plan_t *plan)
+{
+    if (!plan) {
+        return 0;
+    }
+
+    return ECS_SIZEOF(ecs_meta_plan_t) +
+        ecs_vec_size(&plan->ops) * ECS_SIZEOF(ecs_meta_plan_op_t) +
+        ecs_vec_size(&plan->runs) * ECS_SIZEOF(ecs_meta_plan_run_t);
+}
+
+static const ecs_meta_plan_t* flecs_meta_plan_get_pod(
+    const ecs_world_t *world,
+    ecs_entity_t type)
+{
+    const EcsTypeSerializer *ts = ecs_get(world, type, EcsTypeSerializer);
+    if (!ts || !ts->plan || !ts->plan->is_pod) {
+        return NULL;
+    }
+
+    return ts->plan;
+}
+
+ecs_size_t ecs_meta_packed_size(
+    const ecs_world_t *world,
+    ecs_entity_t type)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(type != 0, ECS_INVALID_PARAMETER, NULL);
+
+    const ecs_meta_plan_t *plan = flecs_meta_plan_get_pod(world, type);
+    if (!plan) {
+        return -1;
+    }
+
+    return plan->packed_size;
+error:
+    return -1;
+}
+
+int ecs_meta_pack(
+    const ecs_world_t *world,
+    ecs_entity_t type,
+    const void *ptr,
+    int32_t count,
+    void *out)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(type != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || ptr != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || out != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    const ecs_meta_plan_t *plan = flecs_meta_plan_get_pod(world, type);
+    if (!plan) {
+        ecs_err("cannot pack type '%s': type has no plain data layout",
+            flecs_errstr(ecs_get_path(world, type)));
+        return -1;
+    }
+
+    const ecs_meta_plan_run_t *runs = ecs_vec_first(&plan->runs);
+    int32_t r, run_count = ecs_vec_count(&plan->runs);
+    ecs_size_t size = plan->size;
+
+    if (plan->packed_size == size) {
+        ecs_os_memcpy(out, ptr, size * count);
+        return 0;
+    }
+
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        for (r = 0; r < run_count; r ++) {
+            ecs_os_memcpy(out, ECS_OFFSET(ptr, runs[r].offset), runs[r].size);
+            out = ECS_OFFSET(out, runs[r].size);
+        }
+        ptr = ECS_OFFSET(ptr, size);
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+int ecs_meta_unpack(
+    const ecs_world_t *world,
+    ecs_entity_t type,
+    void *ptr,
+    int32_t count,
+    const void *data)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(type != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || ptr != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || data != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    const ecs_meta_plan_t *plan = flecs_meta_plan_get_pod(world, type);
+    if (!plan) {
+        ecs_err("cannot unpack type '%s': type has no plain data layout",
+            flecs_errstr(ecs_get_path(world, type)));
+        return -1;
+    }
+
+    const ecs_meta_plan_run_t *runs = ecs_vec_first(&plan->runs);
+    int32_t r, run_count = ecs_vec_count(&plan->runs);
+    ecs_size_t size = plan->size;
+
+    if (plan->packed_size == size) {
+        ecs_os_memcpy(ptr, data, size * count);
+        return 0;
+    }
+
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        for (r = 0; r < run_count; r ++) {
+            ecs_os_memcpy(ECS_OFFSET(ptr, runs[r].offset), data, runs[r].size);
+            data = ECS_OFFSET(data, runs[r].size);
+        }
+        ptr = ECS_OFFSET(ptr, size);
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+#endif
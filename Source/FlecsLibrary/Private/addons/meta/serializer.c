@@ -545,6 +545,11 @@ void flecs_meta_type_serializer_init(
 
         ptr->kind = type_ptr->kind;
         ptr->ops = ops;
+
+        const ecs_type_info_t *ti = ecs_get_type_info(world, type);
+        if (ti) {
+            ptr->plan = flecs_meta_plan_init(&ptr->ops, ti->size);
+        }
     }
 }
 
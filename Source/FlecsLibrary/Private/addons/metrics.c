@@ -28,6 +28,9 @@ static ECS_COMPONENT_DECLARE(EcsMetricMemberInstance);
 static ECS_COMPONENT_DECLARE(EcsMetricIdInstance);
 static ECS_COMPONENT_DECLARE(EcsMetricOneOfInstance);
 
+/* Name of timer entity that drives metric collection */
+#define FlecsMetricsTickName "Tick"
+
 /** Context for metric */
 typedef struct {
     ecs_entity_t metric;              /**< Metric entity */
@@ -39,6 +42,7 @@ typedef struct {
     ecs_metric_ctx_t metric;
     ecs_primitive_kind_t type_kind;  /**< Primitive type kind of member */
     uint16_t offset;                 /**< Offset of member in component */
+    bool change_detection;           /**< Only resample when component changed */
 } ecs_member_metric_ctx_t;
 
 /** Context for metric that monitors whether entity has id */
@@ -92,6 +96,10 @@ typedef struct {
     ecs_ref_t ref;
     ecs_id_t id;
     ecs_member_metric_ctx_t *ctx;
+    uint64_t table_id;               /**< Source table when last sampled */
+    int32_t column;                  /**< Column of component in source table */
+    int32_t dirty_state;             /**< Dirty state of column when last sampled */
+    double last_value;               /**< Member value when last sampled */
 } EcsMetricMemberInstance;
 
 /** Instance of id metric */
@@ -163,9 +171,11 @@ static void flecs_metrics_on_member_metric(ecs_iter_t *it) {
 
         EcsMetricMemberInstance *src = ecs_emplace(
             world, m, EcsMetricMemberInstance, NULL);
+        ecs_os_zeromem(src);
         src->ref = ecs_ref_init_id(world, e, id);
         src->id = id;
         src->ctx = ctx;
+        src->column = -1;
         ecs_modified(world, m, EcsMetricMemberInstance);
         ecs_set(world, m, EcsMetricValue, { 0 });
         ecs_set(world, m, EcsMetricSource, { e });
@@ -239,26 +249,60 @@ static void SetMetricDocName(ecs_iter_t *it) {
 }
 #endif
 
-/** Delete metric instances for entities that are no longer alive */
-static void ClearMetricInstance(ecs_iter_t *it) {
-    ecs_world_t *world = it->world;
-    EcsMetricSource *src = ecs_field(it, EcsMetricSource, 0);
+/** Time passed since the metric was last sampled. Metrics are sampled on a
+ * timer which measures unscaled time, so apply the world time scale. */
+static double flecs_metrics_delta_time(
+    const ecs_iter_t *it)
+{
+    return (double)it->delta_system_time * 
+        (double)ecs_get_world_info(it->real_world)->time_scale;
+}
 
-    int32_t i, count = it->count;
-    for (i = 0; i < count; i ++) {
-        ecs_entity_t src_e = src[i].entity;
-        if (!ecs_is_alive(world, src_e)) {
-            ecs_delete(world, it->entities[i]);
-        }
+/** Test if member must be resampled. Uses the dirty state of the table column
+ * that stores the monitored component, which is the same state that queries
+ * use for change detection. */
+static bool flecs_metrics_member_changed(
+    ecs_world_t *world,
+    EcsMetricMemberInstance *mi)
+{
+    ecs_record_t *r = flecs_entities_try(world, mi->ref.entity);
+    if (!r || !r->table) {
+        /* Let the regular path delete the instance */
+        return true;
+    }
+
+    ecs_table_t *table = r->table;
+    if (table->id != mi->table_id) {
+        /* Entity moved to another table, resample and start tracking */
+        mi->table_id = table->id;
+        mi->column = ecs_table_get_column_index(world, table, mi->id);
+        mi->dirty_state = 0;
+    }
+
+    if (mi->column == -1) {
+        /* Component is not stored in a table column (for example when it is
+         * inherited), so changes can't be detected. */
+        return true;
+    }
+
+    int32_t *dirty_state = flecs_table_get_dirty_state(world, table);
+    int32_t state = dirty_state[mi->column + 1];
+    if (state == mi->dirty_state) {
+        return false;
     }
+
+    mi->dirty_state = state;
+    return true;
 }
 
 /** Update member metric */
-static void UpdateMemberInstance(ecs_iter_t *it, bool counter) {
+static void flecs_metrics_update_member_instances(
+    ecs_iter_t *it,
+    EcsMetricValue *m,
+    EcsMetricMemberInstance *mi,
+    double dt)
+{
     ecs_world_t *world = it->real_world;
-    EcsMetricValue *m = ecs_field(it, EcsMetricValue, 0);
-    EcsMetricMemberInstance *mi = ecs_field(it, EcsMetricMemberInstance, 1);
-    ecs_ftime_t dt = it->delta_time;
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -268,14 +312,28 @@ static void UpdateMemberInstance(ecs_iter_t *it, bool counter) {
             continue;
         }
 
+        bool counter = ctx->metric.kind == EcsCounterIncrement;
+
+        if (ctx->change_detection && 
+            !flecs_metrics_member_changed(world, &mi[i])) 
+        {
+            /* Component didn't change, so the last sampled value is still
+             * up to date. */
+            if (counter) {
+                m[i].value += mi[i].last_value * dt;
+            }
+            continue;
+        }
+
         const void *ptr = ecs_ref_get_id(world, ref, mi[i].id);
         if (ptr) {
             ptr = ECS_OFFSET(ptr, ctx->offset);
+            double value = ecs_meta_ptr_to_float(ctx->type_kind, ptr);
+            mi[i].last_value = value;
             if (!counter) {
-                m[i].value = ecs_meta_ptr_to_float(ctx->type_kind, ptr);
+                m[i].value = value;
             } else {
-                m[i].value += 
-                    ecs_meta_ptr_to_float(ctx->type_kind, ptr) * (double)dt;
+                m[i].value += value * dt;
             }
         } else {
             ecs_delete(it->world, it->entities[i]);
@@ -283,24 +341,14 @@ static void UpdateMemberInstance(ecs_iter_t *it, bool counter) {
     }
 }
 
-static void UpdateGaugeMemberInstance(ecs_iter_t *it) {
-    UpdateMemberInstance(it, false);
-}
-
-static void UpdateCounterMemberInstance(ecs_iter_t *it) {
-    UpdateMemberInstance(it, false);
-}
-
-static void UpdateCounterIncrementMemberInstance(ecs_iter_t *it) {
-    UpdateMemberInstance(it, true);
-}
-
 /** Update id metric */
-static void UpdateIdInstance(ecs_iter_t *it, bool counter) {
+static void flecs_metrics_update_id_instances(
+    ecs_iter_t *it,
+    EcsMetricValue *m,
+    EcsMetricIdInstance *mi,
+    double dt)
+{
     ecs_world_t *world = it->real_world;
-    EcsMetricValue *m = ecs_field(it, EcsMetricValue, 0);
-    EcsMetricIdInstance *mi = ecs_field(it, EcsMetricIdInstance, 1);
-    ecs_ftime_t dt = it->delta_time;
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -318,10 +366,10 @@ static void UpdateIdInstance(ecs_iter_t *it, bool counter) {
         ecs_id_metric_ctx_t *ctx = mi[i].ctx;
         ecs_component_record_t *cr = ctx->cr;
         if (ecs_search(world, table, cr->id, NULL) != -1) {
-            if (!counter) {
+            if (ctx->metric.kind != EcsCounter) {
                 m[i].value = 1.0;
             } else {
-                m[i].value += 1.0 * (double)dt;
+                m[i].value += 1.0 * dt;
             }
         } else {
             ecs_delete(it->world, it->entities[i]);
@@ -329,21 +377,14 @@ static void UpdateIdInstance(ecs_iter_t *it, bool counter) {
     }
 }
 
-static void UpdateGaugeIdInstance(ecs_iter_t *it) {
-    UpdateIdInstance(it, false);
-}
-
-static void UpdateCounterIdInstance(ecs_iter_t *it) {
-    UpdateIdInstance(it, true);
-}
-
 /** Update oneof metric */
-static void UpdateOneOfInstance(ecs_iter_t *it, bool counter) {
+static void flecs_metrics_update_oneof_instances(
+    ecs_iter_t *it,
+    void *m,
+    EcsMetricOneOfInstance *mi,
+    double dt)
+{
     ecs_world_t *world = it->real_world;
-    ecs_table_t *table = it->table;
-    void *m = ecs_table_get_column(table, it->trs[0]->column, it->offset);
-    EcsMetricOneOfInstance *mi = ecs_field(it, EcsMetricOneOfInstance, 1);
-    ecs_ftime_t dt = it->delta_time;
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -354,6 +395,7 @@ static void UpdateOneOfInstance(ecs_iter_t *it, bool counter) {
         }
 
         ecs_table_t *mtable = r->table;
+        bool counter = ctx->metric.kind == EcsCounter;
 
         double *value = ECS_ELEM(m, ctx->size, i);
         if (!counter) {
@@ -384,22 +426,53 @@ static void UpdateOneOfInstance(ecs_iter_t *it, bool counter) {
         if (!counter) {
             *value = 1.0;
         } else {
-            *value += 1.0 * (double)dt;
+            *value += 1.0 * dt;
         }
     }
 }
 
-static void UpdateGaugeOneOfInstance(ecs_iter_t *it) {
-    UpdateOneOfInstance(it, false);
-}
+/** Update all metric instances in a single pass over the instance tables, and
+ * delete instances for entities that are no longer alive. */
+static void CollectMetricInstances(ecs_iter_t *it) {
+    ecs_world_t *world = it->real_world;
+    EcsMetricSource *src = ecs_field(it, EcsMetricSource, 0);
+    EcsMetricValue *value = ecs_field(it, EcsMetricValue, 1);
+    EcsMetricMemberInstance *member = ecs_field(it, EcsMetricMemberInstance, 3);
+    EcsMetricIdInstance *id = ecs_field(it, EcsMetricIdInstance, 4);
+    EcsMetricOneOfInstance *oneof = ecs_field(it, EcsMetricOneOfInstance, 5);
+    double dt = flecs_metrics_delta_time(it);
+
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(world, &t_start);
 
-static void UpdateCounterOneOfInstance(ecs_iter_t *it) {
-    UpdateOneOfInstance(it, true);
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t src_e = src[i].entity;
+        if (!ecs_is_alive(world, src_e)) {
+            ecs_delete(it->world, it->entities[i]);
+        }
+    }
+
+    if (member && value) {
+        flecs_metrics_update_member_instances(it, value, member, dt);
+    } else if (id && value) {
+        flecs_metrics_update_id_instances(it, value, id, dt);
+    } else if (oneof && ecs_field_is_set(it, 2)) {
+        void *m = ecs_table_get_column(
+            it->table, it->trs[2]->column, it->offset);
+        flecs_metrics_update_oneof_instances(it, m, oneof, dt);
+    }
+
+    flecs_instrumentation_end(world, &t_start);
 }
 
 static void UpdateCountTargets(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     EcsMetricCountTargets *m = ecs_field(it, EcsMetricCountTargets, 0);
+    double dt = flecs_metrics_delta_time(it);
+
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(world, &t_start);
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -422,22 +495,28 @@ static void UpdateCountTargets(ecs_iter_t *it) {
             }
 
             EcsMetricValue *value = ecs_ensure(world, mi[0], EcsMetricValue);
-            value->value += (double)ecs_count_id(world, cur->id) * 
-                (double)it->delta_system_time;
+            value->value += (double)ecs_count_id(world, cur->id) * dt;
         }
     }
+
+    flecs_instrumentation_end(world, &t_start);
 }
 
 static void UpdateCountIds(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     EcsMetricCountIds *m = ecs_field(it, EcsMetricCountIds, 0);
     EcsMetricValue *v = ecs_field(it, EcsMetricValue, 1);
+    double dt = flecs_metrics_delta_time(it);
+
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(world, &t_start);
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
-        v[i].value += (double)ecs_count_id(world, m[i].id) * 
-            (double)it->delta_system_time;
+        v[i].value += (double)ecs_count_id(world, m[i].id) * dt;
     }
+
+    flecs_instrumentation_end(world, &t_start);
 }
 
 /** Initialize member metric */
@@ -568,6 +647,18 @@ static int flecs_member_metric_init(
     ctx->metric.kind = desc->kind;
     ctx->type_kind = p->kind;
     ctx->offset = flecs_uto(uint16_t, offset);
+    ctx->change_detection = desc->change_detection;
+
+    if (desc->change_detection) {
+        /* Same as queries with change detection: make sure that modified()
+         * isn't skipped for the component, as that's what marks the table
+         * column dirty. */
+        ecs_component_record_t *cr = flecs_components_ensure(world, id);
+        cr->flags |= EcsIdHasOnSet;
+        if (id < FLECS_HI_COMPONENT_ID) {
+            world->non_trivial_set[id] = true;
+        }
+    }
 
     ecs_observer(world, {
         .entity = metric,
@@ -827,10 +918,36 @@ error:
     return 0;
 }
 
+void ecs_metrics_set_interval(
+    ecs_world_t *world,
+    ecs_ftime_t interval)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(interval >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_entity_t tick = ecs_lookup_child(
+        world, ecs_id(FlecsMetrics), FlecsMetricsTickName);
+    ecs_check(tick != 0, ECS_INVALID_OPERATION, 
+        "metrics module is not imported");
+
+    ecs_set_interval(world, tick, interval);
+error:
+    return;
+}
+
+ecs_ftime_t ecs_metrics_get_interval(
+    const ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    return ecs_get_interval(world, 
+        ecs_lookup_child(world, ecs_id(FlecsMetrics), FlecsMetricsTickName));
+}
+
 void FlecsMetricsImport(ecs_world_t *world) {
     ECS_MODULE_DEFINE(world, FlecsMetrics);
 
     ECS_IMPORT(world, FlecsPipeline);
+    ECS_IMPORT(world, FlecsTimer);
     ECS_IMPORT(world, FlecsMeta);
     ECS_IMPORT(world, FlecsUnits);
 
@@ -903,49 +1020,28 @@ void FlecsMetricsImport(ecs_world_t *world) {
         Source);
 #endif
 
-    ECS_SYSTEM(world, ClearMetricInstance, EcsPreStore,
-        [in] Source);
-
-    ECS_SYSTEM(world, UpdateGaugeMemberInstance, EcsPreStore, 
-        [out]  Value, 
-        [in]   MemberInstance,
-        [none] (Metric, Metric.Gauge));
-
-    ECS_SYSTEM(world, UpdateCounterMemberInstance, EcsPreStore, 
-        [out]  Value, 
-        [in]   MemberInstance,
-        [none] (Metric, Metric.Counter));
-
-    ECS_SYSTEM(world, UpdateCounterIncrementMemberInstance, EcsPreStore, 
-        [out]  Value, 
-        [in]   MemberInstance,
-        [none] (Metric, Metric.CounterIncrement));
+    /* Shared timer for metric systems. Ticks every frame until an interval is
+     * set with ecs_metrics_set_interval(). */
+    ecs_entity_t tick = ecs_set_interval(world, 
+        ecs_entity(world, { .name = FlecsMetricsTickName }), 0);
 
-    ECS_SYSTEM(world, UpdateGaugeIdInstance, EcsPreStore, 
-        [out]  Value, 
-        [in]   IdInstance,
-        [none] (Metric, Metric.Gauge));
-
-    ECS_SYSTEM(world, UpdateCounterIdInstance, EcsPreStore, 
-        [inout] Value, 
-        [in]    IdInstance,
-        [none]  (Metric, Metric.Counter));
-
-    ECS_SYSTEM(world, UpdateGaugeOneOfInstance, EcsPreStore, 
-        [none] (_, Value), 
-        [in]   OneOfInstance,
-        [none] (Metric, Metric.Gauge));
-
-    ECS_SYSTEM(world, UpdateCounterOneOfInstance, EcsPreStore, 
-        [none] (_, Value), 
-        [in]   OneOfInstance,
-        [none] (Metric, Metric.Counter));
+    ECS_SYSTEM(world, CollectMetricInstances, EcsPreStore,
+        [in]    Source,
+        [inout] ?Value,
+        [none]  ?(_, Value),
+        [in]    ?MemberInstance,
+        [in]    ?IdInstance,
+        [in]    ?OneOfInstance);
 
     ECS_SYSTEM(world, UpdateCountIds, EcsPreStore, 
         [inout] CountIds, Value);
 
     ECS_SYSTEM(world, UpdateCountTargets, EcsPreStore, 
         [inout] CountTargets);
+
+    ecs_set_tick_source(world, ecs_id(CollectMetricInstances), tick);
+    ecs_set_tick_source(world, ecs_id(UpdateCountIds), tick);
+    ecs_set_tick_source(world, ecs_id(UpdateCountTargets), tick);
 }
 
 #endif
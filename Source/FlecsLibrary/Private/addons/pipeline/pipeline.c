@@ -19,6 +19,15 @@ static void flecs_pipeline_state_free(
         ecs_allocator_t *a = &world->allocator;
         ecs_vec_fini_t(a, &p->ops, ecs_pipeline_op_t);
         ecs_vec_fini_t(a, &p->systems, ecs_system_t*);
+        ecs_vec_fini_t(a, &p->nodes, ecs_pipeline_node_t);
+        ecs_vec_fini_t(a, &p->successors, int32_t);
+        ecs_vec_fini_t(a, &p->ready, int32_t);
+        if (p->sched_cond) {
+            ecs_os_cond_free(p->sched_cond);
+        }
+        if (p->sched_mutex) {
+            ecs_os_mutex_free(p->sched_mutex);
+        }
         ecs_os_free(p);
     }
 }
@@ -245,6 +254,146 @@ static bool flecs_pipeline_check_terms(
     return needs_merge;
 }
 
+typedef enum ecs_access_kind_t {
+    AccessNone = 0,
+    AccessRead,
+    AccessWrite
+} ecs_access_kind_t;
+
+/* Get how a system accesses the storage of a term while it is running. This
+ * uses the same defaults as flecs_pipeline_check_term. Writes that go to the 
+ * command queue don't count as access, as they are only applied when merging. */
+static ecs_access_kind_t flecs_pipeline_term_access(
+    const ecs_term_t *term)
+{
+    int16_t inout = term->inout;
+    if (inout == EcsInOutFilter || inout == EcsInOutNone) {
+        return AccessNone;
+    }
+
+    bool from_any = ecs_term_match_0(term);
+    bool from_this = ecs_term_match_this(term);
+    bool is_shared = !from_any && (!from_this || !(term->src.id & EcsSelf));
+
+    if (inout == EcsInOutDefault) {
+        if (from_any) {
+            return AccessNone;
+        } else if (is_shared) {
+            inout = EcsIn;
+        } else {
+            inout = EcsInOut;
+        }
+    }
+
+    if (term->oper == EcsNot && inout == EcsOut) {
+        /* Component is added with a command */
+        return AccessNone;
+    }
+
+    if (from_any) {
+        /* A get/ensure reads from the main storage, a set is enqueued */
+        return inout == EcsOut ? AccessNone : AccessRead;
+    }
+
+    return inout == EcsIn ? AccessRead : AccessWrite;
+}
+
+static bool flecs_pipeline_id_part_overlap(
+    uint32_t a,
+    uint32_t b)
+{
+    return a == b || 
+        a == (uint32_t)EcsWildcard || b == (uint32_t)EcsWildcard ||
+        a == (uint32_t)EcsAny || b == (uint32_t)EcsAny;
+}
+
+/* Conservatively test whether two (wildcard) ids can match the same id */
+static bool flecs_pipeline_id_overlap(
+    ecs_id_t a,
+    ecs_id_t b)
+{
+    if (a == b || a == EcsWildcard || b == EcsWildcard || 
+        a == EcsAny || b == EcsAny) 
+    {
+        return true;
+    }
+
+    if (!ECS_IS_PAIR(a) || !ECS_IS_PAIR(b)) {
+        return false;
+    }
+
+    return flecs_pipeline_id_part_overlap(ECS_PAIR_FIRST(a), ECS_PAIR_FIRST(b)) &&
+        flecs_pipeline_id_part_overlap(ECS_PAIR_SECOND(a), ECS_PAIR_SECOND(b));
+}
+
+/* Two systems conflict if one writes a component the other reads or writes.
+ * A system without terms (such as a system with only a run callback) doesn't
+ * declare what it accesses, so it conflicts with every other system. */
+static bool flecs_pipeline_systems_conflict(
+    const ecs_query_t *a,
+    const ecs_query_t *b)
+{
+    if (!a->term_count || !b->term_count) {
+        return true;
+    }
+
+    int32_t ta, tb;
+    for (ta = 0; ta < a->term_count; ta ++) {
+        const ecs_term_t *term_a = &a->terms[ta];
+        ecs_access_kind_t access_a = flecs_pipeline_term_access(term_a);
+        if (access_a == AccessNone) {
+            continue;
+        }
+
+        for (tb = 0; tb < b->term_count; tb ++) {
+            const ecs_term_t *term_b = &b->terms[tb];
+            ecs_access_kind_t access_b = flecs_pipeline_term_access(term_b);
+            if (access_b == AccessNone) {
+                continue;
+            }
+
+            if (access_a != AccessWrite && access_b != AccessWrite) {
+                continue;
+            }
+
+            if (flecs_pipeline_id_overlap(term_a->id, term_b->id)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* Build the access graph for the systems of an op. A system depends on each
+ * earlier system in the op that it conflicts with, so declaration order is 
+ * preserved where it matters, and is always a valid order to run the graph. */
+static void flecs_pipeline_build_access_graph(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq,
+    const ecs_pipeline_op_t *op)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    int32_t i, j, end = op->offset + op->count;
+
+    for (i = op->offset; i < end; i ++) {
+        ecs_pipeline_node_t *node = ecs_vec_get_t(
+            &pq->nodes, ecs_pipeline_node_t, i);
+        node->succ_offset = ecs_vec_count(&pq->successors);
+
+        for (j = i + 1; j < end; j ++) {
+            if (flecs_pipeline_systems_conflict(
+                systems[i]->query, systems[j]->query)) 
+            {
+                ecs_vec_append_t(a, &pq->successors, int32_t)[0] = j;
+                ecs_vec_get_t(&pq->nodes, ecs_pipeline_node_t, j)->dep_count ++;
+                node->succ_count ++;
+            }
+        }
+    }
+}
+
 static EcsPoly* flecs_pipeline_term_system(
     ecs_iter_t *it)
 {
@@ -283,6 +432,7 @@ static bool flecs_pipeline_build(
 
     bool multi_threaded = false;
     bool immediate = false;
+    bool schedule_by_access = false;
     bool first = true;
 
     /* Iterate systems in pipeline, add ops for running / merging */
@@ -301,21 +451,31 @@ static bool flecs_pipeline_build(
             needs_merge = flecs_pipeline_check_terms(
                 world, q, is_active, &ws);
 
+            /* Systems that are scheduled by access are distributed over the
+             * workers, so the op is always multi threaded. */
+            bool sys_by_access = sys->schedule_by_access && !sys->immediate;
+            bool sys_multi_threaded = sys->multi_threaded || sys_by_access;
+
             if (is_active) {
                 if (first) {
-                    multi_threaded = sys->multi_threaded;
+                    multi_threaded = sys_multi_threaded;
                     immediate = sys->immediate;
+                    schedule_by_access = sys_by_access;
                     first = false;
                 }
 
-                if (sys->multi_threaded != multi_threaded) {
+                if (sys_multi_threaded != multi_threaded) {
                     needs_merge = true;
-                    multi_threaded = sys->multi_threaded;
+                    multi_threaded = sys_multi_threaded;
                 }
                 if (sys->immediate != immediate) {
                     needs_merge = true;
                     immediate = sys->immediate;
                 }
+                if (sys_by_access != schedule_by_access) {
+                    needs_merge = true;
+                    schedule_by_access = sys_by_access;
+                }
             }
 
             if (immediate) {
@@ -355,6 +515,7 @@ static bool flecs_pipeline_build(
                 op->count = 0;
                 op->multi_threaded = false;
                 op->immediate = false;
+                op->schedule_by_access = false;
                 op->time_spent = 0;
                 op->commands_enqueued = 0;
             }
@@ -366,6 +527,7 @@ static bool flecs_pipeline_build(
                 if (!op->count) {
                     op->multi_threaded = multi_threaded;
                     op->immediate = immediate;
+                    op->schedule_by_access = schedule_by_access;
                 }
                 op->count ++;
             }
@@ -379,6 +541,23 @@ static bool flecs_pipeline_build(
     ecs_map_fini(&ws.ids);
     ecs_map_fini(&ws.wildcard_ids);
 
+    int32_t system_count = ecs_vec_count(&pq->systems);
+    ecs_vec_reset_t(a, &pq->successors, int32_t);
+    ecs_vec_set_count_t(a, &pq->nodes, ecs_pipeline_node_t, system_count);
+    ecs_vec_set_count_t(a, &pq->ready, int32_t, system_count);
+    if (system_count) {
+        ecs_os_memset_n(ecs_vec_first(&pq->nodes), 0, 
+            ecs_pipeline_node_t, system_count);
+    }
+
+    int32_t op_i, op_count = ecs_vec_count(&pq->ops);
+    for (op_i = 0; op_i < op_count; op_i ++) {
+        op = ecs_vec_get_t(&pq->ops, ecs_pipeline_op_t, op_i);
+        if (op->schedule_by_access) {
+            flecs_pipeline_build_access_graph(world, pq, op);
+        }
+    }
+
     op = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
 
     if (!op) {
@@ -389,8 +568,9 @@ static bool flecs_pipeline_build(
         ecs_dbg("#[bold]pipeline rebuild");
         ecs_log_push_1();
 
-        ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d:", 
-            op->multi_threaded, !op->immediate);
+        ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d, "
+            "by access: %d:", op->multi_threaded, !op->immediate,
+                op->schedule_by_access);
         ecs_log_push_1();
 
         int32_t i, count = ecs_vec_count(&pq->systems);
@@ -432,9 +612,10 @@ static bool flecs_pipeline_build(
                 if (op_index < ecs_vec_count(&pq->ops)) {
                     ecs_dbg(
                         "#[green]schedule#[reset]: "
-                        "threading: %d, staging: %d:",
+                        "threading: %d, staging: %d, by access: %d:",
                         op[op_index].multi_threaded, 
-                        !op[op_index].immediate);
+                        !op[op_index].immediate,
+                        op[op_index].schedule_by_access);
                 }
                 ecs_log_push_1();
             }
@@ -534,6 +715,212 @@ void ecs_run_pipeline(
     }
 }
 
+void ecs_pipeline_prepare(
+    ecs_world_t *world,
+    ecs_entity_t pipeline)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION, 
+        "cannot prepare pipeline while world is in readonly mode");
+
+    if (!pipeline) {
+        pipeline = world->pipeline;
+    }
+
+    const EcsPipeline *p = ecs_get(world, pipeline, EcsPipeline);
+    ecs_check(p != NULL, ECS_INVALID_PARAMETER, 
+        "entity passed to ecs_pipeline_prepare is not a pipeline");
+
+    ecs_run_aperiodic(world, 0);
+    flecs_pipeline_build(world, p->state);
+error:
+    return;
+}
+
+bool ecs_run_pipeline_readonly(
+    ecs_world_t *stage,
+    ecs_entity_t pipeline,
+    ecs_ftime_t delta_time)
+{
+    flecs_poly_assert(stage, ecs_stage_t);
+    ecs_stage_t *s = (ecs_stage_t*)stage;
+    ecs_world_t *world = s->world;
+    ecs_check(world->flags & EcsWorldReadonly, ECS_INVALID_OPERATION, 
+        "ecs_run_pipeline_readonly requires the world to be in readonly mode");
+
+    if (!pipeline) {
+        pipeline = world->pipeline;
+    }
+
+    const EcsPipeline *p = ecs_get(world, pipeline, EcsPipeline);
+    ecs_check(p != NULL, ECS_INVALID_PARAMETER, 
+        "entity passed to ecs_run_pipeline_readonly is not a pipeline");
+
+    /* The schedule can't be (re)built in readonly mode, so this runs the
+     * schedule as it was when the pipeline was last prepared. */
+    const ecs_pipeline_state_t *pq = p->state;
+    if (pq->match_count == -1) {
+        return false;
+    }
+
+    int32_t stage_index = s->id < 0 ? 0 : s->id;
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    ecs_pipeline_op_t *ops = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
+    int32_t o, op_count = ecs_vec_count(&pq->ops);
+
+    for (o = 0; o < op_count; o ++) {
+        ecs_check(!ops[o].immediate, ECS_INVALID_OPERATION, 
+            "cannot run pipeline with immediate systems in readonly mode");
+    }
+
+    /* Systems iterate the thread context of the stage, which for async stages
+     * is the world. Point it at the stage so commands are enqueued there. */
+    ecs_world_t *thread_ctx = s->thread_ctx;
+    s->thread_ctx = stage;
+
+    /* Sync points are not honored: every command is enqueued on the stage and
+     * merged when the world leaves readonly mode. This only touches local 
+     * state, so several threads can run pipelines at the same time. */
+    for (o = 0; o < op_count; o ++) {
+        const ecs_pipeline_op_t *op = &ops[o];
+        int32_t i, end = op->offset + op->count;
+        for (i = op->offset; i < end; i ++) {
+            ecs_system_t *sys = systems[i];
+            flecs_run_system(world, s, sys->query->entity, sys, stage_index,
+                1, delta_time, NULL);
+            ecs_os_linc(&world->info.systems_ran_total);
+        }
+    }
+
+    s->thread_ctx = thread_ctx;
+
+    return true;
+error:
+    return false;
+}
+
+/* Prepare the access graph of an op before the workers are signaled */
+static void flecs_pipeline_access_graph_begin(
+    ecs_pipeline_state_t *pq)
+{
+    ecs_pipeline_op_t *op = pq->cur_op;
+    ecs_assert(pq->cur_i == op->offset, ECS_INTERNAL_ERROR, NULL);
+
+    if (!pq->sched_mutex) {
+        pq->sched_mutex = ecs_os_mutex_new();
+        pq->sched_cond = ecs_os_cond_new();
+    }
+
+    ecs_pipeline_node_t *nodes = ecs_vec_first_t(
+        &pq->nodes, ecs_pipeline_node_t);
+    int32_t *ready = ecs_vec_first_t(&pq->ready, int32_t);
+    int32_t i, end = op->offset + op->count;
+
+    pq->ready_head = 0;
+    pq->ready_tail = 0;
+    pq->done_count = 0;
+
+    for (i = op->offset; i < end; i ++) {
+        nodes[i].pending = nodes[i].dep_count;
+        if (!nodes[i].dep_count) {
+            ready[pq->ready_tail ++] = i;
+        }
+    }
+}
+
+static void flecs_pipeline_run_op_system(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    ecs_system_t *sys,
+    int32_t stage_index,
+    ecs_ftime_t delta_time)
+{
+    /* Keep track of the last frame for which the system has run, so we know
+     * from where to resume the schedule in case the schedule changes during a
+     * merge. Each system only runs on one thread, so this doesn't race. */
+    sys->last_frame = world->info.frame_count_total + 1;
+
+    /* The system runs as a whole on this thread, so don't split its tables 
+     * over the workers by passing a stage count of 1. */
+    flecs_run_system(world, stage, sys->query->entity, sys, stage_index,
+        1, delta_time, NULL);
+
+    ecs_os_linc(&world->info.systems_ran_total);
+}
+
+/* Run the systems of an op that schedules by access. Threads take systems of 
+ * which all dependencies finished from the ready vector until every system of
+ * the op has run. */
+static int32_t flecs_run_pipeline_access_graph(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    ecs_pipeline_state_t *pq,
+    int32_t stage_index,
+    ecs_ftime_t delta_time)
+{
+    ecs_pipeline_op_t *op = pq->cur_op;
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    int32_t i, last = op->offset + op->count - 1;
+
+    if (!(world->flags & EcsWorldMultiThreaded)) {
+        /* Without workers declaration order is a valid order for the graph */
+        ecs_assert(!stage_index, ECS_INTERNAL_ERROR, NULL);
+        for (i = pq->cur_i; i <= last; i ++) {
+            flecs_pipeline_run_op_system(
+                world, stage, systems[i], stage_index, delta_time);
+        }
+
+        return last;
+    }
+
+    ecs_pipeline_node_t *nodes = ecs_vec_first_t(
+        &pq->nodes, ecs_pipeline_node_t);
+    int32_t *successors = ecs_vec_first_t(&pq->successors, int32_t);
+    int32_t *ready = ecs_vec_first_t(&pq->ready, int32_t);
+
+    ecs_os_mutex_lock(pq->sched_mutex);
+
+    for (;;) {
+        while (pq->ready_head == pq->ready_tail && 
+            pq->done_count < op->count) 
+        {
+            ecs_os_cond_wait(pq->sched_cond, pq->sched_mutex);
+        }
+
+        if (pq->ready_head == pq->ready_tail) {
+            /* All systems of the op finished */
+            break;
+        }
+
+        i = ready[pq->ready_head ++];
+        ecs_os_mutex_unlock(pq->sched_mutex);
+
+        flecs_pipeline_run_op_system(
+            world, stage, systems[i], stage_index, delta_time);
+
+        ecs_os_mutex_lock(pq->sched_mutex);
+
+        bool signal = ++ pq->done_count == op->count;
+        const ecs_pipeline_node_t *node = &nodes[i];
+        int32_t s, succ_end = node->succ_offset + node->succ_count;
+        for (s = node->succ_offset; s < succ_end; s ++) {
+            int32_t succ = successors[s];
+            if (!(-- nodes[succ].pending)) {
+                ready[pq->ready_tail ++] = succ;
+                signal = true;
+            }
+        }
+
+        if (signal) {
+            ecs_os_cond_broadcast(pq->sched_cond);
+        }
+    }
+
+    ecs_os_mutex_unlock(pq->sched_mutex);
+
+    return last;
+}
+
 int32_t flecs_run_pipeline_ops(
     ecs_world_t* world,
     ecs_stage_t* stage,
@@ -549,6 +936,11 @@ int32_t flecs_run_pipeline_ops(
 
     ecs_assert(!stage_index || op->multi_threaded, ECS_INTERNAL_ERROR, NULL);
 
+    if (op->schedule_by_access) {
+        return flecs_run_pipeline_access_graph(
+            world, stage, pq, stage_index, delta_time);
+    }
+
     int32_t count = ecs_vec_count(&pq->systems);
     ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
     int32_t ran_since_merge = i - op->offset;
@@ -632,6 +1024,10 @@ void flecs_run_pipeline(
         ecs_assert(world->workers_waiting == 0, ECS_INTERNAL_ERROR, NULL);
 
         if (op_multi_threaded) {
+            if (pq->cur_op->schedule_by_access) {
+                flecs_pipeline_access_graph_begin(pq);
+            }
+
             flecs_signal_workers(world);
         }
 
@@ -796,6 +1192,98 @@ error:
     return 0;
 }
 
+char* ecs_pipeline_schedule_to_dot(
+    const ecs_world_t *world,
+    ecs_entity_t pipeline)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    world = ecs_get_world(world);
+
+    if (!pipeline) {
+        pipeline = world->pipeline;
+    }
+
+    const EcsPipeline *p = ecs_get(world, pipeline, EcsPipeline);
+    if (!p || !p->state) {
+        return NULL;
+    }
+
+    const ecs_pipeline_state_t *pq = p->state;
+    bool measure_time = ECS_BIT_IS_SET(world->flags, EcsWorldMeasureSystemTime);
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    const ecs_pipeline_node_t *nodes = ecs_vec_first_t(
+        &pq->nodes, ecs_pipeline_node_t);
+    const int32_t *successors = ecs_vec_first_t(&pq->successors, int32_t);
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    ecs_strbuf_appendstr(&buf, "digraph pipeline {\n");
+    ecs_strbuf_appendstr(&buf, "  rankdir=LR;\n  node [shape=box];\n");
+
+    int32_t op_i, op_count = ecs_vec_count(&pq->ops);
+    for (op_i = 0; op_i < op_count; op_i ++) {
+        const ecs_pipeline_op_t *op = ecs_vec_get_t(
+            &pq->ops, ecs_pipeline_op_t, op_i);
+        int32_t i, end = op->offset + op->count;
+
+        ecs_strbuf_append(&buf, 
+            "  subgraph cluster_%d {\n    label=\"sync point %d (%s)\";\n",
+            op_i, op_i, op->schedule_by_access ? "by access" : 
+                op->immediate ? "immediate" : 
+                op->multi_threaded ? "multi threaded" : "single threaded");
+
+        for (i = op->offset; i < end; i ++) {
+            const ecs_system_t *sys = systems[i];
+            ecs_strbuf_append(&buf, "    s%d [label=\"%s", i, 
+                sys->name ? sys->name : "");
+            if (measure_time) {
+                ecs_strbuf_append(&buf, "\\n%.3f ms", 
+                    (double)sys->time_spent * 1000.0);
+            }
+            ecs_strbuf_appendstr(&buf, "\"];\n");
+        }
+
+        ecs_strbuf_append(&buf, 
+            "    merge_%d [shape=point];\n  }\n", op_i);
+
+        for (i = op->offset; i < end; i ++) {
+            /* Systems without dependencies start after the previous merge,
+             * systems without successors finish before the next merge. */
+            bool is_source = true, is_sink = true;
+
+            if (op->schedule_by_access) {
+                const ecs_pipeline_node_t *node = &nodes[i];
+                int32_t s, succ_end = node->succ_offset + node->succ_count;
+                for (s = node->succ_offset; s < succ_end; s ++) {
+                    ecs_strbuf_append(&buf, "  s%d -> s%d;\n", 
+                        i, successors[s]);
+                }
+
+                is_source = !node->dep_count;
+                is_sink = !node->succ_count;
+            } else {
+                if (i + 1 < end) {
+                    ecs_strbuf_append(&buf, "  s%d -> s%d;\n", i, i + 1);
+                }
+
+                is_source = i == op->offset;
+                is_sink = i + 1 == end;
+            }
+
+            if (is_source && op_i) {
+                ecs_strbuf_append(&buf, "  merge_%d -> s%d;\n", op_i - 1, i);
+            }
+            if (is_sink) {
+                ecs_strbuf_append(&buf, "  s%d -> merge_%d;\n", i, op_i);
+            }
+        }
+    }
+
+    ecs_strbuf_appendstr(&buf, "}\n");
+    return ecs_strbuf_get(&buf);
+error:
+    return NULL;
+}
+
 static ecs_entity_t flecs_pipeline_init(
     ecs_world_t *world,
     ecs_entity_t entity,
@@ -17,8 +17,19 @@ typedef struct ecs_pipeline_op_t {
     int64_t commands_enqueued;  /* Number of commands enqueued for sync point */
     bool multi_threaded;        /* Whether systems can be run multi-threaded */
     bool immediate;           /* Whether systems run in immediate mode */
+    bool schedule_by_access;    /* Whether systems are scheduled by access */
 } ecs_pipeline_op_t;
 
+/** Node in the access graph of a pipeline op that schedules by access.
+ * This type is the element type in the "nodes" vector of a pipeline, which has
+ * the same layout as the "systems" vector. */
+typedef struct ecs_pipeline_node_t {
+    int32_t dep_count;          /* Number of systems that must run first */
+    int32_t succ_offset;        /* Offset in successors vector */
+    int32_t succ_count;         /* Number of systems that wait for this one */
+    int32_t pending;            /* Dependencies that didn't run yet this frame */
+} ecs_pipeline_node_t;
+
 struct ecs_pipeline_state_t {
     ecs_query_t *query;         /* Pipeline query */
     ecs_vec_t ops;              /* Pipeline schedule */
@@ -33,6 +44,16 @@ struct ecs_pipeline_state_t {
     int32_t cur_i;              /* Index in current result */
     int32_t ran_since_merge;    /* Index in current op */
     bool immediate;           /* Is pipeline in immediate mode */
+
+    /* Members for running ops that schedule systems by access */
+    ecs_vec_t nodes;            /* Access graph (ecs_pipeline_node_t) */
+    ecs_vec_t successors;       /* Indices of dependent systems (int32_t) */
+    ecs_vec_t ready;            /* Systems that can run (int32_t) */
+    int32_t ready_head;         /* Next system to take from ready vector */
+    int32_t ready_tail;         /* Next free element in ready vector */
+    int32_t done_count;         /* Systems of current op that finished */
+    ecs_os_mutex_t sched_mutex; /* Protects the members above while running */
+    ecs_os_cond_t sched_cond;   /* Signaled when a system becomes ready */
 };
 
 typedef struct EcsPipeline {
@@ -6,6 +6,7 @@
 #include "../private_api.h"
 #include "query_dsl/query_dsl.h"
 #include "json/json.h"
+#include "rest_delta.h"
 
 #ifdef FLECS_REST
 
@@ -1061,6 +1062,7 @@ static void flecs_world_stats_to_json(
     ECS_COUNTER_APPEND(reply, stats, performance.emit_time, "Time spent on notifying observers in frame");
     ECS_COUNTER_APPEND(reply, stats, performance.merge_time, "Time spent on merging commands in frame");
     ECS_COUNTER_APPEND(reply, stats, performance.rematch_time, "Time spent on revalidating query caches in frame");
+    ECS_COUNTER_APPEND(reply, stats, performance.instrumentation_time, "Time spent collecting stats, metrics and alerts in frame");
 
     ECS_COUNTER_APPEND(reply, stats, commands.add_count, "Add commands executed");
     ECS_COUNTER_APPEND(reply, stats, commands.remove_count, "Remove commands executed");
@@ -2166,6 +2168,11 @@ static bool flecs_rest_reply(
         } else if (!ecs_os_strcmp(req->path, "query")) {
             return flecs_rest_get_query(world, req, reply);
 
+        /* Delta endpoint */
+        } else if (!ecs_os_strcmp(req->path, "delta")) {
+            return flecs_rest_delta_reply(
+                world, impl->delta, req, reply, impl->last_time);
+
         /* World endpoint */
         } else if (!ecs_os_strcmp(req->path, "world")) {
             return flecs_rest_get_world(world, req, reply);
@@ -2251,6 +2258,7 @@ ecs_http_server_t* ecs_rest_server_init(
     srv_ctx->world = world;
     srv_ctx->srv = srv;
     srv_ctx->rc = 1;
+    srv_ctx->delta = flecs_rest_delta_init();
 
     /* Set build info on world so clients know which version they're using */
     ecs_id_t build_info = ecs_lookup(world, "flecs.core.BuildInfo");
@@ -2267,6 +2275,7 @@ void ecs_rest_server_fini(
 {
     ecs_rest_ctx_t *impl = ecs_http_server_ctx(srv);
     flecs_rest_server_garbage_collect_all(impl);
+    flecs_rest_delta_fini(impl->delta);
     ecs_os_free(impl);
     ecs_http_server_fini(srv);
 }
@@ -2284,7 +2293,8 @@ static void flecs_on_set_rest(ecs_iter_t *it) {
             &(ecs_http_server_desc_t){ 
                 .ipaddr = rest[i].ipaddr, 
                 .port = rest[i].port,
-                .cache_timeout = 0.2
+                .cache_timeout = 0.2,
+                .compression_threshold = ECS_REST_COMPRESSION_THRESHOLD
             });
 
         if (!srv) {
@@ -2318,6 +2328,8 @@ static void DequeueRest(ecs_iter_t *it) {
             float elapsed = (float)(wi->world_time_total_raw - ctx->last_time);
             ecs_http_server_dequeue(ctx->srv, (ecs_ftime_t)elapsed);
             flecs_rest_server_garbage_collect(it->world, ctx);
+            flecs_rest_delta_progress(it->world, ctx->delta,
+                wi->world_time_total_raw);
             ctx->last_time = wi->world_time_total_raw;
         }
     } 
@@ -0,0 +1,767 @@
+/**
+ * @file addons/rest_delta.c
+ * @brief Incremental (delta streaming) endpoint for the REST addon.
+ */
+
+#include "rest_delta.h"
+#include "json/json.h"
+
+#ifdef FLECS_REST
+
+/* Snapshot of a single table. Only the main thread dereferences the table
+ * pointer, the serializer thread only reads the copied data. */
+typedef struct {
+    uint64_t id;
+    uint16_t version;
+    int32_t count;
+    ecs_entity_t *entities;
+    int32_t entities_size;
+    ecs_id_t *ids;
+    int32_t id_count;
+    char *type_str;
+    int64_t changed;      /* Revision in which the table data last changed */
+    int64_t created;      /* Revision in which the table was first captured */
+    int64_t seen;         /* Last capture in which the table existed */
+} ecs_rest_delta_table_t;
+
+typedef struct {
+    uint64_t id;
+    int64_t revision;
+} ecs_rest_delta_tombstone_t;
+
+typedef struct {
+    char *id;
+    int64_t acked;              /* Revision acknowledged by the client */
+    bool binary;
+    bool entities;
+    bool wants_payload;         /* Session is waiting on the serializer */
+    int64_t payload_base;
+    int64_t payload_revision;
+    char *payload;
+    int32_t payload_length;
+    double last_request;
+} ecs_rest_delta_session_t;
+
+struct ecs_rest_delta_t {
+    ecs_map_t tables;           /* map<table id, ecs_rest_delta_table_t*> */
+    ecs_vec_t tombstones;       /* vec<ecs_rest_delta_tombstone_t> */
+    int64_t revision;
+    int64_t oldest_revision;    /* Oldest ack that can be served incrementally */
+    double last_capture;
+
+    ecs_map_t sessions;         /* map<session hash, ecs_rest_delta_session_t*> */
+    int32_t last_session_id;
+
+    /* The serializer thread owns the snapshot and sessions while busy is set,
+     * the main thread owns them otherwise. */
+    ecs_os_thread_t thread;
+    ecs_os_mutex_t lock;
+    ecs_os_cond_t cond;
+    bool busy;
+    bool quit;
+};
+
+/* -- Encoding -- */
+
+static void flecs_rest_delta_append_varint(
+    ecs_strbuf_t *buf,
+    uint64_t value)
+{
+    char bytes[10];
+    int32_t len = 0;
+    do {
+        char byte = (char)(value & 0x7F);
+        value >>= 7;
+        if (value) {
+            byte = (char)(byte | 0x80);
+        }
+        bytes[len ++] = byte;
+    } while (value);
+
+    ecs_strbuf_appendstrn(buf, bytes, len);
+}
+
+static void flecs_rest_delta_append_u8(
+    ecs_strbuf_t *buf,
+    uint8_t value)
+{
+    ecs_strbuf_appendch(buf, (char)value);
+}
+
+static bool flecs_rest_delta_table_included(
+    const ecs_rest_delta_table_t *table,
+    int64_t base)
+{
+    return !base || table->changed > base;
+}
+
+static void flecs_rest_delta_encode_json(
+    const ecs_rest_delta_t *delta,
+    const ecs_rest_delta_session_t *session,
+    ecs_strbuf_t *buf,
+    int64_t base,
+    bool pending)
+{
+    ecs_strbuf_list_push(buf, "{", ",");
+
+    ecs_strbuf_list_appendlit(buf, "\"session\":\"");
+    ecs_strbuf_appendstr(buf, session->id);
+    ecs_strbuf_appendch(buf, '"');
+
+    ecs_strbuf_list_appendlit(buf, "\"revision\":");
+    ecs_strbuf_appendint(buf, pending ? session->acked : delta->revision);
+
+    ecs_strbuf_list_appendlit(buf, "\"base\":");
+    ecs_strbuf_appendint(buf, base);
+
+    ecs_strbuf_list_appendlit(buf, "\"full\":");
+    ecs_strbuf_appendbool(buf, !base && !pending);
+
+    ecs_strbuf_list_appendlit(buf, "\"pending\":");
+    ecs_strbuf_appendbool(buf, pending);
+
+    ecs_strbuf_list_appendlit(buf, "\"tables\":");
+    ecs_strbuf_list_push(buf, "[", ",");
+    if (!pending) {
+        ecs_map_iter_t it = ecs_map_iter(&delta->tables);
+        while (ecs_map_next(&it)) {
+            const ecs_rest_delta_table_t *table = ecs_map_ptr(&it);
+            if (!flecs_rest_delta_table_included(table, base)) {
+                continue;
+            }
+
+            ecs_strbuf_list_next(buf);
+            ecs_strbuf_list_push(buf, "{", ",");
+            ecs_strbuf_list_appendlit(buf, "\"id\":");
+            ecs_strbuf_appendint(buf, flecs_uto(int64_t, table->id));
+
+            if (table->created > base || !base) {
+                ecs_strbuf_list_appendlit(buf, "\"type\":\"");
+                if (table->type_str) {
+                    flecs_json_string_escape(buf, table->type_str);
+                }
+                ecs_strbuf_appendch(buf, '"');
+            }
+
+            ecs_strbuf_list_appendlit(buf, "\"count\":");
+            ecs_strbuf_appendint(buf, table->count);
+
+            if (session->entities) {
+                ecs_strbuf_list_appendlit(buf, "\"entities\":");
+                ecs_strbuf_list_push(buf, "[", ",");
+                int32_t i;
+                for (i = 0; i < table->count; i ++) {
+                    ecs_strbuf_list_next(buf);
+                    ecs_strbuf_appendint(buf,
+                        flecs_uto(int64_t, table->entities[i]));
+                }
+                ecs_strbuf_list_pop(buf, "]");
+            }
+
+            ecs_strbuf_list_pop(buf, "}");
+        }
+    }
+    ecs_strbuf_list_pop(buf, "]");
+
+    ecs_strbuf_list_appendlit(buf, "\"removed\":");
+    ecs_strbuf_list_push(buf, "[", ",");
+    if (!pending && base) {
+        int32_t i, count = ecs_vec_count(&delta->tombstones);
+        const ecs_rest_delta_tombstone_t *tombstones =
+            ecs_vec_first(&delta->tombstones);
+        for (i = 0; i < count; i ++) {
+            if (tombstones[i].revision > base) {
+                ecs_strbuf_list_next(buf);
+                ecs_strbuf_appendint(buf,
+                    flecs_uto(int64_t, tombstones[i].id));
+            }
+        }
+    }
+    ecs_strbuf_list_pop(buf, "]");
+
+    ecs_strbuf_list_pop(buf, "}");
+}
+
+static void flecs_rest_delta_encode_binary(
+    const ecs_rest_delta_t *delta,
+    const ecs_rest_delta_session_t *session,
+    ecs_strbuf_t *buf,
+    int64_t base,
+    bool pending)
+{
+    ecs_strbuf_appendlit(buf, "FLD1");
+
+    uint8_t flags = 0;
+    if (!base && !pending) {
+        flags |= 1;
+    }
+    if (pending) {
+        flags |= 2;
+    }
+    flecs_rest_delta_append_u8(buf, flags);
+
+    flecs_rest_delta_append_varint(buf, flecs_ito(uint64_t, base));
+    flecs_rest_delta_append_varint(buf, flecs_ito(uint64_t,
+        pending ? session->acked : delta->revision));
+
+    if (pending) {
+        flecs_rest_delta_append_varint(buf, 0);
+        flecs_rest_delta_append_varint(buf, 0);
+        return;
+    }
+
+    uint64_t table_count = 0;
+    ecs_map_iter_t it = ecs_map_iter(&delta->tables);
+    while (ecs_map_next(&it)) {
+        const ecs_rest_delta_table_t *table = ecs_map_ptr(&it);
+        table_count += flecs_rest_delta_table_included(table, base);
+    }
+
+    flecs_rest_delta_append_varint(buf, table_count);
+
+    it = ecs_map_iter(&delta->tables);
+    while (ecs_map_next(&it)) {
+        const ecs_rest_delta_table_t *table = ecs_map_ptr(&it);
+        if (!flecs_rest_delta_table_included(table, base)) {
+            continue;
+        }
+
+        flecs_rest_delta_append_varint(buf, table->id);
+
+        bool has_type = table->created > base || !base;
+        flecs_rest_delta_append_u8(buf, has_type);
+        if (has_type) {
+            flecs_rest_delta_append_varint(buf,
+                flecs_ito(uint64_t, table->id_count));
+            int32_t i;
+            for (i = 0; i < table->id_count; i ++) {
+                flecs_rest_delta_append_varint(buf, table->ids[i]);
+            }
+        }
+
+        flecs_rest_delta_append_varint(buf,
+            flecs_ito(uint64_t, table->count));
+        flecs_rest_delta_append_u8(buf, session->entities);
+        if (session->entities) {
+            int32_t i;
+            for (i = 0; i < table->count; i ++) {
+                flecs_rest_delta_append_varint(buf, table->entities[i]);
+            }
+        }
+    }
+
+    uint64_t removed_count = 0;
+    int32_t i, count = ecs_vec_count(&delta->tombstones);
+    const ecs_rest_delta_tombstone_t *tombstones =
+        ecs_vec_first(&delta->tombstones);
+    if (base) {
+        for (i = 0; i < count; i ++) {
+            removed_count += tombstones[i].revision > base;
+        }
+    }
+
+    flecs_rest_delta_append_varint(buf, removed_count);
+    if (removed_count) {
+        for (i = 0; i < count; i ++) {
+            if (tombstones[i].revision > base) {
+                flecs_rest_delta_append_varint(buf, tombstones[i].id);
+            }
+        }
+    }
+}
+
+static void flecs_rest_delta_encode(
+    const ecs_rest_delta_t *delta,
+    const ecs_rest_delta_session_t *session,
+    ecs_strbuf_t *buf,
+    bool pending)
+{
+    int64_t base = session->acked;
+    if (base < delta->oldest_revision) {
+        base = 0; /* Ack is too old to be served incrementally */
+    }
+
+    if (session->binary) {
+        flecs_rest_delta_encode_binary(delta, session, buf, base, pending);
+    } else {
+        flecs_rest_delta_encode_json(delta, session, buf, base, pending);
+    }
+}
+
+/* Encode payloads for all sessions that are waiting on one. Runs on the
+ * serializer thread, or on the main thread if there is no serializer. */
+static void flecs_rest_delta_encode_sessions(
+    ecs_rest_delta_t *delta)
+{
+    ecs_map_iter_t it = ecs_map_iter(&delta->sessions);
+    while (ecs_map_next(&it)) {
+        ecs_rest_delta_session_t *session = ecs_map_ptr(&it);
+        if (!session->wants_payload) {
+            continue;
+        }
+
+        if (session->payload &&
+            session->payload_base == session->acked &&
+            session->payload_revision == delta->revision)
+        {
+            continue; /* Already up to date */
+        }
+
+        ecs_os_free(session->payload);
+
+        ecs_strbuf_t buf = ECS_STRBUF_INIT;
+        flecs_rest_delta_encode(delta, session, &buf, false);
+        session->payload_length = ecs_strbuf_written(&buf);
+        session->payload = ecs_strbuf_get(&buf);
+        session->payload_base = session->acked;
+        session->payload_revision = delta->revision;
+    }
+}
+
+/* -- Snapshot -- */
+
+static void flecs_rest_delta_table_free(
+    ecs_rest_delta_table_t *table)
+{
+    ecs_os_free(table->entities);
+    ecs_os_free(table->ids);
+    ecs_os_free(table->type_str);
+    ecs_os_free(table);
+}
+
+static bool flecs_rest_delta_type_equals(
+    const ecs_rest_delta_table_t *entry,
+    const ecs_table_t *table)
+{
+    if (entry->id_count != table->type.count) {
+        return false;
+    }
+
+    return !entry->id_count || !ecs_os_memcmp(entry->ids, table->type.array,
+        ECS_SIZEOF(ecs_id_t) * entry->id_count);
+}
+
+static bool flecs_rest_delta_capture_table(
+    ecs_world_t *world,
+    ecs_rest_delta_t *delta,
+    const ecs_table_t *table,
+    int64_t revision)
+{
+    bool changed = false;
+    ecs_rest_delta_table_t *entry = ecs_map_get_deref(
+        &delta->tables, ecs_rest_delta_table_t, table->id);
+
+    if (entry && entry->seen == revision) {
+        return false;
+    }
+
+    /* Table ids are recycled, treat a table with a different type as new */
+    if (entry && !flecs_rest_delta_type_equals(entry, table)) {
+        ecs_os_free(entry->ids);
+        ecs_os_free(entry->type_str);
+        entry->ids = NULL;
+        entry->type_str = NULL;
+        entry->id_count = 0;
+        entry->created = revision;
+        changed = true;
+    }
+
+    if (!entry) {
+        entry = ecs_os_calloc_t(ecs_rest_delta_table_t);
+        entry->id = table->id;
+        entry->created = revision;
+        ecs_map_insert_ptr(&delta->tables, table->id, entry);
+        changed = true;
+    }
+
+    if (entry->created == revision) {
+        entry->id_count = table->type.count;
+        if (entry->id_count) {
+            entry->ids = ecs_os_memdup_n(
+                table->type.array, ecs_id_t, entry->id_count);
+        }
+        entry->type_str = ecs_table_str(world, table);
+    }
+
+    int32_t count = ecs_table_count(table);
+    if (changed || entry->version != table->version || entry->count != count) {
+        if (count > entry->entities_size) {
+            entry->entities = ecs_os_realloc_n(
+                entry->entities, ecs_entity_t, count);
+            entry->entities_size = count;
+        }
+        if (count) {
+            ecs_os_memcpy_n(entry->entities,
+                ecs_table_entities(table), ecs_entity_t, count);
+        }
+        entry->count = count;
+        entry->version = table->version;
+        entry->changed = revision;
+        changed = true;
+    }
+
+    entry->seen = revision;
+    return changed;
+}
+
+static void flecs_rest_delta_trim_tombstones(
+    ecs_rest_delta_t *delta)
+{
+    int32_t count = ecs_vec_count(&delta->tombstones);
+    if (count <= FLECS_REST_DELTA_TOMBSTONE_MAX) {
+        return;
+    }
+
+    /* Drop the oldest half, clients that acked before the last dropped
+     * tombstone will receive a full reply. */
+    int32_t drop = count / 2;
+    ecs_rest_delta_tombstone_t *tombstones = ecs_vec_first(&delta->tombstones);
+    delta->oldest_revision = tombstones[drop - 1].revision;
+    ecs_os_memmove_n(tombstones, &tombstones[drop],
+        ecs_rest_delta_tombstone_t, count - drop);
+    ecs_vec_set_count_t(NULL, &delta->tombstones,
+        ecs_rest_delta_tombstone_t, count - drop);
+}
+
+static void flecs_rest_delta_capture(
+    ecs_world_t *world,
+    ecs_rest_delta_t *delta)
+{
+    int64_t revision = delta->revision + 1;
+    bool changed = flecs_rest_delta_capture_table(
+        world, delta, &world->store.root, revision);
+
+    int32_t i, count = flecs_sparse_count(&world->store.tables);
+    for (i = 0; i < count; i ++) {
+        const ecs_table_t *table = flecs_sparse_get_dense_t(
+            &world->store.tables, ecs_table_t, i);
+        changed |= flecs_rest_delta_capture_table(
+            world, delta, table, revision);
+    }
+
+    /* Remove tables that no longer exist */
+    ecs_vec_t removed = {0};
+    ecs_map_iter_t it = ecs_map_iter(&delta->tables);
+    while (ecs_map_next(&it)) {
+        ecs_rest_delta_table_t *entry = ecs_map_ptr(&it);
+        if (entry->seen != revision) {
+            ecs_vec_init_if_t(&removed, uint64_t);
+            ecs_vec_append_t(NULL, &removed, uint64_t)[0] = entry->id;
+        }
+    }
+
+    int32_t removed_count = ecs_vec_count(&removed);
+    if (removed_count) {
+        uint64_t *ids = ecs_vec_first(&removed);
+        for (i = 0; i < removed_count; i ++) {
+            flecs_rest_delta_table_free(ecs_map_remove_ptr(
+                &delta->tables, ids[i]));
+
+            ecs_rest_delta_tombstone_t *tombstone = ecs_vec_append_t(NULL,
+                &delta->tombstones, ecs_rest_delta_tombstone_t);
+            tombstone->id = ids[i];
+            tombstone->revision = revision;
+        }
+        ecs_vec_fini_t(NULL, &removed, uint64_t);
+        flecs_rest_delta_trim_tombstones(delta);
+        changed = true;
+    }
+
+    if (changed) {
+        delta->revision = revision;
+    }
+}
+
+/* -- Sessions -- */
+
+static void flecs_rest_delta_session_free(
+    ecs_rest_delta_session_t *session)
+{
+    ecs_os_free(session->id);
+    ecs_os_free(session->payload);
+    ecs_os_free(session);
+}
+
+static ecs_rest_delta_session_t* flecs_rest_delta_ensure_session(
+    ecs_rest_delta_t *delta,
+    const char *id)
+{
+    char id_buf[32];
+    if (!id || !id[0]) {
+        ecs_os_snprintf(id_buf, ECS_SIZEOF(id_buf), "s%d",
+            ++ delta->last_session_id);
+        id = id_buf;
+    }
+
+    uint64_t hash = flecs_hash(id, ecs_os_strlen(id));
+    ecs_rest_delta_session_t *session = ecs_map_get_deref(
+        &delta->sessions, ecs_rest_delta_session_t, hash);
+    if (session && !ecs_os_strcmp(session->id, id)) {
+        return session;
+    }
+
+    if (session) {
+        /* Hash collision, replace the older session */
+        flecs_rest_delta_session_free(session);
+        ecs_map_remove(&delta->sessions, hash);
+    }
+
+    session = ecs_os_calloc_t(ecs_rest_delta_session_t);
+    session->id = ecs_os_strdup(id);
+    session->entities = true;
+    ecs_map_insert_ptr(&delta->sessions, hash, session);
+    return session;
+}
+
+static void flecs_rest_delta_purge_sessions(
+    ecs_rest_delta_t *delta,
+    double time)
+{
+    ecs_vec_t removed = {0};
+    ecs_map_iter_t it = ecs_map_iter(&delta->sessions);
+    while (ecs_map_next(&it)) {
+        ecs_rest_delta_session_t *session = ecs_map_ptr(&it);
+        if ((time - session->last_request) > FLECS_REST_DELTA_SESSION_TIMEOUT) {
+            ecs_vec_init_if_t(&removed, uint64_t);
+            ecs_vec_append_t(NULL, &removed, uint64_t)[0] = ecs_map_key(&it);
+        }
+    }
+
+    int32_t i, count = ecs_vec_count(&removed);
+    if (count) {
+        uint64_t *keys = ecs_vec_first(&removed);
+        for (i = 0; i < count; i ++) {
+            flecs_rest_delta_session_free(ecs_map_remove_ptr(
+                &delta->sessions, keys[i]));
+        }
+        ecs_vec_fini_t(NULL, &removed, uint64_t);
+    }
+}
+
+/* -- Serializer thread -- */
+
+static void* flecs_rest_delta_thread(
+    void *arg)
+{
+    ecs_rest_delta_t *delta = arg;
+
+    ecs_os_mutex_lock(delta->lock);
+    while (!delta->quit) {
+        if (!delta->busy) {
+            ecs_os_cond_wait(delta->cond, delta->lock);
+            continue;
+        }
+        ecs_os_mutex_unlock(delta->lock);
+
+        flecs_rest_delta_encode_sessions(delta);
+
+        ecs_os_mutex_lock(delta->lock);
+        delta->busy = false;
+    }
+    ecs_os_mutex_unlock(delta->lock);
+
+    return NULL;
+}
+
+static bool flecs_rest_delta_is_busy(
+    ecs_rest_delta_t *delta)
+{
+    if (!delta->thread) {
+        return false;
+    }
+
+    ecs_os_mutex_lock(delta->lock);
+    bool busy = delta->busy;
+    ecs_os_mutex_unlock(delta->lock);
+    return busy;
+}
+
+static bool flecs_rest_delta_has_waiting_sessions(
+    ecs_rest_delta_t *delta)
+{
+    ecs_map_iter_t it = ecs_map_iter(&delta->sessions);
+    while (ecs_map_next(&it)) {
+        ecs_rest_delta_session_t *session = ecs_map_ptr(&it);
+        if (session->wants_payload) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* -- Public (internal) API -- */
+
+ecs_rest_delta_t* flecs_rest_delta_init(void) {
+    ecs_rest_delta_t *delta = ecs_os_calloc_t(ecs_rest_delta_t);
+    ecs_map_init(&delta->tables, NULL);
+    ecs_map_init(&delta->sessions, NULL);
+    ecs_vec_init_t(NULL, &delta->tombstones, ecs_rest_delta_tombstone_t, 0);
+    delta->last_capture = -FLECS_REST_DELTA_CAPTURE_INTERVAL;
+
+    if (ecs_os_has_threading()) {
+        delta->lock = ecs_os_mutex_new();
+        delta->cond = ecs_os_cond_new();
+        delta->thread = ecs_os_thread_new(flecs_rest_delta_thread, delta);
+    }
+
+    return delta;
+}
+
+void flecs_rest_delta_fini(
+    ecs_rest_delta_t *delta)
+{
+    if (!delta) {
+        return;
+    }
+
+    if (delta->thread) {
+        ecs_os_mutex_lock(delta->lock);
+        delta->quit = true;
+        ecs_os_cond_signal(delta->cond);
+        ecs_os_mutex_unlock(delta->lock);
+        ecs_os_thread_join(delta->thread);
+        ecs_os_cond_free(delta->cond);
+        ecs_os_mutex_free(delta->lock);
+    }
+
+    ecs_map_iter_t it = ecs_map_iter(&delta->tables);
+    while (ecs_map_next(&it)) {
+        flecs_rest_delta_table_free(ecs_map_ptr(&it));
+    }
+    ecs_map_fini(&delta->tables);
+
+    it = ecs_map_iter(&delta->sessions);
+    while (ecs_map_next(&it)) {
+        flecs_rest_delta_session_free(ecs_map_ptr(&it));
+    }
+    ecs_map_fini(&delta->sessions);
+
+    ecs_vec_fini_t(NULL, &delta->tombstones, ecs_rest_delta_tombstone_t);
+    ecs_os_free(delta);
+}
+
+void flecs_rest_delta_progress(
+    ecs_world_t *world,
+    ecs_rest_delta_t *delta,
+    double time)
+{
+    if (!delta || !ecs_map_count(&delta->sessions)) {
+        return;
+    }
+
+    if (flecs_rest_delta_is_busy(delta)) {
+        return;
+    }
+
+    flecs_rest_delta_purge_sessions(delta, time);
+
+    if (!flecs_rest_delta_has_waiting_sessions(delta)) {
+        return;
+    }
+
+    if ((time - delta->last_capture) < FLECS_REST_DELTA_CAPTURE_INTERVAL) {
+        return;
+    }
+
+    delta->last_capture = time;
+    flecs_rest_delta_capture(world, delta);
+
+    if (delta->thread) {
+        ecs_os_mutex_lock(delta->lock);
+        delta->busy = true;
+        ecs_os_cond_signal(delta->cond);
+        ecs_os_mutex_unlock(delta->lock);
+    } else {
+        flecs_rest_delta_encode_sessions(delta);
+    }
+}
+
+bool flecs_rest_delta_reply(
+    ecs_world_t *world,
+    ecs_rest_delta_t *delta,
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply,
+    double time)
+{
+    const char *encoding = ecs_http_get_param(req, "encoding");
+    bool binary = encoding && !ecs_os_strcmp(encoding, "binary");
+
+    /* Every request advances the baseline of its session, and the session
+     * header isn't part of a cached reply */
+    reply->no_cache = true;
+
+    if (flecs_rest_delta_is_busy(delta)) {
+        /* Serializer owns the sessions, let the client retry */
+        reply->code = 503;
+        reply->status = "Busy";
+        ecs_strbuf_appendlit(&reply->headers, "Retry-After: 0\r\n");
+        return true;
+    }
+
+    const char *ack_str = ecs_http_get_param(req, "ack");
+    const char *entities_str = ecs_http_get_param(req, "entities");
+    const char *sync_str = ecs_http_get_param(req, "sync");
+    int64_t ack = ack_str ? atoll(ack_str) : 0;
+    bool sync = sync_str && !ecs_os_strcmp(sync_str, "true");
+
+    ecs_rest_delta_session_t *session = flecs_rest_delta_ensure_session(
+        delta, ecs_http_get_param(req, "session"));
+    session->last_request = time;
+
+    bool entities = !entities_str || ecs_os_strcmp(entities_str, "false");
+    if (session->binary != binary || session->entities != entities) {
+        /* Encoding changed, discard payload encoded with old settings */
+        ecs_os_free(session->payload);
+        session->payload = NULL;
+        session->binary = binary;
+        session->entities = entities;
+    }
+
+    if (ack < 0 || ack > delta->revision) {
+        ack = 0; /* Unknown revision, resync */
+    }
+    session->acked = ack;
+
+    if (sync) {
+        delta->last_capture = time;
+        flecs_rest_delta_capture(world, delta);
+    }
+
+    bool has_payload = session->payload &&
+        session->payload_base == ack &&
+        session->payload_revision == delta->revision;
+
+    ecs_strbuf_append(&reply->headers,
+        "X-Flecs-Delta-Session: %s\r\n", session->id);
+    if (binary) {
+        reply->content_type = "application/octet-stream";
+    }
+
+    if (ack && ack == delta->revision && ack >= delta->oldest_revision) {
+        /* Client is up to date with the latest snapshot */
+        session->wants_payload = true;
+        flecs_rest_delta_encode(delta, session, &reply->body, false);
+        return true;
+    }
+
+    if (has_payload) {
+        ecs_strbuf_appendstrn(&reply->body,
+            session->payload, session->payload_length);
+        ecs_os_free(session->payload);
+        session->payload = NULL;
+        session->wants_payload = true;
+        return true;
+    }
+
+    session->wants_payload = true;
+
+    if (sync || !delta->thread) {
+        flecs_rest_delta_encode(delta, session, &reply->body, false);
+    } else {
+        flecs_rest_delta_encode(delta, session, &reply->body, true);
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @file addons/rest_delta.h
+ * @brief Incremental (delta streaming) endpoint for the REST addon.
+ *
+ * The delta endpoint lets clients poll the world layout without having the
+ * server rebuild a full reply on every request. The main thread captures a
+ * copy-on-change snapshot of the table storage at most once per capture
+ * interval, after which a worker thread encodes per-session deltas against the
+ * revision each client last acknowledged. A request on the main thread then
+ * only has to hand off an already encoded payload.
+ *
+ * Request:  GET /delta?session=<id>&ack=<revision>[&encoding=binary]
+ *                     [&entities=false][&sync=true]
+ *
+ * The JSON reply has the following layout:
+ *   {
+ *     "session": "<id>", "revision": 12, "base": 10, "full": false,
+ *     "pending": false,
+ *     "tables": [{"id": 123, "type": "Position, Velocity", "count": 2,
+ *                 "entities": [500, 501]}],
+ *     "removed": [456]
+ *   }
+ *
+ * "type" is only sent the first time a table is sent to a session. The client
+ * applies the delta and acknowledges "revision" on its next request. If the
+ * acknowledged revision is unknown (or too old) the server replies with a full
+ * delta ("full": true). If no payload is ready yet the reply has "pending" set
+ * and carries no tables, unless "sync" is set in which case the delta is
+ * encoded on the calling thread. While the serializer thread is encoding, the
+ * server replies with 503 and "Retry-After: 0" so the client can poll again.
+ *
+ * The binary encoding (content type application/octet-stream) contains the
+ * same data, little endian with unsigned LEB128 varints:
+ *   magic "FLD1", u8 flags (1 = full, 2 = pending), varint base,
+ *   varint revision, varint table_count, table_count * {
+ *     varint id, u8 has_type, [varint id_count, id_count * varint id],
+ *     varint count, u8 has_entities, [count * varint entity] },
+ *   varint removed_count, removed_count * varint id
+ * The session id is returned in the "X-Flecs-Delta-Session" header.
+ */
+
+#ifndef FLECS_REST_DELTA_H
+#define FLECS_REST_DELTA_H
+
+#include "../private_api.h"
+
+#ifdef FLECS_REST
+
+/* Minimum time between two snapshots of the world (seconds) */
+#define FLECS_REST_DELTA_CAPTURE_INTERVAL (0.1)
+
+/* Time after which a session that hasn't sent a request is removed (seconds) */
+#define FLECS_REST_DELTA_SESSION_TIMEOUT (10.0)
+
+/* Maximum number of removed tables retained for incremental replies */
+#define FLECS_REST_DELTA_TOMBSTONE_MAX (4096)
+
+typedef struct ecs_rest_delta_t ecs_rest_delta_t;
+
+/* Create delta state for a REST server. Starts the serializer thread when the
+ * OS API supports threading. */
+ecs_rest_delta_t* flecs_rest_delta_init(void);
+
+/* Stop the serializer thread and free all snapshot and session data. */
+void flecs_rest_delta_fini(
+    ecs_rest_delta_t *delta);
+
+/* Capture a new snapshot and wake up the serializer if there are sessions that
+ * are waiting for a payload. Must be called from the main thread while the
+ * world is not in readonly mode. */
+void flecs_rest_delta_progress(
+    ecs_world_t *world,
+    ecs_rest_delta_t *delta,
+    double time);
+
+/* Handle GET /delta request. */
+bool flecs_rest_delta_reply(
+    ecs_world_t *world,
+    ecs_rest_delta_t *delta,
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply,
+    double time);
+
+#endif
+
+#endif
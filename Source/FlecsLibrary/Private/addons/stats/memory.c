@@ -12,6 +12,7 @@
 
 #ifdef FLECS_REST
 #include "../http/http.h"
+#include "../meta/meta.h"
 #endif
 
 ECS_COMPONENT_DECLARE(ecs_entities_memory_t);
@@ -840,6 +841,8 @@ static void flecs_reflection_memory_get(
 
                 result->bytes_reflection += ecs_vec_size(&s[i].ops) *
                     ECS_SIZEOF(ecs_meta_op_t);
+                result->bytes_reflection += flecs_meta_plan_memory_get(
+                    s[i].plan);
 
                 for (o = 0; o < ocount; o ++) {
                     ecs_meta_op_t *op = &ops[o];
@@ -931,9 +934,7 @@ static void flecs_http_memory_get(
             ecs_http_request_key_t *key = &keys[i];
 
             result->bytes_rest += key->count;
-            if (entry->content) {
-                result->bytes_rest += ecs_os_strlen(entry->content);
-            }
+            result->bytes_rest += entry->content_length;
         }
     }
 }
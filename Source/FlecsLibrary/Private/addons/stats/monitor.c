@@ -20,6 +20,9 @@ ecs_entity_t EcsPeriod1w = 0;
 #define FlecsDayIntervalCount (24)
 #define FlecsWeekIntervalCount (168)
 
+/* Name of timer entity that drives sampling of stats */
+#define FlecsStatsTickName "Tick"
+
 typedef struct {
     ecs_stats_api_t api;
     ecs_query_t *query;
@@ -40,8 +43,13 @@ static void MonitorStats(ecs_iter_t *it) {
 
     EcsStatsHeader *hdr = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
 
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(world, &t_start);
+
+    /* Use time since last sample, which is larger than the frame delta time
+     * when stats are sampled at an interval. */
     ecs_ftime_t elapsed = hdr->elapsed;
-    hdr->elapsed += it->delta_time;
+    hdr->elapsed += it->delta_system_time;
 
     int32_t t_last = (int32_t)(elapsed * 60);
     int32_t t_next = (int32_t)(hdr->elapsed * 60);
@@ -125,11 +133,16 @@ static void MonitorStats(ecs_iter_t *it) {
      if (dif > 1) {
         hdr->reduce_count = 0;
     }
+
+    flecs_instrumentation_end(world, &t_start);
 }
 
 static void ReduceStats(ecs_iter_t *it) {
     ecs_reduce_stats_ctx_t *ctx = it->ctx;
 
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(it->real_world, &t_start);
+
     void *dst = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
     void *src = ecs_field_w_size(it, ecs_field_size(it, 1), 1);
 
@@ -151,12 +164,17 @@ static void ReduceStats(ecs_iter_t *it) {
             ctx->api.reduce(dst_el, src_el);
         }
     }
+
+    flecs_instrumentation_end(it->real_world, &t_start);
 }
 
 static void AggregateStats(ecs_iter_t *it) {
     ecs_aggregate_stats_ctx_t *ctx = it->ctx;
     int32_t interval = ctx->interval;
 
+    ecs_time_t t_start = {0};
+    flecs_instrumentation_begin(it->real_world, &t_start);
+
     EcsStatsHeader *dst_hdr = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
     EcsStatsHeader *src_hdr = ecs_field_w_size(it, ecs_field_size(it, 1), 1);
 
@@ -223,6 +241,8 @@ static void AggregateStats(ecs_iter_t *it) {
     if (dst_hdr->reduce_count >= interval) {
         dst_hdr->reduce_count = 0;
     }
+
+    flecs_instrumentation_end(it->real_world, &t_start);
 }
 
 static void flecs_monitor_ctx_free(
@@ -263,7 +283,8 @@ void flecs_stats_api_import(
         });
     }
 
-    // Called each frame, collects 60 measurements per second
+    // Called each frame (or at the sampling interval), collects 60 
+    // measurements per second
     {
         ecs_monitor_stats_ctx_t *ctx = ecs_os_calloc_t(ecs_monitor_stats_ctx_t);
         ctx->api = *api;
@@ -277,6 +298,8 @@ void flecs_stats_api_import(
                 .src.id = EcsWorld 
             }},
             .callback = MonitorStats,
+            .tick_source = ecs_lookup_child(
+                world, ecs_id(FlecsStats), FlecsStatsTickName),
             .ctx = ctx,
             .ctx_free = flecs_monitor_ctx_free
         });
@@ -385,6 +408,31 @@ void flecs_stats_api_import(
     ecs_add_pair(world, EcsWorld, kind, EcsPeriod1w);
 }
 
+void ecs_stats_set_interval(
+    ecs_world_t *world,
+    ecs_ftime_t interval)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(interval >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_entity_t tick = ecs_lookup_child(
+        world, ecs_id(FlecsStats), FlecsStatsTickName);
+    ecs_check(tick != 0, ECS_INVALID_OPERATION, 
+        "stats module is not imported");
+
+    ecs_set_interval(world, tick, interval);
+error:
+    return;
+}
+
+ecs_ftime_t ecs_stats_get_interval(
+    const ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    return ecs_get_interval(world, 
+        ecs_lookup_child(world, ecs_id(FlecsStats), FlecsStatsTickName));
+}
+
 void FlecsStatsImport(
     ecs_world_t *world)
 {
@@ -403,6 +451,11 @@ void FlecsStatsImport(
     EcsPeriod1d = ecs_entity(world, { .name = "EcsPeriod1d" });
     EcsPeriod1w = ecs_entity(world, { .name = "EcsPeriod1w" });
 
+    /* Shared timer for the Monitor1s systems. Ticks every frame until an
+     * interval is set with ecs_stats_set_interval(). */
+    ecs_set_interval(world, 
+        ecs_entity(world, { .name = FlecsStatsTickName }), 0);
+
     FlecsWorldSummaryImport(world);
     FlecsWorldMonitorImport(world);
     FlecsSystemMonitorImport(world);
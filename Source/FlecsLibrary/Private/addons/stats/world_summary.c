@@ -25,6 +25,8 @@ static void flecs_copy_world_summary(
     dst->frame_time_frame = (double)info->frame_time_total - dst->frame_time_total;
     dst->system_time_frame = (double)info->system_time_total - dst->system_time_total;
     dst->merge_time_frame = (double)info->merge_time_total - dst->merge_time_total;
+    dst->instrumentation_time_frame = 
+        (double)info->instrumentation_time_total - dst->instrumentation_time_total;
 
     dst->merge_count_frame = info->merge_count_total - dst->merge_count;
     dst->systems_ran_frame = info->systems_ran_total - dst->systems_ran_total;
@@ -48,6 +50,7 @@ static void flecs_copy_world_summary(
     dst->frame_time_total = (double)info->frame_time_total;
     dst->system_time_total = (double)info->system_time_total;
     dst->merge_time_total = (double)info->merge_time_total;
+    dst->instrumentation_time_total = (double)info->instrumentation_time_total;
 
     dst->entity_count = flecs_entities_count(world);
     dst->table_count = flecs_sparse_count(&world->store.tables);
@@ -108,6 +111,7 @@ void FlecsWorldSummaryImport(
             { .name = "frame_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
             { .name = "system_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
             { .name = "merge_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
+            { .name = "instrumentation_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
 
             { .name = "entity_count", .type = ecs_id(ecs_i64_t) },
             { .name = "table_count", .type = ecs_id(ecs_i64_t) },
@@ -126,6 +130,7 @@ void FlecsWorldSummaryImport(
             { .name = "frame_time_frame", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
             { .name = "system_time_frame", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
             { .name = "merge_time_frame", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
+            { .name = "instrumentation_time_frame", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
 
             { .name = "merge_count_frame", .type = ecs_id(ecs_i64_t) },
             { .name = "systems_ran_frame", .type = ecs_id(ecs_i64_t) },
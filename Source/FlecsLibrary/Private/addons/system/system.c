@@ -330,6 +330,7 @@ ecs_entity_t ecs_system_init(
 
     system->multi_threaded = desc->multi_threaded;
     system->immediate = desc->immediate;
+    system->schedule_by_access = desc->schedule_by_access;
 
     system->name = ecs_get_path(world, entity);
 
@@ -443,6 +444,10 @@ ecs_entity_t ecs_system_update(
         system->immediate = desc->immediate;
     }
 
+    if (desc->schedule_by_access) {
+        system->schedule_by_access = desc->schedule_by_access;
+    }
+
     if (flecs_system_init_timer(world, entity, desc)) {
         return 0;
     }
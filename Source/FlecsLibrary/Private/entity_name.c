@@ -700,6 +700,36 @@ error:
     return 0;
 }
 
+uint64_t ecs_name_hash(
+    const char *name,
+    ecs_size_t length)
+{
+    ecs_check(name != NULL, ECS_INVALID_PARAMETER, NULL);
+    return flecs_hash(name, length);
+error:
+    return 0;
+}
+
+ecs_entity_t ecs_lookup_child_w_hash(
+    const ecs_world_t *world,
+    ecs_entity_t parent,
+    const char *name,
+    ecs_size_t length,
+    uint64_t hash)
+{
+    ecs_check(world != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_check(name != NULL, ECS_INVALID_PARAMETER, NULL);
+    world = ecs_get_world(world);
+
+    if (!length) {
+        return 0;
+    }
+
+    return flecs_lookup_child_n(world, parent, name, length, hash);
+error:
+    return 0;
+}
+
 ecs_entity_t ecs_lookup(
     const ecs_world_t *world,
     const char *path)
@@ -1292,6 +1292,28 @@ uint32_t flecs_get_table_version_fast(
     return world->table_version[table_id & ECS_TABLE_VERSION_ARRAY_BITMASK];
 }
 
+void flecs_instrumentation_begin(
+    ecs_world_t *world,
+    ecs_time_t *t)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    if (world->flags & EcsWorldMeasureFrameTime) {
+        ecs_time_measure(t);
+    }
+}
+
+void flecs_instrumentation_end(
+    ecs_world_t *world,
+    ecs_time_t *t)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    world->info.instrumentation_count_total ++;
+    if (world->flags & EcsWorldMeasureFrameTime) {
+        world->info.instrumentation_time_total += 
+            (ecs_ftime_t)ecs_time_measure(t);
+    }
+}
+
 #ifdef FLECS_EXCLUSIVE_ACCESS
 
 void flecs_check_exclusive_world_access_write(
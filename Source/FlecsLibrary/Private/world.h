@@ -244,6 +244,16 @@ uint32_t flecs_get_table_version_fast(
     const ecs_world_t *world,
     const uint64_t table_id);
 
+/* Start measuring a stats, metrics or alerts collection pass. */
+void flecs_instrumentation_begin(
+    ecs_world_t *world,
+    ecs_time_t *t);
+
+/* Add time spent in collection pass to the instrumentation overhead counter. */
+void flecs_instrumentation_end(
+    ecs_world_t *world,
+    ecs_time_t *t);
+
 /* Throws error when (OnDelete*, Panic) constraint is violated. */
 void flecs_throw_invalid_delete(
     ecs_world_t *world,
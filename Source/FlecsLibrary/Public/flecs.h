@@ -1582,6 +1582,7 @@ typedef struct ecs_world_info_t {
     ecs_ftime_t emit_time_total;      /**< Total time spent notifying observers. */
     ecs_ftime_t merge_time_total;     /**< Total time spent in merges. */
     ecs_ftime_t rematch_time_total;   /**< Time spent on query rematching. */
+    ecs_ftime_t instrumentation_time_total; /**< Time spent collecting stats, metrics and alerts. */
     double world_time_total;          /**< Time elapsed in simulation. */
     double world_time_total_raw;      /**< Time elapsed in simulation (no scaling). */
 
@@ -1598,6 +1599,7 @@ typedef struct ecs_world_info_t {
     int64_t systems_ran_total;        /**< Total number of systems run. */
     int64_t observers_ran_total;      /**< Total number of times an observer was invoked. */
     int64_t queries_ran_total;        /**< Total number of times a query was evaluated. */
+    int64_t instrumentation_count_total; /**< Total number of stats, metrics and alerts collection passes. */
 
     int32_t tag_id_count;             /**< Number of tag (no data) IDs in the world. */
     int32_t component_id_count;       /**< Number of component (data) IDs in the world. */
@@ -3899,6 +3901,45 @@ ecs_entity_t ecs_lookup_child(
     ecs_entity_t parent,
     const char *name);
 
+/** Compute the hash used by the entity name index.
+ * The returned value can be stored alongside a name and passed to
+ * ecs_lookup_child_w_hash() so that repeated lookups of the same name don't
+ * have to rehash the string.
+ *
+ * @param name The name to hash.
+ * @param length The length of the name (excluding the terminator).
+ * @return The name hash.
+ *
+ * @see ecs_lookup_child_w_hash()
+ */
+FLECS_API
+uint64_t ecs_name_hash(
+    const char *name,
+    ecs_size_t length);
+
+/** Look up a child entity by name with a precomputed hash.
+ * Same as ecs_lookup_child(), but the name does not have to be 0-terminated
+ * and the name index hash is provided by the caller. Unlike
+ * ecs_lookup_child(), a parent of 0 always means the root scope.
+ *
+ * @param world The world.
+ * @param parent The parent for which to look up the child.
+ * @param name The entity name.
+ * @param length The length of the name.
+ * @param hash The hash of the name, as returned by ecs_name_hash().
+ * @return The entity with the specified name, or 0 if no entity was found.
+ *
+ * @see ecs_lookup_child()
+ * @see ecs_name_hash()
+ */
+FLECS_API
+ecs_entity_t ecs_lookup_child_w_hash(
+    const ecs_world_t *world,
+    ecs_entity_t parent,
+    const char *name,
+    ecs_size_t length,
+    uint64_t hash);
+
 /** Look up an entity from a path.
  * Look up an entity from a provided path, relative to the provided parent. The
  * operation will use the provided separator to tokenize the path expression. If
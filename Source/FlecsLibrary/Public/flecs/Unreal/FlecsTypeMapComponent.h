@@ -2,16 +2,155 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectBase.h"
 
 #include "FlecsScriptClassComponent.h"
 #include "FlecsScriptEnumComponent.h"
 #include "FlecsScriptStructComponent.h"
 #include "Standard/robin_hood.h"
 
+/**
+ * Direct mapped cache from a reflected type (UScriptStruct, UEnum or UClass) to its component id.
+ * Types are indexed by their UObject index and validated by the serial number of that index, like a weak
+ * object pointer, so a type whose index (and even address) is reused after reinstancing or GC misses the cache.
+ * The page table is sized once from the UObject array capacity and pages are never moved, so lookups from
+ * worker threads can run while types are registered.
+ */
+struct FFlecsTypeIdCache final
+{
+	static constexpr int32 PageBits = 10;
+	static constexpr int32 PageSize = 1 << PageBits;
+	static constexpr int32 PageMask = PageSize - 1;
+
+	struct FEntry
+	{
+		std::atomic<const UObjectBase*> Type = nullptr;
+
+		// Published last, an entry is only read once its serial number matches the live type's
+		std::atomic<int32> SerialNumber = 0;
+
+		std::atomic<flecs::entity_t> Id = 0;
+	}; // struct FEntry
+
+	FFlecsTypeIdCache()
+		: PageCount(FMath::DivideAndRoundUp(GUObjectArray.GetObjectArrayCapacity(), PageSize))
+		, Pages(MakeUnique<std::atomic<FEntry*>[]>(PageCount))
+	{
+	}
+
+	~FFlecsTypeIdCache()
+	{
+		for (int32 PageIndex = 0; PageIndex < PageCount; ++PageIndex)
+		{
+			delete[] Pages[PageIndex].load(std::memory_order_relaxed);
+		}
+	}
+
+	UE_NONCOPYABLE(FFlecsTypeIdCache);
+
+	NO_DISCARD FORCEINLINE flecs::entity_t Find(const UObjectBase* InType) const
+	{
+		const int32 Index = static_cast<int32>(InType->GetUniqueID());
+		const int32 PageIndex = Index >> PageBits;
+
+		if LIKELY_IF(PageIndex < PageCount)
+		{
+			if (const FEntry* Page = Pages[PageIndex].load(std::memory_order_acquire))
+			{
+				const FEntry& Entry = Page[Index & PageMask];
+
+				if LIKELY_IF(Entry.Type.load(std::memory_order_relaxed) == InType)
+				{
+					const int32 SerialNumber = Entry.SerialNumber.load(std::memory_order_acquire);
+					const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(Index);
+
+					if LIKELY_IF(SerialNumber != 0 && ObjectItem && ObjectItem->GetSerialNumber() == SerialNumber)
+					{
+						return Entry.Id.load(std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+
+		return 0;
+	}
+
+	void Add(const UObjectBase* InType, const flecs::entity_t InId)
+	{
+		const int32 Index = static_cast<int32>(InType->GetUniqueID());
+		const int32 PageIndex = Index >> PageBits;
+
+		if UNLIKELY_IF(PageIndex >= PageCount)
+		{
+			return;
+		}
+
+		FEntry* Page = Pages[PageIndex].load(std::memory_order_acquire);
+		if (!Page)
+		{
+			FEntry* NewPage = new FEntry[PageSize];
+			if (Pages[PageIndex].compare_exchange_strong(Page, NewPage, std::memory_order_acq_rel))
+			{
+				Page = NewPage;
+			}
+			else
+			{
+				delete[] NewPage;
+			}
+		}
+
+		FEntry& Entry = Page[Index & PageMask];
+
+		// Readers of the previous type of this index stop matching before the id changes
+		Entry.SerialNumber.store(0, std::memory_order_relaxed);
+		Entry.Type.store(InType, std::memory_order_relaxed);
+		Entry.Id.store(InId, std::memory_order_relaxed);
+		Entry.SerialNumber.store(GUObjectArray.AllocateSerialNumber(Index), std::memory_order_release);
+	}
+
+private:
+	int32 PageCount = 0;
+	TUniquePtr<std::atomic<FEntry*>[]> Pages;
+
+}; // struct FFlecsTypeIdCache
+
 struct FFlecsTypeMapComponent final
 {
+	FORCEINLINE void AddScriptStruct(const UScriptStruct* InScriptStruct, const flecs::entity_t InId) const
+	{
+		ScriptStructMap.emplace(InScriptStruct, InId);
+		TypeIdCache.Add(InScriptStruct, InId);
+	}
+
+	FORCEINLINE void AddScriptClass(const UClass* InScriptClass, const flecs::entity_t InId) const
+	{
+		ScriptClassMap.emplace(InScriptClass, InId);
+		TypeIdCache.Add(InScriptClass, InId);
+	}
+
+	FORCEINLINE void AddScriptEnum(const UEnum* InScriptEnum, const flecs::entity_t InId) const
+	{
+		ScriptEnumMap.emplace(InScriptEnum, InId);
+		TypeIdCache.Add(InScriptEnum, InId);
+	}
+
+	/**
+	 * @brief Get the component id of a registered type without hashing.
+	 * @param InType The UScriptStruct, UEnum or UClass to look up.
+	 * @return The component id, or 0 if the type isn't registered in this world.
+	 */
+	NO_DISCARD FORCEINLINE flecs::entity_t FindTypeId(const UObjectBase* InType) const
+	{
+		return TypeIdCache.Find(InType);
+	}
+
 	mutable robin_hood::unordered_flat_map<FFlecsScriptStructComponent, flecs::entity_t> ScriptStructMap;
 	mutable robin_hood::unordered_flat_map<FFlecsScriptClassComponent, flecs::entity_t> ScriptClassMap;
 	mutable robin_hood::unordered_flat_map<FFlecsScriptEnumComponent, flecs::entity_t> ScriptEnumMap;
+
+	mutable FFlecsTypeIdCache TypeIdCache;
 }; // struct FFlecsTypeMapComponent
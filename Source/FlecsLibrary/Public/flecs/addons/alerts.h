@@ -201,6 +201,32 @@ ecs_entity_t ecs_get_alert(
     ecs_entity_t entity,
     ecs_entity_t alert);
 
+/** Set the interval at which alerts are evaluated.
+ * Alert queries and alert instances are evaluated on a shared timer, which by
+ * default ticks every 0.5 seconds. The duration of active alert instances is
+ * advanced by the time passed since the last evaluation.
+ *
+ * The time spent evaluating alerts is added to
+ * ecs_world_info_t::instrumentation_time_total.
+ *
+ * @param world The world.
+ * @param interval The evaluation interval in seconds (0 = every frame).
+ */
+FLECS_API
+void ecs_alerts_set_interval(
+    ecs_world_t *world,
+    ecs_ftime_t interval);
+
+/** Get the interval at which alerts are evaluated.
+ *
+ * @param world The world.
+ * @return The evaluation interval in seconds.
+ * @see ecs_alerts_set_interval()
+ */
+FLECS_API
+ecs_ftime_t ecs_alerts_get_interval(
+    const ecs_world_t *world);
+
 /** Alert module import function.
  * Usage:
  * @code
@@ -280,7 +280,7 @@ void register_script_struct_component(
         flecs::entity entity_id = flecs::entity(world, component);
                 
         static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-            ->ScriptStructMap.emplace(scriptStruct, entity_id);
+            ->AddScriptStruct(scriptStruct, entity_id);
         
         entity_id.set<FFlecsScriptStructComponent>({ scriptStruct });
     }
@@ -320,7 +320,7 @@ inline void register_script_struct_component<FBox>(
     flecs::entity entity_id = flecs::entity(world, component);
             
     static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-        ->ScriptStructMap.emplace(scriptStruct, entity_id);
+        ->AddScriptStruct(scriptStruct, entity_id);
     
     entity_id.set<FFlecsScriptStructComponent>({ scriptStruct });
     
@@ -340,7 +340,7 @@ inline void register_script_struct_component<FBox>(
         flecs::entity entity_id = flecs::entity(world, component);
             
         static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-            ->ScriptStructMap.emplace(scriptStruct, entity_id);
+            ->AddScriptStruct(scriptStruct, entity_id);
     
         entity_id.set<FFlecsScriptStructComponent>({ scriptStruct });
     
@@ -360,7 +360,7 @@ inline void register_script_struct_component<FBox>(
         flecs::entity entity_id = flecs::entity(world, component);
             
         static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-            ->ScriptStructMap.emplace(scriptStruct, entity_id);
+            ->AddScriptStruct(scriptStruct, entity_id);
     
         entity_id.set<FFlecsScriptStructComponent>({ scriptStruct });
     
@@ -380,7 +380,7 @@ inline void register_script_struct_component<FBox>(
         flecs::entity entity_id = flecs::entity(world, component);
             
         static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-            ->ScriptStructMap.emplace(scriptStruct, entity_id);
+            ->AddScriptStruct(scriptStruct, entity_id);
     
         entity_id.set<FFlecsScriptStructComponent>({ scriptStruct });
     
@@ -403,7 +403,7 @@ void register_script_class_component(
         flecs::entity entity_id = flecs::entity(world, component);
                 
         static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-            ->ScriptClassMap.emplace(scriptClass, entity_id);
+            ->AddScriptClass(scriptClass, entity_id);
                 
         entity_id.set<FFlecsScriptClassComponent>({ scriptClass });
     }
@@ -424,7 +424,7 @@ void register_enum_component(
     
     flecs::entity entity_id = flecs::entity(world, component);
     static_cast<FFlecsTypeMapComponent*>(P_world.get_binding_ctx())
-        ->ScriptEnumMap.emplace(scriptEnum, entity_id);
+        ->AddScriptEnum(scriptEnum, entity_id);
     
     entity_id.set<FFlecsScriptEnumComponent>({ scriptEnum });
 #endif   
@@ -46,7 +46,7 @@ inline void world::init_builtin_components() {
     
     ecs_assert(ScriptStructEntity.is_valid(), ECS_INTERNAL_ERROR, NULL);
 
-    type_map->ScriptStructMap.emplace(FFlecsScriptStructComponent::StaticStruct(), ScriptStructEntity);
+    type_map->AddScriptStruct(FFlecsScriptStructComponent::StaticStruct(), ScriptStructEntity);
 
     flecs::entity ScriptEnumEntity = this->component<FFlecsScriptEnumComponent>()
         .add(flecs::OnInstantiate, flecs::DontInherit)
@@ -141,6 +141,11 @@ struct id {
     /** Get the world. */
     flecs::world world() const;
 
+    /** Get the world (or stage) pointer without claiming a reference. */
+    flecs::world_t* raw_world() const {
+        return world_;
+    }
+
 protected:
     /** World is optional, but guarantees that entity identifiers extracted from
      * the ID are valid. */
@@ -72,6 +72,16 @@ public:
         return *this;
     }
 
+    /** Specify whether the system should be scheduled by the access of its
+     * query terms. Systems that don't conflict run concurrently.
+     *
+     * @param value If false, the system runs in pipeline order.
+     */
+    Base& schedule_by_access(bool value = true) {
+        desc_->schedule_by_access = value;
+        return *this;
+    }
+
     /** Set the system interval.
      * This operation will cause the system to be run at the specified interval.
      *
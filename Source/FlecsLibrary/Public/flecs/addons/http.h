@@ -7,12 +7,18 @@
  * Flecs application (for example, with a web-based UI) and request and visualize
  * data from the ECS world.
  *
- * Each server instance creates a single thread used for receiving requests.
- * Received requests are enqueued and handled when the application calls
- * ecs_http_server_dequeue(). This increases the latency of request handling vs.
- * responding directly in the receive thread, but is better suited for
- * retrieving data from ECS applications, as requests can be processed by an ECS
- * system without having to lock the world.
+ * Each server instance creates a thread that accepts connections and waits for
+ * incoming data, and a pool of worker threads that receive and parse requests
+ * and send replies. Received requests are enqueued and handled when the
+ * application calls ecs_http_server_dequeue(). This increases the latency of
+ * request handling vs. responding directly in a worker thread, but is better
+ * suited for retrieving data from ECS applications, as requests can be
+ * processed by an ECS system without having to lock the world.
+ *
+ * Connections are kept alive between requests, and clients may pipeline
+ * requests on a connection. Replies are sent in the order in which requests
+ * were received. Replies larger than the configured compression threshold are
+ * compressed (gzip or deflate) on the worker threads if the client accepts it.
  *
  * This server is intended to be used in a development environment.
  */
@@ -94,11 +100,12 @@ typedef struct {
     const char* status;         /**< default = OK. */
     const char* content_type;   /**< default = application/json. */
     ecs_strbuf_t headers;       /**< default = "". */
+    bool no_cache;              /**< default = false, set by stateful endpoints whose replies can't be reused. */
 } ecs_http_reply_t;
 
 /** Default initializer for ecs_http_reply_t. */
 #define ECS_HTTP_REPLY_INIT \
-    (ecs_http_reply_t){200, ECS_STRBUF_INIT, "OK", "application/json", ECS_STRBUF_INIT}
+    (ecs_http_reply_t){200, ECS_STRBUF_INIT, "OK", "application/json", ECS_STRBUF_INIT, false}
 
 /** Global HTTP statistics. */
 extern int64_t ecs_http_request_received_count;       /**< Total number of HTTP requests received. */
@@ -126,9 +133,12 @@ typedef struct {
     void *ctx;                        /**< Passed to callback (optional). */
     uint16_t port;                    /**< HTTP port. */
     const char *ipaddr;               /**< Interface to listen on (optional). */
-    int32_t send_queue_wait_ms;       /**< Send queue wait time when empty. */
+    int32_t send_queue_wait_ms;       /**< Max time (ms) the connection thread waits when idle (default = 50). */
     double cache_timeout;             /**< Cache invalidation timeout (0 disables caching). */
     double cache_purge_timeout;       /**< Cache purge timeout (for purging cache entries). */
+    int32_t worker_count;             /**< Number of threads that receive & send (default = 4). */
+    double keep_alive_timeout;        /**< Time (s) before an idle connection is closed (default = 5). */
+    int32_t compression_threshold;    /**< Min reply size for gzip/deflate compression (0 disables compression). */
 } ecs_http_server_desc_t;
 
 /** Create a server.
@@ -160,6 +170,17 @@ FLECS_API
 int ecs_http_server_start(
     ecs_http_server_t* server);
 
+/** Get the port a server is listening on.
+ * If the port passed to ecs_http_server_init() was in use, the server listens on
+ * the next available port after ecs_http_server_start() is called.
+ *
+ * @param server The server.
+ * @return The port.
+ */
+FLECS_API
+uint16_t ecs_http_server_get_port(
+    const ecs_http_server_t* server);
+
 /** Process server requests.
  * This operation invokes the reply callback for each received request. No new
  * requests will be enqueued while processing requests.
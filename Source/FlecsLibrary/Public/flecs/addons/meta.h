@@ -595,11 +595,15 @@ typedef struct ecs_meta_op_t {
     } is;
 } ecs_meta_op_t;
 
+/** Compiled serialization plan (see EcsTypeSerializer::plan). */
+typedef struct ecs_meta_plan_t ecs_meta_plan_t;
+
 /** Component that stores the type serializer.
  * Added to all types with reflection data. */
 typedef struct EcsTypeSerializer {
     ecs_type_kind_t kind;         /**< Quick access to type kind (same as EcsType). */
     ecs_vec_t ops;                /**< vector<ecs_meta_op_t> */
+    ecs_meta_plan_t *plan;        /**< Flattened ops for types without collections (may be NULL). */
 } EcsTypeSerializer;
 
 
@@ -1062,6 +1066,59 @@ ecs_size_t ecs_meta_op_get_elem_count(
     const ecs_meta_op_t *op,
     const void *ptr);
 
+/* Packed (binary) serialization of plain data types. */
+
+/** Get the packed size of a type.
+ * A type can be packed if its reflection data only contains (nested) structs,
+ * fixed size arrays and numeric, boolean, enum or bitmask members. The packed
+ * representation contains the reflected members in offset order without
+ * padding, which for most math types is the same as the in-memory layout.
+ * 
+ * @param world The world.
+ * @param type The type.
+ * @return The packed size of a single value, or -1 if the type can't be packed.
+ */
+FLECS_API
+ecs_size_t ecs_meta_packed_size(
+    const ecs_world_t *world,
+    ecs_entity_t type);
+
+/** Pack an array of values.
+ * The output buffer must be at least ecs_meta_packed_size() * count bytes.
+ * 
+ * @param world The world.
+ * @param type The type of the values.
+ * @param ptr Pointer to the first value.
+ * @param count The number of values.
+ * @param out The output buffer.
+ * @return Zero if success, non-zero if the type can't be packed.
+ */
+FLECS_API
+int ecs_meta_pack(
+    const ecs_world_t *world,
+    ecs_entity_t type,
+    const void *ptr,
+    int32_t count,
+    void *out);
+
+/** Unpack an array of values.
+ * Only the reflected members of the values are written.
+ * 
+ * @param world The world.
+ * @param type The type of the values.
+ * @param ptr Pointer to the first (constructed) value.
+ * @param count The number of values.
+ * @param data The packed data, as produced by ecs_meta_pack().
+ * @return Zero if success, non-zero if the type can't be packed.
+ */
+FLECS_API
+int ecs_meta_unpack(
+    const ecs_world_t *world,
+    ecs_entity_t type,
+    void *ptr,
+    int32_t count,
+    const void *data);
+
 /* Utility functions for working with enum and bitmask types. */
 
 /** Find the entity for an enum constant with the provided value.
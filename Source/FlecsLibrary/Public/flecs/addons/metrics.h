@@ -31,6 +31,10 @@
 #define FLECS_PIPELINE
 #endif
 
+#ifndef FLECS_TIMER
+#define FLECS_TIMER
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -101,6 +105,13 @@ typedef struct ecs_metric_desc_t {
     /** Must be EcsGauge, EcsCounter, EcsCounterIncrement, or EcsCounterId. */
     ecs_entity_t kind;
 
+    /** Only resample a member metric when the column of the monitored
+     * component was marked dirty since the last sample, using the same change
+     * detection as queries (see ecs_query_changed()). Components must be
+     * written with ecs_set(), ecs_modified(), or by systems with [out]
+     * access for changes to be picked up. Ignored for other metric kinds. */
+    bool change_detection;
+
     /** Description of metric. Will only be set if FLECS_DOC addon is enabled. */
     const char *brief;
 } ecs_metric_desc_t;
@@ -163,6 +174,33 @@ ecs_entity_t ecs_metric_init(
 #define ecs_metric(world, ...)\
     ecs_metric_init(world, &(ecs_metric_desc_t) __VA_ARGS__ )
 
+/** Set the interval at which metrics are sampled.
+ * Metric instances are updated in a single pass that runs on a shared timer.
+ * By default metrics are sampled every frame. Counter metrics are advanced by
+ * the (scaled) time passed since the last sample, so their values stay
+ * correct with any interval.
+ *
+ * The time spent updating metrics is added to
+ * ecs_world_info_t::instrumentation_time_total.
+ *
+ * @param world The world.
+ * @param interval The sampling interval in seconds (0 = every frame).
+ */
+FLECS_API
+void ecs_metrics_set_interval(
+    ecs_world_t *world,
+    ecs_ftime_t interval);
+
+/** Get the interval at which metrics are sampled.
+ *
+ * @param world The world.
+ * @return The sampling interval in seconds.
+ * @see ecs_metrics_set_interval()
+ */
+FLECS_API
+ecs_ftime_t ecs_metrics_get_interval(
+    const ecs_world_t *world);
+
 /** Metrics module import function.
  * Usage:
  * @code
@@ -210,6 +210,66 @@ void ecs_run_pipeline(
     ecs_entity_t pipeline,
     ecs_ftime_t delta_time);
 
+/** Prepare the schedule of a pipeline.
+ * Rebuilds the schedule if systems were added to or removed from the pipeline
+ * since it was last built, so that it can be run with 
+ * ecs_run_pipeline_readonly(). This operation must not be invoked while the
+ * world is in readonly mode.
+ *
+ * If 0 is provided for the pipeline ID, the default pipeline is used.
+ *
+ * @param world The world.
+ * @param pipeline The pipeline to prepare.
+ */
+FLECS_API
+void ecs_pipeline_prepare(
+    ecs_world_t *world,
+    ecs_entity_t pipeline);
+
+/** Run pipeline on a stage while the world is in readonly mode.
+ * This runs the systems of the pipeline in schedule order on the calling 
+ * thread. Unlike ecs_run_pipeline(), sync points are not honored: all commands
+ * are enqueued on the provided stage, and are merged when the world leaves
+ * readonly mode. This makes it possible for multiple threads to run pipelines
+ * at the same time, each on their own stage (see ecs_stage_new()).
+ *
+ * The schedule is not rebuilt by this operation, use ecs_pipeline_prepare()
+ * before entering readonly mode. Pipelines with immediate systems can't be
+ * run in readonly mode.
+ *
+ * @param stage The stage.
+ * @param pipeline The pipeline to run.
+ * @param delta_time The delta_time to pass to systems.
+ * @return Whether the pipeline ran, false if it was never prepared.
+ */
+FLECS_API
+bool ecs_run_pipeline_readonly(
+    ecs_world_t *stage,
+    ecs_entity_t pipeline,
+    ecs_ftime_t delta_time);
+
+/** Get the schedule of a pipeline as a graphviz (dot) string.
+ * Each sync point of the pipeline is drawn as a cluster, with the systems in
+ * the order in which they run. For sync points with systems that are scheduled
+ * by access (see ecs_system_desc_t::schedule_by_access) the graph contains an
+ * edge for each pair of systems that access the same component, and systems 
+ * without a path between them run concurrently. When the world measures 
+ * system time, nodes are annotated with the total time spent in the system.
+ *
+ * The schedule is only up to date after the pipeline has run.
+ *
+ * If 0 is provided for the pipeline ID, the default pipeline is used.
+ *
+ * @param world The world.
+ * @param pipeline The pipeline.
+ * @return The dot string, or NULL if the entity is not a pipeline. Must be 
+ *         freed with ecs_os_free().
+ */
+FLECS_API
+char* ecs_pipeline_schedule_to_dot(
+    const ecs_world_t *world,
+    ecs_entity_t pipeline);
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //// Threading
@@ -43,6 +43,9 @@ extern "C" {
 /** Default port for the REST API server. */
 #define ECS_REST_DEFAULT_PORT (27750)
 
+/** Minimum reply size (bytes) compressed by the REST API server. */
+#define ECS_REST_COMPRESSION_THRESHOLD (16 * 1024)
+
 /** Component that instantiates the REST API. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsRest);
 
@@ -53,6 +56,7 @@ typedef struct {
     int32_t rc;                    /**< Reference count. */
     ecs_map_t cmd_captures;        /**< Map of command captures. */
     double last_time;              /**< Last processing time. */
+    struct ecs_rest_delta_t *delta; /**< State for the incremental endpoint. */
 } ecs_rest_ctx_t;
 
 /** Component that creates a REST API server when instantiated. */
@@ -129,6 +129,7 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t emit_time;            /**< Time spent on notifying observers. */
         ecs_metric_t merge_time;           /**< Time spent on merging commands. */
         ecs_metric_t rematch_time;         /**< Time spent on rematching. */
+        ecs_metric_t instrumentation_time; /**< Time spent collecting stats, metrics and alerts. */
         ecs_metric_t fps;                  /**< Frames per second. */
         ecs_metric_t delta_time;           /**< Delta time. */
     } performance;
@@ -473,6 +474,7 @@ typedef struct {
     double frame_time_total;    /**< Total time spent processing a frame. */
     double system_time_total;   /**< Total time spent in systems. */
     double merge_time_total;    /**< Total time spent in merges. */
+    double instrumentation_time_total; /**< Total time spent collecting stats, metrics and alerts. */
 
     int64_t entity_count;       /**< Number of entities. */
     int64_t table_count;        /**< Number of tables. */
@@ -492,6 +494,7 @@ typedef struct {
     double frame_time_frame;    /**< Time spent processing a frame. */
     double system_time_frame;   /**< Time spent in systems. */
     double merge_time_frame;    /**< Time spent in merges. */
+    double instrumentation_time_frame; /**< Time spent collecting stats, metrics and alerts. */
 
     int64_t merge_count_frame;   /**< Number of merges in last frame. */
     int64_t systems_ran_frame;   /**< Number of systems run in last frame. */
@@ -739,6 +742,32 @@ FLECS_API
 ecs_size_t ecs_memory_get(
     const ecs_world_t *world);
 
+/** Set the interval at which world, pipeline and system stats are sampled.
+ * By default stats are sampled every frame. A larger interval reduces the
+ * overhead of the stats addon at the cost of resolution. Sampled values are
+ * repeated for the frames in between samples, so the 1s/1m/1h/1d/1w periods
+ * stay aligned with real time.
+ *
+ * The time spent collecting stats is added to
+ * ecs_world_info_t::instrumentation_time_total.
+ *
+ * @param world The world.
+ * @param interval The sampling interval in seconds (0 = every frame).
+ */
+FLECS_API
+void ecs_stats_set_interval(
+    ecs_world_t *world,
+    ecs_ftime_t interval);
+
+/** Get the interval at which stats are sampled.
+ *
+ * @param world The world.
+ * @return The sampling interval in seconds.
+ * @see ecs_stats_set_interval()
+ */
+FLECS_API
+ecs_ftime_t ecs_stats_get_interval(
+    const ecs_world_t *world);
 
 /** Stats module import function.
  * Usage:
@@ -99,6 +99,15 @@ typedef struct ecs_system_desc_t {
     /** If true, the system will have access to the actual world. Cannot be true at the
      * same time as multi_threaded. */
     bool immediate;
+
+    /** If true, the pipeline schedules the system by the component access of
+     * its query terms. Adjacent systems with this flag are placed in the same
+     * sync point, and systems that don't read/write the same components run at
+     * the same time on the worker threads. Systems that do conflict run in the
+     * order in which they were declared. Systems without query terms don't
+     * declare their access, and are ordered against every other system.
+     * Ignored for immediate systems. */
+    bool schedule_by_access;
 } ecs_system_desc_t;
 
 /** Create a system.
@@ -163,6 +172,9 @@ typedef struct ecs_system_t {
     /** Whether the system is run in immediate mode. */
     bool immediate;
 
+    /** Whether the system is scheduled by the access of its query terms. */
+    bool schedule_by_access;
+
     /** Cached system name (for perf tracing). */
     const char *name;
 
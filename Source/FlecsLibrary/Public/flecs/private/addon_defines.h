@@ -136,6 +136,12 @@
 #endif
 #endif
 
+#ifdef FLECS_METRICS
+#ifndef FLECS_TIMER
+#define FLECS_TIMER
+#endif
+#endif
+
 #ifdef FLECS_JOURNAL
 #ifndef FLECS_LOG
 #define FLECS_LOG
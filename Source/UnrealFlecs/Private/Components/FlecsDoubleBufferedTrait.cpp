@@ -0,0 +1,5 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Components/FlecsDoubleBufferedTrait.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsDoubleBufferedTrait)
@@ -8,6 +8,34 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsCommonHandle)
 
+namespace
+{
+	/**
+	 * Resolves a reflected type through the per world type id cache. This skips resolving the UFlecsWorld,
+	 * which is only validated in builds with checks enabled.
+	 */
+	NO_DISCARD FORCEINLINE flecs::entity_t FindCachedTypeId(const flecs::entity& InEntity, const UObjectBase* InType)
+	{
+		const flecs::world_t* NativeWorld = InEntity.raw_world();
+		if UNLIKELY_IF(!NativeWorld)
+		{
+			return 0;
+		}
+
+		const FFlecsTypeMapComponent* TypeMap = static_cast<const FFlecsTypeMapComponent*>(
+			ecs_get_binding_ctx(NativeWorld));
+		if UNLIKELY_IF(!TypeMap)
+		{
+			return 0;
+		}
+
+		const flecs::entity_t TypeId = TypeMap->FindTypeId(InType);
+		solid_checkf(!TypeId || ecs_is_alive(NativeWorld, TypeId), TEXT("Entity is not alive"));
+		return TypeId;
+	}
+	
+} // namespace
+
 FFlecsCommonHandle::FFlecsCommonHandle(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, const FFlecsId InEntity)
 {
 	SetEntity(flecs::entity(InWorld->GetNativeFlecsWorld(), InEntity));
@@ -53,16 +81,38 @@ TSolidNotNull<UWorld*> FFlecsCommonHandle::GetOuterWorld() const
 
 FFlecsId FFlecsCommonHandle::ObtainComponentTypeStruct(const TSolidNotNull<const UScriptStruct*> StructType) const
 {
+	solid_checkf(IsUnrealFlecsWorld(), TEXT("Entity is not in an Unreal Flecs World"));
+	
+	if (const flecs::entity_t TypeId = FindCachedTypeId(Entity, StructType))
+	{
+		return TypeId;
+	}
+	
 	return GetFlecsWorldChecked()->GetScriptStructEntity(StructType);
 }
 
 FFlecsId FFlecsCommonHandle::ObtainComponentTypeEnum(const TSolidNotNull<const UEnum*> EnumType) const
 {
+	solid_checkf(IsUnrealFlecsWorld(), TEXT("Entity is not in an Unreal Flecs World"));
+	
+	if (const flecs::entity_t TypeId = FindCachedTypeId(Entity, EnumType))
+	{
+		return TypeId;
+	}
+	
 	return GetFlecsWorldChecked()->GetScriptEnumEntity(EnumType);
 }
 
 FFlecsId FFlecsCommonHandle::ObtainTypeClass(const TSolidNotNull<UClass*> ClassType) const
 {
+	solid_checkf(IsUnrealFlecsWorld(), TEXT("Entity is not in an Unreal Flecs World"));
+	
+	if (const flecs::entity_t TypeId = FindCachedTypeId(Entity, ClassType))
+	{
+		return TypeId;
+	}
+	
+	// Registers the class on first use
 	return GetFlecsWorldChecked()->ObtainTypedEntity(ClassType);
 }
 
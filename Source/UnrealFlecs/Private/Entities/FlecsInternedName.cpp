@@ -0,0 +1,186 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Entities/FlecsInternedName.h"
+
+#include <string>
+
+#include "Standard/robin_hood.h"
+
+namespace
+{
+	/**
+	 * Flecs names are case-sensitive while FName is not, so the table is keyed by the exact ANSI string.
+	 * Node storage keeps entry addresses stable for the lifetime of the process.
+	 */
+	struct FFlecsNameInternTable
+	{
+		FRWLock Lock;
+		robin_hood::unordered_node_map<std::string, FFlecsInternedNameEntry> Entries;
+	}; // struct FFlecsNameInternTable
+
+	NO_DISCARD FFlecsNameInternTable& GetNameInternTable()
+	{
+		static FFlecsNameInternTable Table;
+		return Table;
+	}
+
+	NO_DISCARD const FFlecsInternedNameEntry* FindOrAddInternedEntry(const FAnsiStringView InName)
+	{
+		FFlecsNameInternTable& Table = GetNameInternTable();
+		std::string Key(InName.GetData(), InName.Len());
+
+		{
+			FReadScopeLock ReadLock(Table.Lock);
+
+			const auto It = Table.Entries.find(Key);
+			if LIKELY_IF(It != Table.Entries.end())
+			{
+				return &It->second;
+			}
+		}
+
+		FWriteScopeLock WriteLock(Table.Lock);
+
+		auto [It, bInserted] = Table.Entries.try_emplace(MoveTemp(Key));
+		FFlecsInternedNameEntry& Entry = It->second;
+
+		if (bInserted)
+		{
+			Entry.Name = FName(InName.Len(), InName.GetData());
+			Entry.AnsiName.Reserve(InName.Len() + 1);
+			Entry.AnsiName.Append(InName.GetData(), InName.Len());
+			Entry.AnsiName.Add('\0');
+			Entry.NameHash = ecs_name_hash(Entry.GetData(), Entry.Len());
+		}
+
+		return &Entry;
+	}
+
+} // namespace
+
+FFlecsInternedName FFlecsInternedName::Intern(const FName& InName)
+{
+	if (InName.IsNone())
+	{
+		return FFlecsInternedName();
+	}
+
+	TStringBuilder<NAME_SIZE> Builder;
+	InName.AppendString(Builder);
+	return Intern(Builder.ToView());
+}
+
+FFlecsInternedName FFlecsInternedName::Intern(const FStringView InName)
+{
+	const auto AnsiName = StringCast<ANSICHAR>(InName.GetData(), InName.Len());
+	return Intern(FAnsiStringView(AnsiName.Get(), AnsiName.Length()));
+}
+
+FFlecsInternedName FFlecsInternedName::Intern(const FAnsiStringView InName)
+{
+	if (InName.IsEmpty())
+	{
+		return FFlecsInternedName();
+	}
+
+	return FFlecsInternedName(FindOrAddInternedEntry(InName));
+}
+
+bool FFlecsInternedName::MatchesNativeName(const char* InNativeName) const
+{
+	if (!Entry)
+	{
+		return InNativeName == nullptr || InNativeName[0] == '\0';
+	}
+
+	if (!InNativeName)
+	{
+		return false;
+	}
+
+	return FCStringAnsi::Strncmp(InNativeName, Entry->GetData(), Entry->Len()) == 0
+		&& InNativeName[Entry->Len()] == '\0';
+}
+
+FFlecsInternedPath::FFlecsInternedPath(const FString& InPath, const FString& InSeparator)
+{
+	solid_checkf(!InSeparator.IsEmpty(), TEXT("Separator must not be empty"));
+
+	const auto AnsiPath = StringCast<ANSICHAR>(*InPath);
+	const auto AnsiSeparator = StringCast<ANSICHAR>(*InSeparator);
+
+	const FAnsiStringView PathView(AnsiPath.Get(), AnsiPath.Length());
+	const FAnsiStringView SeparatorView(AnsiSeparator.Get(), AnsiSeparator.Length());
+
+	int32 Start = PathView.StartsWith(SeparatorView) ? SeparatorView.Len() : 0;
+
+	while (Start <= PathView.Len())
+	{
+		int32 End = PathView.Len();
+
+		const int32 Found = PathView.RightChop(Start).Find(SeparatorView);
+		if (Found != INDEX_NONE)
+		{
+			End = Start + Found;
+		}
+
+		if (End > Start)
+		{
+			Elements.Add(FFlecsInternedName::Intern(PathView.Mid(Start, End - Start)));
+		}
+
+		Start = End + SeparatorView.Len();
+	}
+
+	RecalculatePathHash();
+}
+
+FFlecsInternedPath::FFlecsInternedPath(const FFlecsInternedName& InName)
+{
+	if (!InName.IsNone())
+	{
+		Elements.Add(InName);
+	}
+
+	RecalculatePathHash();
+}
+
+FFlecsInternedPath::FFlecsInternedPath(const TConstArrayView<FFlecsInternedName> InElements)
+{
+	Elements.Reserve(InElements.Num());
+
+	for (const FFlecsInternedName& Element : InElements)
+	{
+		solid_checkf(!Element.IsNone(), TEXT("Interned path elements must not be None"));
+		Elements.Add(Element);
+	}
+
+	RecalculatePathHash();
+}
+
+FString FFlecsInternedPath::ToString(const FString& InSeparator) const
+{
+	TStringBuilder<256> Builder;
+
+	for (int32 Index = 0; Index < Elements.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Builder << InSeparator;
+		}
+
+		Builder << Elements[Index].GetData();
+	}
+
+	return Builder.ToString();
+}
+
+void FFlecsInternedPath::RecalculatePathHash()
+{
+	PathHash = 0;
+
+	for (const FFlecsInternedName& Element : Elements)
+	{
+		PathHash = (PathHash ^ Element.GetNameHash()) * 1099511628211ULL;
+	}
+}
@@ -90,7 +90,7 @@ void UFlecsObserverObject::InitializeObserver(const TSolidNotNull<UFlecsWorldInt
 		
 		if (InIterator.world().is_stage())
 		{
-			IteratorWorld = GetFlecsWorld()->GetStage(InIterator.world().get_stage_id());
+			IteratorWorld = GetFlecsWorld()->GetStage(InIterator.world());
 		}
 		else
 		{
@@ -4,6 +4,9 @@
 
 #include "Logs/FlecsCategories.h"
 
+#include "Components/FlecsDoubleBufferedTrait.h"
+#include "Components/FlecsPreviousFrame.h"
+
 #include "Pipelines/FlecsOutsideMainLoopTag.h"
 #include "Pipelines/FlecsTickTypeNativeTags.h"
 
@@ -51,6 +54,20 @@ void UFlecsDefaultGameLoop::InitializeGameLoop(TSolidNotNull<UFlecsWorld*> InWor
 	PostPhysicsPipeline = CreatePipelineForTickType(FlecsTickType_PostPhysics, InWorld);
 
 	PostUpdateWorkPipeline = CreatePipelineForTickType(FlecsTickType_PostUpdateWork, InWorld);
+
+	if (bCommitDoubleBufferedComponents)
+	{
+		// Components can be registered before or after the game loop is initialized
+		DoubleBufferedComponentObserver = InWorld->CreateObserver(TEXT("DoubleBufferedComponentObserver"))
+			.Event(flecs::OnAdd)
+			.With<FFlecsDoubleBufferedTrait>() // 0
+			.YieldExisting()
+			.each([this, InWorld](flecs::entity InComponent)
+			{
+				const FFlecsSystemHandle CommitSystem = CreateDoubleBufferCommitSystem(InComponent.id(), InWorld);
+				solid_check(CommitSystem.IsValid());
+			});
+	}
 }
 
 bool UFlecsDefaultGameLoop::Progress(const double DeltaTime, const FGameplayTag& InTickType, const TSolidNotNull<UFlecsWorld*> InWorld)
@@ -137,3 +154,62 @@ FFlecsPipelineHandle UFlecsDefaultGameLoop::CreatePipelineForTickType(const FGam
 	return ResultPipeline;
 }
 
+FFlecsSystemHandle UFlecsDefaultGameLoop::CreateDoubleBufferCommitSystem(const FFlecsId InComponent,
+	const TSolidNotNull<UFlecsWorld*> InWorld) const
+{
+	const FFlecsId PreviousFrame = InWorld->GetScriptStructEntity<FFlecsPreviousFrame>();
+
+	// Named by component id, structs with the same name in different packages would collide otherwise
+	const FString SystemName = FString::Printf(TEXT("DoubleBufferCommit_%llu"), InComponent.GetId());
+
+	// Reads the live component and writes the pair, so the access schedule orders it after the simulation systems
+	// writing the component and the systems reading the pair, without ordering those two against each other
+	return InWorld->CreateSystem(SystemName)
+		.Phase(DoubleBufferCommitPhase)
+		.ScheduleByAccess()
+		.With(InComponent).In() // 0
+		.WithPair(PreviousFrame, InComponent).Out().Optional() // 1
+		.run([InComponent, PreviousFrame](flecs::iter& InIterator)
+		{
+			const ecs_type_info_t* TypeInfo = ecs_get_type_info(InIterator.world(), InComponent);
+			solid_cassumef(TypeInfo != nullptr && TypeInfo->size > 0,
+				TEXT("Double buffered component %llu has no value to commit"), InComponent.GetId());
+
+			const ecs_size_t Size = TypeInfo->size;
+			const flecs::id_t PreviousFramePair = ecs_pair(PreviousFrame.GetId(), InComponent.GetId());
+
+			while (InIterator.next())
+			{
+				// Inherited values are committed on the entity that owns them
+				if (!InIterator.is_self(0))
+				{
+					continue;
+				}
+
+				const void* Live = ecs_field_w_size(InIterator.c_ptr(), Size, 0);
+
+				if LIKELY_IF(InIterator.is_set(1) && InIterator.is_self(1))
+				{
+					void* Previous = ecs_field_w_size(InIterator.c_ptr(), Size, 1);
+
+					if (TypeInfo->hooks.copy)
+					{
+						TypeInfo->hooks.copy(Previous, Live, InIterator.count(), TypeInfo);
+					}
+					else
+					{
+						FMemory::Memcpy(Previous, Live, Size * InIterator.count());
+					}
+				}
+				else
+				{
+					// First commit for these entities, they move to a table with the pair when the commands are merged
+					for (const size_t Index : InIterator)
+					{
+						ecs_set_id(InIterator.world(), InIterator.entity(Index), PreviousFramePair, Size,
+							ECS_ELEM(Live, Size, Index));
+					}
+				}
+			}
+		});
+}
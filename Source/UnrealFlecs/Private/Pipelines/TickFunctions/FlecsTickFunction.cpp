@@ -19,7 +19,7 @@ void FFlecsTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, EName
 		return;
 	}
 	
-	OwningWorld->ProgressGameLoops(TickTypeTag, DeltaTime);
+	OwningWorld->ProgressGameLoops(TickTypeTag, DeltaTime, WorldAccess);
 }
 
 FString FFlecsTickFunction::DiagnosticMessage()
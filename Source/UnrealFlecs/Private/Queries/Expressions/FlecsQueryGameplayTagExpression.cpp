@@ -0,0 +1,26 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Queries/Expressions/FlecsQueryGameplayTagExpression.h"
+
+#include "Queries/FlecsQueryBuilderView.h"
+#include "Worlds/FlecsWorldInterfaceObject.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsQueryGameplayTagExpression)
+
+FFlecsQueryGameplayTagExpression::FFlecsQueryGameplayTagExpression() : Super(true /* bInAllowsChildExpressions */)
+{
+}
+
+void FFlecsQueryGameplayTagExpression::Apply(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld,
+	FFlecsQueryBuilderView& InQueryBuilder) const
+{
+	solid_checkf(GameplayTag.IsValid(), TEXT("Gameplay tag query expression requires a valid tag"));
+	
+	// Leaving the traversal flags of the first term ref unset lets flecs walk the IsA hierarchy of the tag entity
+	InQueryBuilder.term();
+	InQueryBuilder.first(InWorld->GetTagEntity(GameplayTag).GetFlecsId());
+	InQueryBuilder.oper(ToFlecsOperator(Operator));
+	InQueryBuilder.src();
+	
+	Super::Apply(InWorld, InQueryBuilder);
+}
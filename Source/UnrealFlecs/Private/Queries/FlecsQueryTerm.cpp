@@ -23,6 +23,13 @@ void FFlecsQueryTerm::ApplyToQueryBuilder(const TSolidNotNull<const UFlecsWorldI
 		if (bIsPair || !TermId.IsPair())
 		{
 			InQueryBuilder.first(TermRef.Get<FFlecsId>());
+
+			// Tag entities inherit from their parent tags, a regular term only matches the exact tag
+			// @see FFlecsQueryGameplayTagExpression for matching child tags
+			if (Input.First.GetPtr<FFlecsQueryGeneratorInputType_GameplayTag>())
+			{
+				InQueryBuilder.self();
+			}
 		}
 		else
 		{
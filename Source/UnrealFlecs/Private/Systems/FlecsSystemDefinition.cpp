@@ -23,6 +23,7 @@ void FFlecsSystemDefinition::ApplyToSystem(const TSolidNotNull<const UFlecsWorld
 	
 	InSystemBuilder._internal_get_desc()->multi_threaded = bMultiThreaded;
 	InSystemBuilder._internal_get_desc()->immediate = bImmediate;
+	InSystemBuilder._internal_get_desc()->schedule_by_access = bScheduleByAccess;
 
 	InSystemBuilder._internal_get_desc()->callback = callback;
 	InSystemBuilder._internal_get_desc()->run = run;
@@ -90,6 +90,11 @@ void UFlecsSystemObject::ApplySystemDefinitionOverrides(FFlecsSystemDefinition&
 		InOutDefinition.bImmediate = SystemDefinitionOverrides.ImmediateOverride.GetValue();
 	}
 	
+	if (SystemDefinitionOverrides.ScheduleByAccessOverride.IsSet())
+	{
+		InOutDefinition.bScheduleByAccess = SystemDefinitionOverrides.ScheduleByAccessOverride.GetValue();
+	}
+	
 	if (SystemDefinitionOverrides.PipelineInputOverride.IsSet())
 	{
 		InOutDefinition.PipelineInput = SystemDefinitionOverrides.PipelineInputOverride.GetValue();
@@ -110,7 +115,7 @@ void UFlecsSystemObject::InitializeSystem(const TSolidNotNull<const UFlecsWorldI
 		
 		if (InIterator.world().is_stage())
 		{
-			IteratorWorld = GetFlecsWorld()->GetStage(InIterator.world().get_stage_id());
+			IteratorWorld = GetFlecsWorld()->GetStage(InIterator.world());
 		}
 		else
 		{
@@ -0,0 +1,135 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Worlds/FlecsGameplayTagEntityIndex.h"
+
+#include "GameplayTagsManager.h"
+
+#include "Entities/FlecsStablePathTag.h"
+
+void FFlecsGameplayTagEntityIndex::Initialize(const flecs::entity_t InRootEntity, const bool bInLazy)
+{
+	Entries.Reset();
+	RootEntity = InRootEntity;
+	Count = 0;
+	bLazy = bInLazy;
+}
+
+void FFlecsGameplayTagEntityIndex::RegisterAllTags(flecs::world_t* InWorld)
+{
+	solid_cassume(InWorld != nullptr);
+	solid_checkf(RootEntity != 0, TEXT("Tag entity index must be initialized before registering tags"));
+
+	// Sorted by net index, which also means every tag is visited without a lookup by name
+	const TArray<TSharedPtr<FGameplayTagNode>>& Nodes = UGameplayTagsManager::Get().GetNetworkGameplayTagNodeIndex();
+	Entries.SetNum(Nodes.Num());
+
+	ecs_defer_begin(InWorld);
+
+	for (const TSharedPtr<FGameplayTagNode>& Node : Nodes)
+	{
+		if (Node.IsValid())
+		{
+			CreateTagEntity(InWorld, *Node);
+		}
+	}
+
+	ecs_defer_end(InWorld);
+}
+
+flecs::entity_t FFlecsGameplayTagEntityIndex::Find(const FGameplayTag& InTag) const
+{
+	const FGameplayTagNetIndex NetIndex = UGameplayTagsManager::Get().GetNetIndexFromTag(InTag);
+
+	if UNLIKELY_IF(!Entries.IsValidIndex(NetIndex))
+	{
+		return 0;
+	}
+
+	const FEntry& Entry = Entries[NetIndex];
+	return Entry.TagName == InTag.GetTagName() ? Entry.Entity : 0;
+}
+
+flecs::entity_t FFlecsGameplayTagEntityIndex::FindByNetIndex(const FGameplayTagNetIndex InNetIndex) const
+{
+	return Entries.IsValidIndex(InNetIndex) ? Entries[InNetIndex].Entity : 0;
+}
+
+flecs::entity_t FFlecsGameplayTagEntityIndex::FindOrCreate(flecs::world_t* InWorld, const FGameplayTag& InTag)
+{
+	solid_cassume(InWorld != nullptr);
+
+	if (const flecs::entity_t Entity = Find(InTag))
+	{
+		return Entity;
+	}
+
+	const TSharedPtr<FGameplayTagNode> Node = UGameplayTagsManager::Get().FindTagNode(InTag);
+	if UNLIKELY_IF(!Node.IsValid())
+	{
+		return 0;
+	}
+
+	// The tag tree may have been rebuilt (and net indices reassigned) since the last registration
+	const int32 NodeCount = UGameplayTagsManager::Get().GetNetworkGameplayTagNodeIndex().Num();
+	if (Entries.Num() < NodeCount)
+	{
+		Entries.SetNum(NodeCount);
+	}
+
+	return CreateTagEntity(InWorld, *Node);
+}
+
+flecs::entity_t FFlecsGameplayTagEntityIndex::CreateTagEntity(flecs::world_t* InWorld, const FGameplayTagNode& InNode)
+{
+	const FGameplayTagNetIndex NetIndex = InNode.GetNetIndex();
+	solid_checkf(Entries.IsValidIndex(NetIndex), TEXT("Invalid net index for tag %s"),
+		*InNode.GetCompleteTagString());
+
+	FEntry& Entry = Entries[NetIndex];
+	if (Entry.Entity && Entry.TagName == InNode.GetCompleteTagName())
+	{
+		return Entry.Entity;
+	}
+
+	flecs::entity_t Parent = RootEntity;
+	flecs::entity_t ParentTagEntity = 0;
+
+	// The root of the tag tree is an unnamed node that doesn't get an entity
+	const FGameplayTagNode* ParentNode = InNode.GetParentTagNode();
+	if (ParentNode && !ParentNode->GetCompleteTagName().IsNone())
+	{
+		ParentTagEntity = CreateTagEntity(InWorld, *ParentNode);
+		Parent = ParentTagEntity;
+	}
+
+	// The node already holds the leaf name, so the full tag string doesn't need to be split into a path.
+	// An existing child with the same name is reused, which keeps this idempotent after the tag tree changed.
+	const FString LeafName = InNode.GetSimpleTagName().ToString();
+	const auto LeafNameAnsi = StringCast<ANSICHAR>(*LeafName);
+
+	ecs_entity_desc_t Desc = {};
+	Desc.parent = Parent;
+	Desc.name = LeafNameAnsi.Get();
+	Desc.sep = "";
+
+	const flecs::entity TagEntity(InWorld, ecs_entity_init(InWorld, &Desc));
+	solid_check(TagEntity.is_valid());
+
+	// Tag entities inherit from their parent tag, so a query term for a tag also matches its child tags through
+	// component inheritance (unless the term is self only). Inheritable is added up front so queries created before
+	// a lazily created child tag still resolve the hierarchy when they are evaluated.
+	TagEntity.add(flecs::Inheritable);
+	if (ParentTagEntity)
+	{
+		TagEntity.is_a(ParentTagEntity);
+	}
+
+	TagEntity.set<FGameplayTag>(InNode.GetCompleteTag());
+	TagEntity.add<FFlecsStablePathTag>();
+
+	Entry.TagName = InNode.GetCompleteTagName();
+	Entry.Entity = TagEntity;
+	++Count;
+
+	return TagEntity;
+}
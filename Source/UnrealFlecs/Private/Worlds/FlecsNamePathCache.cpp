@@ -0,0 +1,164 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Worlds/FlecsNamePathCache.h"
+
+flecs::entity_t FFlecsNamePathCache::Resolve(const flecs::world_t* InWorld, const FFlecsInternedPath& InPath)
+{
+	solid_cassume(InWorld != nullptr);
+
+	if UNLIKELY_IF(InPath.IsEmpty())
+	{
+		return 0;
+	}
+
+	flecs::entity_t Entity = 0;
+	if LIKELY_IF(FindValidEntry(InWorld, InPath, Entity))
+	{
+		return Entity;
+	}
+
+	FEntityChain Chain;
+	Chain.Reserve(InPath.Num());
+
+	flecs::entity_t Parent = 0;
+	for (const FFlecsInternedName& Element : InPath.GetElements())
+	{
+		Parent = UE::Flecs::LookupChild(InWorld, Parent, Element);
+
+		if (!Parent)
+		{
+			return 0;
+		}
+
+		Chain.Add(Parent);
+	}
+
+	StoreEntry(InPath, MoveTemp(Chain));
+	return Parent;
+}
+
+flecs::entity_t FFlecsNamePathCache::ResolveOrCreate(flecs::world_t* InWorld, const FFlecsInternedPath& InPath)
+{
+	solid_cassume(InWorld != nullptr);
+	solid_checkf(!InPath.IsEmpty(), TEXT("Cannot create an entity from an empty path"));
+
+	flecs::entity_t Entity = 0;
+	if LIKELY_IF(FindValidEntry(InWorld, InPath, Entity))
+	{
+		return Entity;
+	}
+
+	FEntityChain Chain;
+	Chain.Reserve(InPath.Num());
+
+	bool bCreatedAny = false;
+
+	flecs::entity_t Parent = 0;
+	for (const FFlecsInternedName& Element : InPath.GetElements())
+	{
+		flecs::entity_t Child = UE::Flecs::LookupChild(InWorld, Parent, Element);
+
+		if (!Child)
+		{
+			ecs_entity_desc_t Desc = {};
+			Desc.parent = Parent;
+			Desc.name = Element.GetData();
+			// The element is already split, don't let flecs tokenize it again
+			Desc.sep = "";
+
+			Child = ecs_entity_init(InWorld, &Desc);
+			bCreatedAny = true;
+		}
+
+		Chain.Add(Child);
+		Parent = Child;
+	}
+
+	// Entities created in deferred mode don't have their name set yet, only cache once the chain is resolvable
+	if (!bCreatedAny || !ecs_is_deferred(InWorld))
+	{
+		StoreEntry(InPath, MoveTemp(Chain));
+	}
+
+	return Parent;
+}
+
+void FFlecsNamePathCache::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+	Entries.clear();
+}
+
+int32 FFlecsNamePathCache::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return static_cast<int32>(Entries.size());
+}
+
+bool FFlecsNamePathCache::FindValidEntry(const flecs::world_t* InWorld, const FFlecsInternedPath& InPath,
+	flecs::entity_t& OutEntity) const
+{
+	FReadScopeLock ReadLock(Lock);
+
+	const auto It = Entries.find(InPath);
+	if (It == Entries.end())
+	{
+		return false;
+	}
+
+	if (!IsChainValid(InWorld, InPath, It->second))
+	{
+		return false;
+	}
+
+	OutEntity = It->second.Last();
+	return true;
+}
+
+void FFlecsNamePathCache::StoreEntry(const FFlecsInternedPath& InPath, FEntityChain&& InChain)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	if UNLIKELY_IF(Entries.size() >= MaxCachedPaths)
+	{
+		Entries.clear();
+	}
+
+	Entries.insert_or_assign(InPath, MoveTemp(InChain));
+}
+
+bool FFlecsNamePathCache::IsChainValid(const flecs::world_t* InWorld, const FFlecsInternedPath& InPath,
+	const FEntityChain& InChain)
+{
+	const FFlecsInternedPath::FElementArray& Elements = InPath.GetElements();
+
+	if UNLIKELY_IF(Elements.Num() != InChain.Num())
+	{
+		return false;
+	}
+
+	flecs::entity_t Parent = 0;
+	for (int32 Index = 0; Index < InChain.Num(); ++Index)
+	{
+		const flecs::entity_t Entity = InChain[Index];
+
+		if (!ecs_is_alive(InWorld, Entity))
+		{
+			return false;
+		}
+
+		if (ecs_get_parent(InWorld, Entity) != Parent)
+		{
+			return false;
+		}
+
+		if (!Elements[Index].MatchesNativeName(ecs_get_name(InWorld, Entity)))
+		{
+			return false;
+		}
+
+		Parent = Entity;
+	}
+
+	return true;
+}
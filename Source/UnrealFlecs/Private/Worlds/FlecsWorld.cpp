@@ -4,7 +4,10 @@
 #include "Worlds/FlecsWorld.h"
 
 #include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/GarbageCollection.h"
 #include "UObject/UObjectIterator.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -29,6 +32,8 @@
 
 #include "Components/FlecsAddReferencedObjectsTrait.h"
 #include "Components/FlecsBeginPlayComponent.h"
+#include "Components/FlecsDoubleBufferedTrait.h"
+#include "Components/FlecsPreviousFrame.h"
 #include "Components/FlecsUObjectComponent.h"
 #include "Entities/FlecsEntityRange.h"
 #include "Entities/FlecsTableHandle.h"
@@ -56,6 +61,13 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsWorld)
 
+namespace
+{
+	// The stage of the ReadOnly pipeline running on this thread, handed to its systems
+	thread_local UFlecsStage* GReadOnlyPipelineStage = nullptr;
+	
+} // namespace
+
 // static bool GFlecs_bRegisterMemberTypeStructs = false;
 // FAutoConsoleVariable CVarFlecsRegisterMemberTypeStructs(
 // 	TEXT("Flecs.RegisterMemberTypeStructs"),
@@ -63,6 +75,28 @@
 // 	TEXT("Register the member type structs as components if not previously registered."),
 // 	ECVF_Default);
 
+static void FlecsDumpPipelineSchedules(UWorld* InWorld)
+{
+	const UFlecsWorld* FlecsWorld = UFlecsWorldSubsystem::GetDefaultWorldStatic(InWorld);
+	if UNLIKELY_IF(!FlecsWorld)
+	{
+		UE_LOGFMT(LogFlecsWorld, Warning, "No Flecs world to dump the pipeline schedules of");
+		return;
+	}
+	
+	FlecsWorld->GetNativeFlecsWorld().each(flecs::Pipeline, [FlecsWorld](const flecs::entity InPipeline)
+	{
+		UE_LOGFMT(LogFlecsWorld, Log, "Schedule of pipeline {Pipeline}:\n{Dot}",
+			FString(InPipeline.path().c_str()),
+			FlecsWorld->GetPipelineScheduleDot(InPipeline.id()));
+	});
+}
+
+static FAutoConsoleCommandWithWorld CmdFlecsDumpPipelineSchedules(
+	TEXT("Flecs.DumpPipelineSchedules"),
+	TEXT("Logs the schedule of each pipeline in the default Flecs world as a graphviz (dot) graph."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&FlecsDumpPipelineSchedules));
+
 DECLARE_STATS_GROUP(TEXT("FlecsWorld"), STATGROUP_FlecsWorld, STATCAT_Advanced);
 
 DECLARE_CYCLE_STAT(TEXT("FlecsWorld::Progress"),
@@ -79,6 +113,16 @@ UFlecsWorld::UFlecsWorld(const FObjectInitializer& ObjectInitializer)
 	char* argv[] = { const_cast<char*>(ObjectNameCStr) };
 		
 	World = flecs::world(1, argv);
+
+	WorldAccessLock.OnSharedBegin = [this]()
+	{
+		BeginSharedWorldAccess();
+	};
+	
+	WorldAccessLock.OnSharedEnd = [this]()
+	{
+		EndSharedWorldAccess();
+	};
 }
 
 UFlecsWorld::~UFlecsWorld()
@@ -293,6 +337,12 @@ void UFlecsWorld::InitializeDefaultComponents() const
 	{
 		RegisterComponentType<FFlecsAddReferencedObjectsTrait>()
 			.Add(flecs::Trait);
+
+		RegisterComponentType<FFlecsDoubleBufferedTrait>()
+			.Add(flecs::Trait);
+
+		RegisterComponentType<FFlecsPreviousFrame>()
+			.Add(flecs::Relationship);
 	});
 	
 	const TSolidNotNull<UFlecsTypeRegistryEngineSubsystem*> FlecsTypeRegistry
@@ -614,6 +664,7 @@ void UFlecsWorld::Reset()
 	}
 	
 	EntityRanges.Empty();
+	NamePathCache.Reset();
 	GetNativeFlecsWorld().reset();
 }
 
@@ -675,7 +726,8 @@ void UFlecsWorld::HandleWorldPause()
 	}
 }
 
-bool UFlecsWorld::ProgressGameLoops(const FGameplayTag& TickTypeTag, const double DeltaTime)
+bool UFlecsWorld::ProgressGameLoops(const FGameplayTag& TickTypeTag, const double DeltaTime,
+	const EFlecsTickFunctionWorldAccess InAccess)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FlecsWorldProgress);
 
@@ -690,7 +742,13 @@ bool UFlecsWorld::ProgressGameLoops(const FGameplayTag& TickTypeTag, const doubl
 		return false;
 	}
 
-	HandleWorldPause();
+	const FFlecsWorldAccessScope AccessScope(WorldAccessLock, InAccess);
+
+	// Pausing and unpausing the game is only possible from the game thread, and changes the time scale
+	if (IsInGameThread() && WorldAccessLock.GetThreadAccess() == EFlecsTickFunctionWorldAccess::ReadWrite)
+	{
+		HandleWorldPause();
+	}
 
 	const TConstArrayView<TScriptInterface<IFlecsGameLoopInterface>> GameLoopsToTick = GameLoopTickTypes[TickTypeTag];
 
@@ -720,6 +778,11 @@ bool UFlecsWorld::ProgressGameLoops(const FGameplayTag& TickTypeTag, const doubl
 
 bool UFlecsWorld::Progress(const double DeltaTime)
 {
+	solid_checkf(WorldAccessLock.GetThreadAccess() != EFlecsTickFunctionWorldAccess::ReadOnly,
+		TEXT("Progressing world %s requires ReadWrite access, it runs every pipeline phase and merges in between"),
+		*GetName());
+	
+	const FFlecsWorldAccessScope AccessScope(WorldAccessLock, EFlecsTickFunctionWorldAccess::ReadWrite);
 	return GetNativeFlecsWorld().progress(DeltaTime);
 }
 
@@ -764,6 +827,17 @@ void UFlecsWorld::DestroyWorld()
 	}
 	
 	EntityRanges.Empty();
+
+	for (UFlecsStage* Stage : ReadOnlyStages)
+	{
+		if (Stage)
+		{
+			Stage->DestroyStage();
+		}
+	}
+
+	ReadOnlyStages.Empty();
+	FreeReadOnlyStages.Empty();
 		
 	World.release();
 	World.world_ = nullptr;
@@ -867,10 +941,123 @@ void UFlecsWorld::RunPipeline(const FFlecsId InPipeline, const double DeltaTime)
 {
 	solid_checkf(InPipeline.IsValid(), TEXT("Pipeline is not valid"));
 	solid_checkf(IsAlive(InPipeline), TEXT("Pipeline entity is not alive"));
+
+	if (WorldAccessLock.GetThreadAccess() == EFlecsTickFunctionWorldAccess::ReadOnly)
+	{
+		GetSelf()->RunPipelineReadOnly(InPipeline, DeltaTime);
+		return;
+	}
 	
+	const FFlecsWorldAccessScope AccessScope(WorldAccessLock, EFlecsTickFunctionWorldAccess::ReadWrite);
 	GetNativeFlecsWorld().run_pipeline(InPipeline, DeltaTime);
 }
 
+void UFlecsWorld::RunPipelineReadOnly(const FFlecsId InPipeline, const double DeltaTime)
+{
+	UFlecsStage* Stage = AcquireReadOnlyStage();
+	
+	UFlecsStage* OuterPipelineStage = GReadOnlyPipelineStage;
+	GReadOnlyPipelineStage = Stage;
+	
+	const bool bRan = ecs_run_pipeline_readonly(Stage->GetNativeFlecsWorld().c_ptr(), InPipeline,
+		static_cast<ecs_ftime_t>(DeltaTime));
+	
+	GReadOnlyPipelineStage = OuterPipelineStage;
+	ReleaseReadOnlyStage(Stage);
+
+	if UNLIKELY_IF(!bRan)
+	{
+		UE_LOGFMT(LogFlecsWorld, Warning,
+			"Pipeline {Pipeline} was created while world {WorldName} was shared and can't run with ReadOnly access until the world is released",
+			InPipeline.ToString(), GetName());
+	}
+}
+
+void UFlecsWorld::BeginSharedWorldAccess()
+{
+	// Schedules can't be rebuilt in readonly mode, so every pipeline is brought up to date before entering it
+	TArray<flecs::entity_t, TInlineAllocator<8>> Pipelines;
+	
+	ecs_iter_t PipelineIterator = ecs_each_id(World, ecs_id(EcsPipeline));
+	while (ecs_each_next(&PipelineIterator))
+	{
+		Pipelines.Append(PipelineIterator.entities, PipelineIterator.count);
+	}
+
+	for (const flecs::entity_t Pipeline : Pipelines)
+	{
+		ecs_pipeline_prepare(World, Pipeline);
+	}
+	
+	BeginReadOnly();
+}
+
+void UFlecsWorld::EndSharedWorldAccess()
+{
+	EndReadOnly();
+	
+	// ReadOnly pipelines enqueue their commands on their own stages
+	for (const UFlecsStage* Stage : ReadOnlyStages)
+	{
+		Stage->Merge();
+	}
+}
+
+UFlecsStage* UFlecsWorld::AcquireReadOnlyStage()
+{
+	FScopeLock StagesLock(&ReadOnlyStagesCriticalSection);
+	
+	if LIKELY_IF(!FreeReadOnlyStages.IsEmpty())
+	{
+		return FreeReadOnlyStages.Pop(EAllowShrinking::No);
+	}
+
+	// The first ReadOnly pipelines to overlap may be running on a task thread
+	FGCScopeGuard GCGuard;
+	
+	const TSolidNotNull<UFlecsStage*> NewStage = CreateAsyncStage();
+	ReadOnlyStages.Add(NewStage);
+	return NewStage;
+}
+
+void UFlecsWorld::ReleaseReadOnlyStage(UFlecsStage* InStage)
+{
+	solid_cassume(InStage);
+	
+	FScopeLock StagesLock(&ReadOnlyStagesCriticalSection);
+	FreeReadOnlyStages.Add(InStage);
+}
+
+void UFlecsWorld::CheckWorldWriteAccess() const
+{
+#if DO_CHECK
+	const TOptional<EFlecsTickFunctionWorldAccess> ThreadAccess = WorldAccessLock.GetThreadAccess();
+	if (ThreadAccess == EFlecsTickFunctionWorldAccess::ReadWrite)
+	{
+		return;
+	}
+
+	// Changes the game thread makes while the world is shared are deferred on the main stage,
+	// which ReadOnly pipelines don't use
+	solid_checkf(IsInGameThread() && (ThreadAccess.IsSet() || !WorldAccessLock.IsHeld()),
+		TEXT("World %s is changed by a thread without ReadWrite access while it may be in use by another thread, hold it with an FFlecsWorldAccessScope"),
+		*GetName());
+#endif // DO_CHECK
+}
+
+FString UFlecsWorld::GetPipelineScheduleDot(const FFlecsId InPipeline) const
+{
+	char* Dot = ecs_pipeline_schedule_to_dot(GetNativeFlecsWorld(), InPipeline.GetId());
+	if UNLIKELY_IF(!Dot)
+	{
+		return FString();
+	}
+	
+	FString Result(Dot);
+	ecs_os_free(Dot);
+	return Result;
+}
+
 /*
 FFlecsQuery UFlecsWorld::GetQueryFromEntity(const FFlecsEntityHandle& InEntity) const
 {
@@ -1010,18 +1197,21 @@ UFlecsStage* UFlecsWorld::GetStage(const flecs::world& InStageWorld) const
 	}
 	
 	const int32 StageId = InStageWorld.get_stage_id();
+	
+	// Async stages only reach systems through the ReadOnly pipeline running on this thread
+	if (StageId < 0)
+	{
+		return GReadOnlyPipelineStage && GReadOnlyPipelineStage->GetNativeFlecsWorld().c_ptr() == InStageWorld.c_ptr()
+			? GReadOnlyPipelineStage
+			: nullptr;
+	}
+	
 	return GetStage(StageId);
 }
 
 UFlecsStage* UFlecsWorld::GetStage(const flecs::iter& InIter) const
 {
-	if (!InIter.world().is_stage())
-	{
-		return nullptr;
-	}
-	
-	const int32 StageId = InIter.world().get_stage_id();
-	return GetStage(StageId);
+	return GetStage(InIter.world());
 }
 
 TTuple<int32, FFlecsId> UFlecsWorld::Search(const FFlecsTableHandle& InTableHandle, const FFlecsId& InId) const
@@ -1123,13 +1313,14 @@ void UFlecsWorld::ImportRestModule()
 #endif // FLECS_REST
 }
 
-void UFlecsWorld::ImportStatsModule()
+void UFlecsWorld::ImportStatsModule(const float InSampleInterval)
 {
 #ifdef FLECS_STATS
 
-	EndScope([this]()
+	EndScope([this, InSampleInterval]()
 	{
 		ImportFlecsModule<flecs::stats>();
+		ecs_stats_set_interval(GetNativeFlecsWorld().c_ptr(), InSampleInterval);
 	});
 	
 #endif // FLECS_STATS
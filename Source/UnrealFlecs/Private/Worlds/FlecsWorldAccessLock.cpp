@@ -0,0 +1,177 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Worlds/FlecsWorldAccessLock.h"
+
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	struct FFlecsHeldWorldAccess
+	{
+		const FFlecsWorldAccessLock* Lock = nullptr;
+		EFlecsTickFunctionWorldAccess Access = EFlecsTickFunctionWorldAccess::ReadWrite;
+		int32 Depth = 0;
+	}; // struct FFlecsHeldWorldAccess
+
+	// A thread rarely holds more than one world at a time
+	thread_local TArray<FFlecsHeldWorldAccess, TInlineAllocator<2>> GHeldWorldAccess;
+
+	NO_DISCARD int32 FindHeldWorldAccess(const FFlecsWorldAccessLock* InLock)
+	{
+		return GHeldWorldAccess.IndexOfByPredicate([InLock](const FFlecsHeldWorldAccess& InHeld)
+		{
+			return InHeld.Lock == InLock;
+		});
+	}
+
+	// The transition callbacks run while no other thread holds the lock, so the calling thread may write the world
+	void RunTransition(const FFlecsWorldAccessLock* InLock, const TUniqueFunction<void()>& InCallback)
+	{
+		if (!InCallback)
+		{
+			return;
+		}
+
+		GHeldWorldAccess.Add({ InLock, EFlecsTickFunctionWorldAccess::ReadWrite, 1 });
+		InCallback();
+		GHeldWorldAccess.Pop(EAllowShrinking::No);
+	}
+	
+} // namespace
+
+void FFlecsWorldAccessLock::Lock(const EFlecsTickFunctionWorldAccess InAccess)
+{
+	const int32 HeldIndex = FindHeldWorldAccess(this);
+	if (HeldIndex != INDEX_NONE)
+	{
+		FFlecsHeldWorldAccess& Held = GHeldWorldAccess[HeldIndex];
+		solid_checkf(Held.Access == EFlecsTickFunctionWorldAccess::ReadWrite
+			|| InAccess == EFlecsTickFunctionWorldAccess::ReadOnly,
+			TEXT("ReadOnly world access can't be upgraded to ReadWrite access, the thread would wait for itself"));
+		
+		++Held.Depth;
+		return;
+	}
+
+	if (InAccess == EFlecsTickFunctionWorldAccess::ReadOnly)
+	{
+		LockShared();
+	}
+	else
+	{
+		LockExclusive();
+	}
+
+	GHeldWorldAccess.Add({ this, InAccess, 1 });
+}
+
+void FFlecsWorldAccessLock::Unlock()
+{
+	const int32 HeldIndex = FindHeldWorldAccess(this);
+	solid_checkf(HeldIndex != INDEX_NONE, TEXT("World access is not held by the calling thread"));
+
+	FFlecsHeldWorldAccess& Held = GHeldWorldAccess[HeldIndex];
+	if (--Held.Depth > 0)
+	{
+		return;
+	}
+
+	const EFlecsTickFunctionWorldAccess Access = Held.Access;
+	GHeldWorldAccess.RemoveAtSwap(HeldIndex, EAllowShrinking::No);
+
+	if (Access == EFlecsTickFunctionWorldAccess::ReadOnly)
+	{
+		UnlockShared();
+	}
+	else
+	{
+		UnlockExclusive();
+	}
+}
+
+TOptional<EFlecsTickFunctionWorldAccess> FFlecsWorldAccessLock::GetThreadAccess() const
+{
+	const int32 HeldIndex = FindHeldWorldAccess(this);
+	if (HeldIndex == INDEX_NONE)
+	{
+		return {};
+	}
+
+	return GHeldWorldAccess[HeldIndex].Access;
+}
+
+void FFlecsWorldAccessLock::LockShared()
+{
+	FScopeLock ScopeLock(&Mutex);
+
+	while (bHasWriter || WaitingWriterCount > 0 || bIsTransitioning)
+	{
+		Condition.Wait(Mutex);
+	}
+
+	if (ReaderCount == 0)
+	{
+		bIsTransitioning = true;
+		
+		{
+			FScopeUnlock ScopeUnlock(&Mutex);
+			RunTransition(this, OnSharedBegin);
+		}
+
+		bIsTransitioning = false;
+		Condition.NotifyAll();
+	}
+
+	++ReaderCount;
+	HolderCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FFlecsWorldAccessLock::UnlockShared()
+{
+	FScopeLock ScopeLock(&Mutex);
+	solid_check(ReaderCount > 0);
+
+	// New readers wait for the transition, so the last reader still counts until it is done
+	if (ReaderCount == 1)
+	{
+		bIsTransitioning = true;
+		
+		{
+			FScopeUnlock ScopeUnlock(&Mutex);
+			RunTransition(this, OnSharedEnd);
+		}
+
+		bIsTransitioning = false;
+	}
+
+	--ReaderCount;
+	HolderCount.fetch_sub(1, std::memory_order_relaxed);
+	Condition.NotifyAll();
+}
+
+void FFlecsWorldAccessLock::LockExclusive()
+{
+	FScopeLock ScopeLock(&Mutex);
+
+	++WaitingWriterCount;
+	
+	while (bHasWriter || ReaderCount > 0 || bIsTransitioning)
+	{
+		Condition.Wait(Mutex);
+	}
+	
+	--WaitingWriterCount;
+
+	bHasWriter = true;
+	HolderCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FFlecsWorldAccessLock::UnlockExclusive()
+{
+	FScopeLock ScopeLock(&Mutex);
+	solid_check(bHasWriter);
+
+	bHasWriter = false;
+	HolderCount.fetch_sub(1, std::memory_order_relaxed);
+	Condition.NotifyAll();
+}
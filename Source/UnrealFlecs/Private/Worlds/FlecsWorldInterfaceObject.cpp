@@ -191,6 +191,7 @@ bool UFlecsWorldInterfaceObject::ShouldQuit() const
 
 bool UFlecsWorldInterfaceObject::BeginDefer() const
 {
+	CheckWorldWriteAccess();
 	return GetNativeFlecsWorld_Internal()->defer_begin();
 }
 
@@ -201,6 +202,7 @@ FFlecsScopedDeferWindow UFlecsWorldInterfaceObject::DeferWindow() const
 
 bool UFlecsWorldInterfaceObject::EndDefer() const
 {
+	CheckWorldWriteAccess();
 	return GetNativeFlecsWorld_Internal()->defer_end();
 }
 
@@ -251,6 +253,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::GetAlive(const FFlecsId InId) con
 
 FFlecsEntityHandle UFlecsWorldInterfaceObject::MakeAlive(const FFlecsId InId) const
 {
+	CheckWorldWriteAccess();
 	return FFlecsEntityHandle(GetNativeFlecsWorld_Internal()->make_alive(InId));
 }
 
@@ -294,6 +297,19 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::LookupEntity(const FString& Name,
 						bRecursive);
 }
 
+FFlecsEntityHandle UFlecsWorldInterfaceObject::LookupEntity(const FFlecsInternedPath& InPath) const
+{
+	return FFlecsEntityHandle(this, GetFlecsWorld()->NamePathCache.Resolve(
+		GetNativeFlecsWorld_Internal()->c_ptr(), InPath));
+}
+
+FFlecsEntityHandle UFlecsWorldInterfaceObject::LookupChild(const FFlecsId InParent,
+	const FFlecsInternedName& InName) const
+{
+	return FFlecsEntityHandle(this, UE::Flecs::LookupChild(GetNativeFlecsWorld_Internal()->c_ptr(),
+		InParent, InName));
+}
+
 FFlecsEntityHandle UFlecsWorldInterfaceObject::LookupEntityBySymbol_Internal(const FString& Symbol,
 	const bool bLookupAsPath, const bool bRecursive) const
 {
@@ -478,6 +494,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::RegisterScriptStruct(const UScrip
 {
 	solid_cassume(ScriptStruct);
 	solid_checkf(!IsDeferred(), TEXT("Registering script structs while deferred is not allowed"));
+	CheckWorldWriteAccess();
 
 		const FFlecsId OldScope = ClearScope();
 
@@ -629,7 +646,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::RegisterScriptStruct(const UScrip
 
 			flecs_component_ids_set(GetNativeFlecsWorld(), Data.s_index, ScriptStructComponent);
 
-			GetTypeMapComponent()->ScriptStructMap.emplace(ScriptStruct, ScriptStructComponent);
+			GetTypeMapComponent()->AddScriptStruct(ScriptStruct, ScriptStructComponent);
 			
 			ScriptStructComponent.Set<FFlecsScriptStructComponent>({ ScriptStruct });
 
@@ -752,7 +769,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::RegisterComponentEnumType(TSolidN
 				= flecs::_::g_type_to_impl_data.at(EnumNameStdString);
 			
 			flecs_component_ids_set(GetNativeFlecsWorld(), s_index, ScriptEnumComponent);
-			GetTypeMapComponent()->ScriptEnumMap.emplace(ScriptEnum, ScriptEnumComponent);
+			GetTypeMapComponent()->AddScriptEnum(ScriptEnum, ScriptEnumComponent);
 			
 			ScriptEnumComponent.Set<FFlecsScriptEnumComponent>(FFlecsScriptEnumComponent(ScriptEnum));
 			
@@ -786,7 +803,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::RegisterScriptClassType(TSolidNot
 		solid_check(ScriptClassEntity.IsValid());
 
 		ScriptClassEntity.GetEntity().set_symbol(ClassNameCStr);
-		GetTypeMapComponent()->ScriptClassMap.emplace(ScriptClass, ScriptClassEntity);
+		GetTypeMapComponent()->AddScriptClass(ScriptClass, ScriptClassEntity);
 
 		ScriptClassEntity.Set<FFlecsScriptClassComponent>(FFlecsScriptClassComponent(ScriptClass));
 
@@ -812,7 +829,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::RegisterScriptClassType(TSolidNot
 		flecs::_::type_impl_data& Data = flecs::_::g_type_to_impl_data.at(ClassNameStdString);
 			
 		flecs_component_ids_set(GetNativeFlecsWorld(), Data.s_index, ScriptClassEntity);
-		GetTypeMapComponent()->ScriptClassMap.emplace(ScriptClass, ScriptClassEntity);
+		GetTypeMapComponent()->AddScriptClass(ScriptClass, ScriptClassEntity);
 	});
 
 	SetScope(OldScope);
@@ -849,6 +866,12 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::GetScriptStructEntity(const UScri
 {
 	solid_cassume(ScriptStruct)
 
+	if LIKELY_IF(const FFlecsId CachedComponent = GetTypeMapComponent()->FindTypeId(ScriptStruct))
+	{
+		solid_checkf(IsAlive(CachedComponent), TEXT("Entity is not alive"));
+		return GetAlive(CachedComponent);
+	}
+
 	solid_checkf(HasScriptStruct(ScriptStruct),
 		TEXT("Script struct %s is not registered"), *ScriptStruct->GetStructCPPName());
 		
@@ -861,6 +884,12 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::GetScriptStructEntity(const UScri
 FFlecsEntityHandle UFlecsWorldInterfaceObject::GetScriptEnumEntity(const UEnum* ScriptEnum) const
 {
 	solid_cassume(ScriptEnum);
+
+	if LIKELY_IF(const FFlecsId CachedComponent = GetTypeMapComponent()->FindTypeId(ScriptEnum))
+	{
+		solid_checkf(IsAlive(CachedComponent), TEXT("Entity is not alive"));
+		return GetAlive(CachedComponent);
+	}
 	
 	solid_checkf(HasScriptEnum(ScriptEnum),
 		TEXT("Script enum %s is not registered"), *ScriptEnum->GetName());
@@ -873,6 +902,11 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::GetScriptEnumEntity(const UEnum*
 bool UFlecsWorldInterfaceObject::HasScriptStruct(const UScriptStruct* ScriptStruct) const
 {
 	solid_cassume(ScriptStruct);
+
+	if LIKELY_IF(const FFlecsId CachedComponent = GetTypeMapComponent()->FindTypeId(ScriptStruct))
+	{
+		return IsValidId(CachedComponent);
+	}
 		
 	if (GetTypeMapComponent()->ScriptStructMap.contains(ScriptStruct))
 	{
@@ -886,6 +920,11 @@ bool UFlecsWorldInterfaceObject::HasScriptStruct(const UScriptStruct* ScriptStru
 bool UFlecsWorldInterfaceObject::HasScriptEnum(const UEnum* ScriptEnum) const
 {
 	solid_cassume(ScriptEnum);
+
+	if LIKELY_IF(const FFlecsId CachedComponent = GetTypeMapComponent()->FindTypeId(ScriptEnum))
+	{
+		return IsValidId(CachedComponent);
+	}
 		
 	if (GetTypeMapComponent()->ScriptEnumMap.contains(ScriptEnum))
 	{
@@ -899,6 +938,11 @@ bool UFlecsWorldInterfaceObject::HasScriptEnum(const UEnum* ScriptEnum) const
 bool UFlecsWorldInterfaceObject::HasScriptClass(const TSubclassOf<UObject> InClass) const
 {
 	solid_check(InClass);
+
+	if LIKELY_IF(const FFlecsId CachedComponent = GetTypeMapComponent()->FindTypeId(InClass.Get()))
+	{
+		return IsValidId(CachedComponent);
+	}
 		
 	if (GetTypeMapComponent()->ScriptClassMap.contains(FFlecsScriptClassComponent(InClass)))
 	{
@@ -912,6 +956,12 @@ bool UFlecsWorldInterfaceObject::HasScriptClass(const TSubclassOf<UObject> InCla
 FFlecsEntityHandle UFlecsWorldInterfaceObject::GetScriptClassEntity(const TSubclassOf<UObject> InClass) const
 {
 	solid_check(InClass);
+
+	if LIKELY_IF(const FFlecsId CachedComponent = GetTypeMapComponent()->FindTypeId(InClass.Get()))
+	{
+		solid_checkf(IsAlive(CachedComponent), TEXT("Entity is not alive"));
+		return GetAlive(CachedComponent);
+	}
 		
 	const FFlecsId Component = GetTypeMapComponent()->ScriptClassMap.at(FFlecsScriptClassComponent(InClass));
 	solid_checkf(IsAlive(Component), TEXT("Entity is not alive"));
@@ -922,11 +972,21 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::GetScriptClassEntity(const TSubcl
 FFlecsEntityHandle UFlecsWorldInterfaceObject::CreateEntity(const FString& Name, const FString& Separator,
 	const FString& RootSeparator) const
 {
+	CheckWorldWriteAccess();
 	return GetNativeFlecsWorld_Internal()->entity(StringCast<char>(*Name).Get(), 
 						StringCast<char>(*Separator).Get(),
 						StringCast<char>(*RootSeparator).Get());
 }
 
+FFlecsEntityHandle UFlecsWorldInterfaceObject::CreateEntity(const FFlecsInternedPath& InPath) const
+{
+	solid_checkf(!InPath.IsEmpty(), TEXT("Cannot create an entity from an empty interned path"));
+	CheckWorldWriteAccess();
+
+	return FFlecsEntityHandle(this, GetFlecsWorld()->NamePathCache.ResolveOrCreate(
+		GetNativeFlecsWorld_Internal()->c_ptr(), InPath));
+}
+
 FFlecsEntityHandle UFlecsWorldInterfaceObject::ObtainTypedEntity(const TSolidNotNull<UClass*> InClass) const
 {
 	const FFlecsEntityHandle EntityHandle = GetNativeFlecsWorld_Internal()->entity(RegisterScriptClassType(InClass));
@@ -958,6 +1018,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::CreateEntityWithRecordWithId(cons
 void UFlecsWorldInterfaceObject::DestroyEntityByName(const FString& InName) const
 {
 	solid_checkf(!InName.IsEmpty(), TEXT("Name is empty"));
+	CheckWorldWriteAccess();
 
 	const FFlecsEntityHandle Handle = LookupEntity(InName);
 		
@@ -975,15 +1036,24 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::GetTagEntity(const FGameplayTag&
 {
 	solid_checkf(Tag.IsValid(), TEXT("Tag is not valid"));
 
-	solid_checkf(GetFlecsWorld()->TagEntityMap.contains(Tag), TEXT("Tag %s is not registered"), *Tag.ToString());
-	solid_checkf(IsAlive(GetFlecsWorld()->TagEntityMap.at(Tag).GetId()), TEXT("Tag entity is not alive"));
-		
-	return GetAlive(GetFlecsWorld()->TagEntityMap.at(Tag).GetId());
+	FFlecsGameplayTagEntityIndex& TagEntityIndex = GetFlecsWorld()->TagEntityIndex;
+
+	FFlecsId TagEntity = TagEntityIndex.Find(Tag);
+	if UNLIKELY_IF(!TagEntity.IsValid())
+	{
+		// Lazy registration, or a tag that was added to the tag tree after the world was created
+		TagEntity = TagEntityIndex.FindOrCreate(GetNativeFlecsWorld_Internal()->c_ptr(), Tag);
+		solid_checkf(TagEntity.IsValid(), TEXT("Tag %s is not registered"), *Tag.ToString());
+	}
+
+	solid_checkf(IsAlive(TagEntity), TEXT("Tag entity is not alive"));
+	return GetAlive(TagEntity);
 }
 
 FFlecsEntityHandle UFlecsWorldInterfaceObject::CreatePrefabWithRecord(const FFlecsEntityRecord& InRecord,
 	const FString& Name) const
 {
+	CheckWorldWriteAccess();
 	const FFlecsEntityHandle PrefabEntity = GetNativeFlecsWorld_Internal()->prefab(StringCast<char>(*Name).Get());
 	solid_checkf(PrefabEntity.IsPrefab(), TEXT("Entity is not a prefab"));
 		
@@ -1008,6 +1078,7 @@ FFlecsEntityHandle UFlecsWorldInterfaceObject::CreatePrefabWithRecord(const FFle
 
 FFlecsEntityHandle UFlecsWorldInterfaceObject::CreatePrefab(const FString& Name) const
 {
+	CheckWorldWriteAccess();
 	return GetNativeFlecsWorld_Internal()->prefab(StringCast<char>(*Name).Get());
 }
 
@@ -1066,6 +1137,7 @@ FFlecsQuery UFlecsWorldInterfaceObject::CreateQueryWithEntity(const FFlecsQueryD
 FFlecsPipelineHandle UFlecsWorldInterfaceObject::CreatePipeline(const FFlecsPipelineDefinition& InPipelineDefinition,
 	const FString& InPipelineName) const
 {
+	CheckWorldWriteAccess();
 	flecs::pipeline_builder Builder = flecs::pipeline_builder(GetNativeFlecsWorld(), StringCast<char>(*InPipelineName).Get());
 	InPipelineDefinition.ApplyToPipeline(this, Builder);
 	return FFlecsPipelineHandle(Builder.build());
@@ -175,7 +175,7 @@ UFlecsWorld* UFlecsWorldSubsystem::CreateWorld(const FString& Name, const FFlecs
 
 	DefaultWorld->InitializeSystems();
 
-	RegisterAllGameplayTags(DefaultWorld.Get());
+	RegisterAllGameplayTags(DefaultWorld.Get(), Settings.bLazyGameplayTagEntities);
 
 	DefaultWorld->Defer([this, &Settings]()
 	{
@@ -265,7 +265,7 @@ UFlecsWorld* UFlecsWorldSubsystem::CreateWorld(const FString& Name, const FFlecs
 	
 	if (Settings.bImportStats)
 	{
-		DefaultWorld->ImportStatsModule();
+		DefaultWorld->ImportStatsModule(Settings.StatsSampleInterval);
 	}
 
 	DefaultWorld->WorldStart();
@@ -367,27 +367,15 @@ void UFlecsWorldSubsystem::ListenBeginPlay(const FFlecsOnWorldBeginPlay::FDelega
 	}
 }
 
-void UFlecsWorldSubsystem::RegisterAllGameplayTags(const TSolidNotNull<UFlecsWorld*> InFlecsWorld)
+void UFlecsWorldSubsystem::RegisterAllGameplayTags(const TSolidNotNull<UFlecsWorld*> InFlecsWorld, const bool bInLazy)
 {
-	InFlecsWorld->ObtainTypedEntity<FFlecsGameplayTagManagerEntity>()
+	const FFlecsEntityHandle TagManagerEntity = InFlecsWorld->ObtainTypedEntity<FFlecsGameplayTagManagerEntity>()
 	            .Add(flecs::Module);
 
-	UGameplayTagsManager& GameplayTagsManager = UGameplayTagsManager::Get();
+	InFlecsWorld->TagEntityIndex.Initialize(TagManagerEntity, bInLazy);
 
-	// @TODO: defer this
-	InFlecsWorld->Scope<FFlecsGameplayTagManagerEntity>([InFlecsWorld, &GameplayTagsManager]()
+	if (!bInLazy)
 	{
-		FGameplayTagContainer AllTags;
-		GameplayTagsManager.RequestAllGameplayTags(AllTags, false);
-
-		for (const FGameplayTag& Tag : AllTags)
-		{
-			const FFlecsEntityHandle TagEntity = InFlecsWorld->CreateEntity(Tag.ToString(), ".", ".");
-				
-			TagEntity.Set<FGameplayTag>(Tag);
-			TagEntity.Add<FFlecsStablePathTag>();
-
-			InFlecsWorld->TagEntityMap.emplace(Tag, TagEntity.GetFlecsId());
-		}
-	});
+		InFlecsWorld->TagEntityIndex.RegisterAllTags(InFlecsWorld->GetNativeFlecsWorld().c_ptr());
+	}
 }
@@ -89,6 +89,8 @@ TSharedStruct<FFlecsTickFunction> FFlecsTickFunctionSettingsInfo::CreateTickFunc
 	TickFunction.bHighPriority = InTickFunctionSettings.bHighPriority;
 	TickFunction.bAllowTickBatching = InTickFunctionSettings.bAllowTickBatching;
 	TickFunction.bRunTransactionally = InTickFunctionSettings.bRunTransactionally;
+	TickFunction.bRunOnAnyThread = InTickFunctionSettings.bRunOnAnyThread;
+	TickFunction.WorldAccess = InTickFunctionSettings.WorldAccess;
 	
 	TickFunction.bCanEverTick = true;
 
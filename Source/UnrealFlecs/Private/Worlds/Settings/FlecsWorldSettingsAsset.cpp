@@ -6,6 +6,7 @@
 #include "Misc/DataValidation.h"
 
 #include "Pipelines/FlecsDefaultGameLoop.h"
+#include "Pipelines/FlecsTickTypeNativeTags.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsWorldSettingsAsset)
 
@@ -101,6 +102,25 @@ EDataValidationResult UFlecsWorldSettingsAsset::IsDataValid(FDataValidationConte
 						FText::FromName(PrerequisiteTag.GetTagName())));
 				}
 			}
+
+			if (TickFunction.bRunOnAnyThread && TickFunction.TickTypeTag == FlecsTickType_MainLoop)
+			{
+				Context.AddWarning(FText::Format(
+					LOCTEXT("MainLoopRunOnAnyThread",
+						"WorldSettings {0} runs the MainLoop TickFunction on any thread, game pauses won't be applied to the world time scale."),
+					FText::FromString(GetPathName())));
+			}
+
+			if (TickFunction.WorldAccess == EFlecsTickFunctionWorldAccess::ReadOnly
+				&& TickFunction.TickTypeTag == FlecsTickType_MainLoop)
+			{
+				Context.AddError(FText::Format(
+					LOCTEXT("MainLoopReadOnly",
+						"WorldSettings {0} gives the MainLoop TickFunction ReadOnly world access, progressing the world requires ReadWrite access."),
+					FText::FromString(GetPathName())));
+				
+				Result = EDataValidationResult::Invalid;
+			}
 		}
 		
 		bool bHasMainLoop = false;
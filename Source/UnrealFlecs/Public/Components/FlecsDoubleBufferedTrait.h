@@ -0,0 +1,18 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "FlecsDoubleBufferedTrait.generated.h"
+
+/**
+ * Added to a component to keep a copy of its value from the end of the previous frame in (FFlecsPreviousFrame, Component).
+ * flecs::Trait is added when this is registered.
+ * @see UFlecsDefaultGameLoop::bCommitDoubleBufferedComponents
+ */
+USTRUCT()
+struct UNREALFLECS_API FFlecsDoubleBufferedTrait
+{
+	GENERATED_BODY()
+}; // struct FFlecsDoubleBufferedTrait
@@ -0,0 +1,20 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "FlecsPreviousFrame.generated.h"
+
+/**
+ * Relationship for the committed copy of a double buffered component, (FFlecsPreviousFrame, Component) has the type of the
+ * component and holds its value from the end of the previous frame.
+ * Late phase systems that only read this pair don't conflict with the systems writing the live component,
+ * so with ScheduleByAccess they share a sync point with them and can run at the same time.
+ * @see FFlecsDoubleBufferedTrait
+ */
+USTRUCT()
+struct UNREALFLECS_API FFlecsPreviousFrame
+{
+	GENERATED_BODY()
+}; // struct FFlecsPreviousFrame
@@ -408,6 +408,12 @@ public:
 		return *this;
 	}
 
+	SOLID_INLINE const FSelfType& SetName(const FFlecsInternedName& InName) const
+	{
+		GetEntity().set_name(InName.IsNone() ? nullptr : InName.GetData());
+		return *this;
+	}
+
 	SOLID_INLINE const FSelfType& ClearName() const
 	{
 		GetEntity().set_name(nullptr);
@@ -11,6 +11,7 @@
 #include "FlecsEntityHandleTypes.h"
 #include "FlecsCommonHandle.h"
 #include "FlecsArchetype.h"
+#include "FlecsInternedName.h"
 
 #include "FlecsEntityView.generated.h"
 
@@ -479,6 +480,16 @@ public:
 		return GetEntityView().lookup(StringCast<char>(*InPath).Get(), bSearchPath);
 	}
 
+	/**
+	 * @brief Lookup a direct child by interned name, skips the string conversion and name hashing of Lookup
+	 */
+	template <UE::Flecs::TFlecsEntityHandleTypeConcept THandle>
+	NO_DISCARD SOLID_INLINE THandle LookupChild(const FFlecsInternedName& InName) const
+	{
+		return flecs::entity(GetEntityView().world(),
+			UE::Flecs::LookupChild(GetEntityView().world().c_ptr(), GetEntityView().id(), InName));
+	}
+
 	template <typename FunctionType>
 	SOLID_INLINE void Iterate(FunctionType&& InFunction) const
 	{
@@ -0,0 +1,237 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "flecs.h"
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+#include "Standard/Hashing.h"
+
+/**
+ * @brief Immutable storage for an interned name, owned by the global intern table and never freed.
+ * Holds the ANSI representation and the flecs name index hash, so lookups never have to convert or rehash.
+ */
+struct UNREALFLECS_API FFlecsInternedNameEntry
+{
+	FName Name;
+
+	/** Null-terminated ANSI copy of the name */
+	TArray<ANSICHAR> AnsiName;
+
+	/** Hash used by the flecs name index @see ecs_name_hash */
+	uint64 NameHash = 0;
+
+	NO_DISCARD SOLID_INLINE const char* GetData() const
+	{
+		return AnsiName.GetData();
+	}
+
+	NO_DISCARD SOLID_INLINE int32 Len() const
+	{
+		return AnsiName.Num() - 1;
+	}
+
+}; // struct FFlecsInternedNameEntry
+
+/**
+ * @brief A pre-hashed, interned entity name. Implicitly constructible from and convertible to FName,
+ * it can be passed directly to the flecs name index through ecs_lookup_child_w_hash.
+ * Interning is done once per unique name; copying and comparing are pointer operations.
+ */
+struct UNREALFLECS_API FFlecsInternedName
+{
+	NO_DISCARD FORCEINLINE friend uint32 GetTypeHash(const FFlecsInternedName& InName)
+	{
+		return GetTypeHash(InName.Entry);
+	}
+
+	/**
+	 * @brief Intern an FName, note that FName is case-insensitive and may hand back the casing it was first
+	 * registered with outside the editor, prefer the string overloads for case-sensitive names.
+	 */
+	static NO_DISCARD FFlecsInternedName Intern(const FName& InName);
+	static NO_DISCARD FFlecsInternedName Intern(const FStringView InName);
+	static NO_DISCARD FFlecsInternedName Intern(const FAnsiStringView InName);
+
+public:
+	SOLID_INLINE FFlecsInternedName() = default;
+
+	// ReSharper disable once CppNonExplicitConvertingConstructor
+	SOLID_INLINE FFlecsInternedName(const FName& InName)
+		: FFlecsInternedName(Intern(InName))
+	{
+	}
+
+	SOLID_INLINE explicit FFlecsInternedName(const FString& InName)
+		: FFlecsInternedName(Intern(FStringView(InName)))
+	{
+	}
+
+	SOLID_INLINE explicit FFlecsInternedName(const TCHAR* InName)
+		: FFlecsInternedName(Intern(FStringView(InName)))
+	{
+	}
+
+	NO_DISCARD SOLID_INLINE bool IsNone() const
+	{
+		return Entry == nullptr;
+	}
+
+	NO_DISCARD SOLID_INLINE const char* GetData() const
+	{
+		return Entry ? Entry->GetData() : "";
+	}
+
+	NO_DISCARD SOLID_INLINE int32 Len() const
+	{
+		return Entry ? Entry->Len() : 0;
+	}
+
+	NO_DISCARD SOLID_INLINE uint64 GetNameHash() const
+	{
+		return Entry ? Entry->NameHash : 0;
+	}
+
+	NO_DISCARD SOLID_INLINE FName ToName() const
+	{
+		return Entry ? Entry->Name : NAME_None;
+	}
+
+	// ReSharper disable once CppNonExplicitConversionOperator
+	SOLID_INLINE operator FName() const
+	{
+		return ToName();
+	}
+
+	NO_DISCARD SOLID_INLINE FString ToString() const
+	{
+		return FString(Len(), GetData());
+	}
+
+	NO_DISCARD SOLID_INLINE const FFlecsInternedNameEntry* GetEntry() const
+	{
+		return Entry;
+	}
+
+	/**
+	 * @brief Compare against a name as stored by flecs, without allocating.
+	 * @param InNativeName The null-terminated native name, may be nullptr
+	 */
+	NO_DISCARD bool MatchesNativeName(const char* InNativeName) const;
+
+	NO_DISCARD SOLID_INLINE bool operator==(const FFlecsInternedName& Other) const
+	{
+		return Entry == Other.Entry;
+	}
+
+	NO_DISCARD SOLID_INLINE bool operator!=(const FFlecsInternedName& Other) const
+	{
+		return Entry != Other.Entry;
+	}
+
+private:
+	SOLID_INLINE explicit FFlecsInternedName(const FFlecsInternedNameEntry* InEntry)
+		: Entry(InEntry)
+	{
+	}
+
+	const FFlecsInternedNameEntry* Entry = nullptr;
+
+}; // struct FFlecsInternedName
+
+DEFINE_STD_HASH(FFlecsInternedName);
+
+namespace UE::Flecs
+{
+	/**
+	 * @brief Look up a direct child by interned name, a single name index probe with the precomputed hash.
+	 * @param InWorld The world or stage
+	 * @param InParent The parent to search in, 0 for the root scope
+	 * @param InName The name of the child
+	 * @return The child entity, or 0 if not found
+	 */
+	NO_DISCARD SOLID_INLINE flecs::entity_t LookupChild(const flecs::world_t* InWorld, const flecs::entity_t InParent,
+		const FFlecsInternedName& InName)
+	{
+		if UNLIKELY_IF(InName.IsNone())
+		{
+			return 0;
+		}
+
+		return ecs_lookup_child_w_hash(InWorld, InParent, InName.GetData(), InName.Len(), InName.GetNameHash());
+	}
+	
+} // namespace UE::Flecs
+
+/**
+ * @brief A hierarchical entity path split once into interned names, relative to the root scope.
+ * e.g. "Parent::Child::Leaf" is stored as { Parent, Child, Leaf }
+ */
+struct UNREALFLECS_API FFlecsInternedPath
+{
+	using FElementArray = TArray<FFlecsInternedName, TInlineAllocator<8>>;
+
+	NO_DISCARD FORCEINLINE friend uint32 GetTypeHash(const FFlecsInternedPath& InPath)
+	{
+		return static_cast<uint32>(InPath.PathHash);
+	}
+
+public:
+	SOLID_INLINE FFlecsInternedPath() = default;
+
+	explicit FFlecsInternedPath(const FString& InPath, const FString& InSeparator = TEXT("::"));
+
+	// ReSharper disable once CppNonExplicitConvertingConstructor
+	FFlecsInternedPath(const FFlecsInternedName& InName);
+
+	explicit FFlecsInternedPath(const TConstArrayView<FFlecsInternedName> InElements);
+
+	NO_DISCARD SOLID_INLINE bool IsEmpty() const
+	{
+		return Elements.IsEmpty();
+	}
+
+	NO_DISCARD SOLID_INLINE int32 Num() const
+	{
+		return Elements.Num();
+	}
+
+	NO_DISCARD SOLID_INLINE const FElementArray& GetElements() const
+	{
+		return Elements;
+	}
+
+	NO_DISCARD SOLID_INLINE const FFlecsInternedName& GetLeaf() const
+	{
+		solid_check(!Elements.IsEmpty());
+		return Elements.Last();
+	}
+
+	NO_DISCARD SOLID_INLINE uint64 GetPathHash() const
+	{
+		return PathHash;
+	}
+
+	NO_DISCARD FString ToString(const FString& InSeparator = TEXT("::")) const;
+
+	NO_DISCARD SOLID_INLINE bool operator==(const FFlecsInternedPath& Other) const
+	{
+		return PathHash == Other.PathHash && Elements == Other.Elements;
+	}
+
+	NO_DISCARD SOLID_INLINE bool operator!=(const FFlecsInternedPath& Other) const
+	{
+		return !(*this == Other);
+	}
+
+private:
+	void RecalculatePathHash();
+
+	FElementArray Elements;
+	uint64 PathHash = 0;
+
+}; // struct FFlecsInternedPath
+
+DEFINE_STD_HASH(FFlecsInternedPath);
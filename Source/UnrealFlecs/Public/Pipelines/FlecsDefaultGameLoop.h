@@ -6,6 +6,9 @@
 
 #include "FlecsPipelineHandle.h"
 #include "FlecsGameLoopObject.h"
+#include "Observers/FlecsObserverHandle.h"
+#include "Systems/FlecsPhasesType.h"
+#include "Systems/FlecsSystemHandle.h"
 
 #include "FlecsDefaultGameLoop.generated.h"
 
@@ -26,6 +29,20 @@ public:
 	UPROPERTY(EditAnywhere)
 	bool bUsePhasesInUnrealTickGroups = false;
 
+	/**
+	 * Creates a commit system for every component with FFlecsDoubleBufferedTrait, which copies the live value into
+	 * (FFlecsPreviousFrame, Component) once per frame.
+	 * Late phase systems that only read the pair with ScheduleByAccess share a sync point with the simulation systems
+	 * writing the live component and aren't ordered after them.
+	 * Replication doesn't read the pair, UFlecsNetDirtySystem serializes the live components.
+	 */
+	UPROPERTY(EditAnywhere)
+	bool bCommitDoubleBufferedComponents = true;
+
+	// Systems in later phases read the value committed this frame, systems in earlier phases the one from the last frame
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "bCommitDoubleBufferedComponents"))
+	EFlecsPhaseType DoubleBufferCommitPhase = EFlecsPhaseType::PostFrame;
+
 	// Main Loop
 	UPROPERTY()
 	FFlecsPipelineHandle MainLoopPipeline;
@@ -42,7 +59,12 @@ public:
 	UPROPERTY()
 	FFlecsPipelineHandle PostUpdateWorkPipeline;
 
+	UPROPERTY()
+	FFlecsObserverHandle DoubleBufferedComponentObserver;
+
 protected:
 	NO_DISCARD FFlecsPipelineHandle CreatePipelineForTickType(const FGameplayTag& InTickType, TSolidNotNull<UFlecsWorld*> InWorld) const;
+
+	NO_DISCARD FFlecsSystemHandle CreateDoubleBufferCommitSystem(const FFlecsId InComponent, TSolidNotNull<UFlecsWorld*> InWorld) const;
 	
 }; // class UFlecsDefaultGameLoop
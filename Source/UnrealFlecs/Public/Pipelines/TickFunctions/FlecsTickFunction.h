@@ -7,6 +7,8 @@
 #include "Engine/EngineBaseTypes.h"
 #include "GameplayTagContainer.h"
 
+#include "FlecsTickFunctionWorldAccess.h"
+
 #include "FlecsTickFunction.generated.h"
 
 class UFlecsWorld;
@@ -20,6 +22,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Flecs")
 	FGameplayTag TickTypeTag;
 
+	/** The world access lock is held with this access while the game loops progress */
+	UPROPERTY(EditDefaultsOnly, Category = "Flecs")
+	EFlecsTickFunctionWorldAccess WorldAccess = EFlecsTickFunctionWorldAccess::ReadWrite;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UFlecsWorld> OwningWorld;
 
@@ -0,0 +1,25 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "FlecsTickFunctionWorldAccess.generated.h"
+
+/**
+ * How a tick function accesses the Flecs world while its game loops progress, used to decide what may run alongside it.
+ * ReadOnly tick functions run their pipelines in Flecs readonly mode, each on its own stage, so several of them
+ * can progress at the same time next to game thread code that only reads the world.
+ * @see FFlecsWorldAccessLock
+ */
+UENUM(BlueprintType)
+enum class EFlecsTickFunctionWorldAccess : uint8
+{
+	/**
+	 * Systems only read the world, their commands are merged once the last reader is done.
+	 * Sync points within the pipeline are not honored and immediate systems can't be run.
+	 */
+	ReadOnly,
+	/** Systems may write components or change the structure of the world, nothing else may access it while they run */
+	ReadWrite,
+}; // enum class EFlecsTickFunctionWorldAccess
@@ -17,6 +17,7 @@
 #include "Worlds/FlecsWorld.h"
 #include "Entities/FlecsComponentHandle.h"
 #include "Components/FlecsAddReferencedObjectsTrait.h"
+#include "Components/FlecsDoubleBufferedTrait.h"
 #include "Properties/FlecsComponentRegistrationHooks.h"
 #include "Queries/Generator/FlecsQueryGeneratorInput.h"
 #include "Queries/Generator/FlecsQueryGeneratorInputType.h"
@@ -204,6 +205,10 @@ public:
 	static constexpr bool Replicate = false;
 
 	static constexpr bool WithAddReferencedObjects = false;
+
+	// Keeps the value from the end of the previous frame in (FFlecsPreviousFrame, T), @see FFlecsDoubleBufferedTrait
+	static constexpr bool DoubleBuffered = false;
+
 	static constexpr bool RegisterMemberProperties = true;
 	static constexpr bool RegisterWithUnrealModule = std::is_void<ChildOf>::value;
 
@@ -315,6 +320,9 @@ public:
 	UPROPERTY()
 	uint32 bWithAddReferencedObjects : 1 = false;
 
+	UPROPERTY()
+	uint32 bDoubleBuffered : 1 = false;
+
 	// Only matters if the component is a UScriptStruct Type
 	UPROPERTY()
 	uint32 bRegisterMemberProperties : 1 = false;
@@ -374,6 +382,7 @@ public:
 			.bFinal = TFlecsComponentTraits<T>::Final,
 			.bReplicate = TFlecsComponentTraits<T>::Replicate,
 			.bWithAddReferencedObjects = TFlecsComponentTraits<T>::WithAddReferencedObjects,
+			.bDoubleBuffered = TFlecsComponentTraits<T>::DoubleBuffered,
 			.bRegisterMemberProperties = TFlecsComponentTraits<T>::RegisterMemberProperties,
 			.bRegisterWithModule = TFlecsComponentTraits<T>::RegisterWithUnrealModule,
 			.OwningModule = TFlecsComponentTraits<T>::GetOwningModule()
@@ -575,6 +584,12 @@ public:
 				ComponentHandle.Add<FFlecsAddReferencedObjectsTrait>();
 			}
 
+			if constexpr (TFlecsComponentTraits<T>::DoubleBuffered)
+			{
+				static_assert(!std::is_empty_v<T>, "Tags have no value to double buffer");
+				ComponentHandle.Add<FFlecsDoubleBufferedTrait>();
+			}
+
 			if constexpr (TFlecsComponentTraits<T>::Singleton)
 			{
 				ComponentHandle.Add(flecs::Singleton);
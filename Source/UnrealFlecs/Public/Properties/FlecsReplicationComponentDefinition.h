@@ -28,6 +28,9 @@ struct UNREALFLECS_API FFlecsReplicationComponentDefinition
 
 	bool bIsTag = false;
 
+	/** Equal values have equal bytes, so values can be compared without serializing them. */
+	bool bIsBitwiseComparable = false;
+
 	TObjectPtr<UScriptStruct> ScriptStruct = nullptr;
 
 	FFlecsReplicationSerializeFunction Serialize = nullptr;
@@ -87,6 +90,7 @@ namespace UE::Flecs::Replication
 		Definition.Size = sizeof(T);
 		Definition.Alignment = alignof(T);
 		Definition.bIsTag = std::is_empty_v<T>;
+		Definition.bIsBitwiseComparable = std::has_unique_object_representations_v<T>;
 
 		if constexpr (Solid::IsScriptStruct<T>())
 		{
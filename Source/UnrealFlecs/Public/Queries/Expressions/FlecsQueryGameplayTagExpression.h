@@ -0,0 +1,35 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#include "FlecsQueryExpression.h"
+#include "Queries/Enums/FlecsQueryOperators.h"
+
+#include "FlecsQueryGameplayTagExpression.generated.h"
+
+/**
+ * Matches entities that have a gameplay tag or any of its child tags, the query equivalent of FGameplayTag::MatchesTag.
+ * Tag entities inherit (IsA) from their parent tag entity, so the term is resolved by flecs component inheritance:
+ * the descendants of the tag entity are collected once per evaluation and each of them is matched against whole tables,
+ * there is no per entity check.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Gameplay Tag Query (Matches Child Tags)"))
+struct UNREALFLECS_API FFlecsQueryGameplayTagExpression : public FFlecsQueryExpression
+{
+	GENERATED_BODY()
+
+public:
+	FFlecsQueryGameplayTagExpression();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FGameplayTag GameplayTag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EFlecsQueryOperator Operator = EFlecsQueryOperator::Default;
+
+	virtual void Apply(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, FFlecsQueryBuilderView& InQueryBuilder) const override;
+	
+}; // struct FFlecsQueryGameplayTagExpression
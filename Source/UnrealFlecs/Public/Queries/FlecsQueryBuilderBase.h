@@ -15,6 +15,7 @@
 #include "Callbacks/FlecsOrderByCallbackDefinition.h"
 #include "Expressions/FlecsQueryCascadeExpression.h"
 #include "Expressions/FlecsQueryDescendingExpression.h"
+#include "Expressions/FlecsQueryGameplayTagExpression.h"
 #include "Expressions/FlecsQueryGroupByExpression.h"
 #include "Expressions/FlecsQueryOrderByExpression.h"
 #include "Expressions/FlecsQueryScriptExpression.h"
@@ -152,11 +153,11 @@ public:
 	{
 		if (bInDetectChanges)
 		{
-			this->GetQueryDefinition().Flags |= static_cast<uint8>(EFlecsQueryFlags::DetectChanges);
+			this->GetQueryDefinition().Flags |= static_cast<uint32>(EFlecsQueryFlags::DetectChanges);
 		}
 		else
 		{
-			this->GetQueryDefinition().Flags &= ~static_cast<uint8>(EFlecsQueryFlags::DetectChanges);
+			this->GetQueryDefinition().Flags &= ~static_cast<uint32>(EFlecsQueryFlags::DetectChanges);
 		}
 		
 		return GetSelf();
@@ -568,6 +569,30 @@ public:
 		return GetSelf();
 	}
 	
+	/**
+	 * @brief Match entities that have the tag or any of its child tags.
+	 * Unlike With(FGameplayTag), which only matches the exact tag.
+	 * The term is added after all regular terms, term modifiers don't apply to it.
+	 */
+	FORCEINLINE_DEBUGGABLE FInheritedType& WithMatchingTag(const FGameplayTag& InGameplayTag,
+		const EFlecsQueryOperator InOperator = EFlecsQueryOperator::Default)
+	{
+		FFlecsQueryGameplayTagExpression Expr;
+		Expr.GameplayTag = InGameplayTag;
+		Expr.Operator = InOperator;
+
+		this->GetQueryDefinition().AddAdditionalExpression(Expr);
+		return GetSelf();
+	}
+
+	/**
+	 * @brief Exclude entities that have the tag or any of its child tags.
+	 */
+	FORCEINLINE_DEBUGGABLE FInheritedType& WithoutMatchingTag(const FGameplayTag& InGameplayTag)
+	{
+		return WithMatchingTag(InGameplayTag, EFlecsQueryOperator::Not);
+	}
+
 	template <typename T>
 	FORCEINLINE_DEBUGGABLE FInheritedType& Without()
 	{
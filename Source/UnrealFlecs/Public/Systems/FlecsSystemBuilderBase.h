@@ -191,6 +191,12 @@ public:
 		return this->GetSelf();
 	}
 	
+	FORCEINLINE TInherited& ScheduleByAccess(const bool bInScheduleByAccess = true)
+	{
+		GetSystemDefinition().bScheduleByAccess = bInScheduleByAccess;
+		return this->GetSelf();
+	}
+	
 	FORCEINLINE TInherited& Interval(const double InInterval)
 	{
 		GetSystemDefinition().Interval = InInterval;
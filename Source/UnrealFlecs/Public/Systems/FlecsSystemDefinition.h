@@ -42,6 +42,14 @@ public:
 	UPROPERTY(EditAnywhere)
 	bool bImmediate = false;
 	
+	/**
+	 * Run the system concurrently with adjacent systems that don't access the same components,
+	 * ordered after the earlier systems that do, based on the access (In/Out/InOut) of its query terms.
+	 * Systems without query terms are ordered against every other system. Ignored for immediate systems.
+	 */
+	UPROPERTY(EditAnywhere)
+	bool bScheduleByAccess = false;
+	
 	UPROPERTY(EditAnywhere)
 	FFlecsSystemPipelineInput PipelineInput;
 	
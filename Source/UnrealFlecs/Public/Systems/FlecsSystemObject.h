@@ -38,6 +38,9 @@ public:
 	UPROPERTY(EditAnywhere)
 	TOptional<bool> ImmediateOverride;
 	
+	UPROPERTY(EditAnywhere)
+	TOptional<bool> ScheduleByAccessOverride;
+	
 	UPROPERTY(EditAnywhere)
 	TOptional<FFlecsSystemPipelineInput> PipelineInputOverride;
 	
@@ -0,0 +1,85 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "flecs.h"
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#include "SolidMacros/Macros.h"
+
+struct FGameplayTagNode;
+
+/**
+ * @brief Per-world mapping from gameplay tags to their tag entities, indexed by the tag's net index.
+ * Tag entities mirror the gameplay tag tree as named children of a root entity. They are either all created at
+ * world startup in a single deferred batch that walks the tag tree, or lazily the first time a tag entity is requested.
+ * Entries store the tag name next to the entity, so a net index that was reassigned after the tag tree changed
+ * is treated as a miss instead of returning the wrong entity.
+ */
+class UNREALFLECS_API FFlecsGameplayTagEntityIndex
+{
+public:
+	/**
+	 * @brief Reset the index.
+	 * @param InRootEntity The entity that top level tags are created under
+	 * @param bInLazy Only create tag entities the first time they are requested
+	 */
+	void Initialize(const flecs::entity_t InRootEntity, const bool bInLazy);
+
+	/**
+	 * @brief Create the entities of every tag known to the gameplay tags manager in a single deferred batch.
+	 * @param InWorld The world or stage to create the entities in
+	 */
+	void RegisterAllTags(flecs::world_t* InWorld);
+
+	/**
+	 * @brief Find the entity of a tag without creating it.
+	 * @return The tag entity, or 0 if the tag entity wasn't created yet.
+	 */
+	NO_DISCARD flecs::entity_t Find(const FGameplayTag& InTag) const;
+
+	/**
+	 * @brief Find the entity of a tag by its net index, as replicated by the gameplay tags manager.
+	 * @return The tag entity, or 0 if the tag entity wasn't created yet.
+	 */
+	NO_DISCARD flecs::entity_t FindByNetIndex(const FGameplayTagNetIndex InNetIndex) const;
+
+	/**
+	 * @brief Find the entity of a tag, creating it and any missing parent tag entities.
+	 * Creates entities, so it can't be called while the world is in multithreaded mode.
+	 * @param InWorld The world or stage to create missing entities in
+	 * @return The tag entity, or 0 if the tag isn't known to the gameplay tags manager.
+	 */
+	NO_DISCARD flecs::entity_t FindOrCreate(flecs::world_t* InWorld, const FGameplayTag& InTag);
+
+	NO_DISCARD FORCEINLINE bool IsLazy() const
+	{
+		return bLazy;
+	}
+
+	/**
+	 * @brief Get the number of tag entities that have been created.
+	 */
+	NO_DISCARD FORCEINLINE int32 Num() const
+	{
+		return Count;
+	}
+
+private:
+	struct FEntry
+	{
+		FName TagName;
+		flecs::entity_t Entity = 0;
+	}; // struct FEntry
+
+	flecs::entity_t CreateTagEntity(flecs::world_t* InWorld, const FGameplayTagNode& InNode);
+
+	TArray<FEntry> Entries;
+
+	flecs::entity_t RootEntity = 0;
+	int32 Count = 0;
+	bool bLazy = false;
+
+}; // class FFlecsGameplayTagEntityIndex
@@ -0,0 +1,57 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "flecs.h"
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+#include "Standard/robin_hood.h"
+
+#include "Entities/FlecsInternedName.h"
+
+/**
+ * @brief Per-world cache of resolved interned paths.
+ * Each entry stores the resolved entity for every level of the path, a hit is revalidated by checking
+ * that each level is still alive, still parented to the previous level and still carries the same name,
+ * so renames, reparenting and deletes never return stale entities.
+ */
+class UNREALFLECS_API FFlecsNamePathCache
+{
+public:
+	using FEntityChain = TArray<flecs::entity_t, TInlineAllocator<8>>;
+
+	static constexpr int32 MaxCachedPaths = 1 << 14;
+
+	/**
+	 * @brief Resolve a path from the root scope, returns 0 if any level of the path does not exist.
+	 * @param InWorld The world or stage to resolve in
+	 * @param InPath The path to resolve
+	 */
+	NO_DISCARD flecs::entity_t Resolve(const flecs::world_t* InWorld, const FFlecsInternedPath& InPath);
+
+	/**
+	 * @brief Resolve a path from the root scope, creating any missing levels as named children.
+	 * @param InWorld The world or stage to resolve in
+	 * @param InPath The path to resolve, must not be empty
+	 */
+	NO_DISCARD flecs::entity_t ResolveOrCreate(flecs::world_t* InWorld, const FFlecsInternedPath& InPath);
+
+	void Reset();
+
+	NO_DISCARD int32 Num() const;
+
+private:
+	NO_DISCARD bool FindValidEntry(const flecs::world_t* InWorld, const FFlecsInternedPath& InPath,
+		flecs::entity_t& OutEntity) const;
+
+	void StoreEntry(const FFlecsInternedPath& InPath, FEntityChain&& InChain);
+
+	static NO_DISCARD bool IsChainValid(const flecs::world_t* InWorld, const FFlecsInternedPath& InPath,
+		const FEntityChain& InChain);
+
+	mutable FRWLock Lock;
+	robin_hood::unordered_flat_map<FFlecsInternedPath, FEntityChain> Entries;
+
+}; // class FFlecsNamePathCache
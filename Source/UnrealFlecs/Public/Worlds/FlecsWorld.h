@@ -10,6 +10,7 @@
 #include "flecs.h"
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 
 #include "SolidMacros/Macros.h"
 #include "Types/SolidNotNull.h"
@@ -22,6 +23,9 @@
 #include "Entities/FlecsId.h"
 #include "Pipelines/FlecsPipelineHandle.h"
 #include "Queries/FlecsQuery.h"
+#include "Worlds/FlecsGameplayTagEntityIndex.h"
+#include "Worlds/FlecsNamePathCache.h"
+#include "Worlds/FlecsWorldAccessLock.h"
 #include "Worlds/FlecsWorldInterfaceObject.h"
 
 #include "FlecsWorld.generated.h"
@@ -151,8 +155,27 @@ public:
 
 	void HandleWorldPause();
 
+	/**
+	 * @brief Progress the game loops of a tick type while holding the world access lock with the given access.
+	 * With ReadOnly access the pipelines run in Flecs readonly mode on a stage of their own,
+	 * alongside other readers, and their commands are merged when the last reader is done.
+	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "Flecs | World")
-	bool ProgressGameLoops(const FGameplayTag& TickTypeTag, const double DeltaTime = 0.0);
+	bool ProgressGameLoops(const FGameplayTag& TickTypeTag, const double DeltaTime = 0.0,
+		const EFlecsTickFunctionWorldAccess InAccess = EFlecsTickFunctionWorldAccess::ReadWrite);
+
+	/**
+	 * @brief Lock guarding the world against tick functions that run on any thread.
+	 * Tick functions hold it while progressing, shared if they are ReadOnly and exclusive otherwise,
+	 * Progress and RunPipeline take ReadWrite access when the calling thread holds none.
+	 * Game thread code that uses the world while such a tick function may be running should hold it
+	 * with an FFlecsWorldAccessScope, changing the world off the game thread without ReadWrite access asserts.
+	 * @see EFlecsTickFunctionWorldAccess
+	 */
+	NO_DISCARD FORCEINLINE FFlecsWorldAccessLock& GetWorldAccessLock() const
+	{
+		return WorldAccessLock;
+	}
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "Flecs | World")
 	bool Progress(const double DeltaTime = 0.0);
@@ -266,6 +289,16 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "Flecs")
 	void RunPipeline(const FFlecsId InPipeline, const double DeltaTime = 0.0) const;
 	
+	/**
+	 * @brief Get the schedule of a pipeline as a graphviz (dot) graph, as of the last time it ran.
+	 * Systems that are scheduled by access are linked to the systems they wait for,
+	 * systems without a path between them run concurrently.
+	 * @param InPipeline The pipeline, or an invalid id for the default pipeline.
+	 * @return The dot graph, or an empty string if the entity isn't a pipeline.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Flecs")
+	FString GetPipelineScheduleDot(const FFlecsId InPipeline) const;
+	
 	/*UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "Flecs")
 	FFlecsQuery GetQueryFromEntity(const FFlecsEntityHandle& InEntity) const;*/
 	
@@ -332,7 +365,7 @@ public:
 	NO_DISCARD TSolidNotNull<UFlecsStage*> CreateAsyncStage();
 	
 	void ImportRestModule();
-	void ImportStatsModule();
+	void ImportStatsModule(const float InSampleInterval = 0.0f);
 
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
@@ -370,7 +403,18 @@ public:
 	UPROPERTY()
 	TMap<FName, TObjectPtr<UFlecsEntityRange>> EntityRanges;
 
-	robin_hood::unordered_flat_map<FGameplayTag, FFlecsId> TagEntityMap;
+	FFlecsGameplayTagEntityIndex TagEntityIndex;
+
+	FFlecsNamePathCache NamePathCache;
+
+	mutable FFlecsWorldAccessLock WorldAccessLock;
+
+	/** Async stages that ReadOnly pipelines enqueue their commands on, one per pipeline running at a time */
+	UPROPERTY()
+	TArray<TObjectPtr<UFlecsStage>> ReadOnlyStages;
+
+	TArray<UFlecsStage*> FreeReadOnlyStages;
+	FCriticalSection ReadOnlyStagesCriticalSection;
 	
 protected:
 	virtual flecs::world* GetNativeFlecsWorld_Internal() const override
@@ -378,11 +422,21 @@ protected:
 		return const_cast<flecs::world*>(&World);
 	}
 
+	virtual void CheckWorldWriteAccess() const override;
+
 private:
 	flecs::world World;
 	
 	void CallUnregisterOnRegisteredObjects();
 
+	void BeginSharedWorldAccess();
+	void EndSharedWorldAccess();
+
+	void RunPipelineReadOnly(const FFlecsId InPipeline, const double DeltaTime);
+
+	NO_DISCARD UFlecsStage* AcquireReadOnlyStage();
+	void ReleaseReadOnlyStage(UFlecsStage* InStage);
+
 	NO_DISCARD UFlecsEntityRange* FindTrackedEntityRange(const ecs_entity_range_t* InNativeEntityRange) const;
 	NO_DISCARD UFlecsEntityRange* FindTrackedEntityRange(const FName& InRangeName) const;
 	UFlecsEntityRange* TrackEntityRange(const ecs_entity_range_t* InNativeEntityRange, const FName& InRangeName);
@@ -0,0 +1,81 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Experimental/Async/ConditionVariable.h"
+
+#include "SolidMacros/Macros.h"
+
+#include "Pipelines/TickFunctions/FlecsTickFunctionWorldAccess.h"
+
+/**
+ * @brief Readers-writer lock guarding a Flecs world against tick functions that run on any thread.
+ * ReadOnly holders share the world and a ReadWrite holder has it to itself, waiting writers hold off new readers.
+ * Access is tracked per thread and is re-entrant, a thread holding ReadWrite access may take either access again,
+ * a thread holding ReadOnly access may only take ReadOnly access again.
+ * OnSharedBegin runs before the first reader enters and OnSharedEnd after the last reader leaves,
+ * both while no other thread holds the lock.
+ */
+class UNREALFLECS_API FFlecsWorldAccessLock
+{
+public:
+	void Lock(const EFlecsTickFunctionWorldAccess InAccess);
+	void Unlock();
+
+	/** The access held by the calling thread, unset if it holds none */
+	NO_DISCARD TOptional<EFlecsTickFunctionWorldAccess> GetThreadAccess() const;
+
+	/** Whether any thread holds the lock, only a hint unless the calling thread holds it */
+	NO_DISCARD FORCEINLINE bool IsHeld() const
+	{
+		return HolderCount.load(std::memory_order_relaxed) > 0;
+	}
+
+	TUniqueFunction<void()> OnSharedBegin;
+	TUniqueFunction<void()> OnSharedEnd;
+
+private:
+	void LockShared();
+	void UnlockShared();
+
+	void LockExclusive();
+	void UnlockExclusive();
+
+	FCriticalSection Mutex;
+	UE::FConditionVariable Condition;
+
+	int32 ReaderCount = 0;
+	int32 WaitingWriterCount = 0;
+	bool bHasWriter = false;
+	bool bIsTransitioning = false;
+
+	std::atomic<int32> HolderCount = 0;
+
+}; // class FFlecsWorldAccessLock
+
+// RAII helper to hold world access for the lifetime of a scope.
+struct UNREALFLECS_API FFlecsWorldAccessScope
+{
+public:
+	FORCEINLINE FFlecsWorldAccessScope(FFlecsWorldAccessLock& InLock, const EFlecsTickFunctionWorldAccess InAccess)
+		: Lock(InLock)
+	{
+		Lock.Lock(InAccess);
+	}
+
+	FORCEINLINE ~FFlecsWorldAccessScope()
+	{
+		Lock.Unlock();
+	}
+
+	FFlecsWorldAccessScope(const FFlecsWorldAccessScope&) = delete;
+	FFlecsWorldAccessScope& operator=(const FFlecsWorldAccessScope&) = delete;
+
+private:
+	FFlecsWorldAccessLock& Lock;
+
+}; // struct FFlecsWorldAccessScope
@@ -14,6 +14,7 @@
 #include "Entities/FlecsEntityHandle.h"
 #include "Entities/FlecsComponentHandle.h"
 #include "Entities/FlecsId.h"
+#include "Entities/FlecsInternedName.h"
 #include "Observers/FlecsObserverBuilder.h"
 #include "Pipelines/FlecsPipelineBuilder.h"
 #include "Pipelines/FlecsPipelineHandle.h"
@@ -225,6 +226,22 @@ public:
 	
 	NO_DISCARD FFlecsEntityHandle LookupEntityBySymbol_Internal(const FString& Symbol,
 		const bool bLookupAsPath = false, const bool bRecursive = true) const;
+
+	/**
+	 * @brief Lookup an entity by an interned path relative to the root scope, without converting or rehashing names.
+	 * Repeated lookups of the same path are served from the world's path cache.
+	 * @param InPath The interned path to lookup
+	 * @return The entity, or an invalid handle if any level of the path does not exist
+	 */
+	NO_DISCARD FFlecsEntityHandle LookupEntity(const FFlecsInternedPath& InPath) const;
+
+	/**
+	 * @brief Lookup a direct child of a parent by interned name
+	 * @param InParent The parent, a null id looks up in the root scope
+	 * @param InName The name of the child
+	 * @return The child, or an invalid handle if it does not exist
+	 */
+	NO_DISCARD FFlecsEntityHandle LookupChild(const FFlecsId InParent, const FFlecsInternedName& InName) const;
 	
 	/**
 	 * @brief Add a singleton component to the world
@@ -234,6 +251,7 @@ public:
 	template <typename T>
 	UFlecsWorldInterfaceObject* Add() const
 	{
+		CheckWorldWriteAccess();
 		GetNativeFlecsWorld_Internal()->add<T>();
 		return GetSelfInterface_Internal();
 	}
@@ -247,6 +265,7 @@ public:
 	template <typename T>
 	UFlecsWorldInterfaceObject* Set(const T& Value) const
 	{
+		CheckWorldWriteAccess();
 		GetNativeFlecsWorld_Internal()->set<T>(Value);
 		return GetSelfInterface_Internal();
 	}
@@ -254,6 +273,7 @@ public:
 	template <typename T>
 	UFlecsWorldInterfaceObject* Set(T&& Value) const
 	{
+		CheckWorldWriteAccess();
 		GetNativeFlecsWorld_Internal()->set<T>(FLECS_FWD(Value));
 		return GetSelfInterface_Internal();
 	}
@@ -266,6 +286,7 @@ public:
 	template <typename T>
 	UFlecsWorldInterfaceObject* Remove() const
 	{
+		CheckWorldWriteAccess();
 		GetNativeFlecsWorld_Internal()->remove<T>();
 		return GetSelfInterface_Internal();
 	}
@@ -514,6 +535,14 @@ public:
 		meta = (AdvancedDisplay = "Separator, RootSeparator"))
 	FFlecsEntityHandle CreateEntity(const FString& Name = "",
 		const FString& Separator = "::", const FString& RootSeparator = "::") const;
+
+	/**
+	 * @brief Create a new entity at an interned path relative to the root scope,
+	 * missing parents are created and an already existing entity at that path is returned.
+	 * @param InPath The interned path, must not be empty
+	 * @return The created or existing entity handle
+	 */
+	FFlecsEntityHandle CreateEntity(const FFlecsInternedPath& InPath) const;
 	
 	/**
 	 * @brief Obtain a typed entity handle for the given Type
@@ -750,6 +779,9 @@ public:
 protected:
 	virtual flecs::world* GetNativeFlecsWorld_Internal() const 
 		PURE_VIRTUAL(UFlecsWorldInterfaceObject::GetNativeFlecsWorld_Internal, return nullptr;);
+
+	/** Asserts that the calling thread may change the world, stages are only ever used by one thread at a time */
+	virtual void CheckWorldWriteAccess() const {}
 	
 private:
 	NO_DISCARD FORCEINLINE UFlecsWorldInterfaceObject* GetSelfInterface_Internal() const
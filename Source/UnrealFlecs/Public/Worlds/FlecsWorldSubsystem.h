@@ -78,6 +78,6 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UFlecsWorld> DefaultWorld;
 
-	void RegisterAllGameplayTags(const TSolidNotNull<UFlecsWorld*> InFlecsWorld);
+	void RegisterAllGameplayTags(const TSolidNotNull<UFlecsWorld*> InFlecsWorld, const bool bInLazy);
 
 }; // class UFlecsWorldSubsystem
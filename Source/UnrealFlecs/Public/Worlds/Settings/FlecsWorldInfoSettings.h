@@ -10,6 +10,8 @@
 #include "SolidMacros/Macros.h"
 #include "Standard/Hashing.h"
 
+#include "Pipelines/TickFunctions/FlecsTickFunctionWorldAccess.h"
+
 #include "FlecsWorldInfoSettings.generated.h"
 
 struct FFlecsTickFunction;
@@ -51,6 +53,18 @@ public:
     UPROPERTY(EditAnywhere)
     float TickInterval = 0.0f;
 
+    /**
+     * Run the pipelines of this tick function on a task thread, alongside the rest of its tick group(s).
+     * Game thread code using the world in the same tick groups has to hold UFlecsWorld::GetWorldAccessLock()
+     * or be ordered after this tick function with tick prerequisites.
+     */
+    UPROPERTY(EditAnywhere)
+    bool bRunOnAnyThread = false;
+
+    /** ReadOnly tick functions that run on any thread progress alongside each other and game thread readers */
+    UPROPERTY(EditAnywhere)
+    EFlecsTickFunctionWorldAccess WorldAccess = EFlecsTickFunctionWorldAccess::ReadWrite;
+
     UPROPERTY()
     bool bHighPriority = true;
 
@@ -110,6 +124,14 @@ public:
     UPROPERTY(EditAnywhere, Category = "World")
     bool bImportStats = true;
     
+    // Seconds between stats samples, 0 samples every frame
+    UPROPERTY(EditAnywhere, Category = "World", meta = (EditCondition = "bImportStats", ClampMin = "0.0", Units = "s"))
+    float StatsSampleInterval = 0.0f;
+    
+    // Only create gameplay tag entities the first time they are requested, instead of all of them at startup
+    UPROPERTY(EditAnywhere, Category = "World", AdvancedDisplay)
+    bool bLazyGameplayTagEntities = false;
+    
     UPROPERTY(EditAnywhere, Instanced, Category = "Game Loop",
         meta = (ObjectMustImplement = "/Script/UnrealFlecs.FlecsGameLoopInterface", NoElementDuplicate))
     TArray<TObjectPtr<UObject>> GameLoops;
@@ -0,0 +1,23 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Spatial/FlecsQuerySpatialCellExpression.h"
+
+#include "Queries/FlecsQueryBuilderView.h"
+#include "Spatial/FlecsSpatialCellRelationship.h"
+#include "Worlds/FlecsWorldInterfaceObject.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsQuerySpatialCellExpression)
+
+FFlecsQuerySpatialCellExpression::FFlecsQuerySpatialCellExpression() : Super(false /* bInAllowsChildExpressions */)
+{
+}
+
+void FFlecsQuerySpatialCellExpression::Apply(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld,
+	FFlecsQueryBuilderView& InQueryBuilder) const
+{
+	// The builder keeps the name pointer until the query is created, so it has to outlive this call
+	InQueryBuilder.term();
+	InQueryBuilder.first(InWorld->GetScriptStructEntity<FFlecsSpatialCellRelationship>().GetFlecsId());
+	InQueryBuilder.second().var(UE::Flecs::Spatial::CellVariableName);
+	InQueryBuilder.src();
+}
@@ -0,0 +1,7 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Spatial/FlecsSpatialCellRelationship.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsSpatialCellRelationship)
+
+REGISTER_FLECS_COMPONENT(FFlecsSpatialCellRelationship);
@@ -0,0 +1,508 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Spatial/FlecsSpatialIndex.h"
+
+#include "Algo/Sort.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	/** Keeps cell coordinates of huge query shapes in range, the cells that exist are always inside of it */
+	constexpr double MaxCellCoord = static_cast<double>(MAX_int32 / 2);
+	
+	NO_DISCARD FORCEINLINE FIntVector ToClampedCellCoord(const FVector& InLocation, const double InInvCellSize)
+	{
+		return FIntVector(
+			static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(InLocation.X * InInvCellSize), -MaxCellCoord, MaxCellCoord)),
+			static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(InLocation.Y * InInvCellSize), -MaxCellCoord, MaxCellCoord)),
+			static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(InLocation.Z * InInvCellSize), -MaxCellCoord, MaxCellCoord)));
+	}
+	
+	/** Calls InFunction with the index of every location within the sphere, four locations per iteration */
+	template <typename TFunction>
+	FORCEINLINE void ForEachInSphere(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z,
+		const int32 InCount, const FVector& InCenter, const double InRadiusSquared, TFunction&& InFunction)
+	{
+		const VectorRegister4Double CenterX = VectorSetFloat1(InCenter.X);
+		const VectorRegister4Double CenterY = VectorSetFloat1(InCenter.Y);
+		const VectorRegister4Double CenterZ = VectorSetFloat1(InCenter.Z);
+		const VectorRegister4Double RadiusSquared = VectorSetFloat1(InRadiusSquared);
+		
+		int32 Index = 0;
+		
+		for (; Index + 4 <= InCount; Index += 4)
+		{
+			const VectorRegister4Double DeltaX = VectorSubtract(VectorLoad(X + Index), CenterX);
+			const VectorRegister4Double DeltaY = VectorSubtract(VectorLoad(Y + Index), CenterY);
+			const VectorRegister4Double DeltaZ = VectorSubtract(VectorLoad(Z + Index), CenterZ);
+			
+			const VectorRegister4Double DistanceSquared = VectorMultiplyAdd(DeltaX, DeltaX,
+				VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaZ, DeltaZ)));
+			
+			for (uint32 Mask = VectorMaskBits(VectorCompareLE(DistanceSquared, RadiusSquared)); Mask != 0; Mask &= Mask - 1)
+			{
+				InFunction(Index + static_cast<int32>(FMath::CountTrailingZeros(Mask)));
+			}
+		}
+		
+		for (; Index < InCount; ++Index)
+		{
+			if (FVector::DistSquared(FVector(X[Index], Y[Index], Z[Index]), InCenter) <= InRadiusSquared)
+			{
+				InFunction(Index);
+			}
+		}
+	}
+	
+	/** Calls InFunction with the index of every location inside the box, four locations per iteration */
+	template <typename TFunction>
+	FORCEINLINE void ForEachInBox(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z,
+		const int32 InCount, const FBox& InBox, TFunction&& InFunction)
+	{
+		const VectorRegister4Double MinX = VectorSetFloat1(InBox.Min.X);
+		const VectorRegister4Double MinY = VectorSetFloat1(InBox.Min.Y);
+		const VectorRegister4Double MinZ = VectorSetFloat1(InBox.Min.Z);
+		const VectorRegister4Double MaxX = VectorSetFloat1(InBox.Max.X);
+		const VectorRegister4Double MaxY = VectorSetFloat1(InBox.Max.Y);
+		const VectorRegister4Double MaxZ = VectorSetFloat1(InBox.Max.Z);
+		
+		int32 Index = 0;
+		
+		for (; Index + 4 <= InCount; Index += 4)
+		{
+			const VectorRegister4Double LocationX = VectorLoad(X + Index);
+			const VectorRegister4Double LocationY = VectorLoad(Y + Index);
+			const VectorRegister4Double LocationZ = VectorLoad(Z + Index);
+			
+			const VectorRegister4Double InsideX = VectorBitwiseAnd(VectorCompareGE(LocationX, MinX), VectorCompareLE(LocationX, MaxX));
+			const VectorRegister4Double InsideY = VectorBitwiseAnd(VectorCompareGE(LocationY, MinY), VectorCompareLE(LocationY, MaxY));
+			const VectorRegister4Double InsideZ = VectorBitwiseAnd(VectorCompareGE(LocationZ, MinZ), VectorCompareLE(LocationZ, MaxZ));
+			
+			for (uint32 Mask = VectorMaskBits(VectorBitwiseAnd(InsideX, VectorBitwiseAnd(InsideY, InsideZ))); Mask != 0; Mask &= Mask - 1)
+			{
+				InFunction(Index + static_cast<int32>(FMath::CountTrailingZeros(Mask)));
+			}
+		}
+		
+		for (; Index < InCount; ++Index)
+		{
+			if (InBox.IsInsideOrOn(FVector(X[Index], Y[Index], Z[Index])))
+			{
+				InFunction(Index);
+			}
+		}
+	}
+	
+	/** Writes the squared distance of every location to InCenter, four locations per iteration */
+	FORCEINLINE void ComputeDistancesSquared(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z,
+		const int32 InCount, const FVector& InCenter, double* RESTRICT OutDistancesSquared)
+	{
+		const VectorRegister4Double CenterX = VectorSetFloat1(InCenter.X);
+		const VectorRegister4Double CenterY = VectorSetFloat1(InCenter.Y);
+		const VectorRegister4Double CenterZ = VectorSetFloat1(InCenter.Z);
+		
+		int32 Index = 0;
+		
+		for (; Index + 4 <= InCount; Index += 4)
+		{
+			const VectorRegister4Double DeltaX = VectorSubtract(VectorLoad(X + Index), CenterX);
+			const VectorRegister4Double DeltaY = VectorSubtract(VectorLoad(Y + Index), CenterY);
+			const VectorRegister4Double DeltaZ = VectorSubtract(VectorLoad(Z + Index), CenterZ);
+			
+			VectorStore(VectorMultiplyAdd(DeltaX, DeltaX, VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaZ, DeltaZ))),
+				OutDistancesSquared + Index);
+		}
+		
+		for (; Index < InCount; ++Index)
+		{
+			OutDistancesSquared[Index] = FVector::DistSquared(FVector(X[Index], Y[Index], Z[Index]), InCenter);
+		}
+	}
+	
+	/** Squared distance from InPoint to the furthest point of InBox, a box closer than the radius is fully inside the sphere */
+	NO_DISCARD FORCEINLINE double ComputeFurthestDistanceSquared(const FBox& InBox, const FVector& InPoint)
+	{
+		const FVector Furthest(
+			FMath::Max(FMath::Abs(InPoint.X - InBox.Min.X), FMath::Abs(InPoint.X - InBox.Max.X)),
+			FMath::Max(FMath::Abs(InPoint.Y - InBox.Min.Y), FMath::Abs(InPoint.Y - InBox.Max.Y)),
+			FMath::Max(FMath::Abs(InPoint.Z - InBox.Min.Z), FMath::Abs(InPoint.Z - InBox.Max.Z)));
+		
+		return Furthest.SizeSquared();
+	}
+	
+} // namespace
+
+template <typename TFunction>
+void FFlecsSpatialIndex::ForEachCellInRange(const FIntVector& InMin, const FIntVector& InMax, TFunction&& InFunction) const
+{
+	const int64 RangeCellCount = (static_cast<int64>(InMax.X) - InMin.X + 1)
+		* (static_cast<int64>(InMax.Y) - InMin.Y + 1)
+		* (static_cast<int64>(InMax.Z) - InMin.Z + 1);
+	
+	// Large ranges visit the occupied cells instead of hashing every coordinate in them
+	if (RangeCellCount > Cells.Num())
+	{
+		for (const FCell& Cell : Cells)
+		{
+			if (Cell.Coord.X >= InMin.X && Cell.Coord.X <= InMax.X
+				&& Cell.Coord.Y >= InMin.Y && Cell.Coord.Y <= InMax.Y
+				&& Cell.Coord.Z >= InMin.Z && Cell.Coord.Z <= InMax.Z)
+			{
+				InFunction(Cell);
+			}
+		}
+		
+		return;
+	}
+	
+	for (int32 CoordZ = InMin.Z; CoordZ <= InMax.Z; ++CoordZ)
+	{
+		for (int32 CoordY = InMin.Y; CoordY <= InMax.Y; ++CoordY)
+		{
+			for (int32 CoordX = InMin.X; CoordX <= InMax.X; ++CoordX)
+			{
+				if (const int32* CellIndex = CellIndices.Find(FIntVector(CoordX, CoordY, CoordZ)))
+				{
+					InFunction(Cells[*CellIndex]);
+				}
+			}
+		}
+	}
+}
+
+FFlecsSpatialIndex::FFlecsSpatialIndex(const double InCellSize)
+{
+	SetCellSize(InCellSize);
+}
+
+void FFlecsSpatialIndex::SetCellSize(const double InCellSize)
+{
+	solid_checkf(InCellSize > UE_KINDA_SMALL_NUMBER, TEXT("Spatial index cell size must be positive"));
+	
+	CellSize = InCellSize;
+	InvCellSize = 1.0 / InCellSize;
+	Reset();
+}
+
+int32 FFlecsSpatialIndex::Update(const flecs::entity_t InEntity, const FVector& InLocation)
+{
+	const FIntVector Coord = GetCellCoord(InLocation);
+	
+	if (FEntry* Entry = Entries.Find(InEntity))
+	{
+		FCell& Cell = Cells[Entry->CellIndex];
+		
+		if LIKELY_IF(Cell.Coord == Coord)
+		{
+			Cell.X[Entry->Slot] = InLocation.X;
+			Cell.Y[Entry->Slot] = InLocation.Y;
+			Cell.Z[Entry->Slot] = InLocation.Z;
+			return INDEX_NONE;
+		}
+		
+		RemoveFromCell(*Entry);
+		
+		const int32 CellIndex = FindOrAddCell(Coord);
+		*Entry = AddToCell(CellIndex, InEntity, InLocation);
+		return CellIndex;
+	}
+	
+	const int32 CellIndex = FindOrAddCell(Coord);
+	Entries.Add(InEntity, AddToCell(CellIndex, InEntity, InLocation));
+	return CellIndex;
+}
+
+bool FFlecsSpatialIndex::Remove(const flecs::entity_t InEntity)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(InEntity, Entry))
+	{
+		return false;
+	}
+	
+	RemoveFromCell(Entry);
+	return true;
+}
+
+void FFlecsSpatialIndex::Reset()
+{
+	Cells.Reset();
+	CellIndices.Reset();
+	EmptiedCellIndices.Reset();
+	Entries.Reset();
+}
+
+void FFlecsSpatialIndex::RemoveEmptyCells(const TFunctionRef<void(flecs::entity_t)>& InFunction)
+{
+	// Highest index first, so the last cell (which takes the index of a removed one) is never still to be visited
+	EmptiedCellIndices.Sort(TGreater<int32>());
+	
+	int32 PreviousCellIndex = INDEX_NONE;
+	
+	for (const int32 CellIndex : EmptiedCellIndices)
+	{
+		if (CellIndex == PreviousCellIndex || !Cells[CellIndex].Entities.IsEmpty())
+		{
+			continue;
+		}
+		
+		PreviousCellIndex = CellIndex;
+		
+		if (Cells[CellIndex].CellEntity != 0)
+		{
+			InFunction(Cells[CellIndex].CellEntity);
+		}
+		
+		CellIndices.Remove(Cells[CellIndex].Coord);
+		Cells.RemoveAtSwap(CellIndex, 1, EAllowShrinking::No);
+		
+		// The last cell took the index
+		if (CellIndex < Cells.Num())
+		{
+			const FCell& MovedCell = Cells[CellIndex];
+			CellIndices.FindChecked(MovedCell.Coord) = CellIndex;
+			
+			for (const flecs::entity_t Entity : MovedCell.Entities)
+			{
+				Entries.FindChecked(Entity).CellIndex = CellIndex;
+			}
+		}
+	}
+	
+	EmptiedCellIndices.Reset();
+}
+
+void FFlecsSpatialIndex::QueryRadius(const FVector& InCenter, const double InRadius, TArray<flecs::entity_t>& OutEntities) const
+{
+	const double RadiusSquared = FMath::Square(InRadius);
+	
+	const FIntVector MinCoord = ToClampedCellCoord(InCenter - FVector(InRadius), InvCellSize);
+	const FIntVector MaxCoord = ToClampedCellCoord(InCenter + FVector(InRadius), InvCellSize);
+	
+	ForEachCellInRange(MinCoord, MaxCoord, [this, &InCenter, RadiusSquared, &OutEntities](const FCell& InCell)
+	{
+		const FBox Bounds = GetCellBounds(InCell.Coord);
+		
+		if (Bounds.ComputeSquaredDistanceToPoint(InCenter) > RadiusSquared)
+		{
+			return;
+		}
+		
+		if (ComputeFurthestDistanceSquared(Bounds, InCenter) <= RadiusSquared)
+		{
+			OutEntities.Append(InCell.Entities);
+			return;
+		}
+		
+		ForEachInSphere(InCell.X.GetData(), InCell.Y.GetData(), InCell.Z.GetData(), InCell.Entities.Num(),
+			InCenter, RadiusSquared, [&InCell, &OutEntities](const int32 InSlot)
+			{
+				OutEntities.Add(InCell.Entities[InSlot]);
+			});
+	});
+}
+
+void FFlecsSpatialIndex::QueryBox(const FBox& InBox, TArray<flecs::entity_t>& OutEntities) const
+{
+	const FIntVector MinCoord = ToClampedCellCoord(InBox.Min, InvCellSize);
+	const FIntVector MaxCoord = ToClampedCellCoord(InBox.Max, InvCellSize);
+	
+	ForEachCellInRange(MinCoord, MaxCoord, [this, &InBox, &OutEntities](const FCell& InCell)
+	{
+		if (InBox.IsInsideOrOn(GetCellBounds(InCell.Coord)))
+		{
+			OutEntities.Append(InCell.Entities);
+			return;
+		}
+		
+		ForEachInBox(InCell.X.GetData(), InCell.Y.GetData(), InCell.Z.GetData(), InCell.Entities.Num(),
+			InBox, [&InCell, &OutEntities](const int32 InSlot)
+			{
+				OutEntities.Add(InCell.Entities[InSlot]);
+			});
+	});
+}
+
+void FFlecsSpatialIndex::QueryNearest(const FVector& InCenter, const int32 InCount, TArray<flecs::entity_t>& OutEntities,
+	const double InMaxRadius) const
+{
+	if (InCount <= 0 || Entries.IsEmpty())
+	{
+		return;
+	}
+	
+	struct FCandidate
+	{
+		double DistanceSquared = 0.0;
+		flecs::entity_t Entity = 0;
+		
+	}; // struct FCandidate
+	
+	// Max heap, the top is the furthest of the current candidates
+	TArray<FCandidate, TInlineAllocator<32>> Candidates;
+	const auto FurthestFirst = [](const FCandidate& A, const FCandidate& B)
+	{
+		return A.DistanceSquared > B.DistanceSquared;
+	};
+	
+	const double MaxRadiusSquared = FMath::Square(FMath::Min(InMaxRadius, UE_BIG_NUMBER));
+	const auto GetWorstDistanceSquared = [&Candidates, InCount, MaxRadiusSquared]()
+	{
+		return Candidates.Num() < InCount ? MaxRadiusSquared : Candidates.HeapTop().DistanceSquared;
+	};
+	
+	TArray<double, TInlineAllocator<256>> DistancesSquared;
+	
+	const auto VisitCell = [&](const FCell& InCell)
+	{
+		if (InCell.Entities.IsEmpty()
+			|| GetCellBounds(InCell.Coord).ComputeSquaredDistanceToPoint(InCenter) > GetWorstDistanceSquared())
+		{
+			return;
+		}
+		
+		const int32 CellCount = InCell.Entities.Num();
+		DistancesSquared.SetNumUninitialized(CellCount, EAllowShrinking::No);
+		ComputeDistancesSquared(InCell.X.GetData(), InCell.Y.GetData(), InCell.Z.GetData(), CellCount,
+			InCenter, DistancesSquared.GetData());
+		
+		for (int32 Slot = 0; Slot < CellCount; ++Slot)
+		{
+			if (DistancesSquared[Slot] > GetWorstDistanceSquared())
+			{
+				continue;
+			}
+			
+			if (Candidates.Num() == InCount)
+			{
+				Candidates.HeapPopDiscard(FurthestFirst, EAllowShrinking::No);
+			}
+			
+			Candidates.HeapPush(FCandidate{ DistancesSquared[Slot], InCell.Entities[Slot] }, FurthestFirst);
+		}
+	};
+	
+	const FIntVector CenterCoord = ToClampedCellCoord(InCenter, InvCellSize);
+	const int64 CellCount = Cells.Num();
+	
+	for (int32 Ring = 0; ; ++Ring)
+	{
+		// The center can be anywhere in its cell, so cells in this ring are at least (Ring - 1) cells away from it
+		if (Ring > 0)
+		{
+			const double RingDistance = (Ring - 1) * CellSize;
+			
+			if (RingDistance > InMaxRadius
+				|| (Candidates.Num() == InCount && Candidates.HeapTop().DistanceSquared <= FMath::Square(RingDistance)))
+			{
+				break;
+			}
+		}
+		
+		// Once a ring has more cells than exist, visiting the remaining cells directly is cheaper than hashing
+		const int64 Side = 2 * static_cast<int64>(Ring) + 1;
+		if (Side * Side * Side > CellCount)
+		{
+			for (const FCell& Cell : Cells)
+			{
+				const FIntVector Offset = Cell.Coord - CenterCoord;
+				if (FMath::Max3(FMath::Abs(Offset.X), FMath::Abs(Offset.Y), FMath::Abs(Offset.Z)) >= Ring)
+				{
+					VisitCell(Cell);
+				}
+			}
+			
+			break;
+		}
+		
+		for (int32 OffsetZ = -Ring; OffsetZ <= Ring; ++OffsetZ)
+		{
+			for (int32 OffsetY = -Ring; OffsetY <= Ring; ++OffsetY)
+			{
+				// Only the shell of the ring, the inside was visited by the previous rings
+				const bool bOnShell = FMath::Abs(OffsetZ) == Ring || FMath::Abs(OffsetY) == Ring;
+				const int32 StepX = bOnShell ? 1 : FMath::Max(2 * Ring, 1);
+				
+				for (int32 OffsetX = -Ring; OffsetX <= Ring; OffsetX += StepX)
+				{
+					if (const int32* CellIndex = CellIndices.Find(CenterCoord + FIntVector(OffsetX, OffsetY, OffsetZ)))
+					{
+						VisitCell(Cells[*CellIndex]);
+					}
+				}
+			}
+		}
+	}
+	
+	Algo::SortBy(Candidates, &FCandidate::DistanceSquared);
+	
+	OutEntities.Reserve(OutEntities.Num() + Candidates.Num());
+	for (const FCandidate& Candidate : Candidates)
+	{
+		OutEntities.Add(Candidate.Entity);
+	}
+}
+
+void FFlecsSpatialIndex::ForEachCellEntityInBox(const FBox& InBox, const TFunctionRef<void(flecs::entity_t)>& InFunction) const
+{
+	ForEachCellInRange(ToClampedCellCoord(InBox.Min, InvCellSize), ToClampedCellCoord(InBox.Max, InvCellSize),
+		[&InFunction](const FCell& InCell)
+		{
+			if (InCell.CellEntity != 0)
+			{
+				InFunction(InCell.CellEntity);
+			}
+		});
+}
+
+int32 FFlecsSpatialIndex::FindOrAddCell(const FIntVector& InCoord)
+{
+	if (const int32* CellIndex = CellIndices.Find(InCoord))
+	{
+		return *CellIndex;
+	}
+	
+	const int32 CellIndex = Cells.AddDefaulted();
+	Cells[CellIndex].Coord = InCoord;
+	CellIndices.Add(InCoord, CellIndex);
+	return CellIndex;
+}
+
+FFlecsSpatialIndex::FEntry FFlecsSpatialIndex::AddToCell(const int32 InCellIndex, const flecs::entity_t InEntity,
+	const FVector& InLocation)
+{
+	FCell& Cell = Cells[InCellIndex];
+	
+	const int32 Slot = Cell.Entities.Add(InEntity);
+	Cell.X.Add(InLocation.X);
+	Cell.Y.Add(InLocation.Y);
+	Cell.Z.Add(InLocation.Z);
+	
+	return FEntry{ InCellIndex, Slot };
+}
+
+void FFlecsSpatialIndex::RemoveFromCell(const FEntry& InEntry)
+{
+	FCell& Cell = Cells[InEntry.CellIndex];
+	
+	Cell.Entities.RemoveAtSwap(InEntry.Slot, 1, EAllowShrinking::No);
+	Cell.X.RemoveAtSwap(InEntry.Slot, 1, EAllowShrinking::No);
+	Cell.Y.RemoveAtSwap(InEntry.Slot, 1, EAllowShrinking::No);
+	Cell.Z.RemoveAtSwap(InEntry.Slot, 1, EAllowShrinking::No);
+	
+	// The last entity of the cell took the slot
+	if (InEntry.Slot < Cell.Entities.Num())
+	{
+		Entries.FindChecked(Cell.Entities[InEntry.Slot]).Slot = InEntry.Slot;
+	}
+	else if (Cell.Entities.IsEmpty())
+	{
+		EmptiedCellIndices.Add(InEntry.CellIndex);
+	}
+}
+
+FBox FFlecsSpatialIndex::GetCellBounds(const FIntVector& InCoord) const
+{
+	const FVector Min = FVector(InCoord) * CellSize;
+	return FBox(Min, Min + FVector(CellSize));
+}
@@ -0,0 +1,102 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Spatial/Systems/FlecsSpatialIndexSystem.h"
+
+#include "Spatial/FlecsSpatialCellRelationship.h"
+#include "Transforms/FlecsTransformComponent.h"
+#include "Worlds/FlecsWorld.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsSpatialIndexSystem)
+
+void UFlecsSpatialIndexSystem::BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*>,
+	TFlecsSystemBuilder<>& InBuilder) const
+{
+	// After the simulation moved things, so systems from PostUpdate on query this frame's locations
+	InBuilder
+		.Phase(EFlecsPhaseType::OnValidate)
+		.DetectChanges()
+		.With<const FFlecsTransformComponent>(); // 0
+}
+
+void UFlecsSpatialIndexSystem::RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld,
+	flecs::iter& InIterator)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsSpatialIndexSystem_RunIterator);
+	
+	const flecs::world World = InIterator.world();
+	const flecs::entity_t CellRelationship = InWorld->GetScriptStructEntity<FFlecsSpatialCellRelationship>().GetFlecsId();
+	LastCellChangeCount = 0;
+	
+	while (InIterator.next())
+	{
+		if (!InIterator.changed())
+		{
+			continue;
+		}
+		
+		const flecs::field<const FFlecsTransformComponent> Transforms = InIterator.field<const FFlecsTransformComponent>(0);
+		
+		for (const size_t EntityIndex : InIterator)
+		{
+			const flecs::entity_t Entity = InIterator.entity(EntityIndex);
+			
+			const int32 CellIndex = Index.Update(Entity, Transforms[EntityIndex].Transform.GetLocation());
+			if LIKELY_IF(CellIndex == INDEX_NONE)
+			{
+				continue;
+			}
+			
+			flecs::entity_t CellEntity = Index.GetCellEntity(CellIndex);
+			if (!CellEntity)
+			{
+				// Cells are children of the system, so they (and the pairs targeting them) go away with it
+				CellEntity = ecs_new_w_pair(World, EcsChildOf, GetSystemHandle().GetEntity());
+				Index.SetCellEntity(CellIndex, CellEntity);
+			}
+			
+			// Deferred, the entity moves to the tables of its new cell when the commands are merged
+			ecs_add_pair(World, Entity, CellRelationship, CellEntity);
+			++LastCellChangeCount;
+		}
+	}
+	
+	// Deleting a cell removes the pairs that still target it (on entities that left it with the observer) and its tables
+	Index.RemoveEmptyCells([&World](const flecs::entity_t InCellEntity)
+	{
+		ecs_delete(World, InCellEntity);
+	});
+}
+
+void UFlecsSpatialIndexSystem::FlecsWorldBeginPlay(const TSolidNotNull<UFlecsWorldInterfaceObject*> InFlecsWorld)
+{
+	Index.SetCellSize(CellSize);
+	
+	Super::FlecsWorldBeginPlay(InFlecsWorld);
+	
+	const flecs::entity_t CellRelationship = InFlecsWorld->GetScriptStructEntity<FFlecsSpatialCellRelationship>().GetFlecsId();
+	
+	RemoveObserver = InFlecsWorld->CreateObserver(FString::Printf(TEXT("%s_RemoveObserver"), *GetName()))
+		.Event(flecs::OnRemove)
+		.With<const FFlecsTransformComponent>() // 0
+		.each([this, CellRelationship](flecs::entity InEntity)
+		{
+			if (Index.Remove(InEntity))
+			{
+				// Observers run deferred, the pair is removed after the transform (or never if the entity is deleted)
+				InEntity.remove(CellRelationship, flecs::Wildcard);
+			}
+		});
+}
+
+void UFlecsSpatialIndexSystem::UnregisterObject(const TSolidNotNull<UFlecsWorldInterfaceObject*> InFlecsWorld)
+{
+	if LIKELY_IF(RemoveObserver.IsValid())
+	{
+		RemoveObserver.Destroy();
+		RemoveObserver.ResetHandle();
+	}
+	
+	Super::UnregisterObject(InFlecsWorld);
+	
+	Index.Reset();
+}
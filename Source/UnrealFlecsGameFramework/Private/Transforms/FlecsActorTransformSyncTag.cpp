@@ -0,0 +1,7 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Transforms/FlecsActorTransformSyncTag.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsActorTransformSyncTag)
+
+REGISTER_FLECS_COMPONENT(FFlecsActorTransformSyncTag);
@@ -0,0 +1,7 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Transforms/FlecsTransformComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsTransformComponent)
+
+REGISTER_FLECS_COMPONENT(FFlecsTransformComponent);
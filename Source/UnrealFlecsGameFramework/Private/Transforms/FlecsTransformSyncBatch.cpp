@@ -0,0 +1,161 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Transforms/FlecsTransformSyncBatch.h"
+
+#include "Algo/Sort.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+void FFlecsTransformSyncBatch::AddInstanceWrite(UInstancedStaticMeshComponent* InComponent, const int32 InInstanceIndex,
+	const FTransform& InTransform)
+{
+	solid_cassume(InComponent != nullptr);
+	
+	const int32 TransformIndex = InstanceTransforms.Add(InTransform);
+	InstanceWrites.Add(FInstanceWrite{ InComponent, InInstanceIndex, TransformIndex });
+}
+
+void FFlecsTransformSyncBatch::AddActorWrite(AActor* InActor, const FTransform& InTransform)
+{
+	solid_cassume(InActor != nullptr);
+	
+	int32 AttachDepth = 0;
+	for (const AActor* Parent = InActor->GetAttachParentActor(); Parent; Parent = Parent->GetAttachParentActor())
+	{
+		++AttachDepth;
+	}
+	
+	const int32 TransformIndex = ActorTransforms.Add(InTransform);
+	ActorWrites.Add(FActorWrite{ InActor, AttachDepth, TransformIndex });
+}
+
+int32 FFlecsTransformSyncBatch::FlushInstances()
+{
+	if (InstanceWrites.IsEmpty())
+	{
+		return 0;
+	}
+	
+	Algo::Sort(InstanceWrites, [](const FInstanceWrite& A, const FInstanceWrite& B)
+	{
+		if (A.Component != B.Component)
+		{
+			return A.Component < B.Component;
+		}
+		
+		if (A.InstanceIndex != B.InstanceIndex)
+		{
+			return A.InstanceIndex < B.InstanceIndex;
+		}
+		
+		return A.TransformIndex < B.TransformIndex;
+	});
+	
+	int32 BatchCount = 0;
+	
+	const int32 WriteCount = InstanceWrites.Num();
+	int32 WriteIndex = 0;
+	
+	while (WriteIndex < WriteCount)
+	{
+		UInstancedStaticMeshComponent* Component = InstanceWrites[WriteIndex].Component;
+		const int32 InstanceCount = Component->GetInstanceCount();
+		
+		bool bWroteComponent = false;
+		
+		while (WriteIndex < WriteCount && InstanceWrites[WriteIndex].Component == Component)
+		{
+			const int32 StartInstanceIndex = InstanceWrites[WriteIndex].InstanceIndex;
+			int32 NextInstanceIndex = StartInstanceIndex;
+			
+			RunTransforms.Reset();
+			
+			for (; WriteIndex < WriteCount && InstanceWrites[WriteIndex].Component == Component; ++WriteIndex)
+			{
+				const FInstanceWrite& Write = InstanceWrites[WriteIndex];
+				
+				if (Write.InstanceIndex == NextInstanceIndex)
+				{
+					RunTransforms.Add(InstanceTransforms[Write.TransformIndex]);
+					++NextInstanceIndex;
+				}
+				// Written more than once, the write added last wins
+				else if (Write.InstanceIndex == NextInstanceIndex - 1)
+				{
+					RunTransforms.Last() = InstanceTransforms[Write.TransformIndex];
+				}
+				else
+				{
+					break;
+				}
+			}
+			
+			if UNLIKELY_IF(StartInstanceIndex < 0 || NextInstanceIndex > InstanceCount)
+			{
+				continue;
+			}
+			
+			Component->BatchUpdateInstancesTransforms(StartInstanceIndex, RunTransforms,
+				/* bWorldSpace */ true, /* bMarkRenderStateDirty */ false, /* bTeleport */ false);
+			
+			bWroteComponent = true;
+			++BatchCount;
+		}
+		
+		if (bWroteComponent)
+		{
+			Component->MarkRenderStateDirty();
+		}
+	}
+	
+	InstanceWrites.Reset();
+	InstanceTransforms.Reset();
+	
+	return BatchCount;
+}
+
+int32 FFlecsTransformSyncBatch::FlushActors()
+{
+	if (ActorWrites.IsEmpty())
+	{
+		return 0;
+	}
+	
+	// Parents first, moving a parent after its child would move the child again through the attachment
+	Algo::Sort(ActorWrites, [](const FActorWrite& A, const FActorWrite& B)
+	{
+		if (A.AttachDepth != B.AttachDepth)
+		{
+			return A.AttachDepth < B.AttachDepth;
+		}
+		
+		return A.TransformIndex < B.TransformIndex;
+	});
+	
+	int32 MovedCount = 0;
+	
+	for (const FActorWrite& Write : ActorWrites)
+	{
+		if UNLIKELY_IF(!::IsValid(Write.Actor))
+		{
+			continue;
+		}
+		
+		Write.Actor->SetActorTransform(ActorTransforms[Write.TransformIndex], false, nullptr, ETeleportType::None);
+		++MovedCount;
+	}
+	
+	ActorWrites.Reset();
+	ActorTransforms.Reset();
+	
+	return MovedCount;
+}
+
+void FFlecsTransformSyncBatch::Reset()
+{
+	InstanceWrites.Reset();
+	InstanceTransforms.Reset();
+	ActorWrites.Reset();
+	ActorTransforms.Reset();
+	RunTransforms.Reset();
+}
@@ -0,0 +1,53 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Transforms/Systems/FlecsActorTransformSyncSystem.h"
+
+#include "GameFramework/Actor.h"
+
+#include "Components/FlecsUObjectComponent.h"
+#include "Components/ObjectTypes/FlecsActorTag.h"
+#include "Transforms/FlecsActorTransformSyncTag.h"
+#include "Transforms/FlecsTransformComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsActorTransformSyncSystem)
+
+void UFlecsActorTransformSyncSystem::BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*>,
+	TFlecsSystemBuilder<>& InBuilder) const
+{
+	InBuilder
+		.Phase(EFlecsPhaseType::OnStore)
+		.DetectChanges()
+		.With<const FFlecsTransformComponent>() // 0
+		.WithPair<const FFlecsUObjectComponent, FFlecsActorTag>() // 1
+		.With<FFlecsActorTransformSyncTag>(); // 2
+}
+
+void UFlecsActorTransformSyncSystem::RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*>,
+	flecs::iter& InIterator)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsActorTransformSyncSystem_RunIterator);
+	
+	while (InIterator.next())
+	{
+		if (!InIterator.changed())
+		{
+			continue;
+		}
+		
+		const flecs::field<const FFlecsTransformComponent> Transforms = InIterator.field<const FFlecsTransformComponent>(0);
+		const flecs::field<const FFlecsUObjectComponent> Objects = InIterator.field<const FFlecsUObjectComponent>(1);
+		
+		for (const size_t Index : InIterator)
+		{
+			AActor* Actor = Objects[Index].GetObject<AActor>();
+			if UNLIKELY_IF(!Actor)
+			{
+				continue;
+			}
+			
+			Batch.AddActorWrite(Actor, Transforms[Index].Transform);
+		}
+	}
+	
+	LastMovedCount = Batch.FlushActors();
+}
@@ -0,0 +1,62 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Transforms/Systems/FlecsInstancedMeshTransformSyncSystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+
+#include "Transforms/FlecsInstancedMeshInstanceComponent.h"
+#include "Transforms/FlecsTransformComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsInstancedMeshTransformSyncSystem)
+
+void UFlecsInstancedMeshTransformSyncSystem::BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*>,
+	TFlecsSystemBuilder<>& InBuilder) const
+{
+	InBuilder
+		.Phase(EFlecsPhaseType::OnStore)
+		.DetectChanges()
+		.With<const FFlecsTransformComponent>() // 0
+		.With<const FFlecsInstancedMeshInstanceComponent>(); // 1
+}
+
+void UFlecsInstancedMeshTransformSyncSystem::RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*>,
+	flecs::iter& InIterator)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsInstancedMeshTransformSyncSystem_RunIterator);
+	
+	while (InIterator.next())
+	{
+		if (!InIterator.changed())
+		{
+			continue;
+		}
+		
+		const flecs::field<const FFlecsTransformComponent> Transforms = InIterator.field<const FFlecsTransformComponent>(0);
+		const flecs::field<const FFlecsInstancedMeshInstanceComponent> Instances
+			= InIterator.field<const FFlecsInstancedMeshInstanceComponent>(1);
+		
+		// Instances of a table almost always share their component, so the weak pointer is only resolved when it changes
+		const TWeakObjectPtr<UInstancedStaticMeshComponent>* LastWeakComponent = nullptr;
+		UInstancedStaticMeshComponent* LastComponent = nullptr;
+		
+		for (const size_t Index : InIterator)
+		{
+			const FFlecsInstancedMeshInstanceComponent& Instance = Instances[Index];
+			
+			if (!LastWeakComponent || *LastWeakComponent != Instance.Component)
+			{
+				LastWeakComponent = &Instance.Component;
+				LastComponent = Instance.Component.Get();
+			}
+			
+			if UNLIKELY_IF(!LastComponent || Instance.InstanceIndex == INDEX_NONE)
+			{
+				continue;
+			}
+			
+			Batch.AddInstanceWrite(LastComponent, Instance.InstanceIndex, Transforms[Index].Transform);
+		}
+	}
+	
+	LastBatchCount = Batch.FlushInstances();
+}
@@ -0,0 +1,33 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Queries/Expressions/FlecsQueryExpression.h"
+
+#include "FlecsQuerySpatialCellExpression.generated.h"
+
+namespace UE::Flecs::Spatial
+{
+	/** Name of the query variable that holds the cell entity, @see FFlecsQuerySpatialCellExpression */
+	inline constexpr const char* CellVariableName = "SpatialCell";
+	
+} // namespace UE::Flecs::Spatial
+
+/**
+ * Adds a (FFlecsSpatialCellRelationship, $SpatialCell) term, which matches the entities in the spatial index.
+ * Setting the variable to a cell entity limits the query to the tables of that cell,
+ * UFlecsSpatialIndexSystem::RunQueryInBox/RunQueryInRadius run a query like this once for every overlapping cell.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Spatial Cell"))
+struct UNREALFLECSGAMEFRAMEWORK_API FFlecsQuerySpatialCellExpression : public FFlecsQueryExpression
+{
+	GENERATED_BODY()
+
+public:
+	FFlecsQuerySpatialCellExpression();
+
+	virtual void Apply(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, FFlecsQueryBuilderView& InQueryBuilder) const override;
+	
+}; // struct FFlecsQuerySpatialCellExpression
@@ -0,0 +1,34 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsSpatialCellRelationship.generated.h"
+
+/**
+ * (FFlecsSpatialCellRelationship, Cell) is added by UFlecsSpatialIndexSystem to every indexed entity, with the entity
+ * of the spatial index cell the entity is in as target.
+ * Entities of a cell share tables, so a query term with a cell variable only visits the tables of the cells it is set to.
+ * @see FFlecsQuerySpatialCellExpression
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSGAMEFRAMEWORK_API FFlecsSpatialCellRelationship
+{
+	GENERATED_BODY()
+}; // struct FFlecsSpatialCellRelationship
+
+template <>
+struct TFlecsComponentTraits<FFlecsSpatialCellRelationship> : public TFlecsComponentTraitsBase<FFlecsSpatialCellRelationship>
+{
+	static constexpr bool Relationship = true;
+	
+	static void PostRegister(const FFlecsComponentHandle& ComponentHandle)
+	{
+		// An entity is in one cell at a time, adding the new cell replaces the previous one
+		ComponentHandle.Add(flecs::Exclusive);
+	}
+	
+}; // struct TFlecsComponentTraits<FFlecsSpatialCellRelationship>
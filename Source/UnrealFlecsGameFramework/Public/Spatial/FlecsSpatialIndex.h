@@ -0,0 +1,146 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "flecs.h"
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+/**
+ * Uniform spatial hash of entity locations, updated incrementally as entities move.
+ *
+ * Every occupied cell keeps the locations of its entities as a structure of arrays, so the radius and box checks test
+ * four entities per vector instruction. Cells that are fully inside the query shape are taken without testing
+ * their entities, cells outside of it are skipped without touching their entities.
+ * Cells can be given an entity, which UFlecsSpatialIndexSystem uses to expose them as a query variable.
+ * Cells that become empty are kept until RemoveEmptyCells, so cell indices stay stable until then.
+ */
+class UNREALFLECSGAMEFRAMEWORK_API FFlecsSpatialIndex
+{
+public:
+	explicit FFlecsSpatialIndex(const double InCellSize = 1000.0);
+	
+	/** Changing the cell size clears the index */
+	void SetCellSize(const double InCellSize);
+	
+	NO_DISCARD FORCEINLINE double GetCellSize() const
+	{
+		return CellSize;
+	}
+	
+	NO_DISCARD FORCEINLINE FIntVector GetCellCoord(const FVector& InLocation) const
+	{
+		return FIntVector(
+			FMath::FloorToInt32(InLocation.X * InvCellSize),
+			FMath::FloorToInt32(InLocation.Y * InvCellSize),
+			FMath::FloorToInt32(InLocation.Z * InvCellSize));
+	}
+	
+	/**
+	 * @brief Insert an entity or update its location.
+	 * @return The index of the cell the entity entered, INDEX_NONE if it stayed in the same cell.
+	 */
+	int32 Update(const flecs::entity_t InEntity, const FVector& InLocation);
+	
+	/** @return Whether the entity was in the index */
+	bool Remove(const flecs::entity_t InEntity);
+	
+	void Reset();
+	
+	/**
+	 * @brief Remove the cells that became empty since the last call, this changes the indices of other cells.
+	 * @param InFunction Called with the entity of every removed cell that had one.
+	 */
+	void RemoveEmptyCells(const TFunctionRef<void(flecs::entity_t)>& InFunction);
+	
+	NO_DISCARD FORCEINLINE bool Contains(const flecs::entity_t InEntity) const
+	{
+		return Entries.Contains(InEntity);
+	}
+	
+	NO_DISCARD FORCEINLINE int32 Num() const
+	{
+		return Entries.Num();
+	}
+	
+	NO_DISCARD FORCEINLINE int32 NumCells() const
+	{
+		return Cells.Num();
+	}
+	
+	/** Appends the entities within InRadius of InCenter */
+	void QueryRadius(const FVector& InCenter, const double InRadius, TArray<flecs::entity_t>& OutEntities) const;
+	
+	/** Appends the entities inside InBox */
+	void QueryBox(const FBox& InBox, TArray<flecs::entity_t>& OutEntities) const;
+	
+	/**
+	 * @brief Find the InCount entities closest to InCenter, nearest first.
+	 * Cells are visited in rings around the cell of InCenter until no unvisited cell can hold a closer entity.
+	 */
+	void QueryNearest(const FVector& InCenter, const int32 InCount, TArray<flecs::entity_t>& OutEntities,
+		const double InMaxRadius = UE_BIG_NUMBER) const;
+	
+	/** Calls InFunction with the entity of every cell that overlaps InBox, cells without an entity are skipped */
+	void ForEachCellEntityInBox(const FBox& InBox, const TFunctionRef<void(flecs::entity_t)>& InFunction) const;
+	
+	NO_DISCARD FORCEINLINE flecs::entity_t GetCellEntity(const int32 InCellIndex) const
+	{
+		return Cells[InCellIndex].CellEntity;
+	}
+	
+	FORCEINLINE void SetCellEntity(const int32 InCellIndex, const flecs::entity_t InCellEntity)
+	{
+		Cells[InCellIndex].CellEntity = InCellEntity;
+	}
+	
+	NO_DISCARD FORCEINLINE FIntVector GetCellCoordByIndex(const int32 InCellIndex) const
+	{
+		return Cells[InCellIndex].Coord;
+	}
+	
+private:
+	struct FCell
+	{
+		FIntVector Coord = FIntVector::ZeroValue;
+		flecs::entity_t CellEntity = 0;
+		
+		TArray<flecs::entity_t> Entities;
+		
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+		
+	}; // struct FCell
+	
+	struct FEntry
+	{
+		int32 CellIndex = INDEX_NONE;
+		int32 Slot = INDEX_NONE;
+		
+	}; // struct FEntry
+	
+	NO_DISCARD int32 FindOrAddCell(const FIntVector& InCoord);
+	NO_DISCARD FEntry AddToCell(const int32 InCellIndex, const flecs::entity_t InEntity, const FVector& InLocation);
+	void RemoveFromCell(const FEntry& InEntry);
+	
+	NO_DISCARD FBox GetCellBounds(const FIntVector& InCoord) const;
+	
+	/** Calls InFunction with the index of every cell between the two coordinates (inclusive) */
+	template <typename TFunction>
+	void ForEachCellInRange(const FIntVector& InMin, const FIntVector& InMax, TFunction&& InFunction) const;
+	
+	double CellSize = 1000.0;
+	double InvCellSize = 1.0 / 1000.0;
+	
+	TArray<FCell> Cells;
+	TMap<FIntVector, int32> CellIndices;
+	
+	/** Cells whose last entity left, may contain duplicates and cells that were entered again */
+	TArray<int32> EmptiedCellIndices;
+	
+	TMap<flecs::entity_t, FEntry> Entries;
+	
+}; // class FFlecsSpatialIndex
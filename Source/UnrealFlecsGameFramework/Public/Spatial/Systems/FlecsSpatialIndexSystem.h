@@ -0,0 +1,83 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Observers/FlecsObserverHandle.h"
+#include "Queries/FlecsQuery.h"
+#include "Systems/FlecsSystemObject.h"
+
+#include "Spatial/FlecsSpatialIndex.h"
+#include "Spatial/FlecsQuerySpatialCellExpression.h"
+
+#include "FlecsSpatialIndexSystem.generated.h"
+
+/**
+ * Keeps an FFlecsSpatialIndex of the locations of all entities with an FFlecsTransformComponent.
+ * Only tables whose transforms changed since the last run are visited, entities that lose the transform are removed
+ * by an observer. Entities that enter a new cell get the (FFlecsSpatialCellRelationship, Cell) pair of that cell,
+ * so queries with an FFlecsQuerySpatialCellExpression can be limited to a region.
+ * Cells that are left empty are deleted at the end of a run, along with the pairs and tables that target them.
+ */
+UCLASS()
+class UNREALFLECSGAMEFRAMEWORK_API UFlecsSpatialIndexSystem : public UFlecsSystemObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, TFlecsSystemBuilder<>& InBuilder) const override;
+	virtual void RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld, flecs::iter& InIterator) override;
+	
+	virtual void FlecsWorldBeginPlay(const TSolidNotNull<UFlecsWorldInterfaceObject*> InFlecsWorld) override;
+	virtual void UnregisterObject(const TSolidNotNull<UFlecsWorldInterfaceObject*> InFlecsWorld) override;
+	
+	NO_DISCARD FORCEINLINE const FFlecsSpatialIndex& GetIndex() const
+	{
+		return Index;
+	}
+	
+	/**
+	 * @brief Run a query with an FFlecsQuerySpatialCellExpression once for every cell that overlaps the box.
+	 * The query matches whole cells, entities close to the box but outside of it are included.
+	 */
+	template <typename TFunction>
+	void RunQueryInBox(const FFlecsQuery& InQuery, const FBox& InBox, TFunction&& InFunction) const
+	{
+		const int32 CellVariable = InQuery.GetQueryBase().find_var(UE::Flecs::Spatial::CellVariableName);
+		solid_checkf(CellVariable >= 0, TEXT("Query has no spatial cell variable, add an FFlecsQuerySpatialCellExpression"));
+		
+		Index.ForEachCellEntityInBox(InBox, [&InQuery, CellVariable, &InFunction](const flecs::entity_t InCellEntity)
+		{
+			InQuery.set_var(CellVariable, InCellEntity).run(InFunction);
+		});
+	}
+	
+	/** @see RunQueryInBox */
+	template <typename TFunction>
+	FORCEINLINE void RunQueryInRadius(const FFlecsQuery& InQuery, const FVector& InCenter, const double InRadius,
+		TFunction&& InFunction) const
+	{
+		RunQueryInBox(InQuery, FBox(InCenter - FVector(InRadius), InCenter + FVector(InRadius)),
+			Forward<TFunction>(InFunction));
+	}
+	
+	/** The amount of entities that entered a new cell in the last run */
+	NO_DISCARD FORCEINLINE int32 GetLastCellChangeCount() const
+	{
+		return LastCellChangeCount;
+	}
+	
+	/** Edge length of a cell, queries about this size visit the fewest cells */
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Spatial", meta = (ClampMin = "1.0"))
+	double CellSize = 1000.0;
+	
+private:
+	FFlecsSpatialIndex Index;
+	
+	UPROPERTY(Transient)
+	FFlecsObserverHandle RemoveObserver;
+	
+	int32 LastCellChangeCount = 0;
+	
+}; // class UFlecsSpatialIndexSystem
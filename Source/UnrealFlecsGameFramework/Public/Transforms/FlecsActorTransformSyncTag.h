@@ -0,0 +1,20 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsActorTransformSyncTag.generated.h"
+
+/**
+ * Opts an actor entity (an entity with the (FFlecsUObjectComponent, FFlecsActorTag) pair) into having its
+ * FFlecsTransformComponent written to the root component of the actor.
+ * @see UFlecsActorTransformSyncSystem
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSGAMEFRAMEWORK_API FFlecsActorTransformSyncTag
+{
+	GENERATED_BODY()
+}; // struct FFlecsActorTransformSyncTag
@@ -0,0 +1,55 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsInstancedMeshInstanceComponent.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+/**
+ * Links an entity to an instance of an instanced (or hierarchical instanced) static mesh component.
+ * @see UFlecsInstancedMeshTransformSyncSystem
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSGAMEFRAMEWORK_API FFlecsInstancedMeshInstanceComponent
+{
+	GENERATED_BODY()
+	
+public:
+	FFlecsInstancedMeshInstanceComponent() = default;
+	
+	FORCEINLINE FFlecsInstancedMeshInstanceComponent(UInstancedStaticMeshComponent* InComponent, const int32 InInstanceIndex)
+		: Component(InComponent)
+		, InstanceIndex(InInstanceIndex)
+	{
+	}
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Instanced Mesh")
+	TWeakObjectPtr<UInstancedStaticMeshComponent> Component;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Instanced Mesh")
+	int32 InstanceIndex = INDEX_NONE;
+	
+	NO_DISCARD bool operator==(const FFlecsInstancedMeshInstanceComponent& Other) const
+	{
+		return Component == Other.Component && InstanceIndex == Other.InstanceIndex;
+	}
+	
+	NO_DISCARD bool operator!=(const FFlecsInstancedMeshInstanceComponent& Other) const
+	{
+		return !(*this == Other);
+	}
+	
+}; // struct FFlecsInstancedMeshInstanceComponent
+
+template <>
+struct TFlecsComponentTraits<FFlecsInstancedMeshInstanceComponent> : public TFlecsComponentTraitsBase<FFlecsInstancedMeshInstanceComponent>
+{
+	static constexpr EFlecsOnInstantiate OnInstantiate = EFlecsOnInstantiate::DontInherit;
+}; // struct TFlecsComponentTraits<FFlecsInstancedMeshInstanceComponent>
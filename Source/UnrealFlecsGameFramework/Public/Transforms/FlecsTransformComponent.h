@@ -0,0 +1,49 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsTransformComponent.generated.h"
+
+/**
+ * World space transform of an entity. Writing it (through Set or a mutable query term) marks its table as changed,
+ * which is what the transform sync systems use to only visit tables that moved since their last run.
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSGAMEFRAMEWORK_API FFlecsTransformComponent
+{
+	GENERATED_BODY()
+	
+public:
+	FFlecsTransformComponent() = default;
+	
+	FORCEINLINE FFlecsTransformComponent(const FTransform& InTransform)
+		: Transform(InTransform)
+	{
+	}
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transform")
+	FTransform Transform = FTransform::Identity;
+	
+	NO_DISCARD bool operator==(const FFlecsTransformComponent& Other) const
+	{
+		return Transform.Equals(Other.Transform, 0.0);
+	}
+	
+	NO_DISCARD bool operator!=(const FFlecsTransformComponent& Other) const
+	{
+		return !(*this == Other);
+	}
+	
+}; // struct FFlecsTransformComponent
+
+template <>
+struct TFlecsComponentTraits<FFlecsTransformComponent> : public TFlecsComponentTraitsBase<FFlecsTransformComponent>
+{
+	static constexpr EFlecsOnInstantiate OnInstantiate = EFlecsOnInstantiate::Override;
+}; // struct TFlecsComponentTraits<FFlecsTransformComponent>
@@ -0,0 +1,81 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+class AActor;
+class UInstancedStaticMeshComponent;
+
+/**
+ * Collects transform writes while iterating entities and applies them afterwards in bulk.
+ *
+ * Instance writes are sorted by component and instance index, and every run of contiguous indices is written with a
+ * single BatchUpdateInstancesTransforms call. The render state of every touched component is marked dirty once per flush
+ * instead of once per instance.
+ * Actor writes are deferred until after iteration and sorted by attachment depth, so an attach parent is moved
+ * before its children and doesn't drag an already written child away from its new transform.
+ *
+ * The scratch arrays keep their allocation between flushes, and the pointers they hold are only valid until the
+ * next flush, so the batch should not be kept around over a garbage collection with pending writes.
+ */
+class UNREALFLECSGAMEFRAMEWORK_API FFlecsTransformSyncBatch
+{
+public:
+	void AddInstanceWrite(UInstancedStaticMeshComponent* InComponent, const int32 InInstanceIndex, const FTransform& InTransform);
+	void AddActorWrite(AActor* InActor, const FTransform& InTransform);
+	
+	/**
+	 * @brief Write all pending instance transforms and clear them.
+	 * @return The amount of BatchUpdateInstancesTransforms calls made.
+	 */
+	int32 FlushInstances();
+	
+	/**
+	 * @brief Write all pending actor transforms and clear them.
+	 * @return The amount of actors moved.
+	 */
+	int32 FlushActors();
+	
+	void Reset();
+	
+	NO_DISCARD FORCEINLINE int32 NumInstanceWrites() const
+	{
+		return InstanceWrites.Num();
+	}
+	
+	NO_DISCARD FORCEINLINE int32 NumActorWrites() const
+	{
+		return ActorWrites.Num();
+	}
+	
+private:
+	struct FInstanceWrite
+	{
+		UInstancedStaticMeshComponent* Component = nullptr;
+		int32 InstanceIndex = INDEX_NONE;
+		
+		/** Index into Transforms, also used to keep the last write to an instance when it was written twice */
+		int32 TransformIndex = INDEX_NONE;
+	}; // struct FInstanceWrite
+	
+	struct FActorWrite
+	{
+		AActor* Actor = nullptr;
+		int32 AttachDepth = 0;
+		int32 TransformIndex = INDEX_NONE;
+	}; // struct FActorWrite
+	
+	/** Sorting the small write records instead of the transforms keeps the sort cheap */
+	TArray<FInstanceWrite> InstanceWrites;
+	TArray<FTransform> InstanceTransforms;
+	
+	TArray<FActorWrite> ActorWrites;
+	TArray<FTransform> ActorTransforms;
+	
+	/** Contiguous run of transforms handed to BatchUpdateInstancesTransforms */
+	TArray<FTransform> RunTransforms;
+	
+}; // class FFlecsTransformSyncBatch
@@ -0,0 +1,38 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Systems/FlecsSystemObject.h"
+
+#include "Transforms/FlecsTransformSyncBatch.h"
+
+#include "FlecsActorTransformSyncSystem.generated.h"
+
+/**
+ * Writes the FFlecsTransformComponent of actor entities with an FFlecsActorTransformSyncTag to their actor.
+ * Only tables whose transforms changed since the last run are visited. The actors are moved after iteration,
+ * parents before their attached children, so nothing that reacts to an actor moving runs while the query is iterated.
+ */
+UCLASS()
+class UNREALFLECSGAMEFRAMEWORK_API UFlecsActorTransformSyncSystem : public UFlecsSystemObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, TFlecsSystemBuilder<>& InBuilder) const override;
+	virtual void RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld, flecs::iter& InIterator) override;
+	
+	/** The amount of actors moved by the last run */
+	NO_DISCARD FORCEINLINE int32 GetLastMovedCount() const
+	{
+		return LastMovedCount;
+	}
+	
+private:
+	FFlecsTransformSyncBatch Batch;
+	
+	int32 LastMovedCount = 0;
+	
+}; // class UFlecsActorTransformSyncSystem
@@ -0,0 +1,38 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Systems/FlecsSystemObject.h"
+
+#include "Transforms/FlecsTransformSyncBatch.h"
+
+#include "FlecsInstancedMeshTransformSyncSystem.generated.h"
+
+/**
+ * Writes the FFlecsTransformComponent of entities with an FFlecsInstancedMeshInstanceComponent to their instance.
+ * Only tables whose transforms (or instance links) changed since the last run are visited, and the writes are
+ * applied per component in contiguous index ranges after iteration.
+ */
+UCLASS()
+class UNREALFLECSGAMEFRAMEWORK_API UFlecsInstancedMeshTransformSyncSystem : public UFlecsSystemObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, TFlecsSystemBuilder<>& InBuilder) const override;
+	virtual void RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld, flecs::iter& InIterator) override;
+	
+	/** The amount of BatchUpdateInstancesTransforms calls made by the last run */
+	NO_DISCARD FORCEINLINE int32 GetLastBatchCount() const
+	{
+		return LastBatchCount;
+	}
+	
+private:
+	FFlecsTransformSyncBatch Batch;
+	
+	int32 LastBatchCount = 0;
+	
+}; // class UFlecsInstancedMeshTransformSyncSystem
@@ -7,11 +7,13 @@
 #include "Iris/ReplicationSystem/ReplicationFragmentUtil.h"
 #include "Net/UnrealNetwork.h"
 
+#include "Networking/FlecsNetworkingModuleSettings.h"
 #include "Networking/Bridge/FlecsIrisReplicationBridgeNetFactory.h"
 #include "Networking/Profiles/FlecsProfileRelationshipTypes.h"
 #include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
 #include "Networking/Shards/FlecsNetEntityProxy.h"
 #include "Networking/Shards/FlecsNetShardBase.h"
+#include "Networking/Stats/FlecsReplicationStatsCollector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsIrisReplicationBridge)
 
@@ -112,9 +114,9 @@ void UFlecsIrisReplicationBridge::InitializeBridge()
 
 void UFlecsIrisReplicationBridge::DeinitializeBridge()
 {
-	for (TPair<FFlecsReplicationShardPoolKey, TArray<TObjectPtr<UFlecsNetShardBase>>>& Pair : ShardPools)
+	for (TPair<FFlecsReplicationShardPoolKey, FFlecsReplicationShardPool>& Pair : ShardPools)
 	{
-		for (UFlecsNetShardBase* Shard : Pair.Value)
+		for (UFlecsNetShardBase* Shard : Pair.Value.Shards)
 		{
 			if LIKELY_IF(Shard)
 			{
@@ -126,6 +128,7 @@ void UFlecsIrisReplicationBridge::DeinitializeBridge()
 	
 	ShardMap.Reset();
 	ShardPools.Reset();
+	RecycledShards.Reset();
 
 	if (RootObjectAdapter.IsReplicating())
 	{
@@ -258,13 +261,69 @@ UFlecsNetShardBase* UFlecsIrisReplicationBridge::ResolveShard(const FFlecsEntity
 	return Shard;
 }
 
+int32 UFlecsIrisReplicationBridge::GetActiveShardCount() const
+{
+	int32 ShardCount = 0;
+	
+	for (const TPair<FFlecsReplicationShardPoolKey, FFlecsReplicationShardPool>& Pair : ShardPools)
+	{
+		ShardCount += Pair.Value.Shards.Num();
+	}
+	
+	return ShardCount;
+}
+
+int32 UFlecsIrisReplicationBridge::GetRecycledShardCount() const
+{
+	int32 ShardCount = 0;
+	
+	for (const TPair<TObjectPtr<UClass>, FFlecsRecycledShardList>& Pair : RecycledShards)
+	{
+		ShardCount += Pair.Value.Shards.Num();
+	}
+	
+	return ShardCount;
+}
+
+void UFlecsIrisReplicationBridge::GatherShardStats(FFlecsReplicationShardStats& InOutStats) const
+{
+	for (const TPair<FFlecsReplicationShardPoolKey, FFlecsReplicationShardPool>& Pair : ShardPools)
+	{
+		for (const UFlecsNetShardBase* Shard : Pair.Value.Shards)
+		{
+			if UNLIKELY_IF(!Shard)
+			{
+				continue;
+			}
+			
+			++InOutStats.ActiveShardCount;
+			InOutStats.EntityCount += Shard->GetNetEntityCount();
+			InOutStats.Capacity += Shard->GetNetEntityCapacity();
+		}
+	}
+	
+	InOutStats.RecycledShardCount += GetRecycledShardCount();
+}
+
 UFlecsNetShardBase* UFlecsIrisReplicationBridge::CreateNewShard(const FFlecsNetworkId& InNetworkId,
 	const FFlecsEntityReplicationSnapshot& InSnapshot,
 	const FFlecsEntityView& InProfile, const FFlecsReplicationShardSelection& InSelection)
 {
 	solid_checkf(InNetworkId.IsValid(), TEXT("Cannot create a Flecs replication shard without a valid network ID"));
 
-	const TSolidNotNull<UFlecsNetShardBase*> Shard = NewObject<UFlecsNetShardBase>(this, InSelection.ShardClass);
+	UFlecsNetShardBase* RecycledShard = nullptr;
+	
+	if (FFlecsRecycledShardList* Recycled = RecycledShards.Find(InSelection.ShardClass.Get()))
+	{
+		while (!RecycledShard && !Recycled->Shards.IsEmpty())
+		{
+			RecycledShard = Recycled->Shards.Pop(EAllowShrinking::No);
+		}
+	}
+	
+	const TSolidNotNull<UFlecsNetShardBase*> Shard = RecycledShard
+		? RecycledShard
+		: NewObject<UFlecsNetShardBase>(this, InSelection.ShardClass);
 
 	Shard->SetOwningNetworkWorldSubsystem(GetNetworkWorldSubsystem());
 	Shard->InitializeShard(InProfile);
@@ -290,11 +349,21 @@ UFlecsNetShardBase* UFlecsIrisReplicationBridge::FindOrCreateShard(const FFlecsN
 	const FFlecsReplicationShardSelection& InSelection)
 {
 	const FFlecsReplicationShardPoolKey PoolKey(InProfile, InSelection);
-	if (const TArray<TObjectPtr<UFlecsNetShardBase>>* Shards = ShardPools.Find(PoolKey))
+	
+	if (FFlecsReplicationShardPool* Pool = ShardPools.Find(PoolKey))
 	{
-		for (UFlecsNetShardBase* Shard : *Shards)
+		// Only shards with room are scanned, so placing an entity doesn't visit every proxy or full table of the pool
+		for (int32 Index = Pool->OpenShards.Num() - 1; Index >= 0; --Index)
 		{
-			if (Shard && Shard->CanAcceptNetEntity(InNetworkId, InSnapshot))
+			UFlecsNetShardBase* Shard = Pool->OpenShards[Index];
+			
+			if UNLIKELY_IF(!Shard || Shard->IsFull())
+			{
+				Pool->OpenShards.RemoveAtSwap(Index, EAllowShrinking::No);
+				continue;
+			}
+			
+			if (Shard->CanAcceptNetEntity(InNetworkId, InSnapshot))
 			{
 				return Shard;
 			}
@@ -307,31 +376,52 @@ UFlecsNetShardBase* UFlecsIrisReplicationBridge::FindOrCreateShard(const FFlecsN
 		return nullptr;
 	}
 
-	ShardPools.FindOrAdd(PoolKey).Add(NewShard);
+	FFlecsReplicationShardPool& Pool = ShardPools.FindOrAdd(PoolKey);
+	Pool.Shards.Add(NewShard);
+	Pool.OpenShards.Add(NewShard);
 	return NewShard;
 }
 
 void UFlecsIrisReplicationBridge::ReleaseShardIfEmpty(UFlecsNetShardBase* InShard,
 	const FFlecsEntityView& InProfile, const FFlecsReplicationShardSelection& InSelection)
 {
-	if (!InShard || !InShard->IsEmpty())
+	if (!InShard)
 	{
 		return;
 	}
 
 	const FFlecsReplicationShardPoolKey PoolKey(InProfile, InSelection);
-	TArray<TObjectPtr<UFlecsNetShardBase>>* Shards = ShardPools.Find(PoolKey);
-	if (!Shards)
+	FFlecsReplicationShardPool* Pool = ShardPools.Find(PoolKey);
+	if (!Pool)
 	{
 		return;
 	}
+	
+	if (!InShard->IsEmpty())
+	{
+		// The shard has room again after an entity left it
+		Pool->OpenShards.AddUnique(InShard);
+		return;
+	}
 
-	Shards->RemoveSingle(InShard);
-	if (Shards->IsEmpty())
+	Pool->Shards.RemoveSingleSwap(InShard, EAllowShrinking::No);
+	Pool->OpenShards.RemoveSingleSwap(InShard, EAllowShrinking::No);
+	
+	if (Pool->Shards.IsEmpty())
 	{
 		ShardPools.Remove(PoolKey);
 	}
 
 	InShard->DeinitializeShard();
 	InShard->SetOwningNetworkWorldSubsystem(nullptr);
+	
+	if (InShard->CanBeRecycled())
+	{
+		FFlecsRecycledShardList& Recycled = RecycledShards.FindOrAdd(InShard->GetClass());
+		
+		if (Recycled.Shards.Num() < GetDefault<UFlecsNetworkingModuleSettings>()->RecycledShardPoolSize)
+		{
+			Recycled.Shards.Add(InShard);
+		}
+	}
 }
@@ -2,38 +2,204 @@
 
 #include "Networking/DefaultFlecsNetworkIdGenerator.h"
 
+#include "Misc/ScopeLock.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(DefaultFlecsNetworkIdGenerator)
 
+namespace
+{
+	std::atomic<uint32> NextThreadShardIndex { 0 };
+	
+	/** Threads are spread over the shards in the order they first generate an ID. */
+	int32 GetThreadShardIndex()
+	{
+		static thread_local const int32 ThreadShardIndex = static_cast<int32>(
+			NextThreadShardIndex.fetch_add(1, std::memory_order_relaxed) % UDefaultFlecsNetworkIdGenerator::ShardCount);
+		
+		return ThreadShardIndex;
+	}
+	
+	FFlecsNetworkId MakeReusedNetworkId(const FFlecsNetworkId& InReleasedId)
+	{
+		uint32 Generation = InReleasedId.GetGeneration() + 1;
+		
+		// Generation zero is never handed out, slot zero with it would be the invalid ID
+		if UNLIKELY_IF(Generation == 0)
+		{
+			Generation = 1;
+		}
+		
+		return FFlecsNetworkId(InReleasedId.GetSlot(), Generation);
+	}
+	
+} // namespace
+
+UDefaultFlecsNetworkIdGenerator::~UDefaultFlecsNetworkIdGenerator()
+{
+	EmptyFreeIdPool();
+}
+
 FFlecsNetworkId UDefaultFlecsNetworkIdGenerator::GenerateNetworkId()
 {
-	uint32 Slot = 0;
+	FShard& Shard = GetCurrentThreadShard();
+	FScopeLock Lock(&Shard.Lock);
+	
+	return TakeNetworkId(Shard);
+}
+
+void UDefaultFlecsNetworkIdGenerator::ReserveNetworkIdRange(const int32 InCount, TArray<FFlecsNetworkId>& OutNetworkIds)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+	
+	OutNetworkIds.Reserve(OutNetworkIds.Num() + InCount);
+	
+	FShard& Shard = GetCurrentThreadShard();
+	FScopeLock Lock(&Shard.Lock);
+	
+	int32 RemainingCount = InCount;
+	
+	// Released IDs first, so bulk spawns don't grow the slot space while slots are free
+	while (RemainingCount > 0)
+	{
+		if (Shard.FreeIds.IsEmpty())
+		{
+			FFreeIdBatch* Batch = FreeIdPool.Pop();
+			if (!Batch)
+			{
+				break;
+			}
+			
+			Shard.FreeIds = MoveTemp(Batch->NetworkIds);
+			delete Batch;
+		}
+		
+		const int32 TakenCount = FMath::Min(RemainingCount, Shard.FreeIds.Num());
+		for (int32 Index = 0; Index < TakenCount; ++Index)
+		{
+			OutNetworkIds.Add(MakeReusedNetworkId(Shard.FreeIds.Pop(EAllowShrinking::No)));
+		}
+		
+		RemainingCount -= TakenCount;
+	}
 	
-	if (!FreeSlotIds.IsEmpty())
+	const uint64 CachedSlotCount = FMath::Min<uint64>(RemainingCount, Shard.EndSlot - Shard.NextSlot);
+	for (uint64 Index = 0; Index < CachedSlotCount; ++Index)
 	{
-		Slot = FreeSlotIds.Pop();
-		Generations[Slot]++;
-		return FFlecsNetworkId(Slot, Generations[Slot]);
+		OutNetworkIds.Add(FFlecsNetworkId(static_cast<uint32>(Shard.NextSlot++), 1));
 	}
-	else
+	
+	RemainingCount -= static_cast<int32>(CachedSlotCount);
+	
+	// The rest is one contiguous claim instead of one per block
+	uint64 FirstSlot = 0;
+	if (RemainingCount > 0 && ClaimFreshSlots(RemainingCount, FirstSlot))
 	{
-		Slot = Generations.Add(1);
-		return FFlecsNetworkId(Slot, 1);
+		for (int32 Index = 0; Index < RemainingCount; ++Index)
+		{
+			OutNetworkIds.Add(FFlecsNetworkId(static_cast<uint32>(FirstSlot + Index), 1));
+		}
 	}
 }
 
 bool UDefaultFlecsNetworkIdGenerator::ReleaseNetworkId(const FFlecsNetworkId& NetworkId)
 {
-	if (NetworkId.IsValid())
+	if (!NetworkId.IsValid())
+	{
+		return false;
+	}
+	
+	FShard& Shard = GetCurrentThreadShard();
+	FScopeLock Lock(&Shard.Lock);
+	
+	Shard.FreeIds.Add(NetworkId);
+	
+	// A shard that mostly releases, e.g. the one destroying entities spawned by workers, shares its surplus
+	if (Shard.FreeIds.Num() >= FreeIdBatchSize * 2)
 	{
-		FreeSlotIds.Add(NetworkId.GetSlot());
-		return true;
+		FFreeIdBatch* Batch = new FFreeIdBatch();
+		Batch->NetworkIds.Append(Shard.FreeIds.GetData(), FreeIdBatchSize);
+		Shard.FreeIds.RemoveAt(0, FreeIdBatchSize, EAllowShrinking::No);
+		
+		FreeIdPool.Push(Batch);
 	}
 	
-	return false;
+	return true;
 }
 
 void UDefaultFlecsNetworkIdGenerator::ResetNetworkIdGenerator()
 {
-	FreeSlotIds.Empty();
-	Generations.Empty();
+	for (FShard& Shard : Shards)
+	{
+		FScopeLock Lock(&Shard.Lock);
+		
+		Shard.FreeIds.Empty();
+		Shard.NextSlot = 0;
+		Shard.EndSlot = 0;
+	}
+	
+	EmptyFreeIdPool();
+	NextFreshSlot.store(0, std::memory_order_relaxed);
+}
+
+UDefaultFlecsNetworkIdGenerator::FShard& UDefaultFlecsNetworkIdGenerator::GetCurrentThreadShard()
+{
+	return Shards[GetThreadShardIndex()];
+}
+
+FFlecsNetworkId UDefaultFlecsNetworkIdGenerator::TakeNetworkId(FShard& InShard)
+{
+	if (InShard.FreeIds.IsEmpty())
+	{
+		if (FFreeIdBatch* Batch = FreeIdPool.Pop())
+		{
+			InShard.FreeIds = MoveTemp(Batch->NetworkIds);
+			delete Batch;
+		}
+	}
+	
+	if (!InShard.FreeIds.IsEmpty())
+	{
+		return MakeReusedNetworkId(InShard.FreeIds.Pop(EAllowShrinking::No));
+	}
+	
+	if (InShard.NextSlot == InShard.EndSlot)
+	{
+		uint64 FirstSlot = 0;
+		if UNLIKELY_IF(!ClaimFreshSlots(FreshSlotBlockSize, FirstSlot))
+		{
+			return FFlecsNetworkId();
+		}
+		
+		InShard.NextSlot = FirstSlot;
+		InShard.EndSlot = FirstSlot + FreshSlotBlockSize;
+	}
+	
+	return FFlecsNetworkId(static_cast<uint32>(InShard.NextSlot++), 1);
+}
+
+bool UDefaultFlecsNetworkIdGenerator::ClaimFreshSlots(const uint64 InCount, uint64& OutFirstSlot)
+{
+	OutFirstSlot = NextFreshSlot.fetch_add(InCount, std::memory_order_relaxed);
+	
+	if UNLIKELY_IF(OutFirstSlot + InCount > FFlecsNetworkId::SlotMask + 1)
+	{
+		ensureMsgf(false, TEXT("Network ID slots are exhausted"));
+		return false;
+	}
+	
+	return true;
+}
+
+void UDefaultFlecsNetworkIdGenerator::EmptyFreeIdPool()
+{
+	TArray<FFreeIdBatch*> Batches;
+	FreeIdPool.PopAll(Batches);
+	
+	for (FFreeIdBatch* Batch : Batches)
+	{
+		delete Batch;
+	}
 }
@@ -3,6 +3,7 @@
 #include "Networking/FlecsComponentReplicationDescriptor.h"
 
 #include "Misc/SecureHash.h"
+#include "Serialization/MemoryWriter.h"
 #include "UObject/UnrealType.h"
 
 #include "Logs/FlecsCategories.h"
@@ -143,6 +144,44 @@ bool FFlecsComponentReplicationDescriptor::IsValid(FString* OutError) const
 	return true;
 }
 
+bool FFlecsComponentReplicationDescriptor::AreValuesIdentical(const void* InValueA, const void* InValueB) const
+{
+	solid_checkf(InValueA && InValueB, TEXT("Cannot compare null component values"));
+	solid_checkf(!bIsTag, TEXT("Cannot compare values of tag component %s"), *StableName);
+	
+	if (InValueA == InValueB)
+	{
+		return true;
+	}
+	
+	if (ScriptStruct)
+	{
+		return ScriptStruct->CompareScriptStruct(InValueA, InValueB, PPF_None);
+	}
+	
+	if (bIsBitwiseComparable)
+	{
+		return FMemory::Memcmp(InValueA, InValueB, Size) == 0;
+	}
+	
+	// Reused between comparisons, baseline checks compare every value of an entity on every publish
+	thread_local TArray<uint8> BytesA;
+	thread_local TArray<uint8> BytesB;
+	
+	BytesA.Reset();
+	BytesB.Reset();
+	
+	FMemoryWriter WriterA(BytesA, true);
+	FMemoryWriter WriterB(BytesB, true);
+	
+	if UNLIKELY_IF(!Serialize(WriterA, const_cast<void*>(InValueA)) || !Serialize(WriterB, const_cast<void*>(InValueB)))
+	{
+		return false;
+	}
+	
+	return BytesA == BytesB;
+}
+
 FFlecsComponentReplicationRegistry& FFlecsComponentReplicationRegistry::Get(const TSolidNotNull<const UFlecsWorld*> World)
 {
 	RemoveExpiredWorldRegistries();
@@ -260,6 +299,7 @@ bool UE::Flecs::Replication::RegisterComponentDefinition(
 	Descriptor.Size = InDefinition.Size;
 	Descriptor.Alignment = InDefinition.Alignment;
 	Descriptor.bIsTag = InDefinition.bIsTag;
+	Descriptor.bIsBitwiseComparable = InDefinition.bIsBitwiseComparable;
 	Descriptor.ScriptStruct = InDefinition.ScriptStruct;
 	Descriptor.Serialize = InDefinition.Serialize;
 	Descriptor.Deserialize = InDefinition.Deserialize;
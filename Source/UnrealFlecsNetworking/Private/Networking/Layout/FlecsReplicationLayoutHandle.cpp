@@ -0,0 +1,82 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Layout/FlecsReplicationLayoutHandle.h"
+
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamUtil.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsReplicationLayoutHandle)
+
+namespace UE::Net
+{
+	struct FFlecsReplicationLayoutHandleNetSerializer
+	{
+		static constexpr uint32 Version = 0;
+		
+		using SourceType = FFlecsReplicationLayoutHandle;
+		using QuantizedType = uint32;
+		using ConfigType = FFlecsReplicationLayoutHandleNetSerializerConfig;
+		
+		inline static const ConfigType DefaultConfig;
+		
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+		{
+			const QuantizedType Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			WritePackedUint32(Context.GetBitStreamWriter(), Value);
+		}
+		
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+		{
+			*reinterpret_cast<QuantizedType*>(Args.Target) = ReadPackedUint32(Context.GetBitStreamReader());
+		}
+		
+		static void Quantize(FNetSerializationContext&, const FNetQuantizeArgs& Args)
+		{
+			*reinterpret_cast<QuantizedType*>(Args.Target) = reinterpret_cast<const SourceType*>(Args.Source)->Value;
+		}
+		
+		static void Dequantize(FNetSerializationContext&, const FNetDequantizeArgs& Args)
+		{
+			reinterpret_cast<SourceType*>(Args.Target)->Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		}
+		
+		static bool IsEqual(FNetSerializationContext&, const FNetIsEqualArgs& Args)
+		{
+			if (Args.bStateIsQuantized)
+			{
+				return *reinterpret_cast<const QuantizedType*>(Args.Source0) == *reinterpret_cast<const QuantizedType*>(Args.Source1);
+			}
+			
+			return *reinterpret_cast<const SourceType*>(Args.Source0) == *reinterpret_cast<const SourceType*>(Args.Source1);
+		}
+		
+	}; // struct FFlecsReplicationLayoutHandleNetSerializer
+	
+	UE_NET_IMPLEMENT_SERIALIZER(FFlecsReplicationLayoutHandleNetSerializer);
+	
+	static const FName PropertyNetSerializerRegistry_NAME_FlecsReplicationLayoutHandle(TEXT("FlecsReplicationLayoutHandle"));
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_FlecsReplicationLayoutHandle,
+		FFlecsReplicationLayoutHandleNetSerializer);
+	
+	class FFlecsReplicationLayoutHandleNetSerializerRegistryDelegates final : private FNetSerializerRegistryDelegates
+	{
+	public:
+		virtual ~FFlecsReplicationLayoutHandleNetSerializerRegistryDelegates() override
+		{
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_FlecsReplicationLayoutHandle);
+		}
+		
+	private:
+		virtual void OnPreFreezeNetSerializerRegistry() override
+		{
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_FlecsReplicationLayoutHandle);
+		}
+		
+	}; // class FFlecsReplicationLayoutHandleNetSerializerRegistryDelegates
+	
+	static FFlecsReplicationLayoutHandleNetSerializerRegistryDelegates FlecsReplicationLayoutHandleNetSerializerRegistryDelegates;
+	
+} // namespace UE::Net
@@ -7,11 +7,49 @@
 FFlecsReplicationLayoutId FFlecsReplicationLayoutRegistry::ComputeLayoutId(
 	const TArray<FFlecsReplicationKey>& Keys)
 {
-	FMD5 Md5;
+	TArray<FString> CanonicalKeys;
+	CanonicalKeys.Reserve(Keys.Num());
 	
 	for (const FFlecsReplicationKey& Key : Keys)
 	{
-		const FString Canonical = Key.CanonicalString();
+		CanonicalKeys.Add(Key.CanonicalString());
+	}
+	
+	return ComputeLayoutIdFromCanonicalKeys(CanonicalKeys);
+}
+
+FFlecsReplicationLayoutId FFlecsReplicationLayoutRegistry::ComputeLayoutId(
+	const FFlecsReplicationLayoutDefinition& Definition)
+{
+	if (!Definition.HasBaseline())
+	{
+		return ComputeLayoutId(Definition.Keys);
+	}
+	
+	TArray<FString> CanonicalKeys;
+	CanonicalKeys.Reserve(Definition.Keys.Num() + 1);
+	
+	for (const FFlecsReplicationKey& Key : Definition.Keys)
+	{
+		CanonicalKeys.Add(Key.CanonicalString());
+	}
+	
+	CanonicalKeys.Add(GetBaselineCanonicalString(Definition.Baseline));
+	return ComputeLayoutIdFromCanonicalKeys(CanonicalKeys);
+}
+
+FString FFlecsReplicationLayoutRegistry::GetBaselineCanonicalString(const FFlecsReplicationIndividualKey& Baseline)
+{
+	return FString::Printf(TEXT("IsA|%u|%s"), static_cast<uint8>(Baseline.Kind), *Baseline.CanonicalString());
+}
+
+FFlecsReplicationLayoutId FFlecsReplicationLayoutRegistry::ComputeLayoutIdFromCanonicalKeys(
+	const TConstArrayView<FString> CanonicalKeys)
+{
+	FMD5 Md5;
+	
+	for (const FString& Canonical : CanonicalKeys)
+	{
 		FTCHARToUTF8 Utf8(*Canonical);
 		Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
 		const uint8 Separator = 0;
@@ -59,9 +97,32 @@ TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> FFlecsReplicati
 	const FFlecsComponentReplicationRegistry& Registry = FFlecsComponentReplicationRegistry::Get(World->GetFlecsWorld());
 	TArray<FFlecsReplicationKey> Keys;
 	
+	FFlecsReplicationIndividualKey Baseline;
+	int32 PrefabCount = 0;
+	
 	for (const FFlecsId Id : Entity.GetType())
 	{
 		FFlecsReplicationKey Key;
+		
+		// The prefab itself isn't a key, snapshots are filled relative to it if it can be identified on the receiver
+		if (Id.IsPair() && Id.HasRelation(flecs::IsA))
+		{
+			++PrefabCount;
+			
+			const FFlecsEntityHandle PrefabEntity = World->GetAlive(Id.GetSecond());
+			if (PrefabEntity.IsValid())
+			{
+				const TValueOrError<FFlecsReplicationIndividualKey, FString> PrefabKey =
+					FFlecsReplicationIndividualKey::BuildIndividualKey(World, PrefabEntity.GetFlecsId());
+				
+				if (PrefabKey.HasValue())
+				{
+					Baseline = PrefabKey.GetValue();
+				}
+			}
+			
+			continue;
+		}
 
 		if (!Id.IsPair())
 		{
@@ -125,18 +186,49 @@ TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> FFlecsReplicati
 		Keys.Add(MoveTemp(Key));
 	}
 
-	Keys.Sort([](const FFlecsReplicationKey& A, const FFlecsReplicationKey& B)
+	// Canonical strings are built once per key and shared by the sort and the layout hash
+	TArray<FString> CanonicalKeys;
+	CanonicalKeys.Reserve(Keys.Num());
+	
+	TArray<int32> SortedKeyIndices;
+	SortedKeyIndices.Reserve(Keys.Num());
+	
+	for (int32 Index = 0; Index < Keys.Num(); ++Index)
+	{
+		CanonicalKeys.Add(Keys[Index].CanonicalString());
+		SortedKeyIndices.Add(Index);
+	}
+	
+	SortedKeyIndices.Sort([&CanonicalKeys](const int32 A, const int32 B)
 	{
-		return A.CanonicalString() < B.CanonicalString();
+		return CanonicalKeys[A] < CanonicalKeys[B];
 	});
 
 	FFlecsReplicationLayoutDefinition Definition;
-	Definition.Keys = MoveTemp(Keys);
-	Definition.LayoutId = ComputeLayoutId(Definition.Keys);
+	Definition.Keys.Reserve(Keys.Num());
+	
+	TArray<FString> SortedCanonicalKeys;
+	SortedCanonicalKeys.Reserve(Keys.Num());
+	
+	for (const int32 KeyIndex : SortedKeyIndices)
+	{
+		Definition.Keys.Add(MoveTemp(Keys[KeyIndex]));
+		SortedCanonicalKeys.Add(MoveTemp(CanonicalKeys[KeyIndex]));
+	}
+	
+	// Values of an instance of several prefabs could come from any of them, so it's sent without a baseline
+	if (PrefabCount == 1 && Baseline.Kind != EFlecsReplicationPairTargetKind::None
+		&& Baseline.Kind != EFlecsReplicationPairTargetKind::Schema)
+	{
+		Definition.Baseline = MoveTemp(Baseline);
+		SortedCanonicalKeys.Add(GetBaselineCanonicalString(Definition.Baseline));
+	}
+	
+	Definition.LayoutId = ComputeLayoutIdFromCanonicalKeys(SortedCanonicalKeys);
 	
 	if (const FFlecsReplicationLayoutDefinition* Existing = Definitions.Find(Definition.LayoutId))
 	{
-		if (Existing->Keys != Definition.Keys)
+		if (Existing->Keys != Definition.Keys || Existing->Baseline != Definition.Baseline)
 		{
 			return MakeError(FString::Printf(TEXT("Replication layout hash collision for %s"), *Definition.LayoutId.ToString()));
 		}
@@ -150,13 +242,16 @@ TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> FFlecsReplicati
 	
 	solid_ensure(!Definitions.Contains(Id));
 	
+	Definition.Handle = FFlecsReplicationLayoutHandle(NextHandleValue++);
+	HandleToLayoutId.Add(Definition.Handle, Id);
+	
 	Definitions.Add(Id, MoveTemp(Definition));
 	TableCache.Add(Table, Id);
 	bOutCreatedNewLayout = true;
 	
 	UE_LOGFMT(LogFlecsCore, Verbose,
-		"Built replication layout for entity {Entity} with layout ID {LayoutId} and {KeyCount} keys",
-		*Entity.ToString(), *Id.ToString(), Definitions[Id].Keys.Num());
+		"Built replication layout for entity {Entity} with layout ID {LayoutId}, handle {Handle} and {KeyCount} keys",
+		*Entity.ToString(), *Id.ToString(), Definitions[Id].Handle.ToString(), Definitions[Id].Keys.Num());
 	return MakeValue(Definitions.Find(Id));
 }
 
@@ -170,17 +265,27 @@ const FFlecsReplicationLayoutDefinition* FFlecsReplicationLayoutRegistry::Find(c
 	return Definitions.Find(Id);
 }
 
+FFlecsReplicationLayoutId FFlecsReplicationLayoutRegistry::FindLayoutId(const FFlecsReplicationLayoutHandle Handle) const
+{
+	const FFlecsReplicationLayoutId* LayoutId = HandleToLayoutId.Find(Handle);
+	return LayoutId ? *LayoutId : FFlecsReplicationLayoutId();
+}
+
 TValueOrError<bool, FString> FFlecsReplicationLayoutRegistry::AddRemoteDefinition(
 	const FFlecsReplicationLayoutDefinition& Definition, const UFlecsWorldInterfaceObject* World)
 {
-	if (!Definition.LayoutId.IsValid() || ComputeLayoutId(Definition.Keys) != Definition.LayoutId)
+	if (!Definition.LayoutId.IsValid() || ComputeLayoutId(Definition) != Definition.LayoutId)
 	{
 		return MakeError("Received replication layout has an invalid identity");
 	}
 	
+	// Handles are usable as soon as the definition arrives, snapshots of layouts that
+	// can't be resolved yet follow the regular deferred path by their layout ID
+	RegisterRemoteHandle(Definition);
+	
 	if (const FFlecsReplicationLayoutDefinition* Existing = Definitions.Find(Definition.LayoutId))
 	{
-		if (Existing->Keys != Definition.Keys)
+		if (Existing->Keys != Definition.Keys || Existing->Baseline != Definition.Baseline)
 		{
 			return MakeError("Received replication layout collides with an existing definition");
 		}
@@ -227,6 +332,26 @@ void FFlecsReplicationLayoutRegistry::TryConsumePendingLayouts(const TSolidNotNu
 	}
 }
 
+void FFlecsReplicationLayoutRegistry::RegisterRemoteHandle(const FFlecsReplicationLayoutDefinition& Definition)
+{
+	if UNLIKELY_IF(!Definition.Handle.IsValid())
+	{
+		return;
+	}
+	
+	FFlecsReplicationLayoutId& MappedLayoutId = HandleToLayoutId.FindOrAdd(Definition.Handle);
+	
+	// The layout ID stays the identity, a re-sent dictionary entry replaces a stale handle mapping
+	if UNLIKELY_IF(MappedLayoutId.IsValid() && MappedLayoutId != Definition.LayoutId)
+	{
+		UE_LOGFMT(LogFlecsCore, Warning,
+			"Replication layout handle {Handle} was remapped from {OldLayoutId} to {LayoutId}",
+			Definition.Handle.ToString(), *MappedLayoutId.ToString(), *Definition.LayoutId.ToString());
+	}
+	
+	MappedLayoutId = Definition.LayoutId;
+}
+
 void FFlecsReplicationLayoutRegistry::AddPendingLayout(const FFlecsReplicationLayoutDefinition& Definition)
 {
 	PendingLayouts.Add(Definition);
@@ -244,6 +369,12 @@ bool FFlecsReplicationLayoutRegistry::ValidateLayoutDefinition(const FFlecsRepli
 			return false;
 		}
 	}
+	
+	// The prefab has to exist before instances can be reset to its values
+	if (Definition.HasBaseline() && !FFlecsReplicationIndividualKey::ResolveToId(World, Definition.Baseline).IsValid())
+	{
+		return false;
+	}
 
 	return true;
 }
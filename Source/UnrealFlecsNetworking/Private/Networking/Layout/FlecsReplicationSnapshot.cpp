@@ -12,6 +12,18 @@
 
 void FFlecsEntityReplicationSnapshot::FillFromEntity(const FFlecsEntityHandle& InEntityHandle, 
 	const FFlecsReplicationLayoutRegistry& InLayoutRegistry)
+{
+	FillFromEntity_Internal(InEntityHandle, InLayoutRegistry, nullptr);
+}
+
+void FFlecsEntityReplicationSnapshot::FillDirtyFromEntity(const FFlecsEntityHandle& InEntityHandle,
+	const FFlecsReplicationLayoutRegistry& InLayoutRegistry, const TFunctionRef<bool(FFlecsId)>& InIsValueDirty)
+{
+	FillFromEntity_Internal(InEntityHandle, InLayoutRegistry, &InIsValueDirty);
+}
+
+void FFlecsEntityReplicationSnapshot::FillFromEntity_Internal(const FFlecsEntityHandle& InEntityHandle,
+	const FFlecsReplicationLayoutRegistry& InLayoutRegistry, const TFunctionRef<bool(FFlecsId)>* InIsValueDirty)
 {
 	solid_checkf(InEntityHandle.IsValid(), TEXT("Cannot fill snapshot from invalid entity handle"));
 	
@@ -28,9 +40,25 @@ void FFlecsEntityReplicationSnapshot::FillFromEntity(const FFlecsEntityHandle& I
 		return;
 	}
 	
+	const int32 KeyCount = LayoutDefinition->Keys.Num();
+	
+	// Clean values are copied from the previous fill, which is only possible if it had the same layout
+	const bool bKeepCleanValues = InIsValueDirty && StateRevision > 0
+		&& LayoutHandle == LayoutDefinition->Handle && PackedValues.Num() == KeyCount;
+	
+	TArray<uint8> PreviousPayloadData;
+	TArray<FFlecsReplicatedPackedValue, TInlineAllocator<16>> PreviousPackedValues;
+	if (bKeepCleanValues)
+	{
+		PreviousPayloadData = MoveTemp(PayloadData);
+		PreviousPackedValues = PackedValues;
+		PayloadData.Reserve(PreviousPayloadData.Num());
+	}
+	
+	LayoutHandle = LayoutDefinition->Handle;
+	
 	PayloadData.Reset();
 
-	const int32 KeyCount = LayoutDefinition->Keys.Num();
 	PackedValues.SetNum(KeyCount);
 	for (FFlecsReplicatedPackedValue& PackedValue : PackedValues)
 	{
@@ -40,6 +68,13 @@ void FFlecsEntityReplicationSnapshot::FillFromEntity(const FFlecsEntityHandle& I
 	}
 
 	const uint32 NewStateRevision = StateRevision + 1;
+	
+	// Values equal to the prefab's are left without a revision, receivers take them from their own copy of the prefab
+	FFlecsEntityHandle BaselinePrefab;
+	if (LayoutDefinition->HasBaseline())
+	{
+		BaselinePrefab = InEntityHandle.GetPairTarget<FFlecsEntityHandle>(flecs::IsA);
+	}
 
 	for (int32 Index = 0; Index < KeyCount; ++Index)
 	{
@@ -55,6 +90,22 @@ void FFlecsEntityReplicationSnapshot::FillFromEntity(const FFlecsEntityHandle& I
 			continue;
 		}
 		
+		if (bKeepCleanValues && !(*InIsValueDirty)(ComponentId))
+		{
+			const FFlecsReplicatedPackedValue& PreviousValue = PreviousPackedValues[Index];
+			
+			PackedValue.Revision = PreviousValue.Revision;
+			PackedValue.Offset = static_cast<uint32>(PayloadData.Num());
+			PackedValue.Size = PreviousValue.Size;
+			
+			if (PreviousValue.Size > 0)
+			{
+				PayloadData.Append(PreviousPayloadData.GetData() + PreviousValue.Offset, PreviousValue.Size);
+			}
+			
+			continue;
+		}
+		
 #if DO_CHECK
 		
 		if (ComponentId.IsPair())
@@ -98,6 +149,15 @@ void FFlecsEntityReplicationSnapshot::FillFromEntity(const FFlecsEntityHandle& I
 		const void* ComponentValuePtr = InEntityHandle.TryGet(ComponentId);
 		solid_cassume(ComponentValuePtr);
 		
+		if (BaselinePrefab.IsValid())
+		{
+			const void* BaselineValuePtr = BaselinePrefab.TryGet(ComponentId);
+			if (BaselineValuePtr && Descriptor->AreValuesIdentical(ComponentValuePtr, BaselineValuePtr))
+			{
+				continue;
+			}
+		}
+		
 		const int32 PayloadOffset = PayloadData.Num();
 
 		FMemoryWriter Writer(PayloadData, true, true);
@@ -0,0 +1,34 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Prediction/FlecsPredictionGameLoop.h"
+
+#include "Engine/World.h"
+
+#include "Pipelines/FlecsTickTypeNativeTags.h"
+#include "Worlds/FlecsWorld.h"
+
+#include "Networking/Prediction/FlecsPredictionWorldSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsPredictionGameLoop)
+
+bool UFlecsPredictionGameLoop::Progress(const double DeltaTime, const FGameplayTag& InTickType,
+	const TSolidNotNull<UFlecsWorld*> InWorld)
+{
+	const UWorld* World = InWorld->GetWorld();
+	if UNLIKELY_IF(!World)
+	{
+		return true;
+	}
+	
+	if (UFlecsPredictionWorldSubsystem* PredictionSubsystem = World->GetSubsystem<UFlecsPredictionWorldSubsystem>())
+	{
+		PredictionSubsystem->ResimulatePendingRollbacks(DeltaTime);
+	}
+	
+	return true;
+}
+
+TArray<FGameplayTag> UFlecsPredictionGameLoop::GetTickTypeTags() const
+{
+	return { FlecsTickType_MainLoop };
+}
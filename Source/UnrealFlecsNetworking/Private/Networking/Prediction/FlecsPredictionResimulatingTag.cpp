@@ -0,0 +1,7 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Prediction/FlecsPredictionResimulatingTag.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsPredictionResimulatingTag)
+
+REGISTER_FLECS_COMPONENT(FFlecsPredictionResimulatingTag);
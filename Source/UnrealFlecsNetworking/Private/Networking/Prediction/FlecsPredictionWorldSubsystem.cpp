@@ -0,0 +1,293 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Prediction/FlecsPredictionWorldSubsystem.h"
+
+#include "Subsystems/SubsystemCollection.h"
+
+#include "Pipelines/FlecsOutsideMainLoopTag.h"
+#include "Systems/FlecsPhasesType.h"
+
+#include "Networking/FlecsNetworkId.h"
+#include "Networking/FlecsNetworkingModuleSettings.h"
+#include "Networking/FlecsPredictedEntityTag.h"
+#include "Networking/Prediction/FlecsPredictionResimulatingTag.h"
+#include "Networking/Prediction/FlecsPredictionSystemTag.h"
+#include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsPredictionWorldSubsystem)
+
+namespace
+{
+	/** Compares the serialized values of two snapshots, values are predicted correctly only if their bytes are equal */
+	bool MatchesPrediction(const FFlecsEntityReplicationSnapshot& InPredicted, const FFlecsEntityReplicationSnapshot& InSnapshot)
+	{
+		if (InPredicted.LayoutId != InSnapshot.LayoutId || InPredicted.PackedValues.Num() != InSnapshot.PackedValues.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < InSnapshot.PackedValues.Num(); ++Index)
+		{
+			const FFlecsReplicatedPackedValue& PredictedValue = InPredicted.PackedValues[Index];
+			const FFlecsReplicatedPackedValue& Value = InSnapshot.PackedValues[Index];
+
+			if ((PredictedValue.Revision == 0) != (Value.Revision == 0) || PredictedValue.Size != Value.Size)
+			{
+				return false;
+			}
+
+			if (Value.Revision == 0)
+			{
+				continue;
+			}
+
+			const uint64 PredictedEnd = static_cast<uint64>(PredictedValue.Offset) + PredictedValue.Size;
+			const uint64 End = static_cast<uint64>(Value.Offset) + Value.Size;
+
+			if UNLIKELY_IF(PredictedEnd > static_cast<uint64>(InPredicted.PayloadData.Num())
+				|| End > static_cast<uint64>(InSnapshot.PayloadData.Num()))
+			{
+				return false;
+			}
+
+			if (FMemory::Memcmp(InPredicted.PayloadData.GetData() + PredictedValue.Offset,
+				InSnapshot.PayloadData.GetData() + Value.Offset, Value.Size) != 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+} // namespace
+
+void UFlecsPredictionWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	// Needed before Super::Initialize, which initializes the Flecs world part if the world already exists
+	NetworkSubsystem = Collection.InitializeDependency<UFlecsNetworkWorldSubsystem>();
+
+	Super::Initialize(Collection);
+}
+
+void UFlecsPredictionWorldSubsystem::OnFlecsWorldInitialized(const TSolidNotNull<UFlecsWorld*> InWorld)
+{
+	Super::OnFlecsWorldInitialized(InWorld);
+
+	solid_checkf(NetworkSubsystem, TEXT("Prediction subsystem requires the network world subsystem"));
+	NetworkSubsystem->SetPredictionSubsystem(this);
+
+	ResimulationPipeline = InWorld->CreatePipeline("PredictionResimulationPipeline")
+		.With(flecs::System)
+		.With<FFlecsPredictionSystemTag>()
+		.With(flecs::Phase).Cascade(flecs::DependsOn)
+		.Without(flecs::Disabled).Up(flecs::DependsOn)
+		.Without(flecs::Disabled).Up(flecs::ChildOf)
+		.Build();
+
+	// After the simulation phases and before received snapshots are applied in PostUpdate,
+	// so a snapshot is compared against a history that already has the current frame
+	RecordSystem = InWorld->CreateSystem(TEXT("PredictionHistoryRecordSystem"))
+		.Phase(EFlecsPhaseType::OnValidate)
+		.With<FFlecsPredictedEntityTag>() // 0
+		.With<const FFlecsNetworkId>() // 1
+		.run([this](flecs::iter& InIterator)
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsPredictionWorldSubsystem_RecordSystem);
+
+			while (InIterator.next())
+			{
+				for (const size_t Index : InIterator)
+				{
+					RecordPredictedEntity(InIterator.entity(Index));
+				}
+			}
+		});
+
+	PredictedEntityRemovedObserver = InWorld->CreateObserver(TEXT("PredictedEntityRemovedObserver"))
+		.With<FFlecsPredictedEntityTag>()
+		.Event(flecs::OnRemove)
+		.each([this](flecs::iter& InIterator, size_t InIndex)
+		{
+			const FFlecsEntityHandle EntityHandle = InIterator.entity(InIndex);
+
+			PredictionHistories.Remove(EntityHandle);
+			PendingRollbacks.Remove(EntityHandle);
+		});
+}
+
+void UFlecsPredictionWorldSubsystem::Deinitialize()
+{
+	if (NetworkSubsystem)
+	{
+		NetworkSubsystem->SetPredictionSubsystem(nullptr);
+		NetworkSubsystem = nullptr;
+	}
+
+	PredictionHistories.Reset();
+	PendingRollbacks.Reset();
+	ResimulatingEntities.Reset();
+	PredictionStats = FFlecsPredictionStats();
+
+	Super::Deinitialize();
+}
+
+void UFlecsPredictionWorldSubsystem::AddResimulationSystem(const FFlecsSystemHandle& InSystem) const
+{
+	solid_checkf(InSystem.IsValid(), TEXT("Cannot add an invalid system to the resimulation pipeline"));
+
+	InSystem.Add<FFlecsPredictionSystemTag>();
+	InSystem.Add<FFlecsOutsideMainLoopTag>();
+}
+
+void UFlecsPredictionWorldSubsystem::RecordPredictedEntity(const FFlecsEntityHandle& InEntityHandle)
+{
+	FFlecsPredictionHistory& History = FindOrAddPredictionHistory(InEntityHandle);
+
+	if (History.IsEmpty())
+	{
+		const FFlecsNetworkId* NetworkId = InEntityHandle.TryGet<FFlecsNetworkId>();
+		const FFlecsEntityReplicationSnapshot* Snapshot = NetworkId
+			? NetworkSubsystem->FindReplicationSnapshot(*NetworkId)
+			: nullptr;
+
+		// Nothing to predict from until the first snapshot of the entity was applied
+		if (!Snapshot || !Snapshot->LayoutId.IsValid())
+		{
+			return;
+		}
+
+		History.Rewind(Snapshot->StateRevision) = *Snapshot;
+	}
+
+	History.Advance().FillFromEntity(InEntityHandle, NetworkSubsystem->GetLayoutRegistry());
+}
+
+bool UFlecsPredictionWorldSubsystem::ConfirmPredictedSnapshot(const FFlecsEntityHandle& InEntityHandle,
+	const FFlecsEntityReplicationSnapshot& InSnapshot)
+{
+	FFlecsPredictionHistory* History = PredictionHistories.Find(InEntityHandle);
+
+	// Nothing was predicted yet, the snapshot is applied as is and becomes the start of the prediction
+	if (!History || History->IsEmpty())
+	{
+		return false;
+	}
+
+	const uint32 Revision = InSnapshot.StateRevision;
+	const uint32 LatestRevision = History->GetLatestRevision();
+
+	const FFlecsEntityReplicationSnapshot* PredictedFrame = History->Find(Revision);
+	if LIKELY_IF(PredictedFrame && MatchesPrediction(*PredictedFrame, InSnapshot))
+	{
+		++PredictionStats.ConfirmedSnapshotCount;
+		return true;
+	}
+
+	++PredictionStats.MispredictedSnapshotCount;
+
+	History->Rewind(Revision) = InSnapshot;
+
+	if (LatestRevision > Revision)
+	{
+		// Frames that fell out of the history aren't worth more resimulation than the history can hold
+		const uint32 TargetRevision = FMath::Min(LatestRevision, Revision + static_cast<uint32>(History->GetCapacity()));
+
+		uint32& PendingRevision = PendingRollbacks.FindOrAdd(InEntityHandle, TargetRevision);
+		PendingRevision = FMath::Max(PendingRevision, TargetRevision);
+	}
+
+	return false;
+}
+
+void UFlecsPredictionWorldSubsystem::ResimulatePendingRollbacks(const double DeltaTime)
+{
+	if (PendingRollbacks.IsEmpty())
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsPredictionWorldSubsystem_ResimulatePendingRollbacks);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const TSolidNotNull<UFlecsWorld*> World = GetFlecsWorldChecked();
+
+	solid_checkf(!World->IsDeferred(), TEXT("Rollbacks can't be resimulated while the world is deferred"));
+
+	ResimulatingEntities.Reset();
+
+	for (const TPair<FFlecsEntityHandle, uint32>& PendingRollback : PendingRollbacks)
+	{
+		const FFlecsEntityHandle& EntityHandle = PendingRollback.Key;
+		const FFlecsPredictionHistory* History = PredictionHistories.Find(EntityHandle);
+
+		if (!EntityHandle.IsAlive() || !History || History->GetLatestRevision() >= PendingRollback.Value)
+		{
+			continue;
+		}
+
+		EntityHandle.Add<FFlecsPredictionResimulatingTag>();
+		ResimulatingEntities.Emplace(EntityHandle, PendingRollback.Value);
+	}
+
+	PendingRollbacks.Reset();
+
+	if (ResimulatingEntities.IsEmpty())
+	{
+		return;
+	}
+
+	// Entities are stepped in lockstep, one pipeline run advances every entity that is still behind by one frame
+	while (!ResimulatingEntities.IsEmpty())
+	{
+		World->RunPipeline(ResimulationPipeline, DeltaTime);
+
+		// Step systems may destroy an entity or stop predicting it, recording it again would recreate its history
+		for (int32 Index = ResimulatingEntities.Num() - 1; Index >= 0; --Index)
+		{
+			const FFlecsEntityHandle EntityHandle = ResimulatingEntities[Index].Key;
+			if LIKELY_IF(EntityHandle.IsAlive() && EntityHandle.Has<FFlecsPredictedEntityTag>())
+			{
+				continue;
+			}
+
+			if (EntityHandle.IsAlive())
+			{
+				EntityHandle.Remove<FFlecsPredictionResimulatingTag>();
+			}
+
+			ResimulatingEntities.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+
+		++PredictionStats.ResimulatedFrameCount;
+		PredictionStats.ResimulatedEntityFrameCount += ResimulatingEntities.Num();
+
+		for (int32 Index = ResimulatingEntities.Num() - 1; Index >= 0; --Index)
+		{
+			const FFlecsEntityHandle EntityHandle = ResimulatingEntities[Index].Key;
+
+			RecordPredictedEntity(EntityHandle);
+
+			if (FindOrAddPredictionHistory(EntityHandle).GetLatestRevision() >= ResimulatingEntities[Index].Value)
+			{
+				EntityHandle.Remove<FFlecsPredictionResimulatingTag>();
+				ResimulatingEntities.RemoveAtSwap(Index, EAllowShrinking::No);
+			}
+		}
+	}
+
+	++PredictionStats.RollbackCount;
+	PredictionStats.LastRollbackSeconds = FPlatformTime::Seconds() - StartTime;
+	PredictionStats.TotalRollbackSeconds += PredictionStats.LastRollbackSeconds;
+}
+
+FFlecsPredictionHistory& UFlecsPredictionWorldSubsystem::FindOrAddPredictionHistory(const FFlecsEntityHandle& InEntityHandle)
+{
+	if (FFlecsPredictionHistory* History = PredictionHistories.Find(InEntityHandle))
+	{
+		return *History;
+	}
+
+	return PredictionHistories.Emplace(InEntityHandle,
+		FFlecsPredictionHistory(GetDefault<UFlecsNetworkingModuleSettings>()->PredictionHistoryLength));
+}
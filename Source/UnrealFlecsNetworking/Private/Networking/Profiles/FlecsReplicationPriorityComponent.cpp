@@ -0,0 +1,7 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Profiles/FlecsReplicationPriorityComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsReplicationPriorityComponent)
+
+REGISTER_FLECS_COMPONENT(FFlecsReplicationPriorityComponent);
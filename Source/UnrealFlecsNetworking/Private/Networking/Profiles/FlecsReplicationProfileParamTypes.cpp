@@ -5,12 +5,14 @@
 #include "Networking/Profiles/FlecsNetAlwaysRelevantTag.h"
 #include "Networking/Profiles/FlecsProfileRelationshipTypes.h"
 #include "Networking/Profiles/FlecsReplicationCullDistanceComponent.h"
+#include "Networking/Profiles/FlecsReplicationPriorityComponent.h"
 #include "Networking/Profiles/FlecsReplicationUpdateRateComponent.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsReplicationProfileParamTypes)
 
 REGISTER_FLECS_COMPONENT(FFlecsReplicationProfileCullDistance);
 REGISTER_FLECS_COMPONENT(FFlecsReplicationProfileUpdateRate);
+REGISTER_FLECS_COMPONENT(FFlecsReplicationProfilePriority);
 REGISTER_FLECS_COMPONENT(FFlecsReplicationProfileAlwaysRelevant);
 
 REGISTER_FLECS_COMPONENT(FFlecsReplicationProfileObjectPrioritizer);
@@ -44,6 +46,11 @@ void FFlecsReplicationProfileUpdateRate::ApplyToEntity(const FFlecsEntityHandle&
 	InEntity.Set<FFlecsReplicationUpdateRateComponent>({.UpdateRate=UpdateRate});
 }
 
+void FFlecsReplicationProfilePriority::ApplyToEntity(const FFlecsEntityHandle& InEntity) const
+{
+	InEntity.Set<FFlecsReplicationPriorityComponent>({.Priority=Priority});
+}
+
 void FFlecsReplicationProfileAlwaysRelevant::ApplyToEntity(const FFlecsEntityHandle& InEntity) const
 {
 	InEntity.Add<FFlecsNetAlwaysRelevantTag>();
@@ -0,0 +1,256 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Recording/FlecsReplicationRecording.h"
+
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "Logs/FlecsCategories.h"
+
+namespace
+{
+	constexpr uint32 RecordingMagic = 0x46524543; // "FREC"
+	constexpr uint32 RecordingVersion = 1;
+	
+	// Anything larger is treated as a corrupt recording rather than allocated
+	constexpr uint32 MaxRecordedArrayNum = 1u << 24;
+	
+	void SerializeNetworkId(FArchive& InArchive, FFlecsNetworkId& InOutNetworkId)
+	{
+		uint32 Slot = InOutNetworkId.GetSlot();
+		uint32 Generation = InOutNetworkId.GetGeneration();
+		
+		InArchive.SerializeIntPacked(Slot);
+		InArchive.SerializeIntPacked(Generation);
+		
+		if (InArchive.IsLoading())
+		{
+			InOutNetworkId = FFlecsNetworkId(Slot, Generation);
+		}
+	}
+	
+	bool SerializeArrayNum(FArchive& InArchive, int32 InNum, OUT int32& OutNum)
+	{
+		uint32 Num = static_cast<uint32>(InNum);
+		InArchive.SerializeIntPacked(Num);
+		
+		if UNLIKELY_IF(Num > MaxRecordedArrayNum)
+		{
+			InArchive.SetError();
+			return false;
+		}
+		
+		OutNum = static_cast<int32>(Num);
+		return true;
+	}
+	
+	void SerializeSnapshot(FArchive& InArchive, FFlecsEntityReplicationSnapshot& InOutSnapshot)
+	{
+		InArchive.SerializeIntPacked(InOutSnapshot.LayoutHandle.Value);
+		InArchive.SerializeIntPacked(InOutSnapshot.StateRevision);
+		
+		int32 ValueCount = 0;
+		if UNLIKELY_IF(!SerializeArrayNum(InArchive, InOutSnapshot.PackedValues.Num(), ValueCount))
+		{
+			return;
+		}
+		
+		if (InArchive.IsLoading())
+		{
+			InOutSnapshot.LayoutId = FFlecsReplicationLayoutId();
+			InOutSnapshot.PackedValues.SetNum(ValueCount, EAllowShrinking::No);
+		}
+		
+		for (FFlecsReplicatedPackedValue& Value : InOutSnapshot.PackedValues)
+		{
+			InArchive.SerializeIntPacked(Value.Revision);
+			InArchive.SerializeIntPacked(Value.Offset);
+			InArchive.SerializeIntPacked(Value.Size);
+		}
+		
+		int32 PayloadSize = 0;
+		if UNLIKELY_IF(!SerializeArrayNum(InArchive, InOutSnapshot.PayloadData.Num(), PayloadSize))
+		{
+			return;
+		}
+		
+		if (InArchive.IsLoading())
+		{
+			InOutSnapshot.PayloadData.SetNumUninitialized(PayloadSize, EAllowShrinking::No);
+		}
+		
+		InArchive.Serialize(InOutSnapshot.PayloadData.GetData(), PayloadSize);
+	}
+	
+} // namespace
+
+void FFlecsReplicationRecording::Reset()
+{
+	Data.Reset();
+	RecordCount = 0;
+	LastRecordMicroseconds = 0;
+}
+
+void FFlecsReplicationRecording::RecordLayout(const double InTime, const FFlecsReplicationLayoutDefinition& InLayout)
+{
+	FMemoryWriter Writer(Data);
+	Writer.Seek(Data.Num());
+	
+	BeginRecord(Writer, EFlecsReplicationRecordType::Layout, InTime);
+	
+	// Layouts are rare, they keep their tagless property serialization instead of a packed one
+	FFlecsReplicationLayoutDefinition::StaticStruct()->SerializeBin(Writer, const_cast<FFlecsReplicationLayoutDefinition*>(&InLayout));
+}
+
+void FFlecsReplicationRecording::RecordSnapshot(const double InTime, const FFlecsNetworkId& InNetworkId,
+	const FFlecsEntityReplicationSnapshot& InSnapshot)
+{
+	FMemoryWriter Writer(Data);
+	Writer.Seek(Data.Num());
+	
+	BeginRecord(Writer, EFlecsReplicationRecordType::Snapshot, InTime);
+	
+	FFlecsNetworkId NetworkId = InNetworkId;
+	SerializeNetworkId(Writer, NetworkId);
+	SerializeSnapshot(Writer, const_cast<FFlecsEntityReplicationSnapshot&>(InSnapshot));
+}
+
+void FFlecsReplicationRecording::RecordRemoval(const double InTime, const FFlecsNetworkId& InNetworkId,
+	const uint32 InRemovalRevision)
+{
+	FMemoryWriter Writer(Data);
+	Writer.Seek(Data.Num());
+	
+	BeginRecord(Writer, EFlecsReplicationRecordType::Removal, InTime);
+	
+	FFlecsNetworkId NetworkId = InNetworkId;
+	uint32 RemovalRevision = InRemovalRevision;
+	
+	SerializeNetworkId(Writer, NetworkId);
+	Writer.SerializeIntPacked(RemovalRevision);
+}
+
+bool FFlecsReplicationRecording::SaveToFile(const FString& InFilename) const
+{
+	TArray<uint8> FileData;
+	FileData.Reserve(Data.Num() + 32);
+	
+	FMemoryWriter Writer(FileData);
+	
+	uint32 Magic = RecordingMagic;
+	uint32 Version = RecordingVersion;
+	int32 Count = RecordCount;
+	uint64 Microseconds = LastRecordMicroseconds;
+	
+	Writer << Magic << Version << Count << Microseconds;
+	FileData.Append(Data);
+	
+	return FFileHelper::SaveArrayToFile(FileData, *InFilename);
+}
+
+bool FFlecsReplicationRecording::LoadFromFile(const FString& InFilename)
+{
+	Reset();
+	
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *InFilename))
+	{
+		return false;
+	}
+	
+	FMemoryReader Reader(FileData);
+	
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 Count = 0;
+	uint64 Microseconds = 0;
+	
+	Reader << Magic << Version << Count << Microseconds;
+	
+	if (Reader.IsError() || Magic != RecordingMagic || Version != RecordingVersion || Count < 0)
+	{
+		UE_LOGFMT(LogFlecsCore, Error, "'{Filename}' is not a Flecs replication recording of version {Version}",
+			*InFilename, RecordingVersion);
+		return false;
+	}
+	
+	Data.Append(FileData.GetData() + Reader.Tell(), FileData.Num() - static_cast<int32>(Reader.Tell()));
+	RecordCount = Count;
+	LastRecordMicroseconds = Microseconds;
+	return true;
+}
+
+void FFlecsReplicationRecording::BeginRecord(FArchive& InArchive, EFlecsReplicationRecordType InType, const double InTime)
+{
+	const uint64 RecordMicroseconds = FMath::Max(LastRecordMicroseconds,
+		static_cast<uint64>(FMath::Max(InTime, 0.0) * 1e6));
+	
+	uint8 Type = static_cast<uint8>(InType);
+	uint32 DeltaMicroseconds = static_cast<uint32>(FMath::Min<uint64>(RecordMicroseconds - LastRecordMicroseconds, MAX_uint32));
+	
+	InArchive << Type;
+	InArchive.SerializeIntPacked(DeltaMicroseconds);
+	
+	LastRecordMicroseconds += DeltaMicroseconds;
+	++RecordCount;
+}
+
+FFlecsReplicationRecordingReader::FFlecsReplicationRecordingReader(const FFlecsReplicationRecording& InRecording)
+	: Reader(InRecording.GetData())
+{
+}
+
+bool FFlecsReplicationRecordingReader::ReadNext(FFlecsReplicationRecord& OutRecord)
+{
+	if (Reader.IsError() || Reader.AtEnd())
+	{
+		return false;
+	}
+	
+	uint8 Type = 0;
+	uint32 DeltaMicroseconds = 0;
+	
+	Reader << Type;
+	Reader.SerializeIntPacked(DeltaMicroseconds);
+	
+	RecordMicroseconds += DeltaMicroseconds;
+	
+	OutRecord.Type = static_cast<EFlecsReplicationRecordType>(Type);
+	OutRecord.Time = static_cast<double>(RecordMicroseconds) * 1e-6;
+	
+	switch (OutRecord.Type)
+	{
+		case EFlecsReplicationRecordType::Layout:
+		{
+			OutRecord.Layout = FFlecsReplicationLayoutDefinition();
+			FFlecsReplicationLayoutDefinition::StaticStruct()->SerializeBin(Reader, &OutRecord.Layout);
+			break;
+		}
+		case EFlecsReplicationRecordType::Snapshot:
+		{
+			SerializeNetworkId(Reader, OutRecord.NetworkId);
+			SerializeSnapshot(Reader, OutRecord.Snapshot);
+			break;
+		}
+		case EFlecsReplicationRecordType::Removal:
+		{
+			SerializeNetworkId(Reader, OutRecord.NetworkId);
+			Reader.SerializeIntPacked(OutRecord.RemovalRevision);
+			break;
+		}
+		default:
+		{
+			Reader.SetError();
+			break;
+		}
+	}
+	
+	if UNLIKELY_IF(Reader.IsError())
+	{
+		UE_LOGFMT(LogFlecsCore, Error, "Malformed Flecs replication record at offset {Offset}", Reader.Tell());
+		return false;
+	}
+	
+	return true;
+}
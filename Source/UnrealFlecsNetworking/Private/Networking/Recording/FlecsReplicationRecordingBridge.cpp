@@ -0,0 +1,168 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Recording/FlecsReplicationRecordingBridge.h"
+
+#include "HAL/PlatformTime.h"
+
+#include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsReplicationRecordingBridge)
+
+UFlecsReplicationRecordingBridge::UFlecsReplicationRecordingBridge(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UFlecsReplicationRecordingBridge::SetRecordedBridge(UFlecsReplicationBridgeBase* InRecordedBridge)
+{
+	solid_checkf(InRecordedBridge != this, TEXT("A recording bridge can't record itself"));
+	RecordedBridge = InRecordedBridge;
+}
+
+void UFlecsReplicationRecordingBridge::StartRecording()
+{
+	Recording.Reset();
+	RecordingStartSeconds = FPlatformTime::Seconds();
+	bIsRecording = true;
+	
+	// Layouts are only published once, snapshots recorded from here on may use layouts published before
+	for (const TPair<FFlecsReplicationLayoutId, FFlecsReplicationLayoutDefinition>& Definition
+		: GetNetworkWorldSubsystem()->GetLayoutRegistry().GetDefinitions())
+	{
+		Recording.RecordLayout(0.0, Definition.Value);
+	}
+}
+
+void UFlecsReplicationRecordingBridge::StopRecording()
+{
+	bIsRecording = false;
+}
+
+void UFlecsReplicationRecordingBridge::InitializeBridge()
+{
+	if (RecordedBridge)
+	{
+		RecordedBridge->SetNetworkWorldSubsystem(GetNetworkWorldSubsystem());
+		RecordedBridge->InitializeBridge();
+	}
+}
+
+void UFlecsReplicationRecordingBridge::DeinitializeBridge()
+{
+	if (RecordedBridge)
+	{
+		RecordedBridge->DeinitializeBridge();
+	}
+	
+	StopRecording();
+}
+
+void UFlecsReplicationRecordingBridge::PublishEntityLayout(const FFlecsReplicationLayoutDefinition& InLayoutDefinition)
+{
+	if (bIsRecording)
+	{
+		Recording.RecordLayout(GetRecordingTime(), InLayoutDefinition);
+	}
+	
+	if (RecordedBridge)
+	{
+		RecordedBridge->PublishEntityLayout(InLayoutDefinition);
+	}
+}
+
+void UFlecsReplicationRecordingBridge::ReceiveEntityLayout(const FFlecsReplicationLayoutDefinition& InLayoutDefinition)
+{
+	if (bIsRecording)
+	{
+		Recording.RecordLayout(GetRecordingTime(), InLayoutDefinition);
+	}
+	
+	if (RecordedBridge)
+	{
+		RecordedBridge->ReceiveEntityLayout(InLayoutDefinition);
+		return;
+	}
+	
+	Super::ReceiveEntityLayout(InLayoutDefinition);
+}
+
+void UFlecsReplicationRecordingBridge::PublishNetEntity(const FFlecsEntityHandle& EntityHandle,
+	const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot)
+{
+	if (bIsRecording)
+	{
+		Recording.RecordSnapshot(GetRecordingTime(), InNetworkId, InSnapshot);
+	}
+	
+	if (RecordedBridge)
+	{
+		RecordedBridge->PublishNetEntity(EntityHandle, InNetworkId, InSnapshot);
+	}
+}
+
+void UFlecsReplicationRecordingBridge::ReceiveNetEntity(const FFlecsNetworkId& InNetworkId,
+	const FFlecsEntityReplicationSnapshot& InSnapshot)
+{
+	if (bIsRecording)
+	{
+		Recording.RecordSnapshot(GetRecordingTime(), InNetworkId, InSnapshot);
+	}
+	
+	if (RecordedBridge)
+	{
+		RecordedBridge->ReceiveNetEntity(InNetworkId, InSnapshot);
+		return;
+	}
+	
+	Super::ReceiveNetEntity(InNetworkId, InSnapshot);
+}
+
+void UFlecsReplicationRecordingBridge::StopReplicatingEntity(const FFlecsEntityHandle& InEntityHandle)
+{
+	// Called before the network ID is released, so its last published revision is still known
+	if (bIsRecording)
+	{
+		if (const FFlecsNetworkId* NetworkId = InEntityHandle.TryGet<FFlecsNetworkId>())
+		{
+			const FFlecsEntityReplicationSnapshot* LastSnapshot
+				= GetNetworkWorldSubsystem()->FindReplicationSnapshot(*NetworkId);
+			
+			Recording.RecordRemoval(GetRecordingTime(), *NetworkId, LastSnapshot ? LastSnapshot->StateRevision : 0);
+		}
+	}
+	
+	if (RecordedBridge)
+	{
+		RecordedBridge->StopReplicatingEntity(InEntityHandle);
+	}
+}
+
+void UFlecsReplicationRecordingBridge::HandleProtocolError(const FString& InErrorMessage)
+{
+	if (RecordedBridge)
+	{
+		RecordedBridge->HandleProtocolError(InErrorMessage);
+		return;
+	}
+	
+	Super::HandleProtocolError(InErrorMessage);
+}
+
+UFlecsNetShardBase* UFlecsReplicationRecordingBridge::ResolveShard(const FFlecsEntityHandle& InEntity,
+	const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot)
+{
+	return RecordedBridge ? RecordedBridge->ResolveShard(InEntity, InNetworkId, InSnapshot) : nullptr;
+}
+
+void UFlecsReplicationRecordingBridge::GatherShardStats(FFlecsReplicationShardStats& InOutStats) const
+{
+	if (RecordedBridge)
+	{
+		RecordedBridge->GatherShardStats(InOutStats);
+	}
+}
+
+double UFlecsReplicationRecordingBridge::GetRecordingTime() const
+{
+	return FPlatformTime::Seconds() - RecordingStartSeconds;
+}
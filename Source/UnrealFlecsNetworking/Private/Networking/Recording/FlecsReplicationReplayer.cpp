@@ -0,0 +1,104 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Recording/FlecsReplicationReplayer.h"
+
+#include "Logging/StructuredLog.h"
+
+#include "Logs/FlecsCategories.h"
+#include "Worlds/FlecsWorld.h"
+
+#include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
+
+FFlecsReplicationReplayer::FFlecsReplicationReplayer(const FFlecsReplicationRecording& InRecording,
+	const TSolidNotNull<UFlecsNetworkWorldSubsystem*> InNetworkSubsystem)
+	: Reader(InRecording)
+	, NetworkSubsystem(InNetworkSubsystem)
+{
+}
+
+int32 FFlecsReplicationReplayer::Advance(const double InDeltaSeconds)
+{
+	PlaybackTime += InDeltaSeconds * PlaybackRate;
+	return FeedRecordsUntil(PlaybackTime);
+}
+
+int32 FFlecsReplicationReplayer::ReplayToEnd()
+{
+	return FeedRecordsUntil(TNumericLimits<double>::Max());
+}
+
+int32 FFlecsReplicationReplayer::FeedRecordsUntil(const double InTime)
+{
+	UFlecsNetworkWorldSubsystem* Subsystem = NetworkSubsystem.Get();
+	if UNLIKELY_IF(!Subsystem)
+	{
+		bIsFinished = true;
+		return 0;
+	}
+	
+	int32 FedRecordCount = 0;
+	
+	while (!bIsFinished)
+	{
+		if (!bHasPendingRecord)
+		{
+			bHasPendingRecord = Reader.ReadNext(PendingRecord);
+			
+			if (!bHasPendingRecord)
+			{
+				UE_CLOG(Reader.HasError(), LogFlecsCore, Error,
+					TEXT("Replication replay stopped at a malformed record"));
+				
+				bIsFinished = true;
+				break;
+			}
+		}
+		
+		if (PendingRecord.Time > InTime)
+		{
+			break;
+		}
+		
+		FeedRecord(PendingRecord);
+		bHasPendingRecord = false;
+		++FedRecordCount;
+	}
+	
+	ReplayedRecordCount += FedRecordCount;
+	
+	if (FedRecordCount > 0)
+	{
+		Subsystem->ApplyQueuedReplicationUpdates(Subsystem->GetFlecsWorldChecked());
+	}
+	
+	return FedRecordCount;
+}
+
+void FFlecsReplicationReplayer::FeedRecord(const FFlecsReplicationRecord& InRecord) const
+{
+	const TSolidNotNull<UFlecsNetworkWorldSubsystem*> Subsystem = NetworkSubsystem.Get();
+	
+	switch (InRecord.Type)
+	{
+		case EFlecsReplicationRecordType::Layout:
+		{
+			const TValueOrError<bool, FString> Result = Subsystem->GetLayoutRegistry()
+				.AddRemoteDefinition(InRecord.Layout, Subsystem->GetFlecsWorldChecked());
+			
+			if UNLIKELY_IF(Result.HasError())
+			{
+				UE_LOGFMT(LogFlecsCore, Error, "Failed to replay replication layout: {Error}", Result.GetError());
+				break;
+			}
+			
+			Subsystem->OnEntityLayoutReceived(InRecord.Layout);
+			break;
+		}
+		case EFlecsReplicationRecordType::Snapshot:
+			Subsystem->ReceiveNetworkEntitySnapshot(InRecord.NetworkId, InRecord.Snapshot);
+			break;
+		case EFlecsReplicationRecordType::Removal:
+			Subsystem->QueueReplicationRemoval(InRecord.NetworkId, InRecord.RemovalRevision);
+			break;
+	}
+}
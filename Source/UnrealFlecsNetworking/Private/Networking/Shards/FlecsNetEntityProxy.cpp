@@ -5,6 +5,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Net/Core/PushModel/PushModel.h"
 
+#include "Networking/Profiles/FlecsReplicationPriorityComponent.h"
 #include "Networking/Profiles/FlecsReplicationProfileParamTypes.h"
 #include "Networking/Profiles/FlecsReplicationUpdateRateComponent.h"
 #include "Networking/Shards/FlecsNetEntityProxyNetFactory.h"
@@ -42,6 +43,12 @@ void UFlecsNetEntityProxy::FillRootObjectReplicationParams(const UE::Net::FRootO
 		OutParams.PollFrequency = UpdateRateComponent->UpdateRate;
 	}
 	
+	if (const FFlecsReplicationPriorityComponent* PriorityComponent 
+		= GetReplicationProfile().TryGet<FFlecsReplicationPriorityComponent>())
+	{
+		OutParams.StaticPriority = PriorityComponent->Priority;
+	}
+	
 	/*if (const FFlecsReplicationCullDistanceComponent* CullDistanceComponent 
 		= GetReplicationProfile().TryGet<FFlecsReplicationCullDistanceComponent>())
 	{
@@ -83,6 +90,16 @@ bool UFlecsNetEntityProxy::IsEmpty() const
 	return !bContainsEntity;
 }
 
+bool UFlecsNetEntityProxy::IsFull() const
+{
+	return bContainsEntity;
+}
+
+bool UFlecsNetEntityProxy::CanBeRecycled() const
+{
+	return true;
+}
+
 void UFlecsNetEntityProxy::OnRep_NetworkId()
 {
 	bContainsEntity = NetworkId.IsValid();
@@ -4,6 +4,7 @@
 
 #include "Net/UnrealNetwork.h"
 
+#include "Networking/FlecsNetworkingModuleSettings.h"
 #include "Networking/Shards/FlecsNetEntityTableNetFactory.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsNetEntityTable)
@@ -36,28 +37,25 @@ void UFlecsNetEntityTable::ConfigureObjectSettings(OUT UE::Net::FRootObjectSetti
 bool UFlecsNetEntityTable::CanAcceptNetEntity(const FFlecsNetworkId& InNetworkId,
 	const FFlecsEntityReplicationSnapshot&) const
 {
-	return InNetworkId.IsValid();
+	return InNetworkId.IsValid() && (!IsFull() || ItemIndices.Contains(InNetworkId));
 }
 
 void UFlecsNetEntityTable::PublishNetEntity(const FFlecsNetworkId& InNetworkId,
 	const FFlecsEntityReplicationSnapshot& InSnapshot)
 {
 	solid_checkf(CanAcceptNetEntity(InNetworkId, InSnapshot),
-		TEXT("Cannot publish invalid network ID to Flecs entity table '%s'"), *GetName());
+		TEXT("Cannot publish network ID '%s' to Flecs entity table '%s'"), *InNetworkId.ToString(), *GetName());
 	
-	FFlecsNetEntityTableItem* ExistingItem = EntityTable.Items.FindByPredicate(
-		[&InNetworkId](const FFlecsNetEntityTableItem& Item)
-		{
-			return Item.NetworkId == InNetworkId;
-		});
-
-	if (ExistingItem)
+	if (const int32* ExistingIndex = ItemIndices.Find(InNetworkId))
 	{
-		ExistingItem->Snapshot = InSnapshot;
-		EntityTable.MarkItemDirty(*ExistingItem);
+		FFlecsNetEntityTableItem& ExistingItem = EntityTable.Items[*ExistingIndex];
+		ExistingItem.Snapshot = InSnapshot;
+		EntityTable.MarkItemDirty(ExistingItem);
 		return;
 	}
 
+	ItemIndices.Add(InNetworkId, EntityTable.Items.Num());
+	
 	FFlecsNetEntityTableItem& NewItem = EntityTable.Items.Emplace_GetRef();
 	NewItem.NetworkId = InNetworkId;
 	NewItem.Snapshot = InSnapshot;
@@ -66,17 +64,21 @@ void UFlecsNetEntityTable::PublishNetEntity(const FFlecsNetworkId& InNetworkId,
 
 void UFlecsNetEntityTable::RemoveNetEntity(const FFlecsNetworkId& InNetworkId)
 {
-	const int32 RemovedIndex = EntityTable.Items.IndexOfByPredicate(
-		[&InNetworkId](const FFlecsNetEntityTableItem& Item)
-		{
-			return Item.NetworkId == InNetworkId;
-		});
+	int32 RemovedIndex = INDEX_NONE;
+	const bool bRemoved = ItemIndices.RemoveAndCopyValue(InNetworkId, RemovedIndex);
 	
-	solid_cassumef(RemovedIndex != INDEX_NONE,
+	solid_cassumef(bRemoved,
 		TEXT("Cannot remove network ID '%s' from Flecs entity table '%s'"),
 		*InNetworkId.ToString(), *GetName());
 
-	EntityTable.Items.RemoveAt(RemovedIndex);
+	// Items are matched by their replication ID, so the last item can take the removed one's place
+	EntityTable.Items.RemoveAtSwap(RemovedIndex, EAllowShrinking::No);
+	
+	if (EntityTable.Items.IsValidIndex(RemovedIndex))
+	{
+		ItemIndices.FindChecked(EntityTable.Items[RemovedIndex].NetworkId) = RemovedIndex;
+	}
+	
 	EntityTable.MarkArrayDirty();
 }
 
@@ -85,6 +87,21 @@ bool UFlecsNetEntityTable::IsEmpty() const
 	return EntityTable.Items.IsEmpty();
 }
 
+bool UFlecsNetEntityTable::IsFull() const
+{
+	return EntityTable.Items.Num() >= GetNetEntityCapacity();
+}
+
+int32 UFlecsNetEntityTable::GetNetEntityCount() const
+{
+	return EntityTable.Items.Num();
+}
+
+int32 UFlecsNetEntityTable::GetNetEntityCapacity() const
+{
+	return GetDefault<UFlecsNetworkingModuleSettings>()->MaxEntitiesPerTableShard;
+}
+
 void UFlecsNetEntityTable::HandleReplicationDetached()
 {
 	for (const FFlecsNetEntityTableItem& Item : EntityTable.Items)
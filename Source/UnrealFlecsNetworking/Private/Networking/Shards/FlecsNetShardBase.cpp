@@ -58,6 +58,13 @@ void UFlecsNetShardBase::StartShardReplication()
 	{
 		return;
 	}
+	
+	// Standalone and headless worlds keep their shards, they just aren't registered with Iris
+	const UNetDriver* NetDriver = World->GetNetDriver();
+	if (!NetDriver || !NetDriver->GetReplicationSystem())
+	{
+		return;
+	}
 
 	RootObjectAdapter.StartReplication(World->PersistentLevel);
 	ApplyReplicationProfile();
@@ -249,7 +256,7 @@ void UFlecsNetShardBase::FlushPendingReplicationUpdates()
 
 void UFlecsNetShardBase::ReceiveEntityUpdate(const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot)
 {
-	if (!InNetworkId.IsValid() || !InSnapshot.LayoutId.IsValid())
+	if (!InNetworkId.IsValid() || !InSnapshot.HasLayout())
 	{
 		return;
 	}
@@ -0,0 +1,323 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Stats/FlecsReplicationStatsCollector.h"
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+#include "Logs/FlecsCategories.h"
+#include "Worlds/FlecsWorld.h"
+
+#include "Networking/FlecsComponentReplicationDescriptor.h"
+#include "Networking/Layout/FlecsReplicationLayoutDefinition.h"
+#include "Networking/Layout/FlecsReplicationSnapshot.h"
+
+CSV_DEFINE_CATEGORY(FlecsReplication, false);
+
+TRACE_DECLARE_INT_COUNTER(FlecsReplication_PublishedEntities, TEXT("Flecs/Replication/PublishedEntities"));
+TRACE_DECLARE_INT_COUNTER(FlecsReplication_SerializedBytes, TEXT("Flecs/Replication/SerializedBytes"));
+TRACE_DECLARE_FLOAT_COUNTER(FlecsReplication_SnapshotBuildMs, TEXT("Flecs/Replication/SnapshotBuildMs"));
+TRACE_DECLARE_INT_COUNTER(FlecsReplication_ActiveShards, TEXT("Flecs/Replication/ActiveShards"));
+TRACE_DECLARE_FLOAT_COUNTER(FlecsReplication_ShardOccupancy, TEXT("Flecs/Replication/ShardOccupancy"));
+TRACE_DECLARE_INT_COUNTER(FlecsReplication_QueuedUpdates, TEXT("Flecs/Replication/QueuedUpdates"));
+TRACE_DECLARE_INT_COUNTER(FlecsReplication_AppliedUpdates, TEXT("Flecs/Replication/AppliedUpdates"));
+TRACE_DECLARE_FLOAT_COUNTER(FlecsReplication_ApplyMs, TEXT("Flecs/Replication/ApplyMs"));
+
+namespace
+{
+	const TCHAR* const StatsEntityName = TEXT("FlecsReplicationStats");
+
+	/** Stable names and layout IDs may contain path separators, they're replaced so each one is a single child name */
+	FString MakeStatsEntityName(const FString& InName)
+	{
+		FString Result = InName;
+		
+		for (TCHAR& Character : Result)
+		{
+			if (!FChar::IsAlnum(Character))
+			{
+				Character = TEXT('_');
+			}
+		}
+		
+		return Result;
+	}
+
+	void RecordCsvStat(const FName InStatName, const int64 InValue)
+	{
+#if CSV_PROFILER
+		
+		FCsvProfiler::RecordCustomStat(InStatName, CSV_CATEGORY_INDEX(FlecsReplication),
+			static_cast<int32>(FMath::Min<int64>(InValue, MAX_int32)), ECsvCustomStatOp::Set);
+		
+#endif // CSV_PROFILER
+	}
+
+#ifdef FLECS_METRICS
+	
+	/** Creates a gauge for each numeric member of the stats component, flecs instances it for every entity with the component */
+	void CreateMemberMetrics(const TSolidNotNull<UFlecsWorld*> InWorld, const TSolidNotNull<const UScriptStruct*> InStatsStruct)
+	{
+		const FFlecsEntityHandle StructEntity = InWorld->RegisterComponentType(InStatsStruct);
+		ecs_world_t* NativeWorld = InWorld->GetNativeFlecsWorld().c_ptr();
+		
+		for (TFieldIterator<FNumericProperty> PropertyIt(InStatsStruct); PropertyIt; ++PropertyIt)
+		{
+			const FString MetricPath = FString::Printf(TEXT("%s::Metrics::%s::%s"),
+				StatsEntityName, *InStatsStruct->GetName(), *PropertyIt->GetName());
+			
+			// Metrics outlive the collector, enabling stats again reuses them
+			if (InWorld->LookupEntity(MetricPath).IsValid())
+			{
+				continue;
+			}
+			
+			ecs_metric_desc_t Desc = {};
+			Desc.member = ecs_lookup_child(NativeWorld, StructEntity.GetFlecsId(), TCHAR_TO_ANSI(*PropertyIt->GetName()));
+			Desc.kind = EcsGauge;
+			
+			if UNLIKELY_IF(!Desc.member)
+			{
+				UE_LOG(LogFlecsWorld, Warning, TEXT("Replication stats member '%s' of '%s' isn't reflected, it has no metric"),
+					*PropertyIt->GetName(), *InStatsStruct->GetName());
+				continue;
+			}
+			
+			Desc.entity = InWorld->CreateEntity(MetricPath).GetFlecsId();
+			ecs_metric_init(NativeWorld, &Desc);
+		}
+	}
+	
+#endif // FLECS_METRICS
+
+} // namespace
+
+FFlecsReplicationStatsCollector::FFlecsReplicationStatsCollector(const TSolidNotNull<UFlecsWorld*> InWorld)
+{
+	solid_checkf(!InWorld->IsDeferred(), TEXT("Replication stats can't be enabled while the world is deferred"));
+	
+	InWorld->RegisterComponentType(FFlecsReplicationComponentStats::StaticStruct());
+	InWorld->RegisterComponentType(FFlecsReplicationLayoutStats::StaticStruct());
+	
+	StatsEntity = InWorld->CreateEntity(StatsEntityName)
+		.Set<FFlecsReplicationStats>(Stats);
+	
+#ifdef FLECS_METRICS
+	
+	InWorld->ImportFlecsModule<flecs::metrics>();
+	
+	CreateMemberMetrics(InWorld, FFlecsReplicationStats::StaticStruct());
+	CreateMemberMetrics(InWorld, FFlecsReplicationComponentStats::StaticStruct());
+	CreateMemberMetrics(InWorld, FFlecsReplicationLayoutStats::StaticStruct());
+	
+#endif // FLECS_METRICS
+}
+
+void FFlecsReplicationStatsCollector::RecordPublishedSnapshot(const FFlecsReplicationLayoutDefinition& InLayoutDefinition,
+	const FFlecsEntityReplicationSnapshot& InSnapshot, const uint64 InBuildCycles)
+{
+	FLayoutCounter& LayoutCounter = FindOrAddLayoutCounter(InLayoutDefinition);
+	
+	++LayoutCounter.Stats.DirtiedEntityCount;
+	++LayoutCounter.Stats.TotalDirtiedEntityCount;
+	
+	// Clean values are carried over from the previous fill and were counted when they were serialized,
+	// only the values serialized by this fill have the revision of the snapshot
+	int64 SerializedBytes = 0;
+	
+	for (int32 KeyIndex = 0; KeyIndex < InSnapshot.PackedValues.Num(); ++KeyIndex)
+	{
+		const FFlecsReplicatedPackedValue& PackedValue = InSnapshot.PackedValues[KeyIndex];
+		if (PackedValue.Revision != InSnapshot.StateRevision)
+		{
+			continue;
+		}
+		
+		SerializedBytes += PackedValue.Size;
+		
+		const int32 ComponentIndex = LayoutCounter.ComponentIndices.IsValidIndex(KeyIndex)
+			? LayoutCounter.ComponentIndices[KeyIndex]
+			: INDEX_NONE;
+		
+		if (ComponentIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		
+		FFlecsReplicationComponentStats& ComponentStats = ComponentCounters[ComponentIndex].Stats;
+		++ComponentStats.SerializedValueCount;
+		ComponentStats.SerializedBytes += PackedValue.Size;
+		ComponentStats.TotalSerializedBytes += PackedValue.Size;
+	}
+	
+	LayoutCounter.Stats.SerializedBytes += SerializedBytes;
+	
+	++PendingPublishedEntityCount;
+	PendingSerializedBytes += SerializedBytes;
+	PendingBuildCycles += InBuildCycles;
+}
+
+void FFlecsReplicationStatsCollector::FlushPublishStats(const FFlecsReplicationShardStats& InShardStats)
+{
+	Stats.PublishedEntityCount = PendingPublishedEntityCount;
+	Stats.SerializedBytes = PendingSerializedBytes;
+	Stats.SnapshotBuildMilliseconds = FPlatformTime::ToMilliseconds64(PendingBuildCycles);
+	Stats.ActiveShardCount = InShardStats.ActiveShardCount;
+	Stats.RecycledShardCount = InShardStats.RecycledShardCount;
+	Stats.ShardEntityCount = InShardStats.EntityCount;
+	Stats.ShardCapacity = InShardStats.Capacity;
+	Stats.ShardOccupancy = InShardStats.Capacity > 0
+		? static_cast<float>(InShardStats.EntityCount) / static_cast<float>(InShardStats.Capacity)
+		: 0.f;
+	
+	PendingPublishedEntityCount = 0;
+	PendingSerializedBytes = 0;
+	PendingBuildCycles = 0;
+	
+	StatsEntity.Set<FFlecsReplicationStats>(Stats);
+	
+	// Counters that stayed at zero aren't written again, so idle components and layouts cost nothing per pass
+	for (FComponentCounter& Counter : ComponentCounters)
+	{
+		const bool bNonZero = Counter.Stats.SerializedValueCount != 0;
+		if (!bNonZero && !Counter.bWrittenNonZero)
+		{
+			continue;
+		}
+		
+		Counter.Entity.Set<FFlecsReplicationComponentStats>(Counter.Stats);
+		RecordCsvStat(Counter.CsvStatName, Counter.Stats.SerializedBytes);
+		
+		Counter.bWrittenNonZero = bNonZero;
+		Counter.Stats.SerializedValueCount = 0;
+		Counter.Stats.SerializedBytes = 0;
+	}
+	
+	for (TPair<FFlecsReplicationLayoutId, FLayoutCounter>& Pair : LayoutCounters)
+	{
+		FLayoutCounter& Counter = Pair.Value;
+		
+		const bool bNonZero = Counter.Stats.DirtiedEntityCount != 0;
+		if (!bNonZero && !Counter.bWrittenNonZero)
+		{
+			continue;
+		}
+		
+		Counter.Entity.Set<FFlecsReplicationLayoutStats>(Counter.Stats);
+		RecordCsvStat(Counter.CsvStatName, Counter.Stats.DirtiedEntityCount);
+		
+		Counter.bWrittenNonZero = bNonZero;
+		Counter.Stats.DirtiedEntityCount = 0;
+		Counter.Stats.SerializedBytes = 0;
+	}
+	
+	CSV_CUSTOM_STAT(FlecsReplication, PublishedEntities, Stats.PublishedEntityCount, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, SerializedBytes, static_cast<int32>(Stats.SerializedBytes), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, SnapshotBuildMs, Stats.SnapshotBuildMilliseconds, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, ActiveShards, Stats.ActiveShardCount, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, RecycledShards, Stats.RecycledShardCount, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, ShardOccupancy, Stats.ShardOccupancy, ECsvCustomStatOp::Set);
+	
+	TRACE_COUNTER_SET(FlecsReplication_PublishedEntities, Stats.PublishedEntityCount);
+	TRACE_COUNTER_SET(FlecsReplication_SerializedBytes, Stats.SerializedBytes);
+	TRACE_COUNTER_SET(FlecsReplication_SnapshotBuildMs, Stats.SnapshotBuildMilliseconds);
+	TRACE_COUNTER_SET(FlecsReplication_ActiveShards, Stats.ActiveShardCount);
+	TRACE_COUNTER_SET(FlecsReplication_ShardOccupancy, Stats.ShardOccupancy);
+}
+
+void FFlecsReplicationStatsCollector::FlushApplyStats(const int32 InQueuedUpdateCount, const int32 InAppliedUpdateCount,
+	const double InApplySeconds)
+{
+	Stats.QueuedUpdateCount = InQueuedUpdateCount;
+	Stats.AppliedUpdateCount = InAppliedUpdateCount;
+	Stats.ApplyMilliseconds = InApplySeconds * 1000.0;
+	
+	StatsEntity.Set<FFlecsReplicationStats>(Stats);
+	
+	CSV_CUSTOM_STAT(FlecsReplication, QueuedUpdates, Stats.QueuedUpdateCount, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, AppliedUpdates, Stats.AppliedUpdateCount, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(FlecsReplication, ApplyMs, Stats.ApplyMilliseconds, ECsvCustomStatOp::Set);
+	
+	TRACE_COUNTER_SET(FlecsReplication_QueuedUpdates, Stats.QueuedUpdateCount);
+	TRACE_COUNTER_SET(FlecsReplication_AppliedUpdates, Stats.AppliedUpdateCount);
+	TRACE_COUNTER_SET(FlecsReplication_ApplyMs, Stats.ApplyMilliseconds);
+}
+
+FFlecsEntityHandle FFlecsReplicationStatsCollector::FindComponentStatsEntity(const FString& InStableName) const
+{
+	const int32* ComponentIndex = ComponentCounterIndices.Find(InStableName);
+	return ComponentIndex ? ComponentCounters[*ComponentIndex].Entity : FFlecsEntityHandle();
+}
+
+FFlecsEntityHandle FFlecsReplicationStatsCollector::FindLayoutStatsEntity(const FFlecsReplicationLayoutId& InLayoutId) const
+{
+	const FLayoutCounter* LayoutCounter = LayoutCounters.Find(InLayoutId);
+	return LayoutCounter ? LayoutCounter->Entity : FFlecsEntityHandle();
+}
+
+FFlecsReplicationStatsCollector::FLayoutCounter& FFlecsReplicationStatsCollector::FindOrAddLayoutCounter(
+	const FFlecsReplicationLayoutDefinition& InLayoutDefinition)
+{
+	if (FLayoutCounter* ExistingCounter = LayoutCounters.Find(InLayoutDefinition.LayoutId))
+	{
+		return *ExistingCounter;
+	}
+	
+	const TSolidNotNull<UFlecsWorldInterfaceObject*> World = StatsEntity.GetFlecsWorld();
+	const FFlecsComponentReplicationRegistry& ComponentRegistry = FFlecsComponentReplicationRegistry::Get(World->GetFlecsWorld());
+	
+	const FString LayoutName = MakeStatsEntityName(InLayoutDefinition.LayoutId.ToString());
+	
+	FLayoutCounter& Counter = LayoutCounters.Add(InLayoutDefinition.LayoutId);
+	Counter.Entity = World->CreateEntity(FString::Printf(TEXT("%s::Layouts::%s"), StatsEntityName, *LayoutName));
+	Counter.CsvStatName = FName(FString::Printf(TEXT("Layout_%s_DirtiedEntities"), *LayoutName));
+	
+	// Keys are resolved like the snapshot resolves them, once per layout
+	Counter.ComponentIndices.Init(INDEX_NONE, InLayoutDefinition.Keys.Num());
+	
+	for (int32 KeyIndex = 0; KeyIndex < InLayoutDefinition.Keys.Num(); ++KeyIndex)
+	{
+		const FFlecsReplicationKey& Key = InLayoutDefinition.Keys[KeyIndex];
+		if (!FFlecsReplicationKey::IsValidPairStorageKind(Key.StorageKind))
+		{
+			continue;
+		}
+		
+		const FFlecsId ComponentId = FFlecsReplicationKey::ResolveToId(World, Key);
+		if UNLIKELY_IF(!ComponentId.IsValid())
+		{
+			continue;
+		}
+		
+		const ecs_type_info_t* ValueTypeInfo = ComponentId.GetTypeInfo(World);
+		const FFlecsComponentReplicationDescriptor* Descriptor = ValueTypeInfo
+			? ComponentRegistry.Find(FFlecsId(ValueTypeInfo->component))
+			: nullptr;
+		
+		if (Descriptor)
+		{
+			Counter.ComponentIndices[KeyIndex] = FindOrAddComponentCounter(Descriptor->GetStableName());
+		}
+	}
+	
+	return Counter;
+}
+
+int32 FFlecsReplicationStatsCollector::FindOrAddComponentCounter(const FString& InStableName)
+{
+	if (const int32* ExistingIndex = ComponentCounterIndices.Find(InStableName))
+	{
+		return *ExistingIndex;
+	}
+	
+	const FString ComponentName = MakeStatsEntityName(InStableName);
+	
+	const int32 Index = ComponentCounters.AddDefaulted();
+	FComponentCounter& Counter = ComponentCounters[Index];
+	Counter.Entity = StatsEntity.GetFlecsWorld()->CreateEntity(
+		FString::Printf(TEXT("%s::Components::%s"), StatsEntityName, *ComponentName));
+	Counter.CsvStatName = FName(FString::Printf(TEXT("Component_%s_SerializedBytes"), *ComponentName));
+	
+	ComponentCounterIndices.Add(InStableName, Index);
+	return Index;
+}
@@ -0,0 +1,11 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Networking/Stats/FlecsReplicationStatsComponents.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsReplicationStatsComponents)
+
+REGISTER_FLECS_COMPONENT(FFlecsReplicationStats);
+REGISTER_FLECS_COMPONENT(FFlecsReplicationComponentStats);
+REGISTER_FLECS_COMPONENT(FFlecsReplicationLayoutStats);
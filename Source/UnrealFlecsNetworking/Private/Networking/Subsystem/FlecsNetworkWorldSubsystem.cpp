@@ -2,7 +2,14 @@
 
 #include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
 
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
 #include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include "Algo/AnyOf.h"
+#include "Algo/Count.h"
+#include "Algo/Sort.h"
 
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
@@ -14,6 +21,11 @@
 #include "Networking/Bridge/FlecsReplicationBridgeBase.h"
 #include "Networking/FlecsDirtyObserverTag.h"
 #include "Networking/FlecsNetDirtyTag.h"
+#include "Networking/FlecsPredictedEntityTag.h"
+#include "Networking/Prediction/FlecsPredictionWorldSubsystem.h"
+#include "Networking/Profiles/FlecsNetAlwaysRelevantTag.h"
+#include "Networking/Profiles/FlecsReplicationCullDistanceComponent.h"
+#include "Networking/Profiles/FlecsReplicationPriorityComponent.h"
 #include "Networking/Profiles/FlecsReplicationProfile.h"
 #include "Networking/Profiles/FlecsReplicationProfileDataAsset.h"
 #include "Networking/FlecsReplicationShardSelection.h"
@@ -22,9 +34,45 @@
 #include "Networking/Profiles/FlecsReplicationProfileParamTypes.h"
 #include "Networking/Shards/FlecsNetEntityTable.h"
 #include "Networking/Shards/FlecsNetEntityProxy.h"
+#include "Networking/Stats/FlecsReplicationStatsCollector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsNetworkWorldSubsystem)
 
+namespace
+{
+	/** Deserializes the packed value of a layout key, false if the snapshot has no (valid) value for it */
+	bool ReadPackedValue(const FFlecsEntityReplicationSnapshot& InSnapshot, const int32 InKeyIndex,
+		const FFlecsComponentReplicationDescriptor& InDescriptor, void* InOutValue)
+	{
+		if UNLIKELY_IF(!InSnapshot.PackedValues.IsValidIndex(InKeyIndex))
+		{
+			return false;
+		}
+		
+		const FFlecsReplicatedPackedValue& PackedValue = InSnapshot.PackedValues[InKeyIndex];
+		if (PackedValue.Revision == 0)
+		{
+			return false;
+		}
+		
+		const uint64 PayloadEnd = static_cast<uint64>(PackedValue.Offset) + static_cast<uint64>(PackedValue.Size);
+		if UNLIKELY_IF(PayloadEnd > static_cast<uint64>(InSnapshot.PayloadData.Num()))
+		{
+			UE_LOG(LogFlecsWorld, Error,
+				TEXT("Payload range [%u, %llu) of layout '%s' is outside the payload buffer of size %d"),
+				PackedValue.Offset, PayloadEnd, *InSnapshot.LayoutId.ToString(), InSnapshot.PayloadData.Num());
+			return false;
+		}
+		
+		FMemoryReader Reader(InSnapshot.PayloadData, true);
+		Reader.Seek(PackedValue.Offset);
+		Reader.SetLimitSize(static_cast<int64>(PayloadEnd));
+		
+		return InDescriptor.GetDeserializeFunction()(Reader, InOutValue) && !Reader.IsError();
+	}
+	
+} // namespace
+
 UFlecsNetworkWorldSubsystem::UFlecsNetworkWorldSubsystem()
 {
 }
@@ -66,15 +114,31 @@ void UFlecsNetworkWorldSubsystem::OnFlecsWorldInitialized(const TSolidNotNull<UF
 		.With<FFlecsReplicatedEntityComponent>().Filter()
 		.Event(flecs::OnAdd)
 		.Event(flecs::OnRemove)
-		.each([](flecs::iter& InIterator, size_t InIndex)
+		.each([this](flecs::iter& InIterator, size_t InIndex)
 		{
-			const FFlecsEntityHandle EntityHandle = InIterator.entity(InIndex);
-			EntityHandle.Add<FFlecsNetDirtyTag>();
+			if (!HasAuthority())
+			{
+				return;
+			}
+			
+			MarkReplicatedEntityDirty(InIterator.entity(InIndex), FFlecsReplicatedEntityComponent::EntityDirtyMask);
 		});
 
 	ProfileObserverHandle.Add<FFlecsDirtyObserverTag>();
 	ComponentDirtyObservers.Add(ProfileObserverHandle);
 	
+	// Received entities can be destroyed by gameplay code as well, not only by a replicated removal
+	AppliedLayoutObserver = GetFlecsWorldChecked()->CreateObserver("NetAppliedLayoutObserver")
+		.With<FFlecsNetworkId>()
+		.Event(flecs::OnRemove)
+		.each([this](flecs::iter& InIterator, size_t InIndex)
+		{
+			if (!AppliedEntityLayouts.IsEmpty())
+			{
+				AppliedEntityLayouts.Remove(InIterator.entity(InIndex));
+			}
+		});
+	
 #if WITH_SERVER_CODE
 	
 	if (HasAuthority())
@@ -90,6 +154,11 @@ void UFlecsNetworkWorldSubsystem::OnFlecsWorldInitialized(const TSolidNotNull<UF
 #endif // WITH_SERVER_CODE
 
 	CreateReplicationBridge();
+	
+	if (GetNetworkingSettings()->bEnableReplicationStats)
+	{
+		SetReplicationStatsEnabled(true);
+	}
 }
 
 void UFlecsNetworkWorldSubsystem::Deinitialize()
@@ -104,6 +173,12 @@ void UFlecsNetworkWorldSubsystem::Deinitialize()
 	ReplicationProfilePrefabs.Reset();
 	ReplicationShardSelectors.Reset();
 	ReplicationUpdateQueue.Reset();
+	AppliedEntityLayouts.Reset();
+	ComponentDirtyMasks.Reset();
+	DirtyReplicatedEntities.Reset();
+	NetworkEntities.Reset();
+	PredictionSubsystem = nullptr;
+	ReplicationStats.Reset();
 	
 	Super::Deinitialize();
 }
@@ -146,7 +221,10 @@ void UFlecsNetworkWorldSubsystem::RegisterIndividualComponentDirtyObserver(const
 		return;
 	}
 	
-	auto CreateObserver = [this](
+	// Both observers of the descriptor share its dirty bit
+	const uint64 DirtyMask = 1ull << FMath::Min<uint8>(NextComponentDirtyBit, FFlecsReplicatedEntityComponent::ComponentDirtyBitCount - 1);
+	
+	auto CreateObserver = [this, DirtyMask](
 		const FFlecsId InFirstId,
 		const FFlecsId InSecondId = FFlecsId()) -> FFlecsObserverHandle
 	{
@@ -179,12 +257,12 @@ void UFlecsNetworkWorldSubsystem::RegisterIndividualComponentDirtyObserver(const
 			.Event(flecs::OnSet)
 			.Event(flecs::OnAdd)
 			.Event(flecs::OnRemove)
-			.each([this](flecs::iter& Iter, size_t Index)
+			.each([this, DirtyMask](flecs::iter& Iter, size_t Index)
 			{
 				const FFlecsEntityHandle EntityHandle = Iter.entity(Index);
 				solid_check(EntityHandle.IsValid());
 				
-				EntityHandle.Add<FFlecsNetDirtyTag>();
+				MarkReplicatedEntityDirty(EntityHandle, DirtyMask);
 			});
 		
 		solid_check(DirtyObserverHandle.IsValid());
@@ -198,6 +276,12 @@ void UFlecsNetworkWorldSubsystem::RegisterIndividualComponentDirtyObserver(const
 	/*const FFlecsObserverHandle PairSecondObserverHandle =
 		CreateObserver(flecs::Wildcard, InDescriptor.LocalFlecsId);*/
 	
+	if (PrimaryObserverHandle.IsValid() || PairFirstObserverHandle.IsValid())
+	{
+		ComponentDirtyMasks.Add(InDescriptor.LocalFlecsId, DirtyMask);
+		NextComponentDirtyBit = FMath::Min<uint8>(NextComponentDirtyBit + 1, FFlecsReplicatedEntityComponent::ComponentDirtyBitCount);
+	}
+	
 	if (PrimaryObserverHandle.IsValid())
 	{
 		ComponentDirtyObservers.Add(PrimaryObserverHandle);
@@ -222,7 +306,77 @@ FFlecsNetworkId UFlecsNetworkWorldSubsystem::BeginReplicatingEntity(const FFlecs
 {
 	solid_checkf(InEntityHandle.IsValid(), TEXT("Cannot begin replicating an invalid entity handle"));
 	solid_checkf(HasAuthority(), TEXT("Cannot begin replicating entity %s without authority"), *InEntityHandle.ToString());
+	solid_checkf(IsInGameThread(), TEXT("Entities are registered in the network entity table on the game thread"));
+	
+	const FFlecsNetworkId ExistingNetworkId = FindExistingNetworkId(InEntityHandle);
+	if (ExistingNetworkId.IsValid())
+	{
+		return ExistingNetworkId;
+	}
+	
+	const FFlecsNetworkId NetworkId = GetNetworkIdGenerator()->GenerateNetworkId();
+	
+	if UNLIKELY_IF(!ensureMsgf(NetworkId.IsValid(), TEXT("Generated network ID is not valid")))
+	{
+		return FFlecsNetworkId();
+	}
+
+	RegisterReplicatedEntity(InEntityHandle, NetworkId);
+	return NetworkId;
+}
+
+int32 UFlecsNetworkWorldSubsystem::BeginReplicatingEntities(const TConstArrayView<FFlecsEntityHandle> InEntityHandles)
+{
+	solid_checkf(HasAuthority(), TEXT("Cannot begin replicating entities without authority"));
+	solid_checkf(IsInGameThread(), TEXT("Entities are registered in the network entity table on the game thread"));
+	
+	TArray<FFlecsEntityHandle> NewEntities;
+	NewEntities.Reserve(InEntityHandles.Num());
+	
+	// A handle listed twice would otherwise get a second network ID that's never released
+	TSet<FFlecsEntityHandle> SeenEntities;
+	SeenEntities.Reserve(InEntityHandles.Num());
+	
+	for (const FFlecsEntityHandle& EntityHandle : InEntityHandles)
+	{
+		solid_checkf(EntityHandle.IsValid(), TEXT("Cannot begin replicating an invalid entity handle"));
+		
+		bool bAlreadySeen = false;
+		SeenEntities.Add(EntityHandle, &bAlreadySeen);
+		
+		if (!bAlreadySeen && !FindExistingNetworkId(EntityHandle).IsValid())
+		{
+			NewEntities.Add(EntityHandle);
+		}
+	}
+	
+	TArray<FFlecsNetworkId> NetworkIds;
+	GetNetworkIdGenerator()->ReserveNetworkIdRange(NewEntities.Num(), NetworkIds);
 	
+	if UNLIKELY_IF(!ensureMsgf(NetworkIds.Num() == NewEntities.Num(),
+		TEXT("Reserved %d network IDs for %d entities"), NetworkIds.Num(), NewEntities.Num()))
+	{
+		NewEntities.SetNum(FMath::Min(NetworkIds.Num(), NewEntities.Num()));
+	}
+	
+	int32 RegisteredCount = 0;
+	
+	for (int32 Index = 0; Index < NewEntities.Num(); ++Index)
+	{
+		if UNLIKELY_IF(!ensureMsgf(NetworkIds[Index].IsValid(), TEXT("Reserved network ID is not valid")))
+		{
+			continue;
+		}
+		
+		RegisterReplicatedEntity(NewEntities[Index], NetworkIds[Index]);
+		++RegisteredCount;
+	}
+	
+	return RegisteredCount;
+}
+
+FFlecsNetworkId UFlecsNetworkWorldSubsystem::FindExistingNetworkId(const FFlecsEntityHandle& InEntityHandle) const
+{
 	const FFlecsNetworkId* ExistingNetworkId = InEntityHandle.TryGet<FFlecsNetworkId>();
 	
 	if (ExistingNetworkId && ExistingNetworkId->IsValid())
@@ -234,13 +388,12 @@ FFlecsNetworkId UFlecsNetworkWorldSubsystem::BeginReplicatingEntity(const FFlecs
 		return *ExistingNetworkId;
 	}
 	
-	const FFlecsNetworkId NetworkId = GetNetworkIdGenerator()->GenerateNetworkId();
-	
-	if UNLIKELY_IF(!ensureMsgf(NetworkId.IsValid(), TEXT("Generated network ID is not valid")))
-	{
-		return FFlecsNetworkId();
-	}
+	return FFlecsNetworkId();
+}
 
+void UFlecsNetworkWorldSubsystem::RegisterReplicatedEntity(const FFlecsEntityHandle& InEntityHandle,
+	const FFlecsNetworkId& InNetworkId)
+{
 	if (FFlecsReplicatedEntityComponent* ReplicatedEntity = InEntityHandle.TryGetMut<FFlecsReplicatedEntityComponent>())
 	{
 		if (ReplicatedEntity->ProfileId.IsNone())
@@ -257,12 +410,10 @@ FFlecsNetworkId UFlecsNetworkWorldSubsystem::BeginReplicatingEntity(const FFlecs
 		}
 	}
 	
-	InEntityHandle.Set<FFlecsNetworkId>(NetworkId);
-	InEntityHandle.Add<FFlecsNetDirtyTag>();
+	InEntityHandle.Set<FFlecsNetworkId>(InNetworkId);
+	MarkReplicatedEntityDirty(InEntityHandle, FFlecsReplicatedEntityComponent::EntityDirtyMask);
 	
-	NetworkIdToEntityMap.Add(NetworkId, InEntityHandle);
-
-	return NetworkId;
+	NetworkEntities.FindOrAdd(InNetworkId).Entity = InEntityHandle;
 }
 
 void UFlecsNetworkWorldSubsystem::StopReplicatingEntity(const FFlecsEntityHandle& InEntityHandle)
@@ -281,7 +432,7 @@ void UFlecsNetworkWorldSubsystem::StopReplicatingEntity(const FFlecsEntityHandle
 		return;
 	}
 
-	if (!NetworkIdToEntityMap.Contains(*NetworkId))
+	if (!NetworkEntities.Find(*NetworkId))
 	{
 		return;
 	}
@@ -291,8 +442,7 @@ void UFlecsNetworkWorldSubsystem::StopReplicatingEntity(const FFlecsEntityHandle
 		ReplicationBridge->StopReplicatingEntity(InEntityHandle);
 	}
 
-	NetworkIdToEntityMap.Remove(*NetworkId);
-	ReplicationSnapshots.Remove(*NetworkId);
+	NetworkEntities.Remove(*NetworkId);
 
 	if (NetworkIdGenerator)
 	{
@@ -302,6 +452,308 @@ void UFlecsNetworkWorldSubsystem::StopReplicatingEntity(const FFlecsEntityHandle
 	InEntityHandle.Remove<FFlecsNetworkId>();
 }
 
+void UFlecsNetworkWorldSubsystem::MarkReplicatedEntityDirty(const FFlecsEntityHandle& InEntityHandle, const uint64 InDirtyMask)
+{
+	FFlecsReplicatedEntityComponent* ReplicatedEntity = InEntityHandle.TryGetMut<FFlecsReplicatedEntityComponent>();
+	
+	// e.g. the component is still being added in a deferred batch, the dirty system picks up the tag
+	if UNLIKELY_IF(!ReplicatedEntity)
+	{
+		InEntityHandle.Add<FFlecsNetDirtyTag>();
+		return;
+	}
+	
+	if (ReplicatedEntity->DirtyComponentMask == 0)
+	{
+		DirtyReplicatedEntities.Add(InEntityHandle);
+	}
+	
+	ReplicatedEntity->DirtyComponentMask |= InDirtyMask;
+}
+
+void UFlecsNetworkWorldSubsystem::PublishReplicatedEntity(const FFlecsEntityHandle& InEntityHandle,
+	FFlecsReplicatedEntityComponent& InOutReplicatedComponent, const FFlecsNetworkId& InNetworkId)
+{
+	const uint64 DirtyComponentMask = InOutReplicatedComponent.DirtyComponentMask;
+	
+	InOutReplicatedComponent.DirtyComponentMask = 0;
+	InOutReplicatedComponent.DeferredPublishCount = 0;
+	
+	bool bCreatedNewLayout = false;
+		
+	TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult = 
+		LayoutRegistry.BuildForEntity(GetFlecsWorldChecked(), InEntityHandle, bCreatedNewLayout);
+		
+	// @TODO: Remove this in shipping?
+	if UNLIKELY_IF(LayoutResult.HasError())
+	{
+		GetReplicationBridge()->HandleProtocolError(FString::Printf(
+			TEXT("Failed to build replication layout for entity %s: %s"),
+			*InEntityHandle.ToString(), *LayoutResult.GetError()));
+		return;
+	}
+	
+	const TSolidNotNull<const FFlecsReplicationLayoutDefinition*> LayoutDefinition = LayoutResult.GetValue();
+	
+	InOutReplicatedComponent.LayoutId = LayoutDefinition->LayoutId;
+		
+	FFlecsNetworkEntityRecord& Record = NetworkEntities.FindOrAdd(InNetworkId);
+	Record.bHasSnapshot = true;
+	
+	FFlecsEntityReplicationSnapshot& Snapshot = Record.Snapshot;
+	Snapshot.LayoutId = LayoutDefinition->LayoutId;
+	
+	// Only the components written since the last publish are serialized again, unless the whole entity is dirty.
+	// Components sharing the last bit are serialized when any of them was written, ones without an observer always are.
+	const auto IsValueDirty = [this, DirtyComponentMask](const FFlecsId InComponentId)
+	{
+		if (DirtyComponentMask & FFlecsReplicatedEntityComponent::EntityDirtyMask)
+		{
+			return true;
+		}
+		
+		const uint64 ComponentDirtyMask = GetComponentDirtyMask(InComponentId.IsPair() ? InComponentId.GetFirst() : InComponentId);
+		return ComponentDirtyMask == 0 || (DirtyComponentMask & ComponentDirtyMask) != 0;
+	};
+	
+	if UNLIKELY_IF(ReplicationStats)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Snapshot.FillDirtyFromEntity(InEntityHandle, LayoutRegistry, IsValueDirty);
+		ReplicationStats->RecordPublishedSnapshot(*LayoutDefinition, Snapshot, FPlatformTime::Cycles64() - StartCycles);
+	}
+	else
+	{
+		Snapshot.FillDirtyFromEntity(InEntityHandle, LayoutRegistry, IsValueDirty);
+	}
+	
+	if (bCreatedNewLayout)
+	{
+		GetReplicationBridge()->PublishEntityLayout(*LayoutDefinition);
+	}
+		
+	GetReplicationBridge()->PublishNetEntity(InEntityHandle, InNetworkId, Snapshot);
+}
+
+void UFlecsNetworkWorldSubsystem::PublishDirtyReplicatedEntities()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsNetworkWorldSubsystem_PublishDirtyReplicatedEntities);
+	
+	// Entities marked while publishing wait for the next pass
+	Swap(PublishingReplicatedEntities, DirtyReplicatedEntities);
+	DirtyReplicatedEntities.Reset();
+	
+	LastDeferredReplicatedEntityCount = 0;
+	GatherReplicationViewers();
+	
+	if (Algo::AnyOf(ReplicationViewers, &FFlecsReplicationViewer::HasByteBudget))
+	{
+		PublishPrioritizedReplicatedEntities();
+		PublishingReplicatedEntities.Reset();
+		FlushReplicationPublishStats();
+		return;
+	}
+	
+	for (const FFlecsEntityHandle& EntityHandle : PublishingReplicatedEntities)
+	{
+		if UNLIKELY_IF(!EntityHandle.IsAlive())
+		{
+			continue;
+		}
+		
+		FFlecsReplicatedEntityComponent* ReplicatedEntity = EntityHandle.TryGetMut<FFlecsReplicatedEntityComponent>();
+		const FFlecsNetworkId* NetworkId = EntityHandle.TryGet<FFlecsNetworkId>();
+		
+		// A clean entity was already published through FFlecsNetDirtyTag or is listed twice after re-replicating
+		if (!ReplicatedEntity || ReplicatedEntity->DirtyComponentMask == 0 || !NetworkId || !NetworkId->IsValid())
+		{
+			continue;
+		}
+		
+		PublishReplicatedEntity(EntityHandle, *ReplicatedEntity, *NetworkId);
+	}
+	
+	PublishingReplicatedEntities.Reset();
+	FlushReplicationPublishStats();
+}
+
+void UFlecsNetworkWorldSubsystem::FlushReplicationPublishStats()
+{
+	if LIKELY_IF(!ReplicationStats)
+	{
+		return;
+	}
+	
+	FFlecsReplicationShardStats ShardStats;
+	if (ReplicationBridge)
+	{
+		ReplicationBridge->GatherShardStats(ShardStats);
+	}
+	
+	ReplicationStats->FlushPublishStats(ShardStats);
+}
+
+void UFlecsNetworkWorldSubsystem::PublishPrioritizedReplicatedEntities()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsNetworkWorldSubsystem_PublishPrioritizedReplicatedEntities);
+	
+	const float DistanceScale = GetNetworkingSettings()->ReplicationPriorityDistanceScale;
+	
+	ReplicationPriorityCandidates.Reset();
+	
+	for (const FFlecsEntityHandle& EntityHandle : PublishingReplicatedEntities)
+	{
+		if UNLIKELY_IF(!EntityHandle.IsAlive())
+		{
+			continue;
+		}
+		
+		const FFlecsReplicatedEntityComponent* ReplicatedEntity = EntityHandle.TryGet<FFlecsReplicatedEntityComponent>();
+		const FFlecsNetworkId* NetworkId = EntityHandle.TryGet<FFlecsNetworkId>();
+		
+		if (!ReplicatedEntity || ReplicatedEntity->DirtyComponentMask == 0 || !NetworkId || !NetworkId->IsValid())
+		{
+			continue;
+		}
+		
+		FFlecsReplicationPriorityCandidate& Candidate = ReplicationPriorityCandidates.Emplace_GetRef();
+		Candidate.EntityHandle = EntityHandle;
+		
+		const FFlecsReplicationPriorityComponent* Priority = EntityHandle.TryGet<FFlecsReplicationPriorityComponent>();
+		Candidate.Weight = (Priority ? Priority->Priority : 1.f) * (1 + ReplicatedEntity->DeferredPublishCount);
+		
+		if (ReplicationLocationProvider)
+		{
+			Candidate.bHasLocation = ReplicationLocationProvider(EntityHandle, Candidate.Location);
+		}
+		
+		const FFlecsReplicationCullDistanceComponent* CullDistance = EntityHandle.TryGet<FFlecsReplicationCullDistanceComponent>();
+		if (CullDistance && CullDistance->CullDistance > 0.f && !EntityHandle.Has<FFlecsNetAlwaysRelevantTag>())
+		{
+			Candidate.CullDistanceSquared = FMath::Square(static_cast<double>(CullDistance->CullDistance));
+		}
+		
+		// The entity's last snapshot is the best guess for the size of the next one
+		const FFlecsEntityReplicationSnapshot* LastSnapshot = FindReplicationSnapshot(*NetworkId);
+		Candidate.Cost = LastSnapshot ? LastSnapshot->GetEstimatedNetSize() : FFlecsEntityReplicationSnapshot().GetEstimatedNetSize();
+		
+		for (const FFlecsReplicationViewer& Viewer : ReplicationViewers)
+		{
+			if (Candidate.IsRelevantTo(Viewer))
+			{
+				Candidate.Score = FMath::Max(Candidate.Score, Candidate.GetScoreFor(Viewer, DistanceScale));
+			}
+		}
+	}
+	
+	Algo::SortBy(ReplicationPriorityCandidates, &FFlecsReplicationPriorityCandidate::Score, TGreater<>());
+	
+	TArray<int32, TInlineAllocator<16>> BytesLeft;
+	BytesLeft.Reserve(ReplicationViewers.Num());
+	
+	for (const FFlecsReplicationViewer& Viewer : ReplicationViewers)
+	{
+		BytesLeft.Add(Viewer.ByteBudget);
+	}
+	
+	for (const FFlecsReplicationPriorityCandidate& Candidate : ReplicationPriorityCandidates)
+	{
+		bool bIsRelevant = false;
+		bool bFitsBudgets = true;
+		
+		for (int32 ViewerIndex = 0; ViewerIndex < ReplicationViewers.Num(); ++ViewerIndex)
+		{
+			const FFlecsReplicationViewer& Viewer = ReplicationViewers[ViewerIndex];
+			if (!Candidate.IsRelevantTo(Viewer))
+			{
+				continue;
+			}
+			
+			bIsRelevant = true;
+			
+			// Every relevant viewer reads the same shard, so one viewer without room holds the entity back for all of them.
+			// The first entity of a viewer always fits, so an entity larger than the budget isn't starved forever.
+			if (Viewer.HasByteBudget() && BytesLeft[ViewerIndex] < Candidate.Cost && BytesLeft[ViewerIndex] < Viewer.ByteBudget)
+			{
+				bFitsBudgets = false;
+				break;
+			}
+		}
+		
+		FFlecsReplicatedEntityComponent& ReplicatedEntity = Candidate.EntityHandle.GetMut<FFlecsReplicatedEntityComponent>();
+		
+		// Entities out of every viewer's cull distance stay dirty until one comes close enough,
+		// only the ones held back by a budget raise their score for the next publish
+		if (!bIsRelevant || !bFitsBudgets)
+		{
+			if (bIsRelevant && ReplicatedEntity.DeferredPublishCount < TNumericLimits<uint16>::Max())
+			{
+				++ReplicatedEntity.DeferredPublishCount;
+			}
+			
+			DirtyReplicatedEntities.Add(Candidate.EntityHandle);
+			++LastDeferredReplicatedEntityCount;
+			continue;
+		}
+		
+		for (int32 ViewerIndex = 0; ViewerIndex < ReplicationViewers.Num(); ++ViewerIndex)
+		{
+			if (Candidate.IsRelevantTo(ReplicationViewers[ViewerIndex]))
+			{
+				BytesLeft[ViewerIndex] -= Candidate.Cost;
+			}
+		}
+		
+		PublishReplicatedEntity(Candidate.EntityHandle, ReplicatedEntity, Candidate.EntityHandle.Get<FFlecsNetworkId>());
+	}
+	
+	ReplicationPriorityCandidates.Reset();
+}
+
+void UFlecsNetworkWorldSubsystem::SetReplicationLocationProvider(FFlecsReplicationLocationFunction InLocationProvider)
+{
+	ReplicationLocationProvider = MoveTemp(InLocationProvider);
+}
+
+void UFlecsNetworkWorldSubsystem::SetReplicationViewers(const TConstArrayView<FFlecsReplicationViewer> InViewers)
+{
+	ReplicationViewers.Reset();
+	ReplicationViewers.Append(InViewers.GetData(), InViewers.Num());
+}
+
+void UFlecsNetworkWorldSubsystem::GatherReplicationViewers()
+{
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if (!NetDriver)
+	{
+		return;
+	}
+	
+	ReplicationViewers.Reset();
+	
+	const int32 ByteBudget = GetNetworkingSettings()->ReplicationByteBudgetPerConnection;
+	if (ByteBudget <= 0)
+	{
+		return;
+	}
+	
+	for (const UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (!Connection || Connection->GetConnectionState() == USOCK_Closed)
+		{
+			continue;
+		}
+		
+		FFlecsReplicationViewer& Viewer = ReplicationViewers.Emplace_GetRef();
+		Viewer.ByteBudget = ByteBudget;
+		
+		if (const AActor* ViewTarget = Connection->ViewTarget)
+		{
+			Viewer.ViewLocation = ViewTarget->GetActorLocation();
+		}
+	}
+}
+
 void UFlecsNetworkWorldSubsystem::CreateNetworkIdGenerator()
 {
 	if (!HasAuthority())
@@ -368,12 +820,34 @@ void UFlecsNetworkWorldSubsystem::UnbindReplicationBridge(const UFlecsReplicatio
 	ReplicationBridge = nullptr;
 }
 
-TSolidNotNull<IFlecsNetworkIDGeneratorInterface*> UFlecsNetworkWorldSubsystem::GetNetworkIdGenerator() const
+void UFlecsNetworkWorldSubsystem::SetPredictionSubsystem(UFlecsPredictionWorldSubsystem* InPredictionSubsystem)
 {
-	return CastChecked<IFlecsNetworkIDGeneratorInterface>(NetworkIdGenerator);
+	PredictionSubsystem = InPredictionSubsystem;
 }
 
-TSolidNotNull<UFlecsReplicationBridgeBase*> UFlecsNetworkWorldSubsystem::GetReplicationBridge() const
+void UFlecsNetworkWorldSubsystem::SetReplicationStatsEnabled(const bool bInEnabled)
+{
+	if (bInEnabled == ReplicationStats.IsValid())
+	{
+		return;
+	}
+	
+	if (bInEnabled)
+	{
+		ReplicationStats = MakeUnique<FFlecsReplicationStatsCollector>(GetFlecsWorldChecked());
+	}
+	else
+	{
+		ReplicationStats.Reset();
+	}
+}
+
+TSolidNotNull<IFlecsNetworkIDGeneratorInterface*> UFlecsNetworkWorldSubsystem::GetNetworkIdGenerator() const
+{
+	return CastChecked<IFlecsNetworkIDGeneratorInterface>(NetworkIdGenerator);
+}
+
+TSolidNotNull<UFlecsReplicationBridgeBase*> UFlecsNetworkWorldSubsystem::GetReplicationBridge() const
 {
 	solid_cassumef(ReplicationBridge, TEXT("Replication bridge is not valid"));
 	return ReplicationBridge;
@@ -427,7 +901,7 @@ void UFlecsNetworkWorldSubsystem::OnEntityLayoutReceived(const FFlecsReplication
 void UFlecsNetworkWorldSubsystem::ReceiveNetworkEntitySnapshot(const FFlecsNetworkId& InNetworkId,
                                                                const FFlecsEntityReplicationSnapshot& InSnapshot)
 {
-	if UNLIKELY_IF(!InNetworkId.IsValid() || !InSnapshot.LayoutId.IsValid())
+	if UNLIKELY_IF(!InNetworkId.IsValid() || !InSnapshot.HasLayout())
 	{
 		UE_LOG(LogFlecsWorld, Error, TEXT("Received an invalid Flecs entity snapshot"));
 		return;
@@ -457,20 +931,50 @@ void UFlecsNetworkWorldSubsystem::RemoveReceivedNetworkEntity(const FFlecsNetwor
 void UFlecsNetworkWorldSubsystem::QueueReplicationSnapshot(const FFlecsNetworkId& InNetworkId,
 	const FFlecsEntityReplicationSnapshot& InSnapshot)
 {
+	// Updates arrive on the game thread, the queue system may be applying the queue in an any-thread tick function
+	const FFlecsWorldAccessScope AccessScope(GetFlecsWorldChecked()->GetWorldAccessLock(),
+		EFlecsTickFunctionWorldAccess::ReadWrite);
+	
 	ReplicationUpdateQueue.EnqueueSnapshot(InNetworkId, InSnapshot);
 }
 
 void UFlecsNetworkWorldSubsystem::QueueReplicationRemoval(const FFlecsNetworkId& InNetworkId,
 	const uint32 InStateRevision)
 {
+	const FFlecsWorldAccessScope AccessScope(GetFlecsWorldChecked()->GetWorldAccessLock(),
+		EFlecsTickFunctionWorldAccess::ReadWrite);
+	
 	ReplicationUpdateQueue.EnqueueRemoval(InNetworkId, InStateRevision);
 }
 
 void UFlecsNetworkWorldSubsystem::ApplyQueuedReplicationUpdates(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld)
 {
-	const TArray<FFlecsReplicationQueuedUpdate> Updates = ReplicationUpdateQueue.Drain();
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FlecsNetworkWorldSubsystem_ApplyQueuedReplicationUpdates);
+	
+	const TSolidNotNull<const UFlecsNetworkingModuleSettings*> Settings = GetNetworkingSettings();
+	const double TimeBudget = Settings->ReplicationApplyTimeBudget;
+	const int32 BatchSize = FMath::Max(Settings->ReplicationApplyBatchSize, 1);
+	const double StartTime = FPlatformTime::Seconds();
+	
+	TArray<FFlecsReplicationQueuedUpdate> Updates = ReplicationUpdateQueue.Drain();
+	
+	// Layouts are consumed first so snapshots that arrived together with their layout can be applied in the same batch
+	ApplyPendingLayoutDefinitions(InWorld);
+	
+	// Inside a system the world is already deferred and the commands are merged when the system finishes
+	TOptional<FFlecsScopedDeferWindow> DeferWindow;
+	if (!InWorld->IsDeferred())
+	{
+		DeferWindow.Emplace(InWorld);
+	}
+	
+	// Snapshots are grouped by layout, so the component ids of a layout are resolved once per batch
+	// and new entities of the batch are created together in their target table
+	TMap<FFlecsReplicationLayoutId, TArray<const FFlecsReplicationQueuedUpdate*>> SnapshotsByLayout;
+	
+	TArray<FFlecsReplicationQueuedUpdate> RemainingUpdates;
 
-	for (const FFlecsReplicationQueuedUpdate& Update : Updates)
+	for (FFlecsReplicationQueuedUpdate& Update : Updates)
 	{
 		if UNLIKELY_IF(!Update.NetworkId.IsValid())
 		{
@@ -478,7 +982,7 @@ void UFlecsNetworkWorldSubsystem::ApplyQueuedReplicationUpdates(const TSolidNotN
 			continue;
 		}
 
-		if UNLIKELY_IF(!Update.bRemove && !Update.Snapshot.LayoutId.IsValid())
+		if UNLIKELY_IF(!Update.bRemove && !Update.Snapshot.HasLayout())
 		{
 			UE_LOG(LogFlecsWorld, Error, TEXT("Replication queue contains an invalid entity snapshot"));
 			continue;
@@ -487,15 +991,66 @@ void UFlecsNetworkWorldSubsystem::ApplyQueuedReplicationUpdates(const TSolidNotN
 		if (Update.bRemove)
 		{
 			ApplyReceivedNetworkEntityRemoval(Update.NetworkId, Update.StateRevision);
+			continue;
 		}
-		else
+		
+		if (!Update.Snapshot.LayoutId.IsValid())
 		{
-			ApplyReceivedNetworkEntitySnapshot(Update.NetworkId, Update.Snapshot);
+			Update.Snapshot.LayoutId = GetLayoutRegistry().FindLayoutId(Update.Snapshot.LayoutHandle);
+			
+			// The dictionary entry for the handle hasn't arrived yet, the snapshot waits in the queue
+			if (!Update.Snapshot.LayoutId.IsValid())
+			{
+				RemainingUpdates.Add(MoveTemp(Update));
+				continue;
+			}
 		}
+		
+		SnapshotsByLayout.FindOrAdd(Update.Snapshot.LayoutId).Add(&Update);
 	}
-
-	ApplyPendingLayoutDefinitions(InWorld);
+	
+	bool bOutOfTime = false;
+	
+	for (const TPair<FFlecsReplicationLayoutId, TArray<const FFlecsReplicationQueuedUpdate*>>& LayoutSnapshots : SnapshotsByLayout)
+	{
+		const TArray<const FFlecsReplicationQueuedUpdate*>& LayoutUpdates = LayoutSnapshots.Value;
+		
+		for (int32 BatchStart = 0; BatchStart < LayoutUpdates.Num(); BatchStart += BatchSize)
+		{
+			const TConstArrayView<const FFlecsReplicationQueuedUpdate*> Batch = MakeArrayView(LayoutUpdates)
+				.Mid(BatchStart, BatchSize);
+			
+			if (bOutOfTime)
+			{
+				// The drained array owns the updates, so they're moved back into the queue rather than copied
+				for (const FFlecsReplicationQueuedUpdate* Update : Batch)
+				{
+					RemainingUpdates.Add(MoveTemp(Updates[static_cast<int32>(Update - Updates.GetData())]));
+				}
+				
+				continue;
+			}
+			
+			ApplyReceivedNetworkEntitySnapshots(LayoutSnapshots.Key, Batch);
+			
+			// At least one batch is applied every frame so the queue always makes progress
+			bOutOfTime = TimeBudget > 0.0 && FPlatformTime::Seconds() - StartTime >= TimeBudget;
+		}
+	}
+	
 	ApplyDeferredEntityLayouts();
+	
+	const int32 RemainingUpdateCount = RemainingUpdates.Num();
+	if (RemainingUpdateCount > 0)
+	{
+		ReplicationUpdateQueue.Requeue(MoveTemp(RemainingUpdates));
+	}
+	
+	if UNLIKELY_IF(ReplicationStats)
+	{
+		ReplicationStats->FlushApplyStats(Updates.Num(), Updates.Num() - RemainingUpdateCount,
+			FPlatformTime::Seconds() - StartTime);
+	}
 }
 
 FFlecsEntityHandle UFlecsNetworkWorldSubsystem::RegisterReplicationProfileAsset(const UFlecsReplicationProfileDataAsset* InAsset)
@@ -590,7 +1145,11 @@ bool UFlecsNetworkWorldSubsystem::SetReplicationProfile(const FFlecsEntityHandle
 	{
 		ReplicatedEntity->ProfileId = ProfileId;
 		InEntity.Modified<FFlecsReplicatedEntityComponent>();
-		InEntity.Add<FFlecsNetDirtyTag>();
+		
+		if (HasAuthority())
+		{
+			MarkReplicatedEntityDirty(InEntity, FFlecsReplicatedEntityComponent::EntityDirtyMask);
+		}
 	}
 
 	return true;
@@ -679,61 +1238,427 @@ bool UFlecsNetworkWorldSubsystem::SelectReplicationShard(const FFlecsEntityHandl
 	return true;
 }
 
-void UFlecsNetworkWorldSubsystem::ApplyReceivedNetworkEntitySnapshot(const FFlecsNetworkId& InNetworkId,
-	const FFlecsEntityReplicationSnapshot& InSnapshot)
+bool UFlecsNetworkWorldSubsystem::AcceptReceivedNetworkEntitySnapshot(const FFlecsNetworkId& InNetworkId,
+	const FFlecsEntityReplicationSnapshot& InSnapshot) const
 {
-	const FFlecsEntityReplicationSnapshot* ExistingSnapshot = ReplicationSnapshots.Find(InNetworkId);
-	if (ExistingSnapshot && ExistingSnapshot->StateRevision >= InSnapshot.StateRevision)
+	const FFlecsNetworkEntityRecord* Record = NetworkEntities.FindSlot(InNetworkId.GetSlot());
+	if (!Record)
+	{
+		return true;
+	}
+	
+	if (!(Record->NetworkId == InNetworkId))
+	{
+		if (Record->NetworkId.GetGeneration() > InNetworkId.GetGeneration())
+		{
+			UE_LOG(LogFlecsWorld, Warning,
+				TEXT("Received replication snapshot for network ID '%s', but its slot is already used by network ID '%s'"),
+				*InNetworkId.ToString(), *Record->NetworkId.ToString());
+			return false;
+		}
+		
+		// An older generation is released by ReleaseStaleNetworkEntitySlot before the snapshot is applied
+		return true;
+	}
+	
+	if (Record->bHasSnapshot && Record->Snapshot.StateRevision >= InSnapshot.StateRevision)
 	{
 		UE_LOG(LogFlecsWorld, Warning,
 			TEXT("Received replication snapshot for network ID '%s' with state revision %d, but existing snapshot has state revision %d"),
-			*InNetworkId.ToString(), InSnapshot.StateRevision, ExistingSnapshot->StateRevision);
-		return;
+			*InNetworkId.ToString(), InSnapshot.StateRevision, Record->Snapshot.StateRevision);
+		return false;
 	}
 
-	if (const uint32* RemovedRevision = RemovedEntityRevisions.Find(InNetworkId))
+	if (Record->bRemoved)
 	{
-		if (*RemovedRevision >= InSnapshot.StateRevision)
+		if (Record->RemovedRevision >= InSnapshot.StateRevision)
 		{
 			UE_LOG(LogFlecsWorld, Warning,
 				TEXT("Received replication snapshot for removed network ID '%s' with state revision %d, but removal has state revision %d"),
-				*InNetworkId.ToString(), InSnapshot.StateRevision, *RemovedRevision);
-			return;
+				*InNetworkId.ToString(), InSnapshot.StateRevision, Record->RemovedRevision);
+			return false;
 		}
-
-		RemovedEntityRevisions.Remove(InNetworkId);
 	}
+	
+	return true;
+}
 
-	const TOptional<FFlecsEntityHandle> EntityHandlePtr = GetEntityFromNetworkId(InNetworkId);
+void UFlecsNetworkWorldSubsystem::ReleaseStaleNetworkEntitySlot(const FFlecsNetworkId& InNetworkId)
+{
+	FFlecsNetworkEntityRecord* Record = NetworkEntities.FindSlot(InNetworkId.GetSlot());
+	if (!Record || Record->NetworkId == InNetworkId)
+	{
+		return;
+	}
 	
-	FFlecsEntityHandle EntityHandle;
-	if (EntityHandlePtr.IsSet())
+	solid_checkf(Record->NetworkId.GetGeneration() < InNetworkId.GetGeneration(),
+		TEXT("Cannot release network ID '%s' for older network ID '%s'"),
+		*Record->NetworkId.ToString(), *InNetworkId.ToString());
+	
+	// The authority only reuses a slot after releasing its entity, even if the removal is still in flight
+	const FFlecsNetworkId StaleNetworkId = Record->NetworkId;
+	DestroyReceivedNetworkEntity(*Record);
+	NetworkEntities.Remove(StaleNetworkId);
+}
+
+void UFlecsNetworkWorldSubsystem::ApplyReceivedNetworkEntitySnapshot(const FFlecsNetworkId& InNetworkId,
+	const FFlecsEntityReplicationSnapshot& InSnapshot)
+{
+	if (!AcceptReceivedNetworkEntitySnapshot(InNetworkId, InSnapshot))
 	{
-		EntityHandle = EntityHandlePtr.GetValue();
-		solid_checkf(EntityHandle.IsValid(), TEXT("Entity handle for network ID '%s' is not valid"), *InNetworkId.ToString());
+		return;
 	}
-	else
+	
+	ReleaseStaleNetworkEntitySlot(InNetworkId);
+
+	FFlecsNetworkEntityRecord& Record = NetworkEntities.FindOrAdd(InNetworkId);
+	
+	if (!Record.HasEntity())
 	{
-		EntityHandle = GetFlecsWorldChecked()->CreateEntity()
+		Record.Entity = GetFlecsWorldChecked()->CreateEntity()
 			.Set<FFlecsNetworkId>(InNetworkId);
-	
-		NetworkIdToEntityMap.Add(InNetworkId, EntityHandle);
 	}
-		
-	FFlecsEntityReplicationSnapshot& StoredSnapshot = GetReplicationSnapshots().FindOrAdd(InNetworkId);
+	
+	const FFlecsEntityHandle EntityHandle = Record.Entity;
+	
+	// Stored even if the layout is deferred, so older snapshots arriving before the layout are still rejected
+	Record.Snapshot = InSnapshot;
+	Record.bHasSnapshot = true;
+	Record.bRemoved = false;
 		
 	const FFlecsReplicationLayoutDefinition* LayoutDefinition = GetLayoutRegistry().Find(InSnapshot.LayoutId);
 	if (!LayoutDefinition)
 	{
-		// @TODO: is this correct?
-		StoredSnapshot = InSnapshot;
-		
 		AddDeferredEntityLayout(EntityHandle, InSnapshot.LayoutId, InSnapshot);
 		return;
 	}
 		
 	ApplySnapshotToEntity(EntityHandle, InSnapshot);
-	StoredSnapshot = InSnapshot;
+}
+
+void UFlecsNetworkWorldSubsystem::ApplyReceivedNetworkEntitySnapshots(const FFlecsReplicationLayoutId& InLayoutId,
+	const TConstArrayView<const FFlecsReplicationQueuedUpdate*> InUpdates)
+{
+	const FFlecsResolvedReplicationLayout Layout = ResolveReplicationLayout(InLayoutId);
+	
+	// The queue coalesces by network ID, but a batch can still hold several generations of a slot.
+	// Only the newest one can own the slot, the older ones were already released by the authority.
+	TMap<uint32, const FFlecsReplicationQueuedUpdate*> UpdatesBySlot;
+	UpdatesBySlot.Reserve(InUpdates.Num());
+	
+	for (const FFlecsReplicationQueuedUpdate* Update : InUpdates)
+	{
+		const FFlecsReplicationQueuedUpdate*& SlotUpdate = UpdatesBySlot.FindOrAdd(Update->NetworkId.GetSlot(), Update);
+		if (SlotUpdate->NetworkId.GetGeneration() < Update->NetworkId.GetGeneration())
+		{
+			SlotUpdate = Update;
+		}
+	}
+	
+	TArray<const FFlecsReplicationQueuedUpdate*> AcceptedUpdates;
+	TArray<const FFlecsReplicationQueuedUpdate*> NewEntityUpdates;
+	TBitArray<> AcceptedNewEntities;
+	AcceptedUpdates.Reserve(UpdatesBySlot.Num());
+	
+	for (const FFlecsReplicationQueuedUpdate* Update : InUpdates)
+	{
+		if (UpdatesBySlot.FindChecked(Update->NetworkId.GetSlot()) != Update)
+		{
+			UE_LOG(LogFlecsWorld, Warning,
+				TEXT("Dropped replication snapshot for network ID '%s', a newer generation of its slot is in the same batch"),
+				*Update->NetworkId.ToString());
+			continue;
+		}
+		
+		if (!AcceptReceivedNetworkEntitySnapshot(Update->NetworkId, Update->Snapshot))
+		{
+			continue;
+		}
+		
+		ReleaseStaleNetworkEntitySlot(Update->NetworkId);
+		
+		const FFlecsNetworkEntityRecord* Record = NetworkEntities.Find(Update->NetworkId);
+		const bool bNewEntity = !Record || !Record->HasEntity();
+		
+		AcceptedUpdates.Add(Update);
+		AcceptedNewEntities.Add(bNewEntity);
+		
+		if (bNewEntity)
+		{
+			NewEntityUpdates.Add(Update);
+		}
+	}
+	
+	TArray<FFlecsEntityHandle> NewEntities;
+	const bool bNewEntitiesHaveValues = CreateReceivedNetworkEntities(Layout, NewEntityUpdates, NewEntities);
+	
+	for (int32 Index = 0; Index < NewEntityUpdates.Num(); ++Index)
+	{
+		NetworkEntities.FindOrAdd(NewEntityUpdates[Index]->NetworkId).Entity = NewEntities[Index];
+	}
+	
+	for (int32 Index = 0; Index < AcceptedUpdates.Num(); ++Index)
+	{
+		const FFlecsReplicationQueuedUpdate* Update = AcceptedUpdates[Index];
+		
+		FFlecsNetworkEntityRecord* Record = NetworkEntities.Find(Update->NetworkId);
+		solid_checkf(Record && Record->HasEntity(), TEXT("Entity handle for network ID '%s' is not valid"), *Update->NetworkId.ToString());
+		
+		const FFlecsEntityHandle EntityHandle = Record->Entity;
+		Record->Snapshot = Update->Snapshot;
+		Record->bHasSnapshot = true;
+		Record->bRemoved = false;
+		
+		if (!Layout.IsValid())
+		{
+			AddDeferredEntityLayout(EntityHandle, InLayoutId, Update->Snapshot);
+			continue;
+		}
+		
+		// Bulk created entities already hold the snapshot values
+		if (bNewEntitiesHaveValues && AcceptedNewEntities[Index])
+		{
+			AppliedEntityLayouts.Add(EntityHandle, InLayoutId);
+			continue;
+		}
+		
+		ApplySnapshotToEntity(EntityHandle, Update->Snapshot, Layout);
+	}
+}
+
+FFlecsResolvedReplicationLayout UFlecsNetworkWorldSubsystem::ResolveReplicationLayout(
+	const FFlecsReplicationLayoutId& InLayoutId) const
+{
+	FFlecsResolvedReplicationLayout Layout;
+	Layout.Definition = GetLayoutRegistry().Find(InLayoutId);
+	
+	if (!Layout.Definition)
+	{
+		return Layout;
+	}
+	
+	const TSolidNotNull<UFlecsWorld*> FlecsWorld = GetFlecsWorldChecked();
+	const FFlecsComponentReplicationRegistry& ComponentRegistry = FFlecsComponentReplicationRegistry::Get(FlecsWorld);
+	
+	Layout.Keys.SetNum(Layout.Definition->Keys.Num());
+	
+	if (Layout.Definition->HasBaseline())
+	{
+		Layout.BaselineId = FFlecsReplicationIndividualKey::ResolveToId(FlecsWorld, Layout.Definition->Baseline);
+		
+		if UNLIKELY_IF(!Layout.BaselineId.IsValid())
+		{
+			UE_LOG(LogFlecsWorld, Error,
+				TEXT("Cannot reset values of layout '%s' to its baseline because prefab '%s' is not valid"),
+				*InLayoutId.ToString(), *Layout.Definition->Baseline.CanonicalString());
+		}
+	}
+	
+	for (int32 Index = 0; Index < Layout.Definition->Keys.Num(); ++Index)
+	{
+		const FFlecsReplicationKey& Key = Layout.Definition->Keys[Index];
+		FFlecsResolvedReplicationKey& ResolvedKey = Layout.Keys[Index];
+		
+		ResolvedKey.ComponentId = FFlecsReplicationKey::ResolveToId(FlecsWorld, Key);
+		
+		if UNLIKELY_IF(!ResolvedKey.ComponentId.IsValid())
+		{
+			UE_LOG(LogFlecsWorld, Error,
+				TEXT("Cannot apply snapshots of layout '%s' because component ID for key '%s' is not valid"),
+				*InLayoutId.ToString(), *Key.CanonicalString());
+			continue;
+		}
+		
+		if (!FFlecsReplicationKey::IsValidPairStorageKind(Key.StorageKind))
+		{
+			continue;
+		}
+		
+		FFlecsId StorageId = ResolvedKey.ComponentId;
+		
+		if (ResolvedKey.ComponentId.IsPair())
+		{
+			const EFlecsReplicationKeyStorageKind StorageKind
+				= FFlecsReplicationKey::GetStorageKindForPair(FlecsWorld, ResolvedKey.ComponentId);
+			
+			if (StorageKind == EFlecsReplicationKeyStorageKind::Primary)
+			{
+				StorageId = ResolvedKey.ComponentId.GetFirst();
+			}
+			else if (StorageKind == EFlecsReplicationKeyStorageKind::Secondary)
+			{
+				StorageId = ResolvedKey.ComponentId.GetSecond();
+			}
+			else UNLIKELY_ATTRIBUTE
+			{
+				UE_LOG(LogFlecsWorld, Error,
+					TEXT("Cannot apply snapshots of layout '%s' because storage kind for pair component ID '%s' is invalid"),
+					*InLayoutId.ToString(), *ResolvedKey.ComponentId.ToString());
+				continue;
+			}
+		}
+		
+		const FFlecsComponentReplicationDescriptor* Descriptor = ComponentRegistry.Find(StorageId);
+		
+		if UNLIKELY_IF(!Descriptor || !Descriptor->GetDeserializeFunction()
+			|| !Descriptor->GetConstructFunction() || !Descriptor->GetDestroyFunction())
+		{
+			UE_LOG(LogFlecsWorld, Error,
+				TEXT("Cannot deserialize snapshot values of layout '%s' for component key '%s'"),
+				*InLayoutId.ToString(), *Key.CanonicalString());
+			continue;
+		}
+		
+		ResolvedKey.Descriptor = Descriptor;
+		++Layout.ValueCount;
+	}
+	
+	return Layout;
+}
+
+bool UFlecsNetworkWorldSubsystem::CreateReceivedNetworkEntities(const FFlecsResolvedReplicationLayout& InLayout,
+	const TConstArrayView<const FFlecsReplicationQueuedUpdate*> InUpdates, OUT TArray<FFlecsEntityHandle>& OutEntities)
+{
+	const TSolidNotNull<UFlecsWorld*> FlecsWorld = GetFlecsWorldChecked();
+	
+	OutEntities.Reset(InUpdates.Num());
+	
+	if (InUpdates.IsEmpty())
+	{
+		return true;
+	}
+	
+	const FFlecsId NetworkIdComponent = FlecsWorld->GetIdIfRegistered<FFlecsNetworkId>();
+	
+	const int32 ResolvedKeyCount = Algo::CountIf(InLayout.Keys, [](const FFlecsResolvedReplicationKey& Key)
+	{
+		return Key.ComponentId.IsValid();
+	});
+	
+	// Bulk creation writes straight into the table, which a readonly stage doesn't allow.
+	// The first id slot holds the network id and the id list is zero terminated.
+	// Instances of a baseline are created one by one, values they don't override are copied from the prefab when applied.
+	const bool bCanBulkCreate = InLayout.IsValid()
+		&& !InLayout.BaselineId.IsValid()
+		&& NetworkIdComponent.IsValid()
+		&& ResolvedKeyCount + 2 <= FLECS_ID_DESC_MAX
+		&& !ecs_stage_is_readonly(FlecsWorld->GetNativeFlecsWorld());
+	
+	if (!bCanBulkCreate)
+	{
+		for (const FFlecsReplicationQueuedUpdate* Update : InUpdates)
+		{
+			OutEntities.Add(FlecsWorld->CreateEntity()
+				.Set<FFlecsNetworkId>(Update->NetworkId));
+		}
+		
+		return false;
+	}
+	
+	const int32 Count = InUpdates.Num();
+	
+	// The value columns only live until the values are moved into the table
+	FMemMark ScratchMark(ReplicationScratch);
+	
+	ecs_bulk_desc_t BulkDesc = {};
+	BulkDesc.count = Count;
+	
+	TArray<void*, TInlineAllocator<FLECS_ID_DESC_MAX>> ComponentData;
+	
+	FFlecsNetworkId* NetworkIds = New<FFlecsNetworkId>(ReplicationScratch, Count);
+	for (int32 EntityIndex = 0; EntityIndex < Count; ++EntityIndex)
+	{
+		NetworkIds[EntityIndex] = InUpdates[EntityIndex]->NetworkId;
+	}
+	
+	BulkDesc.ids[ComponentData.Num()] = NetworkIdComponent;
+	ComponentData.Add(NetworkIds);
+	
+	// Values that are missing from a snapshot or fail to deserialize are removed after creation,
+	// like the per entity apply does
+	TArray<TPair<int32, FFlecsId>> MissingValues;
+	
+	for (int32 KeyIndex = 0; KeyIndex < InLayout.Keys.Num(); ++KeyIndex)
+	{
+		const FFlecsResolvedReplicationKey& Key = InLayout.Keys[KeyIndex];
+		if (!Key.ComponentId.IsValid())
+		{
+			continue;
+		}
+		
+		// Tags and pairs without a value are part of the table but have no column data
+		if (!Key.Descriptor)
+		{
+			BulkDesc.ids[ComponentData.Num()] = Key.ComponentId;
+			ComponentData.Add(nullptr);
+			continue;
+		}
+		
+		const uint32 ValueSize = Key.Descriptor->GetSize();
+		uint8* Values = static_cast<uint8*>(ReplicationScratch.Alloc(ValueSize * Count, Key.Descriptor->GetAlignment()));
+		solid_cassume(Values);
+		
+		for (int32 EntityIndex = 0; EntityIndex < Count; ++EntityIndex)
+		{
+			void* Value = Values + ValueSize * EntityIndex;
+			Key.Descriptor->GetConstructFunction()(Value);
+			
+			const FFlecsEntityReplicationSnapshot& Snapshot = InUpdates[EntityIndex]->Snapshot;
+			if (!ReadPackedValue(Snapshot, KeyIndex, *Key.Descriptor, Value))
+			{
+				if UNLIKELY_IF(Snapshot.PackedValues.IsValidIndex(KeyIndex) && Snapshot.PackedValues[KeyIndex].Revision != 0)
+				{
+					UE_LOG(LogFlecsWorld, Error,
+						TEXT("Cannot deserialize snapshot value for network ID '%s' and component key '%s'"),
+						*InUpdates[EntityIndex]->NetworkId.ToString(), *InLayout.Definition->Keys[KeyIndex].CanonicalString());
+				}
+				
+				MissingValues.Emplace(EntityIndex, Key.ComponentId);
+			}
+		}
+		
+		BulkDesc.ids[ComponentData.Num()] = Key.ComponentId;
+		ComponentData.Add(Values);
+	}
+	
+	BulkDesc.data = ComponentData.GetData();
+	
+	const ecs_entity_t* Entities = ecs_bulk_init(FlecsWorld->GetNativeFlecsWorld(), &BulkDesc);
+	solid_cassume(Entities);
+	
+	for (int32 EntityIndex = 0; EntityIndex < Count; ++EntityIndex)
+	{
+		OutEntities.Add(FFlecsEntityHandle(FlecsWorld, FFlecsId(Entities[EntityIndex])));
+	}
+	
+	// The values were moved into the table, the moved-from values still have to be destroyed.
+	// The scratch memory itself is released with the mark.
+	int32 DataIndex = 1;
+	for (const FFlecsResolvedReplicationKey& Key : InLayout.Keys)
+	{
+		if (!Key.ComponentId.IsValid())
+		{
+			continue;
+		}
+		
+		uint8* Values = static_cast<uint8*>(ComponentData[DataIndex++]);
+		if (!Values)
+		{
+			continue;
+		}
+		
+		for (int32 EntityIndex = 0; EntityIndex < Count; ++EntityIndex)
+		{
+			Key.Descriptor->GetDestroyFunction()(Values + Key.Descriptor->GetSize() * EntityIndex);
+		}
+	}
+	
+	for (const TPair<int32, FFlecsId>& MissingValue : MissingValues)
+	{
+		OutEntities[MissingValue.Key].Remove(MissingValue.Value);
+	}
+	
+	return true;
 }
 
 void UFlecsNetworkWorldSubsystem::ApplyReceivedNetworkEntityRemoval(const FFlecsNetworkId& InNetworkId,
@@ -750,60 +1675,73 @@ void UFlecsNetworkWorldSubsystem::ApplyReceivedNetworkEntityRemoval(const FFlecs
 		return;
 	}
 
-	if (const FFlecsEntityReplicationSnapshot* ExistingSnapshot = ReplicationSnapshots.Find(InNetworkId))
+	if (FFlecsNetworkEntityRecord* SlotRecord = NetworkEntities.FindSlot(InNetworkId.GetSlot());
+		SlotRecord && !(SlotRecord->NetworkId == InNetworkId))
 	{
-		if (ExistingSnapshot->StateRevision > InStateRevision)
+		// A newer generation owns the slot, the older entity is already gone
+		if (SlotRecord->NetworkId.GetGeneration() > InNetworkId.GetGeneration())
 		{
-			UE_LOG(LogFlecsWorld, Warning,
-				TEXT("Received removal for network ID '%s' with state revision %d, but existing snapshot has state revision %d"),
-				*InNetworkId.ToString(), InStateRevision, ExistingSnapshot->StateRevision);
 			return;
 		}
+		
+		DestroyReceivedNetworkEntity(*SlotRecord);
 	}
+	
+	FFlecsNetworkEntityRecord& Record = NetworkEntities.FindOrAdd(InNetworkId);
 
-	if (const uint32* ExistingRemovalRevision = RemovedEntityRevisions.Find(InNetworkId))
+	if (Record.bHasSnapshot && Record.Snapshot.StateRevision > InStateRevision)
 	{
-		if (*ExistingRemovalRevision > InStateRevision)
-		{
-			UE_LOG(LogFlecsWorld, Warning,
-				TEXT("Received removal for network ID '%s' with state revision %d, but existing removal has state revision %d"),
-				*InNetworkId.ToString(), InStateRevision, *ExistingRemovalRevision);
-			return;
-		}
+		UE_LOG(LogFlecsWorld, Warning,
+			TEXT("Received removal for network ID '%s' with state revision %d, but existing snapshot has state revision %d"),
+			*InNetworkId.ToString(), InStateRevision, Record.Snapshot.StateRevision);
+		return;
+	}
+
+	if (Record.bRemoved && Record.RemovedRevision > InStateRevision)
+	{
+		UE_LOG(LogFlecsWorld, Warning,
+			TEXT("Received removal for network ID '%s' with state revision %d, but existing removal has state revision %d"),
+			*InNetworkId.ToString(), InStateRevision, Record.RemovedRevision);
+		return;
 	}
 
 	uint32 RemovalRevision = InStateRevision;
-	if (const FFlecsEntityReplicationSnapshot* ExistingSnapshot = ReplicationSnapshots.Find(InNetworkId))
+	if (Record.bHasSnapshot)
 	{
-		RemovalRevision = FMath::Max(RemovalRevision, ExistingSnapshot->StateRevision);
+		RemovalRevision = FMath::Max(RemovalRevision, Record.Snapshot.StateRevision);
 	}
 
-	if (const uint32* ExistingRemovalRevision = RemovedEntityRevisions.Find(InNetworkId))
+	if (Record.bRemoved)
 	{
-		RemovalRevision = FMath::Max(RemovalRevision, *ExistingRemovalRevision);
+		RemovalRevision = FMath::Max(RemovalRevision, Record.RemovedRevision);
 	}
 
-	RemovedEntityRevisions.Add(InNetworkId, RemovalRevision);
+	DestroyReceivedNetworkEntity(Record);
+	
+	Record.Snapshot = FFlecsEntityReplicationSnapshot();
+	Record.bHasSnapshot = false;
+	Record.RemovedRevision = RemovalRevision;
+	Record.bRemoved = true;
+}
 
-	if (const FFlecsEntityHandle* EntityHandle = NetworkIdToEntityMap.Find(InNetworkId))
+void UFlecsNetworkWorldSubsystem::DestroyReceivedNetworkEntity(FFlecsNetworkEntityRecord& InOutRecord)
+{
+	if (!InOutRecord.HasEntity())
 	{
-		if (EntityHandle->IsValid())
-		{
-			EntityHandle->Destroy();
-		}
-
-		NetworkIdToEntityMap.Remove(InNetworkId);
+		return;
 	}
-
-	ReplicationSnapshots.Remove(InNetworkId);
+	
+	const FFlecsEntityHandle EntityHandle = InOutRecord.Entity;
+	InOutRecord.Entity = FFlecsEntityHandle();
+	
+	AppliedEntityLayouts.Remove(EntityHandle);
 
 	for (auto It = DeferredEntityLayouts.CreateIterator(); It; ++It)
 	{
 		It.Value().RemoveAll(
-			[&InNetworkId](const TPair<FFlecsEntityHandle, FFlecsEntityReplicationSnapshot>& Pair)
+			[&EntityHandle](const TPair<FFlecsEntityHandle, FFlecsEntityReplicationSnapshot>& Pair)
 			{
-				const FFlecsNetworkId* PairNetworkId = Pair.Key.TryGet<FFlecsNetworkId>();
-				return PairNetworkId && *PairNetworkId == InNetworkId;
+				return Pair.Key == EntityHandle;
 			});
 
 		if (It.Value().IsEmpty())
@@ -811,6 +1749,11 @@ void UFlecsNetworkWorldSubsystem::ApplyReceivedNetworkEntityRemoval(const FFlecs
 			It.RemoveCurrent();
 		}
 	}
+	
+	if (EntityHandle.IsAlive())
+	{
+		EntityHandle.Destroy();
+	}
 }
 
 void UFlecsNetworkWorldSubsystem::ApplyPendingLayoutDefinitions(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld)
@@ -828,6 +1771,8 @@ void UFlecsNetworkWorldSubsystem::ApplyDeferredEntityLayouts()
 			continue;
 		}
 
+		const FFlecsResolvedReplicationLayout Layout = ResolveReplicationLayout(It.Key());
+		
 		TArray<TPair<FFlecsEntityHandle, FFlecsEntityReplicationSnapshot>> DeferredSnapshots = MoveTemp(It.Value());
 		It.RemoveCurrent();
 
@@ -843,7 +1788,7 @@ void UFlecsNetworkWorldSubsystem::ApplyDeferredEntityLayouts()
 
 			const FFlecsNetworkId* NetworkId = EntityHandle.TryGet<FFlecsNetworkId>();
 			const FFlecsEntityReplicationSnapshot* LatestSnapshot = NetworkId
-				? ReplicationSnapshots.Find(*NetworkId)
+				? FindReplicationSnapshot(*NetworkId)
 				: nullptr;
 
 			if UNLIKELY_IF(LatestSnapshot &&
@@ -853,7 +1798,7 @@ void UFlecsNetworkWorldSubsystem::ApplyDeferredEntityLayouts()
 				continue;
 			}
 
-			ApplySnapshotToEntity(EntityHandle, Snapshot);
+			ApplySnapshotToEntity(EntityHandle, Snapshot, Layout);
 		}
 	}
 }
@@ -861,147 +1806,195 @@ void UFlecsNetworkWorldSubsystem::ApplyDeferredEntityLayouts()
 void UFlecsNetworkWorldSubsystem::ApplySnapshotToEntity(const FFlecsEntityHandle& InEntityHandle,
 	const FFlecsEntityReplicationSnapshot& InSnapshot)
 {
-	//FFlecsScopedDeferWindow DeferWindow(InEntityHandle.GetFlecsWorldChecked());
-
-	const FFlecsReplicationLayoutDefinition* LayoutDefinition = GetLayoutRegistry().Find(InSnapshot.LayoutId);
-	if UNLIKELY_IF(!LayoutDefinition)
+	const FFlecsResolvedReplicationLayout Layout = ResolveReplicationLayout(InSnapshot.LayoutId);
+	if UNLIKELY_IF(!Layout.IsValid())
 	{
 		UE_LOG(LogFlecsWorld, Error,
 			TEXT("Cannot apply snapshot to entity %s because layout ID '%s' is not registered"),
 			*InEntityHandle.ToString(), *InSnapshot.LayoutId.ToString());
 		return;
 	}
+	
+	ApplySnapshotToEntity(InEntityHandle, InSnapshot, Layout);
+}
 
-	if UNLIKELY_IF(InSnapshot.PackedValues.Num() != LayoutDefinition->Keys.Num())
+void UFlecsNetworkWorldSubsystem::ApplySnapshotToEntity(const FFlecsEntityHandle& InEntityHandle,
+	const FFlecsEntityReplicationSnapshot& InSnapshot, const FFlecsResolvedReplicationLayout& InLayout)
+{
+	solid_check(InLayout.IsValid());
+	
+	if UNLIKELY_IF(InSnapshot.PackedValues.Num() != InLayout.Keys.Num())
 	{
 		UE_LOG(LogFlecsWorld, Error,
 			TEXT("Cannot apply snapshot to entity %s because packed value count %d does not match layout '%s' key count %d"),
-			*InEntityHandle.ToString(), InSnapshot.PackedValues.Num(), *InSnapshot.LayoutId.ToString(), LayoutDefinition->Keys.Num());
+			*InEntityHandle.ToString(), InSnapshot.PackedValues.Num(), *InSnapshot.LayoutId.ToString(), InLayout.Keys.Num());
+		return;
+	}
+	
+	// A correctly predicted snapshot isn't applied, the entity's predicted state is already ahead of it
+	if (PredictionSubsystem && InEntityHandle.Has<FFlecsPredictedEntityTag>()
+		&& PredictionSubsystem->ConfirmPredictedSnapshot(InEntityHandle, InSnapshot))
+	{
 		return;
 	}
 
-	for (const FFlecsReplicationKey& Key : LayoutDefinition->Keys)
+	// Only keys of the previously applied layout that are missing from this one are removed,
+	// every other key stays in place so an update doesn't move the entity between tables
+	FFlecsReplicationLayoutId& AppliedLayoutId = AppliedEntityLayouts.FindOrAdd(InEntityHandle);
+	
+	if (AppliedLayoutId.IsValid() && AppliedLayoutId != InLayout.Definition->LayoutId)
 	{
-		const FFlecsId ComponentId = FFlecsReplicationKey::ResolveToId(GetFlecsWorldChecked(), Key);
+		const FFlecsResolvedReplicationLayout AppliedLayout = ResolveReplicationLayout(AppliedLayoutId);
 		
-		if UNLIKELY_IF(!ComponentId.IsValid())
+		if (AppliedLayout.BaselineId.IsValid() && AppliedLayout.BaselineId != InLayout.BaselineId)
 		{
-			UE_LOG(LogFlecsWorld, Error,
-				TEXT("Cannot apply snapshot to entity %s because component ID for key '%s' is not valid"),
-				*InEntityHandle.ToString(), *Key.CanonicalString());
-			continue;
+			InEntityHandle.RemovePrefab(AppliedLayout.BaselineId);
 		}
 		
-		InEntityHandle.Remove(ComponentId);
+		for (const FFlecsResolvedReplicationKey& AppliedKey : AppliedLayout.Keys)
+		{
+			const bool bKeyRemains = InLayout.Keys.ContainsByPredicate(
+				[&AppliedKey](const FFlecsResolvedReplicationKey& Key)
+				{
+					return Key.ComponentId == AppliedKey.ComponentId;
+				});
+			
+			if (AppliedKey.ComponentId.IsValid() && !bKeyRemains)
+			{
+				InEntityHandle.Remove(AppliedKey.ComponentId);
+			}
+		}
 	}
 	
-	for (int32 Index = 0; Index < LayoutDefinition->Keys.Num(); ++Index)
+	AppliedLayoutId = InLayout.Definition->LayoutId;
+	
+	FFlecsEntityHandle BaselinePrefab;
+	if (InLayout.BaselineId.IsValid())
 	{
-		const FFlecsReplicatedPackedValue& PackedValue = InSnapshot.PackedValues[Index];
-		if (PackedValue.Revision == 0)
+		BaselinePrefab = FFlecsEntityHandle(GetFlecsWorldChecked(), InLayout.BaselineId);
+		
+		if (!InEntityHandle.IsA(InLayout.BaselineId))
 		{
-			continue;
+			InEntityHandle.AddPrefab(InLayout.BaselineId);
 		}
+	}
+	
+	for (int32 Index = 0; Index < InLayout.Keys.Num(); ++Index)
+	{
+		const FFlecsReplicatedPackedValue& PackedValue = InSnapshot.PackedValues[Index];
+		const FFlecsResolvedReplicationKey& Key = InLayout.Keys[Index];
 		
-		const FFlecsReplicationKey& Key = LayoutDefinition->Keys[Index];
-		const uint64 PayloadEnd = static_cast<uint64>(PackedValue.Offset) + static_cast<uint64>(PackedValue.Size);
-		if UNLIKELY_IF(PayloadEnd > static_cast<uint64>(InSnapshot.PayloadData.Num()))
+		if UNLIKELY_IF(!Key.ComponentId.IsValid())
 		{
-			UE_LOG(LogFlecsWorld, Error,
-				TEXT("Cannot apply snapshot to entity %s because payload range [%u, %llu) for component key '%s' is outside the payload buffer of size %d"),
-				*InEntityHandle.ToString(), PackedValue.Offset, PayloadEnd, *Key.CanonicalString(), InSnapshot.PayloadData.Num());
 			continue;
 		}
 		
-		const FFlecsId ComponentId = FFlecsReplicationKey::ResolveToId(GetFlecsWorldChecked(), Key);
-		
-		if UNLIKELY_IF(!ComponentId.IsValid())
+		if (!Key.Descriptor)
 		{
-			UE_LOG(LogFlecsWorld, Error,
-				TEXT("Cannot apply snapshot to entity %s because component ID for key '%s' is not valid"),
-				*InEntityHandle.ToString(), *Key.CanonicalString());
+			if (!InEntityHandle.Has(Key.ComponentId))
+			{
+				InEntityHandle.Add(Key.ComponentId);
+			}
+			
 			continue;
 		}
 		
-		FFlecsId StorageId;
-		
-		if (ComponentId.IsPair())
+		if (PackedValue.Revision == 0)
 		{
-			const EFlecsReplicationKeyStorageKind StorageKind
-				= FFlecsReplicationKey::GetStorageKindForPair(GetFlecsWorldChecked(), ComponentId);
-			
-			if UNLIKELY_IF(StorageKind == EFlecsReplicationKeyStorageKind::None)
+			// A value without a revision is equal to the baseline's, an override that was reverted is reset to it
+			if (BaselinePrefab.IsValid())
 			{
-				UE_LOG(LogFlecsWorld, Error,
-					TEXT("Cannot apply snapshot to entity %s because storage kind for pair component ID '%s' is invalid"),
-					*InEntityHandle.ToString(), *ComponentId.ToString());
-				continue;
+				ResetValueToBaseline(InEntityHandle, BaselinePrefab, Key);
 			}
 			
-			if (StorageKind == EFlecsReplicationKeyStorageKind::Primary)
-			{
-				StorageId = ComponentId.GetFirst();
-			}
-			else if (StorageKind == EFlecsReplicationKeyStorageKind::Secondary)
-			{
-				StorageId = ComponentId.GetSecond();
-			}
-			else UNLIKELY_ATTRIBUTE
-			{
-				UE_LOG(LogFlecsWorld, Error,
-					TEXT("Cannot apply snapshot to entity %s because storage kind for pair component ID '%s' is invalid"),
-					*InEntityHandle.ToString(), *ComponentId.ToString());
-				continue;
-			}
-		}
-		else
-		{
-			StorageId = ComponentId;
+			continue;
 		}
 		
-		const FFlecsComponentReplicationDescriptor* Descriptor =
-			FFlecsComponentReplicationRegistry::Get(GetFlecsWorldChecked()).Find(StorageId);
+		// Deserialized into scratch first, a value that fails halfway leaves the entity's component untouched
+		FMemMark ScratchMark(ReplicationScratch);
 		
-		if UNLIKELY_IF(!Descriptor || !Descriptor->GetDeserializeFunction()
-			|| !Descriptor->GetConstructFunction() || !Descriptor->GetDestroyFunction())
+		void* Value = ReplicationScratch.Alloc(Key.Descriptor->GetSize(), Key.Descriptor->GetAlignment());
+		solid_cassume(Value);
+		Key.Descriptor->GetConstructFunction()(Value);
+		
+		if UNLIKELY_IF(!ReadPackedValue(InSnapshot, Index, *Key.Descriptor, Value))
 		{
+			Key.Descriptor->GetDestroyFunction()(Value);
+			
 			UE_LOG(LogFlecsWorld, Error,
 				TEXT("Cannot deserialize snapshot value for entity %s and component key '%s'"),
-				*InEntityHandle.ToString(), *Key.CanonicalString());
-			
+				*InEntityHandle.ToString(), *InLayout.Definition->Keys[Index].CanonicalString());
 			continue;
 		}
-
-		void* ComponentData = FMemory::Malloc(Descriptor->GetSize(), Descriptor->GetAlignment());
+		
+		// Values the entity already has are replaced in their storage, so the entity doesn't change tables
+		void* ComponentData = InEntityHandle.TryGetMut(Key.ComponentId);
+		if (!ComponentData)
+		{
+			ComponentData = InEntityHandle.Obtain(Key.ComponentId);
+		}
+		
 		solid_cassume(ComponentData);
-
-		Descriptor->GetConstructFunction()(ComponentData);
-
-		FMemoryReader Reader(InSnapshot.PayloadData, true);
-		Reader.Seek(PackedValue.Offset);
-		Reader.SetLimitSize(static_cast<int64>(PayloadEnd));
 		
-		const bool bDeserialized = Descriptor->GetDeserializeFunction()(Reader, ComponentData);
+		const ecs_type_info_t* TypeInfo = Key.ComponentId.GetTypeInfo(GetFlecsWorldChecked());
+		solid_cassume(TypeInfo);
 		
-		if UNLIKELY_IF(!bDeserialized || Reader.IsError())
+		if (TypeInfo->hooks.move)
 		{
-			UE_LOG(LogFlecsWorld, Error,
-				TEXT("Cannot deserialize snapshot value for entity %s and component key '%s'"),
-				*InEntityHandle.ToString(), *Key.CanonicalString());
-			
-			Descriptor->GetDestroyFunction()(ComponentData);
-			FMemory::Free(ComponentData);
-			
-			continue;
+			TypeInfo->hooks.move(ComponentData, Value, 1, TypeInfo);
+		}
+		else if (TypeInfo->hooks.copy)
+		{
+			TypeInfo->hooks.copy(ComponentData, Value, 1, TypeInfo);
+		}
+		else
+		{
+			FMemory::Memcpy(ComponentData, Value, TypeInfo->size);
 		}
-
-		InEntityHandle.Set(ComponentId, Descriptor->GetSize(), ComponentData);
-		Descriptor->GetDestroyFunction()(ComponentData);
 		
-		FMemory::Free(ComponentData);
+		Key.Descriptor->GetDestroyFunction()(Value);
+		
+		InEntityHandle.Modified(Key.ComponentId);
 	}
 }
 
+void UFlecsNetworkWorldSubsystem::ResetValueToBaseline(const FFlecsEntityHandle& InEntityHandle,
+	const FFlecsEntityHandle& InBaselinePrefab, const FFlecsResolvedReplicationKey& InKey)
+{
+	const void* BaselineValue = InBaselinePrefab.TryGet(InKey.ComponentId);
+	if UNLIKELY_IF(!BaselineValue)
+	{
+		return;
+	}
+	
+	void* ComponentData = InEntityHandle.TryGetMut(InKey.ComponentId);
+	if (!ComponentData)
+	{
+		ComponentData = InEntityHandle.Obtain(InKey.ComponentId);
+	}
+	
+	solid_cassume(ComponentData);
+	
+	if (InKey.Descriptor->AreValuesIdentical(ComponentData, BaselineValue))
+	{
+		return;
+	}
+	
+	const ecs_type_info_t* TypeInfo = InKey.ComponentId.GetTypeInfo(GetFlecsWorldChecked());
+	solid_cassume(TypeInfo);
+	
+	if (TypeInfo->hooks.copy)
+	{
+		TypeInfo->hooks.copy(ComponentData, BaselineValue, 1, TypeInfo);
+	}
+	else
+	{
+		FMemory::Memcpy(ComponentData, BaselineValue, TypeInfo->size);
+	}
+	
+	InEntityHandle.Modified(InKey.ComponentId);
+}
+
 void UFlecsNetworkWorldSubsystem::AddDeferredEntityLayout(const FFlecsEntityHandle& InEntityHandle,
 	const FFlecsReplicationLayoutId& InLayout, const FFlecsEntityReplicationSnapshot& InSnapshot)
 {
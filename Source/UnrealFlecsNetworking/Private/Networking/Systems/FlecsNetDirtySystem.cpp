@@ -6,8 +6,6 @@
 #include "Networking/Subsystem/FlecsNetworkSubsystemSingleton.h"
 #include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
 #include "Networking/FlecsReplicatedEntityComponent.h"
-#include "Networking/Bridge/FlecsReplicationBridgeBase.h"
-#include "Networking/Layout/FlecsReplicationSnapshot.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlecsNetDirtySystem)
 
@@ -27,6 +25,18 @@ void UFlecsNetDirtySystem::BuildSystem(const TSolidNotNull<const UFlecsWorldInte
 		//.With<FFlecsNetDirtyTag>().ReadWrite(); // 4 // @TODO: is this needed?
 }
 
+void UFlecsNetDirtySystem::RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld,
+                                       flecs::iter& InIterator)
+{
+	// Tagged entities first, their dirty bits are cleared so they're skipped in the dirty list
+	Super::RunIterator(InWorld, InIterator);
+	
+	if (const FFlecsNetworkSubsystemSingleton* NetworkSubsystem = InWorld->TryGet<FFlecsNetworkSubsystemSingleton>())
+	{
+		NetworkSubsystem->GetSubsystemChecked<UFlecsNetworkWorldSubsystem>()->PublishDirtyReplicatedEntities();
+	}
+}
+
 void UFlecsNetDirtySystem::EachIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld,
                                         flecs::iter& InIterator, const FFlecsId InIndex)
 {
@@ -40,40 +50,7 @@ void UFlecsNetDirtySystem::EachIterator(const TSolidNotNull<UFlecsWorldInterface
 		
 	const FFlecsEntityHandle EntityHandle = InIterator.entity(InIndex);
 
-	bool bCreatedNewLayout = false;
-		
-	TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult = 
-		NetworkSubsystem->GetLayoutRegistry().BuildForEntity(InWorld, EntityHandle, bCreatedNewLayout);
-		
-	// @TODO: Remove this in shipping?
-	if UNLIKELY_IF(LayoutResult.HasError())
-	{
-		NetworkSubsystem->GetReplicationBridge()->HandleProtocolError(FString::Printf(
-			TEXT("Failed to build replication layout for entity %s: %s"),
-			*EntityHandle.ToString(), *LayoutResult.GetError()));
-		
-		EntityHandle.Remove<FFlecsNetDirtyTag>();
-		return;
-	}
-		
-	// @TODO: DontFragment
-	
-	const TSolidNotNull<const FFlecsReplicationLayoutDefinition*> LayoutDefinition = LayoutResult.GetValue();
-		
-	const FFlecsReplicationLayoutId NewLayoutId = LayoutResult.GetValue()->LayoutId;
-		
-	ReplicatedComponent.LayoutId = NewLayoutId;
-		
-	FFlecsEntityReplicationSnapshot& Snapshot = NetworkSubsystem->GetReplicationSnapshots().FindOrAdd(NetworkId);
-	Snapshot.LayoutId = NewLayoutId;
-	Snapshot.FillFromEntity(EntityHandle, NetworkSubsystem->GetLayoutRegistry());
-	
-	if (bCreatedNewLayout)
-	{
-		NetworkSubsystem->GetReplicationBridge()->PublishEntityLayout(*LayoutDefinition);
-	}
-		
-	NetworkSubsystem->GetReplicationBridge()->PublishNetEntity(EntityHandle, NetworkId, Snapshot);
+	NetworkSubsystem->PublishReplicatedEntity(EntityHandle, ReplicatedComponent, NetworkId);
 
 	EntityHandle.Remove<FFlecsNetDirtyTag>();
 }
\ No newline at end of file
@@ -17,8 +17,10 @@ UFlecsReplicationQueueSystem::UFlecsReplicationQueueSystem()
 void UFlecsReplicationQueueSystem::BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*>,
 	TFlecsSystemBuilder<>& InBuilder) const
 {
+	// Immediate, so received entities can be created in bulk directly in their tables
 	InBuilder
 		.Phase(EFlecsPhaseType::PostUpdate)
+		.Immediate()
 		.With<const FFlecsNetworkSubsystemSingleton>();
 }
 
@@ -73,6 +73,27 @@ struct FFlecsReplicationShardPoolKey
 
 }; // struct FFlecsReplicationShardPoolKey
 
+/** Physical shards of one pool key. */
+struct FFlecsReplicationShardPool
+{
+	TArray<TObjectPtr<UFlecsNetShardBase>> Shards;
+	
+	/** Shards that may take another entity, full shards are dropped from it when a placement runs into them. */
+	TArray<TObjectPtr<UFlecsNetShardBase>> OpenShards;
+
+}; // struct FFlecsReplicationShardPool
+
+/** Deinitialized shards of one class that wait to be reused. */
+USTRUCT()
+struct FFlecsRecycledShardList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UFlecsNetShardBase>> Shards;
+
+}; // struct FFlecsRecycledShardList
+
 UCLASS()
 class UNREALFLECSNETWORKING_API UFlecsIrisReplicationBridge : public UFlecsReplicationBridgeBase, public INetRootObjectFactoryExtension
 {
@@ -108,7 +129,15 @@ public:
 		return ReplicatedLayouts;
 	}
 	
+	/** Number of shards that currently hold entities. */
+	NO_DISCARD int32 GetActiveShardCount() const;
+	
+	NO_DISCARD int32 GetRecycledShardCount() const;
+	
+	virtual void GatherShardStats(FFlecsReplicationShardStats& InOutStats) const override;
+	
 protected:
+	/** Creates a shard for the selection, or reinitializes a recycled one of the same class. */
 	NO_DISCARD UFlecsNetShardBase* CreateNewShard(const FFlecsNetworkId& InNetworkId,
 		const FFlecsEntityReplicationSnapshot& InSnapshot,
 		const FFlecsEntityView& InProfile,
@@ -129,7 +158,11 @@ protected:
 	UPROPERTY()
 	TMap<FFlecsEntityView, FFlecsReplicationShardPlacement> ShardMap;
 
-	TMap<FFlecsReplicationShardPoolKey, TArray<TObjectPtr<UFlecsNetShardBase>>> ShardPools;
+	// Shards in pools are kept alive by the placements of their entities.
+	TMap<FFlecsReplicationShardPoolKey, FFlecsReplicationShardPool> ShardPools;
+	
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FFlecsRecycledShardList> RecycledShards;
 
 	UE::Net::FNetRootObjectAdapter RootObjectAdapter;
 	
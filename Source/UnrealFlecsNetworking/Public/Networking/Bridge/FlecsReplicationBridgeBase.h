@@ -13,6 +13,7 @@
 
 class UFlecsNetworkWorldSubsystem;
 class UFlecsNetShardBase;
+struct FFlecsReplicationShardStats;
 
 /**
  * 
@@ -63,6 +64,9 @@ public:
 		const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot)
 		PURE_VIRTUAL(UFlecsReplicationBridgeBase::ResolveShard, return nullptr;);
 
+	/** Adds the counts of the bridge's shards to the stats, bridges without shards leave them untouched. */
+	virtual void GatherShardStats(FFlecsReplicationShardStats& InOutStats) const {}
+
 	void SetNetworkWorldSubsystem(UFlecsNetworkWorldSubsystem* InNetworkWorldSubsystem);
 
 	NO_DISCARD bool HasAuthority() const;
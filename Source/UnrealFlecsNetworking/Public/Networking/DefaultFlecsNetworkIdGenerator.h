@@ -2,8 +2,13 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 
+#include "Containers/LockFreeList.h"
+#include "Containers/StaticArray.h"
+#include "HAL/CriticalSection.h"
 #include "UObject/Object.h"
 
 #include "FlecsNetworkIDGeneratorInterface.h"
@@ -11,7 +16,13 @@
 #include "DefaultFlecsNetworkIdGenerator.generated.h"
 
 /**
- * 
+ * Thread-safe network ID generator.
+ *
+ * Every thread allocates from one of a fixed number of shards, each with its own free list and block of fresh slots,
+ * so concurrent callers rarely share a lock. Shards with more released IDs than they reuse hand batches of them to a
+ * lock-free pool that empty shards refill from before claiming fresh slots.
+ *
+ * Released IDs carry their generation, a reused slot gets the next generation and skips zero when it wraps around.
  */
 UCLASS(BlueprintType)
 class UNREALFLECSNETWORKING_API UDefaultFlecsNetworkIdGenerator : public UObject, public IFlecsNetworkIDGeneratorInterface
@@ -19,15 +30,63 @@ class UNREALFLECSNETWORKING_API UDefaultFlecsNetworkIdGenerator : public UObject
 	GENERATED_BODY()
 
 public:
+	static constexpr int32 ShardCount = 16;
+	
+	/** Fresh slots a shard claims at once. */
+	static constexpr uint32 FreshSlotBlockSize = 64;
+	
+	/** IDs per batch handed between the shards and the shared pool. */
+	static constexpr int32 FreeIdBatchSize = 64;
+	
+	virtual ~UDefaultFlecsNetworkIdGenerator() override;
+	
 	virtual FFlecsNetworkId GenerateNetworkId() override;
+	virtual void ReserveNetworkIdRange(int32 InCount, TArray<FFlecsNetworkId>& OutNetworkIds) override;
 	virtual bool ReleaseNetworkId(const FFlecsNetworkId& NetworkId) override;
 	virtual void ResetNetworkIdGenerator() override;
 	
+	virtual bool IsThreadSafe() const override
+	{
+		return true;
+	}
+	
+	/** Slots that were ever handed out, including the ones currently free. */
+	NO_DISCARD uint64 GetClaimedSlotCount() const
+	{
+		return NextFreshSlot.load(std::memory_order_relaxed);
+	}
+	
 protected:
-	UPROPERTY()
-	TArray<uint32> FreeSlotIds;
+	struct FFreeIdBatch
+	{
+		TArray<FFlecsNetworkId> NetworkIds;
+	}; // struct FFreeIdBatch
+	
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+	{
+		FCriticalSection Lock;
+		
+		TArray<FFlecsNetworkId> FreeIds;
+		
+		// Fresh slots claimed from NextFreshSlot that weren't handed out yet
+		uint64 NextSlot = 0;
+		uint64 EndSlot = 0;
+	}; // struct FShard
+	
+	NO_DISCARD FShard& GetCurrentThreadShard();
+	
+	/** Takes the next ID of the shard, refilling it from the shared pool or with fresh slots. Requires the shard's lock. */
+	NO_DISCARD FFlecsNetworkId TakeNetworkId(FShard& InShard);
+	
+	/** Claims InCount contiguous fresh slots, false once the slot space is exhausted. */
+	NO_DISCARD bool ClaimFreshSlots(uint64 InCount, uint64& OutFirstSlot);
+	
+	void EmptyFreeIdPool();
+	
+	TStaticArray<FShard, ShardCount> Shards;
+	
+	TLockFreePointerListUnordered<FFreeIdBatch, PLATFORM_CACHE_LINE_SIZE> FreeIdPool;
 	
-	UPROPERTY()
-	TArray<uint32> Generations;
+	std::atomic<uint64> NextFreshSlot { 0 };
 	
 }; // class UDefaultFlecsNetworkIdGenerator
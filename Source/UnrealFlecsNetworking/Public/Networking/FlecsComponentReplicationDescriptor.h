@@ -108,6 +108,7 @@ struct UNREALFLECSNETWORKING_API FFlecsComponentReplicationDescriptor
 	uint16 Alignment = 0;
 	
 	bool bIsTag = false;
+	bool bIsBitwiseComparable = false;
 	
 	TObjectPtr<UScriptStruct> ScriptStruct = nullptr;
 	
@@ -184,6 +185,12 @@ struct UNREALFLECSNETWORKING_API FFlecsComponentReplicationDescriptor
 		return Size > 0 && Alignment > 0 && !bIsTag;
 	}
 	
+	/**
+	 * Compares two values of the component, script structs use their identical operator,
+	 * native types without padding compare their memory and other native types compare their serialized bytes.
+	 */
+	NO_DISCARD bool AreValuesIdentical(const void* InValueA, const void* InValueB) const;
+	
 }; // struct FFlecsComponentReplicationDescriptor
 
 /**
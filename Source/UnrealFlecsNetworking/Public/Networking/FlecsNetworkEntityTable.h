@@ -0,0 +1,171 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Entities/FlecsEntityHandle.h"
+
+#include "Networking/FlecsNetworkId.h"
+#include "Networking/Layout/FlecsReplicationSnapshot.h"
+
+/** Replication state of one network ID, stored in the table slot of the ID. */
+struct FFlecsNetworkEntityRecord
+{
+	/** Network ID that owns the slot, invalid while the slot is empty. */
+	FFlecsNetworkId NetworkId;
+
+	/** Local entity of the network ID, invalid once it's removed. */
+	FFlecsEntityHandle Entity;
+
+	/** Latest published (authority) or accepted (client) snapshot, valid if bHasSnapshot is set. */
+	FFlecsEntityReplicationSnapshot Snapshot;
+
+	/** Revision of the removal, prevents a late snapshot from resurrecting the entity. Valid if bRemoved is set. */
+	uint32 RemovedRevision = 0;
+
+	bool bHasSnapshot = false;
+	bool bRemoved = false;
+
+	NO_DISCARD FORCEINLINE bool HasEntity() const
+	{
+		return Entity.IsValid();
+	}
+
+	NO_DISCARD FORCEINLINE const FFlecsEntityReplicationSnapshot* GetSnapshot() const
+	{
+		return bHasSnapshot ? &Snapshot : nullptr;
+	}
+
+}; // struct FFlecsNetworkEntityRecord
+
+/**
+ * Replication state of network entities indexed by the slot of their network ID.
+ *
+ * Records live in fixed size pages that are allocated on first use, so lookups are
+ * a shift and a mask, mass spawns never rehash or move records, and record references
+ * stay valid while other slots are claimed. A slot holds one generation at a time;
+ * a lookup with another generation of the slot finds nothing.
+ */
+class FFlecsNetworkEntityTable
+{
+public:
+	static constexpr uint32 PageBitCount = 10;
+	static constexpr uint32 PageSize = 1u << PageBitCount;
+	static constexpr uint32 PageMask = PageSize - 1u;
+
+	/** Record of the network ID, null if its slot is empty or owned by another generation. */
+	NO_DISCARD FORCEINLINE FFlecsNetworkEntityRecord* Find(const FFlecsNetworkId& InNetworkId)
+	{
+		FFlecsNetworkEntityRecord* Record = FindSlot(InNetworkId.GetSlot());
+		return (Record && Record->NetworkId == InNetworkId) ? Record : nullptr;
+	}
+
+	NO_DISCARD FORCEINLINE const FFlecsNetworkEntityRecord* Find(const FFlecsNetworkId& InNetworkId) const
+	{
+		return const_cast<FFlecsNetworkEntityTable*>(this)->Find(InNetworkId);
+	}
+
+	/** Record occupying the slot, whatever its generation. Null if the slot is empty. */
+	NO_DISCARD FORCEINLINE FFlecsNetworkEntityRecord* FindSlot(const uint32 InSlot)
+	{
+		const uint32 PageIndex = InSlot >> PageBitCount;
+		if (PageIndex >= static_cast<uint32>(Pages.Num()) || !Pages[PageIndex])
+		{
+			return nullptr;
+		}
+
+		FFlecsNetworkEntityRecord& Record = Pages[PageIndex][InSlot & PageMask];
+		return Record.NetworkId.IsValid() ? &Record : nullptr;
+	}
+
+	NO_DISCARD FORCEINLINE const FFlecsNetworkEntityRecord* FindSlot(const uint32 InSlot) const
+	{
+		return const_cast<FFlecsNetworkEntityTable*>(this)->FindSlot(InSlot);
+	}
+
+	/** Record of the network ID, claims the slot if it's empty or owned by another generation. */
+	FFlecsNetworkEntityRecord& FindOrAdd(const FFlecsNetworkId& InNetworkId)
+	{
+		solid_checkf(InNetworkId.IsValid(), TEXT("Cannot add an invalid network ID to the network entity table"));
+
+		const uint32 Slot = InNetworkId.GetSlot();
+		const uint32 PageIndex = Slot >> PageBitCount;
+
+		if (PageIndex >= static_cast<uint32>(Pages.Num()))
+		{
+			Pages.SetNum(PageIndex + 1);
+		}
+
+		if (!Pages[PageIndex])
+		{
+			Pages[PageIndex] = MakeUnique<FFlecsNetworkEntityRecord[]>(PageSize);
+		}
+
+		FFlecsNetworkEntityRecord& Record = Pages[PageIndex][Slot & PageMask];
+		if (Record.NetworkId == InNetworkId)
+		{
+			return Record;
+		}
+
+		if (!Record.NetworkId.IsValid())
+		{
+			++RecordCount;
+		}
+
+		Record = FFlecsNetworkEntityRecord();
+		Record.NetworkId = InNetworkId;
+		return Record;
+	}
+
+	/** Empties the slot of the network ID, does nothing if the slot is owned by another generation. */
+	bool Remove(const FFlecsNetworkId& InNetworkId)
+	{
+		FFlecsNetworkEntityRecord* Record = Find(InNetworkId);
+		if (!Record)
+		{
+			return false;
+		}
+
+		*Record = FFlecsNetworkEntityRecord();
+		--RecordCount;
+		return true;
+	}
+
+	/** Calls InFunction for every occupied slot in slot order. */
+	template <typename FunctionType>
+	void ForEach(FunctionType&& InFunction) const
+	{
+		for (const TUniquePtr<FFlecsNetworkEntityRecord[]>& Page : Pages)
+		{
+			if (!Page)
+			{
+				continue;
+			}
+
+			for (uint32 Index = 0; Index < PageSize; ++Index)
+			{
+				if (Page[Index].NetworkId.IsValid())
+				{
+					InFunction(Page[Index]);
+				}
+			}
+		}
+	}
+
+	NO_DISCARD int32 Num() const
+	{
+		return RecordCount;
+	}
+
+	void Reset()
+	{
+		Pages.Reset();
+		RecordCount = 0;
+	}
+
+private:
+	TArray<TUniquePtr<FFlecsNetworkEntityRecord[]>> Pages;
+	int32 RecordCount = 0;
+
+}; // class FFlecsNetworkEntityTable
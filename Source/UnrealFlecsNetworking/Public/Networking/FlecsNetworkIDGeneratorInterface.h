@@ -30,7 +30,25 @@ class UNREALFLECSNETWORKING_API IFlecsNetworkIDGeneratorInterface
 public:
 
 	virtual NO_DISCARD FFlecsNetworkId GenerateNetworkId() = 0;
+	
+	/** Appends InCount new network IDs to OutNetworkIds, used to register a batch of entities at once. */
+	virtual void ReserveNetworkIdRange(const int32 InCount, TArray<FFlecsNetworkId>& OutNetworkIds)
+	{
+		OutNetworkIds.Reserve(OutNetworkIds.Num() + InCount);
+		
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			OutNetworkIds.Add(GenerateNetworkId());
+		}
+	}
+	
 	virtual bool ReleaseNetworkId(const FFlecsNetworkId& NetworkId) = 0;
 	virtual void ResetNetworkIdGenerator() = 0;
+	
+	/** Whether IDs can be generated and released from any thread at the same time. */
+	virtual NO_DISCARD bool IsThreadSafe() const
+	{
+		return false;
+	}
 
 }; // class IFlecsNetworkIDGeneratorInterface
@@ -28,4 +28,53 @@ public:
 	UPROPERTY(EditAnywhere, Config, meta = (AllowAbstract = false))
 	TSubclassOf<UFlecsReplicationBridgeBase> ReplicationBridgeClass;
 	
+	/**
+	 * @brief Time a client may spend applying received snapshots per frame, 0 applies everything that was received.
+	 * Updates that don't fit stay queued for the next frame, at least one batch is applied every frame.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication",
+		meta = (ClampMin = "0", UIMin = "0", ForceUnits = "s"))
+	double ReplicationApplyTimeBudget = 0.0;
+	
+	/** Maximum number of snapshots of one layout that are created or updated together. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (ClampMin = "1", UIMin = "1"))
+	int32 ReplicationApplyBatchSize = 256;
+	
+	/**
+	 * Entities one table shard (UFlecsNetEntityTable) carries, a full table makes the bridge open another one.
+	 * Each entity is a Fast Array item, so only the entities that changed are sent.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (ClampMin = "1", UIMin = "1"))
+	int32 MaxEntitiesPerTableShard = 512;
+	
+	/** Detached shards of one class the bridge keeps for reuse, 0 destroys every shard that runs empty. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (ClampMin = "0", UIMin = "0"))
+	int32 RecycledShardPoolSize = 1024;
+	
+	/**
+	 * Bytes of snapshots each client connection may be sent per publish, 0 publishes every dirty entity.
+	 * Dirty entities are published by their score (profile priority, distance to the connection's view target
+	 * and the publishes they already missed), the ones that don't fit stay dirty for the next publish.
+	 * Snapshots are shared by every connection an entity is relevant to, so an entity is only published
+	 * once it fits the remaining budget of all of them.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication|Prioritization", meta = (ClampMin = "0", UIMin = "0"))
+	int32 ReplicationByteBudgetPerConnection = 0;
+	
+	/** Distance from a view target at which an entity's score is halved. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication|Prioritization", meta = (ClampMin = "1", UIMin = "1", ForceUnits = "cm"))
+	float ReplicationPriorityDistanceScale = 5000.f;
+	
+	/**
+	 * Collects replication cost counters (bytes per component, dirty entities per layout, snapshot build and
+	 * apply time, shard occupancy) into Flecs stats entities, CSV stats and Insights counters.
+	 * Can also be toggled at runtime through UFlecsNetworkWorldSubsystem::SetReplicationStatsEnabled.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication|Stats")
+	bool bEnableReplicationStats = false;
+	
+	/** Number of frames each predicted entity keeps, a snapshot older than that is always treated as a misprediction. */
+	UPROPERTY(EditAnywhere, Config, Category = "Prediction", meta = (ClampMin = "1", UIMin = "1"))
+	int32 PredictionHistoryLength = 64;
+	
 }; // class UFlecsNetworkingModuleSettings
@@ -8,7 +8,10 @@
 
 #include "FlecsPredictedEntityTag.generated.h"
 
-// @TODO: Not implemented
+/**
+ * Marks a received entity as predicted by this client, its state is recorded every frame and received
+ * snapshots are checked against it instead of overwriting it, see UFlecsPredictionWorldSubsystem.
+ */
 USTRUCT(BlueprintType)
 struct UNREALFLECSNETWORKING_API FFlecsPredictedEntityTag
 {
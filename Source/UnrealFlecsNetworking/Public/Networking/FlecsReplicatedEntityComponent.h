@@ -23,6 +23,11 @@ struct UNREALFLECSNETWORKING_API FFlecsReplicatedEntityComponent
 	GENERATED_BODY()
 	
 public:
+	/** Number of dirty bits handed out to replicated components, later components share the last one. */
+	static constexpr uint8 ComponentDirtyBitCount = 63;
+	
+	/** Dirty bit for changes that concern the whole entity (replication start, profile changes). */
+	static constexpr uint64 EntityDirtyMask = 1ull << 63;
 
 	// @TODO:
 	/*UPROPERTY()
@@ -36,4 +41,14 @@ public:
 	UPROPERTY()
 	FName ProfileId = NAME_None;
 	
+	/**
+	 * Replicated components written since the entity was last published, one bit per
+	 * component dirty observer. Lives in the component so marking a write never moves
+	 * the entity to another table.
+	 */
+	uint64 DirtyComponentMask = 0;
+	
+	/** Publishes the entity was dirty for but didn't fit the byte budgets, raises its score until it's published. */
+	uint16 DeferredPublishCount = 0;
+	
 }; // struct FFlecsReplicatedEntityComponent
@@ -0,0 +1,65 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Entities/FlecsEntityHandle.h"
+
+/**
+ * A client connection as seen by the prioritization stage of PublishDirtyReplicatedEntities.
+ * Gathered from the net driver's client connections before every publish.
+ */
+struct FFlecsReplicationViewer
+{
+	FVector ViewLocation = FVector::ZeroVector;
+	
+	/** Bytes of snapshots the connection may be sent per publish, 0 or less is unbudgeted. */
+	int32 ByteBudget = 0;
+	
+	NO_DISCARD FORCEINLINE bool HasByteBudget() const
+	{
+		return ByteBudget > 0;
+	}
+
+}; // struct FFlecsReplicationViewer
+
+/** A dirty entity competing for the byte budgets of the viewers. */
+struct FFlecsReplicationPriorityCandidate
+{
+	FFlecsEntityHandle EntityHandle;
+	
+	FVector Location = FVector::ZeroVector;
+	bool bHasLocation = false;
+	
+	/** 0 is relevant at any distance. */
+	double CullDistanceSquared = 0.0;
+	
+	/** Profile priority scaled by the publishes the entity already missed. */
+	float Weight = 1.f;
+	
+	/** Highest score of the entity for any viewer it's relevant to. */
+	float Score = 0.f;
+	
+	/** Estimated bytes charged to every viewer the entity is relevant to. */
+	int32 Cost = 0;
+	
+	NO_DISCARD FORCEINLINE bool IsRelevantTo(const FFlecsReplicationViewer& InViewer) const
+	{
+		return !bHasLocation || CullDistanceSquared <= 0.0
+			|| FVector::DistSquared(Location, InViewer.ViewLocation) <= CullDistanceSquared;
+	}
+	
+	/** Weight falling off with the distance to the viewer, halved at InDistanceScale. */
+	NO_DISCARD FORCEINLINE float GetScoreFor(const FFlecsReplicationViewer& InViewer, const float InDistanceScale) const
+	{
+		if (!bHasLocation)
+		{
+			return Weight;
+		}
+		
+		const double Distance = FVector::Dist(Location, InViewer.ViewLocation);
+		return Weight * static_cast<float>(InDistanceScale / (InDistanceScale + Distance));
+	}
+
+}; // struct FFlecsReplicationPriorityCandidate
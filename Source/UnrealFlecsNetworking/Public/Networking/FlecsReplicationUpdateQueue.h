@@ -24,7 +24,6 @@ public:
 	void EnqueueSnapshot(const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot)
 	{
 		FFlecsReplicationQueuedUpdate* ExistingUpdate = FindPendingUpdate(InNetworkId);
-		
 		if (ExistingUpdate)
 		{
 			if (ExistingUpdate->StateRevision > InSnapshot.StateRevision)
@@ -38,6 +37,8 @@ public:
 			return;
 		}
 
+		UpdateIndices.Add(InNetworkId, Updates.Num());
+
 		FFlecsReplicationQueuedUpdate& Update = Updates.Emplace_GetRef();
 		Update.NetworkId = InNetworkId;
 		Update.Snapshot = InSnapshot;
@@ -61,6 +62,8 @@ public:
 			return;
 		}
 
+		UpdateIndices.Add(InNetworkId, Updates.Num());
+
 		FFlecsReplicationQueuedUpdate& Update = Updates.Emplace_GetRef();
 		Update.NetworkId = InNetworkId;
 		Update.StateRevision = InStateRevision;
@@ -69,9 +72,52 @@ public:
 
 	NO_DISCARD TArray<FFlecsReplicationQueuedUpdate> Drain()
 	{
+		UpdateIndices.Reset();
 		return MoveTemp(Updates);
 	}
 
+	/**
+	 * Puts drained updates that weren't applied back in front of the updates queued in the meantime,
+	 * a newer update of the same network ID still wins.
+	 */
+	void Requeue(TArray<FFlecsReplicationQueuedUpdate>&& InUpdates)
+	{
+		if (!Updates.IsEmpty())
+		{
+			InUpdates.RemoveAll([this](FFlecsReplicationQueuedUpdate& InUpdate)
+			{
+				FFlecsReplicationQueuedUpdate* QueuedUpdate = FindPendingUpdate(InUpdate.NetworkId);
+				if (!QueuedUpdate)
+				{
+					return false;
+				}
+
+				if (QueuedUpdate->StateRevision < InUpdate.StateRevision)
+				{
+					*QueuedUpdate = MoveTemp(InUpdate);
+				}
+
+				return true;
+			});
+		}
+
+		if (InUpdates.IsEmpty())
+		{
+			return;
+		}
+
+		InUpdates.Append(MoveTemp(Updates));
+		Updates = MoveTemp(InUpdates);
+
+		UpdateIndices.Reset();
+		UpdateIndices.Reserve(Updates.Num());
+
+		for (int32 Index = 0; Index < Updates.Num(); ++Index)
+		{
+			UpdateIndices.Add(Updates[Index].NetworkId, Index);
+		}
+	}
+
 	NO_DISCARD int32 Num() const
 	{
 		return Updates.Num();
@@ -80,18 +126,19 @@ public:
 	void Reset()
 	{
 		Updates.Reset();
+		UpdateIndices.Reset();
 	}
 
 private:
 	NO_DISCARD FFlecsReplicationQueuedUpdate* FindPendingUpdate(const FFlecsNetworkId& InNetworkId)
 	{
-		return Updates.FindByPredicate(
-			[&InNetworkId](const FFlecsReplicationQueuedUpdate& InUpdate)
-			{
-				return InUpdate.NetworkId == InNetworkId;
-			});
+		const int32* Index = UpdateIndices.Find(InNetworkId);
+		return Index ? &Updates[*Index] : nullptr;
 	}
 
 	TArray<FFlecsReplicationQueuedUpdate> Updates;
 
+	/** Index of the pending update of each network ID in Updates */
+	TMap<FFlecsNetworkId, int32> UpdateIndices;
+
 }; // class FFlecsReplicationUpdateQueue
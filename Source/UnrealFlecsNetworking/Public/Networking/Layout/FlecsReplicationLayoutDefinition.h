@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "FlecsReplicationLayoutHandle.h"
 #include "FlecsReplicationLayoutId.h"
 #include "Networking/FlecsReplicationKey.h"
 
@@ -18,7 +19,23 @@ struct UNREALFLECSNETWORKING_API FFlecsReplicationLayoutDefinition
 	UPROPERTY()
 	FFlecsReplicationLayoutId LayoutId;
 
+	/** Compact reference assigned by the authority, snapshots refer to the layout through it. */
+	UPROPERTY()
+	FFlecsReplicationLayoutHandle Handle;
+
 	UPROPERTY()
 	TArray<FFlecsReplicationKey> Keys;
 	
+	/**
+	 * Prefab the entities of the layout are instances of, if it has a stable identity.
+	 * Snapshots of such a layout leave out the values that are equal to the prefab's, receivers reset them from their own prefab.
+	 */
+	UPROPERTY()
+	FFlecsReplicationIndividualKey Baseline;
+	
+	NO_DISCARD FORCEINLINE bool HasBaseline() const
+	{
+		return Baseline.Kind != EFlecsReplicationPairTargetKind::None;
+	}
+	
 }; // struct FFlecsReplicationLayoutDefinition
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+#include "Iris/Serialization/NetSerializer.h"
+#include "Iris/Serialization/NetSerializerConfig.h"
+
+#include "FlecsReplicationLayoutHandle.generated.h"
+
+/**
+ * Compact reference to a replication layout, assigned by the authority in registration order.
+ *
+ * Snapshots carry the handle instead of the 16 byte layout ID. The layout dictionary
+ * replicates the handle together with the full definition, so receivers map it back
+ * to the deterministic layout ID once per layout.
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsReplicationLayoutHandle
+{
+	GENERATED_BODY()
+	
+	friend uint32 GetTypeHash(const FFlecsReplicationLayoutHandle& Handle)
+	{
+		return GetTypeHash(Handle.Value);
+	}
+	
+public:
+	FFlecsReplicationLayoutHandle() = default;
+	explicit FFlecsReplicationLayoutHandle(const uint32 InValue)
+		: Value(InValue)
+	{
+	}
+	
+	NO_DISCARD bool IsValid() const
+	{
+		return Value != 0;
+	}
+	
+	NO_DISCARD FString ToString() const
+	{
+		return FString::Printf(TEXT("#%u"), Value);
+	}
+	
+	friend bool operator==(const FFlecsReplicationLayoutHandle&, const FFlecsReplicationLayoutHandle&) = default;
+	
+	/** 0 is invalid */
+	UPROPERTY()
+	uint32 Value = 0;
+	
+}; // struct FFlecsReplicationLayoutHandle
+
+USTRUCT()
+struct FFlecsReplicationLayoutHandleNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+}; // struct FFlecsReplicationLayoutHandleNetSerializerConfig
+
+namespace UE::Net
+{
+	/** Writes layout handles as variable length integers, small handles take a single byte on the wire. */
+	UE_NET_DECLARE_SERIALIZER(FFlecsReplicationLayoutHandleNetSerializer, UNREALFLECSNETWORKING_API);
+} // namespace UE::Net
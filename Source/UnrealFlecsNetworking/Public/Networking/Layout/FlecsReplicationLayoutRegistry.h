@@ -30,6 +30,9 @@ public:
 	/** Computes the deterministic layout ID from a sorted key list. */
 	static NO_DISCARD FFlecsReplicationLayoutId ComputeLayoutId(const TArray<FFlecsReplicationKey>& Keys);
 	
+	/** Computes the deterministic layout ID of a definition's sorted keys and baseline. */
+	static NO_DISCARD FFlecsReplicationLayoutId ComputeLayoutId(const FFlecsReplicationLayoutDefinition& Definition);
+	
 	/** Builds or reuses a local layout for Entity's current Flecs table. */
 	TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> BuildForEntity(
 		const TSolidNotNull<const UFlecsWorldInterfaceObject*> World,
@@ -41,6 +44,15 @@ public:
 	/** Finds a previously generated or accepted layout definition. */
 	NO_DISCARD const FFlecsReplicationLayoutDefinition* Find(FFlecsReplicationLayoutId Id) const;
 	
+	/** Every generated or accepted layout definition, by layout ID. */
+	NO_DISCARD FORCEINLINE const TMap<FFlecsReplicationLayoutId, FFlecsReplicationLayoutDefinition>& GetDefinitions() const
+	{
+		return Definitions;
+	}
+	
+	/** Maps a compact handle to its layout ID, invalid if the dictionary entry hasn't been received yet. */
+	NO_DISCARD FFlecsReplicationLayoutId FindLayoutId(FFlecsReplicationLayoutHandle Handle) const;
+	
 	/** Adds an already validated remote layout, rejecting identity collisions. */
 	TValueOrError<bool, FString> AddRemoteDefinition(const FFlecsReplicationLayoutDefinition& Definition,
 		const UFlecsWorldInterfaceObject* World);
@@ -58,6 +70,16 @@ private:
 	
 	TArray<FFlecsReplicationLayoutDefinition> PendingLayouts;
 	
+	TMap<FFlecsReplicationLayoutHandle, FFlecsReplicationLayoutId> HandleToLayoutId;
+	uint32 NextHandleValue = 1;
+	
+	static NO_DISCARD FFlecsReplicationLayoutId ComputeLayoutIdFromCanonicalKeys(TConstArrayView<FString> CanonicalKeys);
+	
+	/** Canonical string hashed after the keys of a layout with a baseline, so the same keys with another prefab are another layout. */
+	static NO_DISCARD FString GetBaselineCanonicalString(const FFlecsReplicationIndividualKey& Baseline);
+	
+	void RegisterRemoteHandle(const FFlecsReplicationLayoutDefinition& Definition);
+	
 	void AddPendingLayout(const FFlecsReplicationLayoutDefinition& Definition);
 	
 	NO_DISCARD bool ValidateLayoutDefinition(const FFlecsReplicationLayoutDefinition& Definition,
@@ -6,6 +6,7 @@
 
 #include "Iris/Serialization/NetSerializerConfig.h"
 
+#include "FlecsReplicationLayoutHandle.h"
 #include "FlecsReplicationLayoutId.h"
 #include "Networking/FlecsReplicationKey.h"
 #include "Iris/Serialization/NetSerializer.h"
@@ -37,9 +38,13 @@ struct UNREALFLECSNETWORKING_API FFlecsEntityReplicationSnapshot
 	GENERATED_BODY()
 	
 public:
-	UPROPERTY()
+	/** Resolved from LayoutHandle on receivers, the full ID is only exchanged through the layout dictionary. */
+	UPROPERTY(NotReplicated)
 	FFlecsReplicationLayoutId LayoutId;
 	
+	UPROPERTY()
+	FFlecsReplicationLayoutHandle LayoutHandle;
+	
 	UPROPERTY()
 	TArray<FFlecsReplicatedPackedValue> PackedValues;
 	
@@ -49,9 +54,33 @@ public:
 	UPROPERTY()
 	uint32 StateRevision = 0;
 	
+	NO_DISCARD bool HasLayout() const
+	{
+		return LayoutId.IsValid() || LayoutHandle.IsValid();
+	}
+	
+	/** Rough size of the snapshot on the wire, charged against the byte budgets of the connections it's sent to. */
+	NO_DISCARD int32 GetEstimatedNetSize() const
+	{
+		return static_cast<int32>(sizeof(StateRevision) + sizeof(FFlecsReplicationLayoutHandle)
+			+ PackedValues.Num() * sizeof(FFlecsReplicatedPackedValue)) + PayloadData.Num();
+	}
+	
 	// Increments StateRevision
 	void FillFromEntity(const FFlecsEntityHandle& InEntityHandle, const FFlecsReplicationLayoutRegistry& InLayoutRegistry);
 	
+	/**
+	 * @brief Like FillFromEntity, but only serializes the values InIsValueDirty returns true for (by component ID).
+	 * The other values keep their payload and revision from the previous fill, which has to be of the same layout,
+	 * otherwise every value is serialized.
+	 */
+	void FillDirtyFromEntity(const FFlecsEntityHandle& InEntityHandle, const FFlecsReplicationLayoutRegistry& InLayoutRegistry,
+		const TFunctionRef<bool(FFlecsId)>& InIsValueDirty);
+	
+private:
+	void FillFromEntity_Internal(const FFlecsEntityHandle& InEntityHandle, const FFlecsReplicationLayoutRegistry& InLayoutRegistry,
+		const TFunctionRef<bool(FFlecsId)>* InIsValueDirty);
+	
 }; // struct FFlecsEntityReplicationSnapshot
 
 USTRUCT()
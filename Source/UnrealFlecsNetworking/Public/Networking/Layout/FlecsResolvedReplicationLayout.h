@@ -0,0 +1,44 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Entities/FlecsId.h"
+
+struct FFlecsComponentReplicationDescriptor;
+struct FFlecsReplicationLayoutDefinition;
+
+/** One layout key resolved against the local world. */
+struct FFlecsResolvedReplicationKey
+{
+	/** Local component or pair id, invalid if the key couldn't be resolved (e.g. a pair target that hasn't arrived yet). */
+	FFlecsId ComponentId;
+
+	/** Descriptor of the stored value, null for keys without a deserializable payload. */
+	const FFlecsComponentReplicationDescriptor* Descriptor = nullptr;
+
+}; // struct FFlecsResolvedReplicationKey
+
+/**
+ * Local ids of a replication layout, resolved once and shared by every snapshot
+ * of a batch that uses the layout. Keys are indexed like the layout definition.
+ */
+struct FFlecsResolvedReplicationLayout
+{
+	const FFlecsReplicationLayoutDefinition* Definition = nullptr;
+
+	TArray<FFlecsResolvedReplicationKey> Keys;
+
+	/** Number of keys with a valid component id and descriptor. */
+	int32 ValueCount = 0;
+
+	/** Local prefab the layout's values are relative to, invalid if the layout has no baseline. */
+	FFlecsId BaselineId;
+
+	NO_DISCARD FORCEINLINE bool IsValid() const
+	{
+		return Definition != nullptr;
+	}
+
+}; // struct FFlecsResolvedReplicationLayout
@@ -0,0 +1,25 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Pipelines/FlecsGameLoopObject.h"
+
+#include "FlecsPredictionGameLoop.generated.h"
+
+/**
+ * Resimulates mispredicted entities after the main loop progressed, add it to the world's game loops
+ * after the main loop. The resimulation pipeline can't run from inside the frame that applied the snapshots.
+ */
+UCLASS(BlueprintType)
+class UNREALFLECSNETWORKING_API UFlecsPredictionGameLoop final : public UFlecsGameLoopObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool Progress(double DeltaTime, const FGameplayTag& InTickType, TSolidNotNull<UFlecsWorld*> InWorld) override;
+	
+	virtual TArray<FGameplayTag> GetTickTypeTags() const override;
+	
+}; // class UFlecsPredictionGameLoop
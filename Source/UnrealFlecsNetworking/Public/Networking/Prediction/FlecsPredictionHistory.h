@@ -0,0 +1,109 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Networking/Layout/FlecsReplicationSnapshot.h"
+
+/**
+ * Ring buffer of the predicted states of one entity, keyed by the StateRevision the server
+ * snapshot of the same frame will have. Frames are stored as snapshots of the entity's applied
+ * layout, so they compare byte for byte against received snapshots and reuse their payload storage.
+ */
+class FFlecsPredictionHistory
+{
+public:
+	explicit FFlecsPredictionHistory(const int32 InCapacity)
+	{
+		Frames.SetNum(FMath::Max(InCapacity, 1));
+	}
+
+	NO_DISCARD FORCEINLINE bool IsEmpty() const
+	{
+		return !bHasFrames;
+	}
+
+	NO_DISCARD FORCEINLINE int32 GetCapacity() const
+	{
+		return Frames.Num();
+	}
+
+	NO_DISCARD FORCEINLINE uint32 GetLatestRevision() const
+	{
+		return LatestRevision;
+	}
+
+	/** Frame of the revision, null if it was never recorded, fell out of the buffer or was rewound past. */
+	NO_DISCARD const FFlecsEntityReplicationSnapshot* Find(const uint32 InRevision) const
+	{
+		if (!bHasFrames || InRevision > LatestRevision || LatestRevision - InRevision >= static_cast<uint32>(Frames.Num()))
+		{
+			return nullptr;
+		}
+
+		const FFlecsEntityReplicationSnapshot& Frame = Frames[InRevision % Frames.Num()];
+		return Frame.StateRevision == InRevision ? &Frame : nullptr;
+	}
+
+	/** Makes the revision the latest frame, frames after it are dropped and recorded again when they're predicted. */
+	FFlecsEntityReplicationSnapshot& Rewind(const uint32 InRevision)
+	{
+		bHasFrames = true;
+		LatestRevision = InRevision;
+		return Frames[InRevision % Frames.Num()];
+	}
+
+	/**
+	 * Claims the frame after the latest one, filling it from the entity increments its StateRevision to the new latest revision.
+	 * @pre The history isn't empty.
+	 */
+	FFlecsEntityReplicationSnapshot& Advance()
+	{
+		solid_checkf(bHasFrames, TEXT("Cannot advance an empty prediction history"));
+
+		const FFlecsReplicationLayoutId LayoutId = Frames[LatestRevision % Frames.Num()].LayoutId;
+
+		FFlecsEntityReplicationSnapshot& Frame = Frames[(LatestRevision + 1) % Frames.Num()];
+		Frame.LayoutId = LayoutId;
+		Frame.StateRevision = LatestRevision;
+
+		++LatestRevision;
+		return Frame;
+	}
+
+private:
+	TArray<FFlecsEntityReplicationSnapshot> Frames;
+	uint32 LatestRevision = 0;
+	bool bHasFrames = false;
+
+}; // class FFlecsPredictionHistory
+
+/** Counters of the prediction subsystem, accumulated since the world was initialized. */
+struct FFlecsPredictionStats
+{
+	/** Server snapshots that matched the predicted frame of their revision. */
+	int32 ConfirmedSnapshotCount = 0;
+
+	/** Server snapshots that didn't match and were applied over the prediction. */
+	int32 MispredictedSnapshotCount = 0;
+
+	/** Calls to ResimulatePendingRollbacks that resimulated at least one entity. */
+	int32 RollbackCount = 0;
+
+	/** Runs of the resimulation pipeline. */
+	int32 ResimulatedFrameCount = 0;
+
+	/** Sum of the entities that were resimulated in every run of the resimulation pipeline. */
+	int64 ResimulatedEntityFrameCount = 0;
+
+	double LastRollbackSeconds = 0.0;
+	double TotalRollbackSeconds = 0.0;
+
+	NO_DISCARD FORCEINLINE double GetMispredictionRate() const
+	{
+		const int32 SnapshotCount = ConfirmedSnapshotCount + MispredictedSnapshotCount;
+		return SnapshotCount > 0 ? static_cast<double>(MispredictedSnapshotCount) / SnapshotCount : 0.0;
+	}
+
+}; // struct FFlecsPredictionStats
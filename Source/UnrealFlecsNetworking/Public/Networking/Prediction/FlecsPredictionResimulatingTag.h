@@ -0,0 +1,28 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsPredictionResimulatingTag.generated.h"
+
+/**
+ * Present on predicted entities while they're resimulated after a misprediction,
+ * resimulation systems query it so they only advance the entities that are rolled back.
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsPredictionResimulatingTag
+{
+	GENERATED_BODY()
+	
+	static constexpr bool DontFragment = true;
+	
+}; // struct FFlecsPredictionResimulatingTag
+
+template <>
+struct TFlecsComponentTraits<FFlecsPredictionResimulatingTag> : public TFlecsComponentTraitsBase<FFlecsPredictionResimulatingTag>
+{
+	static constexpr bool DontFragment = true;
+}; // struct TFlecsComponentTraits<FFlecsPredictionResimulatingTag>
@@ -0,0 +1,21 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsPredictionSystemTag.generated.h"
+
+/** Marks a system as part of the prediction resimulation pipeline, see UFlecsPredictionWorldSubsystem. */
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsPredictionSystemTag
+{
+	GENERATED_BODY()
+}; // struct FFlecsPredictionSystemTag
+
+template <>
+struct TFlecsComponentTraits<FFlecsPredictionSystemTag> : public TFlecsComponentTraitsBase<FFlecsPredictionSystemTag>
+{
+}; // struct TFlecsComponentTraits<FFlecsPredictionSystemTag>
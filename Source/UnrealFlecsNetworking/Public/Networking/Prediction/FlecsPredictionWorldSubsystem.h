@@ -0,0 +1,109 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Observers/FlecsObserverHandle.h"
+#include "Pipelines/FlecsPipelineHandle.h"
+#include "Systems/FlecsSystemHandle.h"
+#include "Worlds/FlecsAbstractWorldSubsystem.h"
+
+#include "Networking/Prediction/FlecsPredictionHistory.h"
+
+#include "FlecsPredictionWorldSubsystem.generated.h"
+
+class UFlecsNetworkWorldSubsystem;
+
+/**
+ * Client-side prediction and rollback of entities with FFlecsPredictedEntityTag.
+ *
+ * Every frame the state of each predicted entity is recorded into its history under the
+ * StateRevision the server will give the same frame. A received snapshot is compared against
+ * the history: a match is dropped so the prediction stays ahead of the server, a mismatch is
+ * applied and the entity is rolled forward again by running the resimulation pipeline
+ * (systems with FFlecsPredictionSystemTag) once per predicted frame, with only the mispredicted
+ * entities carrying FFlecsPredictionResimulatingTag.
+ *
+ * Assumes the authority publishes predicted entities once per simulation frame and both sides
+ * step at the same fixed rate, so one StateRevision is one frame.
+ */
+UCLASS()
+class UNREALFLECSNETWORKING_API UFlecsPredictionWorldSubsystem : public UFlecsAbstractWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnFlecsWorldInitialized(const TSolidNotNull<UFlecsWorld*> InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Adds the system to the resimulation pipeline and takes it out of the main loop. */
+	void AddResimulationSystem(const FFlecsSystemHandle& InSystem) const;
+
+	/**
+	 * Records the current state of a predicted entity as its next frame, ran by the record system after the simulation phases.
+	 * The first frame of an entity starts from the latest snapshot accepted for its network ID.
+	 */
+	void RecordPredictedEntity(const FFlecsEntityHandle& InEntityHandle);
+
+	/**
+	 * Compares a received snapshot of a predicted entity against the frame of the same revision.
+	 * A mismatch replaces the frame with the snapshot and queues the entity for resimulation.
+	 * @return true if the prediction matched and the snapshot doesn't need to be applied.
+	 */
+	NO_DISCARD bool ConfirmPredictedSnapshot(const FFlecsEntityHandle& InEntityHandle,
+		const FFlecsEntityReplicationSnapshot& InSnapshot);
+
+	/**
+	 * Rolls mispredicted entities forward to their latest predicted frame, has to run outside of the world's progress.
+	 * Ran after the main loop by UFlecsPredictionGameLoop.
+	 */
+	void ResimulatePendingRollbacks(double DeltaTime);
+
+	NO_DISCARD const FFlecsPredictionHistory* FindPredictionHistory(const FFlecsEntityHandle& InEntityHandle) const
+	{
+		return PredictionHistories.Find(InEntityHandle);
+	}
+
+	NO_DISCARD int32 GetPendingRollbackCount() const
+	{
+		return PendingRollbacks.Num();
+	}
+
+	NO_DISCARD FORCEINLINE const FFlecsPredictionStats& GetPredictionStats() const
+	{
+		return PredictionStats;
+	}
+
+	NO_DISCARD FORCEINLINE const FFlecsPipelineHandle& GetResimulationPipeline() const
+	{
+		return ResimulationPipeline;
+	}
+
+protected:
+	NO_DISCARD FFlecsPredictionHistory& FindOrAddPredictionHistory(const FFlecsEntityHandle& InEntityHandle);
+
+	UPROPERTY()
+	TObjectPtr<UFlecsNetworkWorldSubsystem> NetworkSubsystem;
+
+	UPROPERTY()
+	FFlecsPipelineHandle ResimulationPipeline;
+
+	UPROPERTY()
+	FFlecsSystemHandle RecordSystem;
+
+	UPROPERTY()
+	FFlecsObserverHandle PredictedEntityRemovedObserver;
+
+	TMap<FFlecsEntityHandle, FFlecsPredictionHistory> PredictionHistories;
+
+	// Mispredicted entities and the revision they're resimulated up to.
+	TMap<FFlecsEntityHandle, uint32> PendingRollbacks;
+
+	// Reused while resimulating.
+	TArray<TPair<FFlecsEntityHandle, uint32>> ResimulatingEntities;
+
+	FFlecsPredictionStats PredictionStats;
+
+}; // class UFlecsPredictionWorldSubsystem
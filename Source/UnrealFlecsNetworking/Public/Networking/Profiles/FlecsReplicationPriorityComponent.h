@@ -0,0 +1,37 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Properties/FlecsComponentProperties.h"
+
+#include "FlecsReplicationPriorityComponent.generated.h"
+
+/** Weight of an entity's score when dirty entities compete for the byte budget of a connection. */
+USTRUCT()
+struct FFlecsReplicationPriorityComponent
+{
+	GENERATED_BODY()
+	
+public:
+	UPROPERTY(EditAnywhere, Category = "Replication")
+	float Priority = 1.f;
+	
+	NO_DISCARD bool operator==(const FFlecsReplicationPriorityComponent& Other) const
+	{
+		return Priority == Other.Priority;
+	}
+	
+	NO_DISCARD bool operator!=(const FFlecsReplicationPriorityComponent& Other) const
+	{
+		return !(*this == Other);
+	}
+	
+}; // struct FFlecsReplicationPriorityComponent
+
+template <>
+struct TFlecsComponentTraits<FFlecsReplicationPriorityComponent> : public TFlecsComponentTraitsBase<FFlecsReplicationPriorityComponent>
+{
+	static constexpr EFlecsOnInstantiate OnInstantiate = EFlecsOnInstantiate::Inherit;
+}; // struct TFlecsComponentTraits<FFlecsReplicationPriorityComponent>
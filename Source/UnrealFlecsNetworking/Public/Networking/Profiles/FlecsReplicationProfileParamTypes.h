@@ -56,6 +56,36 @@ public:
 	
 }; // struct FFlecsReplicationProfileUpdateRate
 
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsReplicationProfilePriority : public FFlecsReplicationProfileParamsBase
+{
+	GENERATED_BODY()
+	
+public:
+	FFlecsReplicationProfilePriority() = default;
+	FFlecsReplicationProfilePriority(const float InPriority)
+		: Priority(InPriority)
+	{
+	}
+	
+	/** Relative weight against other profiles when dirty entities compete for a connection's byte budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication", meta = (ClampMin = "0", UIMin = "0"))
+	float Priority = 1.f;
+	
+	NO_DISCARD bool operator==(const FFlecsReplicationProfilePriority& Other) const
+	{
+		return Priority == Other.Priority;
+	}
+	
+	NO_DISCARD bool operator!=(const FFlecsReplicationProfilePriority& Other) const
+	{
+		return !(*this == Other);
+	}
+	
+	virtual void ApplyToEntity(const FFlecsEntityHandle& InEntity) const override;
+	
+}; // struct FFlecsReplicationProfilePriority
+
 USTRUCT(BlueprintType)
 struct UNREALFLECSNETWORKING_API FFlecsReplicationProfileAlwaysRelevant : public FFlecsReplicationProfileParamsBase
 {
@@ -0,0 +1,104 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Serialization/MemoryReader.h"
+
+#include "Networking/FlecsNetworkId.h"
+#include "Networking/Layout/FlecsReplicationLayoutDefinition.h"
+#include "Networking/Layout/FlecsReplicationSnapshot.h"
+
+enum class EFlecsReplicationRecordType : uint8
+{
+	Layout,
+	Snapshot,
+	Removal,
+}; // enum class EFlecsReplicationRecordType
+
+/** One recorded replication call, only the members of its type are read. */
+struct FFlecsReplicationRecord
+{
+	EFlecsReplicationRecordType Type = EFlecsReplicationRecordType::Snapshot;
+	
+	/** Seconds since the recording started. */
+	double Time = 0.0;
+	
+	FFlecsNetworkId NetworkId;
+	
+	/** Last published revision of a removed network ID. */
+	uint32 RemovalRevision = 0;
+	
+	FFlecsReplicationLayoutDefinition Layout;
+	FFlecsEntityReplicationSnapshot Snapshot;
+	
+}; // struct FFlecsReplicationRecord
+
+/**
+ * Binary stream of the layouts, snapshots and removals that went through a replication bridge, in the order
+ * they were published or received. Integers are packed and times are stored as microsecond deltas.
+ * Snapshots keep the layout handle they're sent with, like on the wire, so a replay resolves them through
+ * the recorded layouts.
+ */
+class UNREALFLECSNETWORKING_API FFlecsReplicationRecording
+{
+public:
+	void Reset();
+	
+	void RecordLayout(double InTime, const FFlecsReplicationLayoutDefinition& InLayout);
+	void RecordSnapshot(double InTime, const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot);
+	void RecordRemoval(double InTime, const FFlecsNetworkId& InNetworkId, uint32 InRemovalRevision);
+	
+	bool SaveToFile(const FString& InFilename) const;
+	
+	/** Replaces the recording with the one in the file, the recording is empty if the file isn't a valid recording. */
+	bool LoadFromFile(const FString& InFilename);
+	
+	NO_DISCARD FORCEINLINE int32 GetRecordCount() const
+	{
+		return RecordCount;
+	}
+	
+	NO_DISCARD FORCEINLINE double GetDuration() const
+	{
+		return static_cast<double>(LastRecordMicroseconds) * 1e-6;
+	}
+	
+	NO_DISCARD FORCEINLINE const TArray<uint8>& GetData() const
+	{
+		return Data;
+	}
+	
+private:
+	/** Writes the header every record starts with and advances the record clock. */
+	void BeginRecord(FArchive& InArchive, EFlecsReplicationRecordType InType, double InTime);
+	
+	TArray<uint8> Data;
+	int32 RecordCount = 0;
+	uint64 LastRecordMicroseconds = 0;
+	
+}; // class FFlecsReplicationRecording
+
+/** Reads the records of a recording in order, the recording has to outlive the reader. */
+class UNREALFLECSNETWORKING_API FFlecsReplicationRecordingReader
+{
+public:
+	explicit FFlecsReplicationRecordingReader(const FFlecsReplicationRecording& InRecording);
+	
+	/**
+	 * Reads the next record into OutRecord, reusing its arrays.
+	 * @return false at the end of the recording or if the record is malformed.
+	 */
+	bool ReadNext(FFlecsReplicationRecord& OutRecord);
+	
+	NO_DISCARD FORCEINLINE bool HasError() const
+	{
+		return Reader.IsError();
+	}
+	
+private:
+	FMemoryReader Reader;
+	uint64 RecordMicroseconds = 0;
+	
+}; // class FFlecsReplicationRecordingReader
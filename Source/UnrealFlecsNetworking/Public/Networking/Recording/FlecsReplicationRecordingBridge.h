@@ -0,0 +1,81 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Networking/Bridge/FlecsReplicationBridgeBase.h"
+#include "Networking/Recording/FlecsReplicationRecording.h"
+
+#include "FlecsReplicationRecordingBridge.generated.h"
+
+/**
+ * Records the layouts, snapshots and removals that pass through it and forwards every call to the recorded bridge.
+ * Installed in front of the regular bridge, e.g. with UFlecsNetworkWorldSubsystem::SetReplicationBridgeForTesting.
+ *
+ * Iris shards on clients hand received snapshots straight to the network subsystem, so recordings are taken
+ * on the authority, where the published stream is what every client receives.
+ */
+UCLASS(NotBlueprintable)
+class UNREALFLECSNETWORKING_API UFlecsReplicationRecordingBridge : public UFlecsReplicationBridgeBase
+{
+	GENERATED_BODY()
+
+public:
+	UFlecsReplicationRecordingBridge(const FObjectInitializer& ObjectInitializer);
+	
+	/** Bridge the calls are forwarded to, nullptr only records. */
+	void SetRecordedBridge(UFlecsReplicationBridgeBase* InRecordedBridge);
+	
+	NO_DISCARD FORCEINLINE UFlecsReplicationBridgeBase* GetRecordedBridge() const
+	{
+		return RecordedBridge;
+	}
+	
+	/**
+	 * Starts a new recording, the previous one is discarded.
+	 * Layouts already known to the network subsystem are recorded first, so the recording replays on its own.
+	 */
+	void StartRecording();
+	void StopRecording();
+	
+	NO_DISCARD FORCEINLINE bool IsRecording() const
+	{
+		return bIsRecording;
+	}
+	
+	NO_DISCARD FORCEINLINE const FFlecsReplicationRecording& GetRecording() const
+	{
+		return Recording;
+	}
+	
+	virtual void InitializeBridge() override;
+	virtual void DeinitializeBridge() override;
+	
+	virtual void PublishEntityLayout(const FFlecsReplicationLayoutDefinition& InLayoutDefinition) override;
+	virtual void ReceiveEntityLayout(const FFlecsReplicationLayoutDefinition& InLayoutDefinition) override;
+	
+	virtual void PublishNetEntity(const FFlecsEntityHandle& EntityHandle, const FFlecsNetworkId& InNetworkId,
+		const FFlecsEntityReplicationSnapshot& InSnapshot) override;
+	virtual void ReceiveNetEntity(const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot) override;
+	virtual void StopReplicatingEntity(const FFlecsEntityHandle& InEntityHandle) override;
+	
+	virtual void HandleProtocolError(const FString& InErrorMessage) override;
+	
+	virtual NO_DISCARD UFlecsNetShardBase* ResolveShard(const FFlecsEntityHandle& InEntity,
+		const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot) override;
+	
+	virtual void GatherShardStats(FFlecsReplicationShardStats& InOutStats) const override;
+	
+protected:
+	NO_DISCARD double GetRecordingTime() const;
+	
+	UPROPERTY(Transient)
+	TObjectPtr<UFlecsReplicationBridgeBase> RecordedBridge;
+	
+	FFlecsReplicationRecording Recording;
+	
+	double RecordingStartSeconds = 0.0;
+	bool bIsRecording = false;
+	
+}; // class UFlecsReplicationRecordingBridge
@@ -0,0 +1,70 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Networking/Recording/FlecsReplicationRecording.h"
+
+class UFlecsNetworkWorldSubsystem;
+
+/**
+ * Feeds a recording into a network subsystem as if its records arrived from the server, without a net driver or
+ * connection. Used to load test the receiving side offline, e.g. by replaying a capture of a full match.
+ * Layouts are registered as remote layouts, snapshots and removals are queued and applied once per Advance.
+ */
+class UNREALFLECSNETWORKING_API FFlecsReplicationReplayer
+{
+public:
+	/** The recording has to outlive the replayer. */
+	FFlecsReplicationReplayer(const FFlecsReplicationRecording& InRecording,
+		const TSolidNotNull<UFlecsNetworkWorldSubsystem*> InNetworkSubsystem);
+	
+	/** Speed of the playback, 2.0 replays a recording twice as fast as it was recorded. */
+	void SetPlaybackRate(const double InPlaybackRate)
+	{
+		solid_checkf(InPlaybackRate > 0.0, TEXT("Playback rate must be positive"));
+		PlaybackRate = InPlaybackRate;
+	}
+	
+	/**
+	 * Feeds every record up to the advanced playback time and applies the queued updates.
+	 * @return The number of records fed.
+	 */
+	int32 Advance(double InDeltaSeconds);
+	
+	/** Feeds every remaining record regardless of its time. */
+	int32 ReplayToEnd();
+	
+	NO_DISCARD FORCEINLINE bool IsFinished() const
+	{
+		return bIsFinished;
+	}
+	
+	NO_DISCARD FORCEINLINE double GetPlaybackTime() const
+	{
+		return PlaybackTime;
+	}
+	
+	NO_DISCARD FORCEINLINE int32 GetReplayedRecordCount() const
+	{
+		return ReplayedRecordCount;
+	}
+	
+private:
+	int32 FeedRecordsUntil(double InTime);
+	void FeedRecord(const FFlecsReplicationRecord& InRecord) const;
+	
+	FFlecsReplicationRecordingReader Reader;
+	TWeakObjectPtr<UFlecsNetworkWorldSubsystem> NetworkSubsystem;
+	
+	// Read ahead, fed once the playback reaches its time
+	FFlecsReplicationRecord PendingRecord;
+	bool bHasPendingRecord = false;
+	bool bIsFinished = false;
+	
+	double PlaybackRate = 1.0;
+	double PlaybackTime = 0.0;
+	int32 ReplayedRecordCount = 0;
+	
+}; // class FFlecsReplicationReplayer
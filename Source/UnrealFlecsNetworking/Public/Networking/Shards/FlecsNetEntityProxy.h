@@ -10,7 +10,10 @@
 
 #include "FlecsNetEntityProxy.generated.h"
 
-/** Individually replicated shard storage for one Flecs entity. */
+/**
+ * Individually replicated shard storage for one Flecs entity.
+ * Proxies are recycled by the bridge, a proxy detached from its last entity is reused for the next one.
+ */
 UCLASS()
 class UNREALFLECSNETWORKING_API UFlecsNetEntityProxy : public UFlecsNetShardBase
 {
@@ -26,6 +29,8 @@ public:
 	virtual void PublishNetEntity(const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot) override;
 	virtual void RemoveNetEntity(const FFlecsNetworkId& InNetworkId) override;
 	virtual bool IsEmpty() const override;
+	virtual bool IsFull() const override;
+	virtual bool CanBeRecycled() const override;
 
 	void HandleReplicationDetached();
 
@@ -9,7 +9,10 @@
 
 #include "FlecsNetEntityTable.generated.h"
 
-/** Table-backed shard storage for replicated Flecs entities. */
+/**
+ * Table-backed shard storage for replicated Flecs entities, one Iris root object carries up to
+ * UFlecsNetworkingModuleSettings::MaxEntitiesPerTableShard entities.
+ */
 UCLASS()
 class UNREALFLECSNETWORKING_API UFlecsNetEntityTable : public UFlecsNetShardBase
 {
@@ -26,6 +29,9 @@ public:
 	virtual void PublishNetEntity(const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot) override;
 	virtual void RemoveNetEntity(const FFlecsNetworkId& InNetworkId) override;
 	virtual bool IsEmpty() const override;
+	virtual bool IsFull() const override;
+	virtual int32 GetNetEntityCount() const override;
+	virtual int32 GetNetEntityCapacity() const override;
 
 	void HandleReplicationDetached();
 	void HandleEntityRemoved(const FFlecsNetworkId& InNetworkId, uint32 InStateRevision);
@@ -37,4 +43,8 @@ public:
 	UFUNCTION()
 	void OnRep_EntityTable();
 
+private:
+	// Authority only, item index of every published network ID.
+	TMap<FFlecsNetworkId, int32> ItemIndices;
+
 }; // class UFlecsNetEntityTable
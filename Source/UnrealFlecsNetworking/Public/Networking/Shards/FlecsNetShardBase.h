@@ -79,6 +79,34 @@ public:
 	/** Whether the physical shard contains no replicated entities. */
 	virtual bool IsEmpty() const
 		PURE_VIRTUAL(UFlecsNetShardBase::IsEmpty, return true;);
+
+	/** Whether the shard can't take another entity, the bridge doesn't offer new entities to full shards. */
+	virtual bool IsFull() const
+	{
+		return false;
+	}
+
+	/** Replicated entities the shard holds, reported by replication stats. Shards hold one entity unless they override it. */
+	virtual int32 GetNetEntityCount() const
+	{
+		return IsEmpty() ? 0 : 1;
+	}
+
+	/** Entities the shard can hold before it's full. */
+	virtual int32 GetNetEntityCapacity() const
+	{
+		return 1;
+	}
+
+	/**
+	 * Whether the bridge may keep the shard once its last entity left and reinitialize it for a later entity,
+	 * instead of allocating a new object. Recycled shards are deinitialized, so they're detached from Iris while they wait
+	 * and registered with it again when they're reused, recycling saves the allocation but not the Iris registration.
+	 */
+	virtual bool CanBeRecycled() const
+	{
+		return false;
+	}
 	
 	virtual NO_DISCARD TOptional<UNetObjectFactory::FWorldInfoData> GetWorldInfoData() const;
 
@@ -0,0 +1,107 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Entities/FlecsEntityHandle.h"
+
+#include "Networking/Layout/FlecsReplicationLayoutId.h"
+#include "Networking/Stats/FlecsReplicationStatsComponents.h"
+
+class UFlecsWorld;
+struct FFlecsEntityReplicationSnapshot;
+struct FFlecsReplicationLayoutDefinition;
+
+/** Shard counts gathered from the replication bridge after each publish pass. */
+struct FFlecsReplicationShardStats
+{
+	int32 ActiveShardCount = 0;
+	int32 RecycledShardCount = 0;
+
+	/** Entities stored in the active shards. */
+	int32 EntityCount = 0;
+
+	/** Entities the active shards could store. */
+	int32 Capacity = 0;
+
+}; // struct FFlecsReplicationShardStats
+
+/**
+ * Collects replication cost counters of one world while stats are enabled on the network subsystem.
+ *
+ * Counters are accumulated while entities are published or received updates are applied, and written
+ * when the pass is flushed: as components on the FlecsReplicationStats entity and its Components and
+ * Layouts children (queryable through REST, with a Flecs gauge metric per member when FLECS_METRICS is
+ * available), as custom stats of the FlecsReplication CSV category and as Insights counters.
+ */
+class UNREALFLECSNETWORKING_API FFlecsReplicationStatsCollector
+{
+public:
+	/** Creates the stats entities and their metrics, the world must not be deferred. */
+	explicit FFlecsReplicationStatsCollector(const TSolidNotNull<UFlecsWorld*> InWorld);
+
+	/** Counts the entity as dirtied for its layout and adds the size of each value to the value's component schema. */
+	void RecordPublishedSnapshot(const FFlecsReplicationLayoutDefinition& InLayoutDefinition,
+		const FFlecsEntityReplicationSnapshot& InSnapshot, uint64 InBuildCycles);
+
+	/** Writes the counters of the publish pass and resets them for the next one. */
+	void FlushPublishStats(const FFlecsReplicationShardStats& InShardStats);
+
+	void FlushApplyStats(int32 InQueuedUpdateCount, int32 InAppliedUpdateCount, double InApplySeconds);
+
+	NO_DISCARD FORCEINLINE const FFlecsReplicationStats& GetStats() const
+	{
+		return Stats;
+	}
+
+	NO_DISCARD FORCEINLINE const FFlecsEntityHandle& GetStatsEntity() const
+	{
+		return StatsEntity;
+	}
+
+	/** Stats entity of a component schema, invalid until a value of the component was published. */
+	NO_DISCARD FFlecsEntityHandle FindComponentStatsEntity(const FString& InStableName) const;
+
+	/** Stats entity of a layout, invalid until an entity of the layout was published. */
+	NO_DISCARD FFlecsEntityHandle FindLayoutStatsEntity(const FFlecsReplicationLayoutId& InLayoutId) const;
+
+private:
+	struct FComponentCounter
+	{
+		FFlecsEntityHandle Entity;
+		FName CsvStatName;
+		FFlecsReplicationComponentStats Stats;
+		bool bWrittenNonZero = false;
+
+	}; // struct FComponentCounter
+
+	struct FLayoutCounter
+	{
+		FFlecsEntityHandle Entity;
+		FName CsvStatName;
+		FFlecsReplicationLayoutStats Stats;
+		bool bWrittenNonZero = false;
+
+		/** Component counter of each layout key, INDEX_NONE for keys without a value. */
+		TArray<int32> ComponentIndices;
+
+	}; // struct FLayoutCounter
+
+	NO_DISCARD FLayoutCounter& FindOrAddLayoutCounter(const FFlecsReplicationLayoutDefinition& InLayoutDefinition);
+	NO_DISCARD int32 FindOrAddComponentCounter(const FString& InStableName);
+
+	FFlecsEntityHandle StatsEntity;
+	FFlecsReplicationStats Stats;
+
+	TArray<FComponentCounter> ComponentCounters;
+	TMap<FString, int32> ComponentCounterIndices;
+
+	TMap<FFlecsReplicationLayoutId, FLayoutCounter> LayoutCounters;
+
+	// Accumulated by the current publish pass.
+	int32 PendingPublishedEntityCount = 0;
+	int64 PendingSerializedBytes = 0;
+	uint64 PendingBuildCycles = 0;
+
+}; // class FFlecsReplicationStatsCollector
@@ -0,0 +1,101 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "FlecsReplicationStatsComponents.generated.h"
+
+/**
+ * Replication counters of the world, set on the FlecsReplicationStats entity.
+ * Publish counters are written after every publish pass, apply counters after every apply of the client queue.
+ */
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsReplicationStats
+{
+	GENERATED_BODY()
+
+	/** Entities whose snapshot was built in the last publish pass. */
+	UPROPERTY()
+	int32 PublishedEntityCount = 0;
+
+	/** Bytes of the values serialized in the last publish pass, clean values carried over by a snapshot aren't counted. */
+	UPROPERTY()
+	int64 SerializedBytes = 0;
+
+	/** Time spent filling snapshots in the last publish pass. */
+	UPROPERTY()
+	double SnapshotBuildMilliseconds = 0.0;
+
+	/** Shards that hold entities. */
+	UPROPERTY()
+	int32 ActiveShardCount = 0;
+
+	/** Empty shards kept by the bridge for reuse. */
+	UPROPERTY()
+	int32 RecycledShardCount = 0;
+
+	/** Entities stored in the active shards. */
+	UPROPERTY()
+	int32 ShardEntityCount = 0;
+
+	/** Entities the active shards could store before the bridge opens new ones. */
+	UPROPERTY()
+	int32 ShardCapacity = 0;
+
+	/** ShardEntityCount over ShardCapacity. */
+	UPROPERTY()
+	float ShardOccupancy = 0.f;
+
+	/** Received updates that were queued when the last apply started. */
+	UPROPERTY()
+	int32 QueuedUpdateCount = 0;
+
+	/** Updates taken off the queue by the last apply, the rest wait for the next frame. */
+	UPROPERTY()
+	int32 AppliedUpdateCount = 0;
+
+	UPROPERTY()
+	double ApplyMilliseconds = 0.0;
+
+}; // struct FFlecsReplicationStats
+
+/** Bytes serialized for one replicated component schema, set on FlecsReplicationStats::Components::<StableName>. */
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsReplicationComponentStats
+{
+	GENERATED_BODY()
+
+	/** Dirty values of the component serialized in the last publish pass. */
+	UPROPERTY()
+	int32 SerializedValueCount = 0;
+
+	/** Bytes of those values. */
+	UPROPERTY()
+	int64 SerializedBytes = 0;
+
+	/** Bytes serialized since stats were enabled. */
+	UPROPERTY()
+	int64 TotalSerializedBytes = 0;
+
+}; // struct FFlecsReplicationComponentStats
+
+/** Publishes of one replication layout, set on FlecsReplicationStats::Layouts::<LayoutId>. */
+USTRUCT(BlueprintType)
+struct UNREALFLECSNETWORKING_API FFlecsReplicationLayoutStats
+{
+	GENERATED_BODY()
+
+	/** Dirty entities of the layout that were published in the last publish pass. */
+	UPROPERTY()
+	int32 DirtiedEntityCount = 0;
+
+	/** Bytes of the values serialized for those entities. */
+	UPROPERTY()
+	int64 SerializedBytes = 0;
+
+	/** Entities of the layout published since stats were enabled. */
+	UPROPERTY()
+	int64 TotalDirtiedEntityCount = 0;
+
+}; // struct FFlecsReplicationLayoutStats
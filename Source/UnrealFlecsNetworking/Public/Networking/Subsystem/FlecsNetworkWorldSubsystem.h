@@ -4,22 +4,30 @@
 
 #include "CoreMinimal.h"
 
+#include "Misc/MemStack.h"
 #include "Templates/Function.h"
 
 #include "Worlds/FlecsAbstractWorldSubsystem.h"
 
+#include "Networking/FlecsNetworkEntityTable.h"
 #include "Networking/FlecsNetworkId.h"
+#include "Networking/FlecsReplicationPrioritization.h"
 #include "Networking/FlecsReplicationShardSelection.h"
 #include "Networking/FlecsReplicationUpdateQueue.h"
 #include "Networking/Layout/FlecsReplicationLayoutRegistry.h"
 #include "Networking/Layout/FlecsReplicationSnapshot.h"
+#include "Networking/Layout/FlecsResolvedReplicationLayout.h"
+#include "Networking/Stats/FlecsReplicationStatsCollector.h"
 
 #include "FlecsNetworkWorldSubsystem.generated.h"
 
+struct FFlecsReplicatedEntityComponent;
+
 class UFlecsReplicationProfileDataAsset;
 class UFlecsReplicationBridgeBase;
 class IFlecsNetworkIDGeneratorInterface;
 class UFlecsNetworkingModuleSettings;
+class UFlecsPredictionWorldSubsystem;
 
 using FFlecsReplicationShardSelectorFunction = TFunction<bool(
 	const FFlecsEntityHandle&,
@@ -27,6 +35,10 @@ using FFlecsReplicationShardSelectorFunction = TFunction<bool(
 	const FFlecsEntityView&, /** InProfilePrefabEntity */
 	OUT FFlecsReplicationShardSelection&)>;
 
+using FFlecsReplicationLocationFunction = TFunction<bool(
+	const FFlecsEntityHandle&,
+	OUT FVector&)>;
+
 /**
  * Per-UWorld coordinator for Flecs replication.
  *
@@ -51,9 +63,65 @@ public:
 	void RegisterComponentDirtyObservers();
 	void RegisterIndividualComponentDirtyObserver(const FFlecsComponentReplicationDescriptor& InDescriptor);
 	
+	/** Game thread only, the network entity table isn't synchronized even though the ID generator is. */
 	FFlecsNetworkId BeginReplicatingEntity(const FFlecsEntityHandle& InEntityHandle);
+	
+	/**
+	 * Begins replicating every entity with IDs reserved from the generator in one call, for wave spawns.
+	 * Entities that already replicate keep their network ID and handles listed twice are registered once.
+	 * Game thread only, like BeginReplicatingEntity.
+	 * @return The number of entities that began replicating.
+	 */
+	int32 BeginReplicatingEntities(TConstArrayView<FFlecsEntityHandle> InEntityHandles);
+	
 	void StopReplicatingEntity(const FFlecsEntityHandle& InEntityHandle);
 	
+	/**
+	 * Sets dirty bits on a replicated entity, it's queued for publishing when it gets its first bit.
+	 * Entities whose FFlecsReplicatedEntityComponent isn't readable yet fall back to FFlecsNetDirtyTag.
+	 */
+	void MarkReplicatedEntityDirty(const FFlecsEntityHandle& InEntityHandle, uint64 InDirtyMask);
+	
+	/** Builds and publishes the snapshot of a replicated entity and clears its dirty bits. */
+	void PublishReplicatedEntity(const FFlecsEntityHandle& InEntityHandle,
+		FFlecsReplicatedEntityComponent& InOutReplicatedComponent, const FFlecsNetworkId& InNetworkId);
+	
+	/**
+	 * Publishes the entities queued by MarkReplicatedEntityDirty, ran by the net dirty system.
+	 * While a viewer has a byte budget, entities are published by score until the budgets run out,
+	 * the rest stay dirty for the next publish.
+	 */
+	void PublishDirtyReplicatedEntities();
+	
+	/** Locates replicated entities for distance scoring and cull distances, entities without a location are never culled. */
+	void SetReplicationLocationProvider(FFlecsReplicationLocationFunction InLocationProvider);
+	
+	/** Replaces the viewers until they're gathered from the net driver's client connections again. */
+	void SetReplicationViewers(const TConstArrayView<FFlecsReplicationViewer> InViewers);
+	
+	NO_DISCARD TConstArrayView<FFlecsReplicationViewer> GetReplicationViewers() const
+	{
+		return ReplicationViewers;
+	}
+	
+	/** Dirty entities the last publish left for the next one because they didn't fit the byte budgets. */
+	NO_DISCARD int32 GetLastDeferredReplicatedEntityCount() const
+	{
+		return LastDeferredReplicatedEntityCount;
+	}
+	
+	/** Dirty bit of a replicated component, 0 if no dirty observer is registered for it. */
+	NO_DISCARD uint64 GetComponentDirtyMask(const FFlecsId InComponentId) const
+	{
+		const uint64* DirtyMask = ComponentDirtyMasks.Find(InComponentId);
+		return DirtyMask ? *DirtyMask : 0;
+	}
+	
+	NO_DISCARD int32 GetDirtyReplicatedEntityCount() const
+	{
+		return DirtyReplicatedEntities.Num();
+	}
+	
 	NO_DISCARD TSolidNotNull<IFlecsNetworkIDGeneratorInterface*> GetNetworkIdGenerator() const;
 	
 	NO_DISCARD TSolidNotNull<UFlecsReplicationBridgeBase*> GetReplicationBridge() const;
@@ -63,6 +131,23 @@ public:
 	void BindReplicationBridge(const TSolidNotNull<UFlecsReplicationBridgeBase*> InReplicationBridge);
 	void UnbindReplicationBridge(const UFlecsReplicationBridgeBase* InReplicationBridge);
 
+	/** Received snapshots of entities with FFlecsPredictedEntityTag are checked against its history before they're applied. */
+	void SetPredictionSubsystem(UFlecsPredictionWorldSubsystem* InPredictionSubsystem);
+	
+	/** Starts or stops collecting replication stats, enabled at startup by UFlecsNetworkingModuleSettings::bEnableReplicationStats. */
+	void SetReplicationStatsEnabled(const bool bInEnabled);
+	
+	NO_DISCARD bool IsReplicationStatsEnabled() const
+	{
+		return ReplicationStats.IsValid();
+	}
+	
+	/** Stats of the last publish and apply passes, nullptr while stats are disabled. */
+	NO_DISCARD const FFlecsReplicationStatsCollector* GetReplicationStats() const
+	{
+		return ReplicationStats.Get();
+	}
+
 #if WITH_AUTOMATION_TESTS
 	void SetReplicationBridgeForTesting(UFlecsReplicationBridgeBase* InReplicationBridge);
 #endif // WITH_AUTOMATION_TESTS
@@ -84,19 +169,22 @@ public:
 		return LayoutRegistry;
 	}
 	
-	NO_DISCARD FORCEINLINE const TMap<FFlecsNetworkId, FFlecsEntityHandle>& GetNetworkIdToEntityMap() const
+	NO_DISCARD FORCEINLINE const FFlecsNetworkEntityTable& GetNetworkEntities() const
 	{
-		return NetworkIdToEntityMap;
+		return NetworkEntities;
 	}
 	
-	NO_DISCARD FORCEINLINE TMap<FFlecsNetworkId, FFlecsEntityReplicationSnapshot>& GetReplicationSnapshots()
+	/** Latest published (authority) or accepted (client) snapshot of the network ID. */
+	NO_DISCARD FORCEINLINE const FFlecsEntityReplicationSnapshot* FindReplicationSnapshot(const FFlecsNetworkId& InNetworkId) const
 	{
-		return ReplicationSnapshots;
+		const FFlecsNetworkEntityRecord* Record = NetworkEntities.Find(InNetworkId);
+		return Record ? Record->GetSnapshot() : nullptr;
 	}
 	
-	NO_DISCARD FORCEINLINE const TMap<FFlecsNetworkId, FFlecsEntityReplicationSnapshot>& GetReplicationSnapshots() const
+	/** Layout last applied to a received entity, nullptr once the entity is destroyed. */
+	NO_DISCARD FORCEINLINE const FFlecsReplicationLayoutId* FindAppliedEntityLayout(const FFlecsEntityHandle& InEntityHandle) const
 	{
-		return ReplicationSnapshots;
+		return AppliedEntityLayouts.Find(InEntityHandle);
 	}
 	
 	NO_DISCARD bool HasAuthority() const;
@@ -105,9 +193,10 @@ public:
 	template <UE::Flecs::TFlecsEntityHandleTypeConcept T = FFlecsEntityHandle>
 	NO_DISCARD TOptional<T> GetEntityFromNetworkId(const FFlecsNetworkId& InNetworkId) const
 	{
-		if LIKELY_IF(const FFlecsEntityHandle* EntityHandle = NetworkIdToEntityMap.Find(InNetworkId))
+		const FFlecsNetworkEntityRecord* Record = NetworkEntities.Find(InNetworkId);
+		if LIKELY_IF(Record && Record->HasEntity())
 		{
-			return TOptional<T>(*EntityHandle);
+			return TOptional<T>(Record->Entity);
 		}
 		
 		return TOptional<T>();
@@ -116,9 +205,10 @@ public:
 	template <UE::Flecs::TFlecsEntityHandleTypeConcept T = FFlecsEntityHandle>
 	NO_DISCARD T GetEntityFromNetworkIdChecked(const FFlecsNetworkId& InNetworkId) const
 	{
-		if LIKELY_IF(const FFlecsEntityHandle* EntityHandle = NetworkIdToEntityMap.Find(InNetworkId))
+		const FFlecsNetworkEntityRecord* Record = NetworkEntities.Find(InNetworkId);
+		if LIKELY_IF(Record && Record->HasEntity())
 		{
-			return static_cast<T>(*EntityHandle);
+			return static_cast<T>(Record->Entity);
 		}
 		
 		checkf(false, TEXT("No entity found for network ID %s"), *InNetworkId.ToString());
@@ -165,13 +255,44 @@ public:
 
 protected:
 	
+	/** Checks the snapshot against the latest applied snapshot and removal of the network ID */
+	NO_DISCARD bool AcceptReceivedNetworkEntitySnapshot(const FFlecsNetworkId& InNetworkId,
+		const FFlecsEntityReplicationSnapshot& InSnapshot) const;
+	
+	/** Destroys the entity of an older generation that still occupies the slot of the network ID */
+	void ReleaseStaleNetworkEntitySlot(const FFlecsNetworkId& InNetworkId);
+	
 	void ApplyReceivedNetworkEntitySnapshot(const FFlecsNetworkId& InNetworkId, const FFlecsEntityReplicationSnapshot& InSnapshot);
 	
+	/** Applies a batch of snapshots that share a layout, new entities are created together in the layout's table */
+	void ApplyReceivedNetworkEntitySnapshots(const FFlecsReplicationLayoutId& InLayoutId,
+		const TConstArrayView<const FFlecsReplicationQueuedUpdate*> InUpdates);
+	
+	/**
+	 * Creates the entities of a batch of new network IDs.
+	 * @return true if the entities were created in bulk with the snapshot values, false if only the entities were created.
+	 */
+	bool CreateReceivedNetworkEntities(const FFlecsResolvedReplicationLayout& InLayout,
+		const TConstArrayView<const FFlecsReplicationQueuedUpdate*> InUpdates, OUT TArray<FFlecsEntityHandle>& OutEntities);
+	
+	/** Resolves the local ids of a registered layout, the result is invalid if the layout isn't registered yet */
+	NO_DISCARD FFlecsResolvedReplicationLayout ResolveReplicationLayout(const FFlecsReplicationLayoutId& InLayoutId) const;
+	
 	void ApplyReceivedNetworkEntityRemoval(const FFlecsNetworkId& InNetworkId, uint32 InStateRevision);
+	
+	/** Destroys the local entity of a received network ID and drops its pending work, the record is kept. */
+	void DestroyReceivedNetworkEntity(FFlecsNetworkEntityRecord& InOutRecord);
+	
 	void ApplyPendingLayoutDefinitions(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld);
 	void ApplyDeferredEntityLayouts();
 	
 	void ApplySnapshotToEntity(const FFlecsEntityHandle& InEntityHandle, const FFlecsEntityReplicationSnapshot& InSnapshot);
+	void ApplySnapshotToEntity(const FFlecsEntityHandle& InEntityHandle, const FFlecsEntityReplicationSnapshot& InSnapshot,
+		const FFlecsResolvedReplicationLayout& InLayout);
+	
+	/** Copies the prefab's value of a key over the entity's, for values the authority left out because they equal the baseline. */
+	void ResetValueToBaseline(const FFlecsEntityHandle& InEntityHandle, const FFlecsEntityHandle& InBaselinePrefab,
+		const FFlecsResolvedReplicationKey& InKey);
 	
 	// Ran on Client
 	void AddDeferredEntityLayout(const FFlecsEntityHandle& InEntityHandle, const FFlecsReplicationLayoutId& InLayout,
@@ -182,15 +303,31 @@ protected:
 	void CreateReplicationBridge();
 	void CreateNetworkIdGenerator();
 	
+	/** Returns the entity's network ID if it already replicates, logging a warning, an invalid ID otherwise. */
+	NO_DISCARD FFlecsNetworkId FindExistingNetworkId(const FFlecsEntityHandle& InEntityHandle) const;
+	void RegisterReplicatedEntity(const FFlecsEntityHandle& InEntityHandle, const FFlecsNetworkId& InNetworkId);
+	
+	/** Rebuilds the viewers from the net driver's client connections, viewers are kept as they are without a net driver. */
+	void GatherReplicationViewers();
+	
+	void PublishPrioritizedReplicatedEntities();
+	
+	void FlushReplicationPublishStats();
+	
 	TMap<FFlecsReplicationLayoutId, TArray<TPair<FFlecsEntityHandle, FFlecsEntityReplicationSnapshot>>> DeferredEntityLayouts;
 	
-	TMap<FFlecsNetworkId, FFlecsEntityHandle> NetworkIdToEntityMap;
+	// Entity, latest snapshot and removal revision of every known network ID, indexed by slot.
+	FFlecsNetworkEntityTable NetworkEntities;
 	
-	// @TODO: maybe move to a singleton or on the entity?
-	TMap<FFlecsNetworkId, FFlecsEntityReplicationSnapshot> ReplicationSnapshots;
+	// Layout last applied to each received entity, a new layout only removes the keys it no longer has.
+	// Entries are removed with the entity's network ID, whether it is destroyed by replication or not.
+	TMap<FFlecsEntityHandle, FFlecsReplicationLayoutId> AppliedEntityLayouts;
 	
-	// Prevents a late snapshot from resurrecting a removed network entity.
-	TMap<FFlecsNetworkId, uint32> RemovedEntityRevisions;
+	UPROPERTY()
+	FFlecsObserverHandle AppliedLayoutObserver;
+	
+	// Reusable scratch memory for received values that are staged before they're moved into the world.
+	FMemStackBase ReplicationScratch;
 
 	TMap<FName, FFlecsEntityHandle> ReplicationProfilePrefabs;
 	TMap<FName, FFlecsReplicationShardSelectorFunction> ReplicationShardSelectors;
@@ -199,12 +336,33 @@ protected:
 	UPROPERTY()
 	TArray<FFlecsObserverHandle> ComponentDirtyObservers;
 	
+	TMap<FFlecsId, uint64> ComponentDirtyMasks;
+	uint8 NextComponentDirtyBit = 0;
+	
+	// Entities that got their first dirty bit since the last publish, the second array is reused while publishing.
+	TArray<FFlecsEntityHandle> DirtyReplicatedEntities;
+	TArray<FFlecsEntityHandle> PublishingReplicatedEntities;
+	
+	TArray<FFlecsReplicationViewer> ReplicationViewers;
+	FFlecsReplicationLocationFunction ReplicationLocationProvider;
+	
+	// Reused while publishing by priority.
+	TArray<FFlecsReplicationPriorityCandidate> ReplicationPriorityCandidates;
+	
+	int32 LastDeferredReplicatedEntityCount = 0;
+	
+	// Only set while replication stats are enabled, so disabled stats cost a pointer check.
+	TUniquePtr<FFlecsReplicationStatsCollector> ReplicationStats;
+	
 	UPROPERTY()
 	TObjectPtr<UObject> NetworkIdGenerator;
 	
 	UPROPERTY()
 	TObjectPtr<UFlecsReplicationBridgeBase> ReplicationBridge;
 	
+	UPROPERTY()
+	TObjectPtr<UFlecsPredictionWorldSubsystem> PredictionSubsystem;
+	
 	FFlecsReplicationLayoutRegistry LayoutRegistry;
 	
 }; // class UFlecsNetworkWorldSubsystem
@@ -9,7 +9,8 @@
 #include "FlecsNetDirtySystem.generated.h"
 
 /**
- * 
+ * Publishes replicated entities with dirty bits queued on the network subsystem,
+ * and entities explicitly flagged with FFlecsNetDirtyTag.
  */
 UCLASS()
 class UNREALFLECSNETWORKING_API UFlecsNetDirtySystem : public UFlecsSystemObject
@@ -20,6 +21,7 @@ public:
 	UFlecsNetDirtySystem();
 	
 	virtual void BuildSystem(const TSolidNotNull<const UFlecsWorldInterfaceObject*> InWorld, TFlecsSystemBuilder<>& InBuilder) const override;
+	virtual void RunIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld, flecs::iter& InIterator) override;
 	virtual void EachIterator(const TSolidNotNull<UFlecsWorldInterfaceObject*> InWorld, flecs::iter& InIterator, const FFlecsId InIndex) override;
 	
 }; // class UFlecsNetDirtySystem
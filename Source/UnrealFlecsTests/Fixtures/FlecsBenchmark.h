@@ -0,0 +1,75 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CQTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+
+#include "HAL/PlatformTime.h"
+
+struct FFlecsBenchmarkResult
+{
+	FString Name;
+
+	int32 Iterations = 0;
+	int32 OperationsPerIteration = 0;
+
+	double MinSeconds = 0.0;
+	double AverageSeconds = 0.0;
+
+	double GetMinNanosecondsPerOperation() const
+	{
+		return OperationsPerIteration > 0
+			? (MinSeconds * 1e9) / static_cast<double>(OperationsPerIteration)
+			: 0.0;
+	}
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("%s: min %.3f ms, avg %.3f ms, %.2f ns/op (%d iterations x %d ops)"),
+			*Name, MinSeconds * 1000.0, AverageSeconds * 1000.0, GetMinNanosecondsPerOperation(),
+			Iterations, OperationsPerIteration);
+	}
+
+}; // struct FFlecsBenchmarkResult
+
+/**
+ * @brief Run InFunction once to warm up, then InIterations times, and report the timings to the test runner.
+ * @param InOperationsPerIteration The amount of operations a single call of InFunction performs, used for ns/op
+ */
+template<typename TFixture, typename TFunction>
+FFlecsBenchmarkResult RunFlecsBenchmark(TFixture& InFixture, const FString& InName, const int32 InIterations,
+	const int32 InOperationsPerIteration, TFunction&& InFunction)
+{
+	check(InIterations > 0);
+
+	InFunction();
+
+	FFlecsBenchmarkResult Result;
+	Result.Name = InName;
+	Result.Iterations = InIterations;
+	Result.OperationsPerIteration = InOperationsPerIteration;
+	Result.MinSeconds = TNumericLimits<double>::Max();
+
+	double TotalSeconds = 0.0;
+
+	for (int32 Iteration = 0; Iteration < InIterations; ++Iteration)
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		InFunction();
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+		Result.MinSeconds = FMath::Min(Result.MinSeconds, ElapsedSeconds);
+		TotalSeconds += ElapsedSeconds;
+	}
+
+	Result.AverageSeconds = TotalSeconds / static_cast<double>(InIterations);
+
+	InFixture.TestRunner->AddInfo(Result.ToString());
+	return Result;
+}
+
+#endif // WITH_AUTOMATION_TESTS
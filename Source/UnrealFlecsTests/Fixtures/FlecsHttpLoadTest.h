@@ -0,0 +1,393 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#pragma once
+
+#include "CQTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+#include "flecs.h"
+
+struct FFlecsHttpLoadTestSettings
+{
+	FString Path = TEXT("/");
+
+	int32 ClientCount = 16;
+	int32 RequestsPerClient = 32;
+
+	/** Number of requests a client sends before waiting for the replies. */
+	int32 PipelineDepth = 1;
+
+	/** Sent as Accept-Encoding when set, e.g. "gzip". */
+	FString AcceptEncoding;
+
+	double TimeoutSeconds = 30.0;
+
+}; // struct FFlecsHttpLoadTestSettings
+
+struct FFlecsHttpLoadTestResult
+{
+	FString Name;
+
+	int32 Requests = 0;
+	int32 Failures = 0;
+	int64 BytesReceived = 0;
+
+	double TotalSeconds = 0.0;
+
+	double P50Milliseconds = 0.0;
+	double P90Milliseconds = 0.0;
+	double P99Milliseconds = 0.0;
+	double MaxMilliseconds = 0.0;
+
+	double GetRequestsPerSecond() const
+	{
+		return TotalSeconds > 0.0 ? static_cast<double>(Requests) / TotalSeconds : 0.0;
+	}
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("%s: %d requests (%d failed) in %.3f s, %.0f req/s, %lld bytes, "
+			"p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms"),
+			*Name, Requests, Failures, TotalSeconds, GetRequestsPerSecond(), BytesReceived,
+			P50Milliseconds, P90Milliseconds, P99Milliseconds, MaxMilliseconds);
+	}
+
+}; // struct FFlecsHttpLoadTestResult
+
+namespace Unreal::Flecs::Tests::Http
+{
+	struct FClientResult
+	{
+		TArray<double> LatencySeconds;
+		int32 Failures = 0;
+		int64 BytesReceived = 0;
+	}; // struct FClientResult
+
+	struct FReply
+	{
+		/** Lower case status line and headers. */
+		FString Headers;
+		TArray<uint8> Body;
+	}; // struct FReply
+
+	/**
+	 * @brief Read a single HTTP/1.1 reply from InSocket, InOutBuffer holds data received past the previous reply.
+	 * @param OutReply Receives the headers and body of the reply (optional)
+	 */
+	inline bool ReadReply(FSocket& InSocket, TArray<uint8>& InOutBuffer, const double InDeadline, int64& OutBytes,
+		FReply* OutReply = nullptr)
+	{
+		static constexpr ANSICHAR HeaderEnd[] = "\r\n\r\n";
+		static constexpr ANSICHAR ContentLengthKey[] = "content-length:";
+
+		int32 HeaderLength = INDEX_NONE;
+		int32 ContentLength = INDEX_NONE;
+
+		uint8 Chunk[16 * 1024];
+
+		while (true)
+		{
+			if (HeaderLength == INDEX_NONE)
+			{
+				for (int32 Index = 0; Index + 4 <= InOutBuffer.Num(); ++Index)
+				{
+					if (FMemory::Memcmp(&InOutBuffer[Index], HeaderEnd, 4) == 0)
+					{
+						HeaderLength = Index + 4;
+						break;
+					}
+				}
+
+				if (HeaderLength != INDEX_NONE)
+				{
+					const FString Headers = FString::ConstructFromPtrSize(
+						reinterpret_cast<const ANSICHAR*>(InOutBuffer.GetData()), HeaderLength).ToLower();
+
+					const int32 KeyIndex = Headers.Find(ANSI_TO_TCHAR(ContentLengthKey));
+					if (KeyIndex == INDEX_NONE)
+					{
+						return false;
+					}
+
+					ContentLength = FCString::Atoi(*Headers.Mid(KeyIndex + UE_ARRAY_COUNT(ContentLengthKey) - 1));
+
+					if (OutReply)
+					{
+						OutReply->Headers = Headers;
+					}
+				}
+			}
+
+			if (HeaderLength != INDEX_NONE && InOutBuffer.Num() >= HeaderLength + ContentLength)
+			{
+				OutBytes += HeaderLength + ContentLength;
+
+				if (OutReply)
+				{
+					OutReply->Body = TArray<uint8>(InOutBuffer.GetData() + HeaderLength, ContentLength);
+				}
+
+				InOutBuffer.RemoveAt(0, HeaderLength + ContentLength, EAllowShrinking::No);
+				return true;
+			}
+
+			if (FPlatformTime::Seconds() > InDeadline)
+			{
+				return false;
+			}
+
+			if (!InSocket.Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+			{
+				continue;
+			}
+
+			int32 BytesRead = 0;
+			if (!InSocket.Recv(Chunk, sizeof(Chunk), BytesRead) || BytesRead <= 0)
+			{
+				return false;
+			}
+
+			InOutBuffer.Append(Chunk, BytesRead);
+		}
+	}
+
+	/** Connect a blocking TCP socket to InPort on the loopback address, nullptr on failure. */
+	inline FSocket* Connect(const uint16 InPort)
+	{
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("FlecsHttpLoadTestClient"), false);
+
+		if (!Socket)
+		{
+			return nullptr;
+		}
+
+		Socket->SetNoDelay(true);
+
+		const TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+		Address->SetLoopbackAddress();
+		Address->SetPort(InPort);
+
+		if (!Socket->Connect(*Address))
+		{
+			SocketSubsystem->DestroySocket(Socket);
+			return nullptr;
+		}
+
+		return Socket;
+	}
+
+	inline void Disconnect(FSocket* InSocket)
+	{
+		InSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(InSocket);
+	}
+
+	inline bool SendAll(FSocket& InSocket, const ANSICHAR* InData, const int32 InLength)
+	{
+		int32 BytesSent = 0;
+		return InSocket.Send(reinterpret_cast<const uint8*>(InData), InLength, BytesSent) && BytesSent == InLength;
+	}
+
+	/** Pump ecs_http_server_dequeue() on the calling thread until all InFutures are ready. */
+	template<typename TResult>
+	void DequeueUntilReady(ecs_http_server_t* InServer, const TArray<TFuture<TResult>>& InFutures)
+	{
+		double LastSeconds = FPlatformTime::Seconds();
+		while (InFutures.ContainsByPredicate([](const TFuture<TResult>& InFuture) { return !InFuture.IsReady(); }))
+		{
+			const double NowSeconds = FPlatformTime::Seconds();
+			ecs_http_server_dequeue(InServer, static_cast<ecs_ftime_t>(NowSeconds - LastSeconds));
+			LastSeconds = NowSeconds;
+
+			FPlatformProcess::Sleep(0.0f);
+		}
+	}
+
+	inline FClientResult RunClient(const uint16 InPort, const FFlecsHttpLoadTestSettings& InSettings)
+	{
+		FClientResult Result;
+
+		FSocket* Socket = Connect(InPort);
+		if (!Socket)
+		{
+			Result.Failures = InSettings.RequestsPerClient;
+			return Result;
+		}
+
+		FString RequestString = FString::Printf(TEXT("GET %s HTTP/1.1\r\nHost: localhost\r\n"), *InSettings.Path);
+		if (!InSettings.AcceptEncoding.IsEmpty())
+		{
+			RequestString += FString::Printf(TEXT("Accept-Encoding: %s\r\n"), *InSettings.AcceptEncoding);
+		}
+		RequestString += TEXT("\r\n");
+
+		const FTCHARToUTF8 Request(*RequestString);
+		const double Deadline = FPlatformTime::Seconds() + InSettings.TimeoutSeconds;
+		const int32 PipelineDepth = FMath::Max(1, InSettings.PipelineDepth);
+
+		TArray<uint8> Buffer;
+		TArray<double> SendTimes;
+		Result.LatencySeconds.Reserve(InSettings.RequestsPerClient);
+
+		int32 Remaining = InSettings.RequestsPerClient;
+		while (Remaining > 0)
+		{
+			const int32 BatchCount = FMath::Min(PipelineDepth, Remaining);
+			SendTimes.Reset();
+
+			bool bSent = true;
+			for (int32 Index = 0; Index < BatchCount && bSent; ++Index)
+			{
+				SendTimes.Add(FPlatformTime::Seconds());
+				bSent = SendAll(*Socket, Request.Get(), Request.Length());
+			}
+
+			for (int32 Index = 0; Index < BatchCount; ++Index)
+			{
+				if (!bSent || !ReadReply(*Socket, Buffer, Deadline, Result.BytesReceived))
+				{
+					Result.Failures += Remaining - Index;
+					Remaining = 0;
+					break;
+				}
+
+				Result.LatencySeconds.Add(FPlatformTime::Seconds() - SendTimes[Index]);
+			}
+
+			Remaining = FMath::Max(0, Remaining - BatchCount);
+		}
+
+		Disconnect(Socket);
+		return Result;
+	}
+
+	inline double Percentile(const TArray<double>& InSortedSeconds, const double InPercentile)
+	{
+		if (InSortedSeconds.IsEmpty())
+		{
+			return 0.0;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(InPercentile * InSortedSeconds.Num()) - 1,
+			0, InSortedSeconds.Num() - 1);
+		return InSortedSeconds[Index] * 1000.0;
+	}
+
+} // namespace Unreal::Flecs::Tests::Http
+
+/**
+ * @brief Hit a started HTTP server with concurrent loopback clients and report latency percentiles.
+ * Clients run on their own threads, the calling thread pumps ecs_http_server_dequeue() until all clients finished.
+ */
+template<typename TFixture>
+FFlecsHttpLoadTestResult RunFlecsHttpLoadTest(TFixture& InFixture, const FString& InName,
+	ecs_http_server_t* InServer, const FFlecsHttpLoadTestSettings& InSettings)
+{
+	using namespace Unreal::Flecs::Tests::Http;
+
+	check(InServer);
+
+	const uint16 Port = ecs_http_server_get_port(InServer);
+
+	TArray<TFuture<FClientResult>> Clients;
+	Clients.Reserve(InSettings.ClientCount);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	for (int32 Index = 0; Index < InSettings.ClientCount; ++Index)
+	{
+		Clients.Add(Async(EAsyncExecution::Thread, [Port, InSettings]()
+		{
+			return RunClient(Port, InSettings);
+		}));
+	}
+
+	DequeueUntilReady(InServer, Clients);
+
+	FFlecsHttpLoadTestResult Result;
+	Result.Name = InName;
+	Result.TotalSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	TArray<double> LatencySeconds;
+	for (TFuture<FClientResult>& Client : Clients)
+	{
+		const FClientResult& ClientResult = Client.Get();
+		LatencySeconds.Append(ClientResult.LatencySeconds);
+		Result.Failures += ClientResult.Failures;
+		Result.BytesReceived += ClientResult.BytesReceived;
+	}
+
+	LatencySeconds.Sort();
+
+	Result.Requests = LatencySeconds.Num();
+	Result.P50Milliseconds = Percentile(LatencySeconds, 0.50);
+	Result.P90Milliseconds = Percentile(LatencySeconds, 0.90);
+	Result.P99Milliseconds = Percentile(LatencySeconds, 0.99);
+	Result.MaxMilliseconds = LatencySeconds.IsEmpty() ? 0.0 : LatencySeconds.Last() * 1000.0;
+
+	InFixture.TestRunner->AddInfo(Result.ToString());
+	return Result;
+}
+
+/**
+ * @brief Send InRawRequests over a single loopback connection and read InReplyCount replies.
+ * The calling thread pumps ecs_http_server_dequeue() while the replies are received.
+ */
+inline TArray<Unreal::Flecs::Tests::Http::FReply> SendFlecsHttpRequests(ecs_http_server_t* InServer,
+	const FString& InRawRequests, const int32 InReplyCount, const double InTimeoutSeconds = 10.0)
+{
+	using namespace Unreal::Flecs::Tests::Http;
+
+	check(InServer);
+
+	const uint16 Port = ecs_http_server_get_port(InServer);
+
+	TArray<TFuture<TArray<FReply>>> Client;
+	Client.Add(Async(EAsyncExecution::Thread, [Port, InRawRequests, InReplyCount, InTimeoutSeconds]()
+	{
+		TArray<FReply> Replies;
+
+		FSocket* Socket = Connect(Port);
+		if (!Socket)
+		{
+			return Replies;
+		}
+
+		const FTCHARToUTF8 Request(*InRawRequests);
+		if (SendAll(*Socket, Request.Get(), Request.Length()))
+		{
+			const double Deadline = FPlatformTime::Seconds() + InTimeoutSeconds;
+
+			TArray<uint8> Buffer;
+			int64 BytesReceived = 0;
+
+			for (int32 Index = 0; Index < InReplyCount; ++Index)
+			{
+				if (!ReadReply(*Socket, Buffer, Deadline, BytesReceived, &Replies.AddDefaulted_GetRef()))
+				{
+					Replies.Pop();
+					break;
+				}
+			}
+		}
+
+		Disconnect(Socket);
+		return Replies;
+	}));
+
+	DequeueUntilReady(InServer, Client);
+	return Client[0].Get();
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Networking/FlecsReplicatedEntityComponent.h"
+#include "Networking/Observers/FlecsReplicatedComponentObservers.h"
 #include "Networking/Subsystem/FlecsNetworkWorldSubsystem.h"
 #include "UnrealFlecsTests/Fixtures/FlecsRegisteredWorldFixture.h"
 #include "UnrealFlecsTests/Fixtures/FlecsTestReplicationBridge.h"
@@ -19,6 +21,10 @@ protected:
 		NetworkSubsystemInstance = this->UnrealWorld()->template GetSubsystem<UFlecsNetworkWorldSubsystem>();
 		check(NetworkSubsystemInstance);
 
+		// Fixture worlds are standalone, so the server only observer never begins replication on its own,
+		// tests begin replicating their entities explicitly
+		check(!this->World()->template IsFlecsObjectRegistered<UFlecsReplicatedComponentObservers>());
+
 		TestBridgeInstance = NewObject<UFlecsTestReplicationBridge>(NetworkSubsystemInstance);
 		NetworkSubsystemInstance->SetReplicationBridgeForTesting(TestBridgeInstance);
 
@@ -26,6 +32,7 @@ protected:
 		RegisterReplicationComponent<FFlecsReplicationTestValue>();
 		RegisterReplicationComponent<FFlecsReplicationTestDontFragmentValue>();
 		RegisterReplicationComponent<FFlecsReplicationTestNativeValue>();
+		RegisterReplicationComponent<FFlecsReplicationTestNativePair>();
 		RegisterReplicationComponent<FFlecsReplicationTestTag>();
 		RegisterReplicationComponent<FFlecsReplicationTestRelationship>();
 		RegisterReplicationComponent<FFlecsReplicationTestValueRelationship>();
@@ -54,6 +61,17 @@ protected:
 		return TestBridgeInstance;
 	}
 
+	/** Creates an entity with a replicated test value and begins replicating it, the entity starts out dirty. */
+	FFlecsEntityHandle CreateReplicatedEntity(const int32 InValue) const
+	{
+		const FFlecsEntityHandle Entity = this->World()->CreateEntity()
+			.template Set<FFlecsReplicationTestValue>({ InValue })
+			.template Add<FFlecsReplicatedEntityComponent>();
+
+		NetworkSubsystemInstance->BeginReplicatingEntity(Entity);
+		return Entity;
+	}
+
 private:
 	template<typename T>
 	void RegisterReplicationComponent()
@@ -6,6 +6,11 @@
 
 #if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
 
+#include "GameplayTagsManager.h"
+
+#include "Entities/FlecsStablePathTag.h"
+#include "Queries/FlecsQuery.h"
+#include "Queries/FlecsQueryBuilder.h"
 #include "Worlds/FlecsWorld.h"
 
 FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsGameplayTagTests,
@@ -161,6 +166,85 @@ FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsGameplayTagTests,
 		TestEntity.RemovePair<FFlecsTestStruct_Value>(TestTag2);
 		ASSERT_THAT(IsFalse(TestEntity.HasPair<FFlecsTestStruct_Value>(TestTag2)));
 	}
+
+	TEST_METHOD(GameplayTagEntity_HierarchyMatchesTagTree)
+	{
+		const FGameplayTag ChildTag = FFlecsTestNativeGameplayTags::Get().TestSameSubGrandchildTag2;
+		const FGameplayTag ParentTag = ChildTag.RequestDirectParent();
+		ASSERT_THAT(IsTrue(ParentTag.IsValid()));
+
+		const FFlecsEntityHandle ChildEntity = World()->GetTagEntity(ChildTag);
+		const FFlecsEntityHandle ParentEntity = World()->GetTagEntity(ParentTag);
+
+		ASSERT_THAT(IsTrue(ChildEntity.GetParent<FFlecsEntityHandle>() == ParentEntity));
+		ASSERT_THAT(IsTrue(ChildEntity.Has<FFlecsStablePathTag>()));
+		ASSERT_THAT(AreEqual(FString(TEXT("Tag2")), ChildEntity.GetName()));
+		ASSERT_THAT(IsTrue(World()->TagEntityIndex.FindByNetIndex(
+			UGameplayTagsManager::Get().GetNetIndexFromTag(ChildTag)) == ChildEntity.GetFlecsId()));
+	}
+
+	TEST_METHOD(GameplayTagEntityIndex_LazyCreatesTagAndParentsOnFirstRequest)
+	{
+		const FFlecsEntityHandle Root = World()->CreateEntity(TEXT("LazyTagRoot"));
+		flecs::world_t* NativeWorld = World()->GetNativeFlecsWorld().c_ptr();
+
+		FFlecsGameplayTagEntityIndex TagEntityIndex;
+		TagEntityIndex.Initialize(Root.GetFlecsId(), true);
+
+		const FGameplayTag Tag = FFlecsTestNativeGameplayTags::Get().TestSameSubGrandchildTag2;
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(0), TagEntityIndex.Find(Tag)));
+
+		const flecs::entity_t TagEntity = TagEntityIndex.FindOrCreate(NativeWorld, Tag);
+		ASSERT_THAT(IsTrue(TagEntity != 0));
+		ASSERT_THAT(AreEqual(TagEntity, TagEntityIndex.Find(Tag)));
+		ASSERT_THAT(AreEqual(TagEntity, TagEntityIndex.FindOrCreate(NativeWorld, Tag)));
+
+		// Test.UnrealFlecs.Sub1.Tag2 and each of its parents
+		ASSERT_THAT(AreEqual(4, TagEntityIndex.Num()));
+		ASSERT_THAT(AreEqual(TagEntity, ecs_lookup_path_w_sep(NativeWorld, Root, "Test.UnrealFlecs.Sub1.Tag2", ".", nullptr, false)));
+		ASSERT_THAT(IsTrue(World()->GetAlive(TagEntity).Get<FGameplayTag>() == Tag));
+	}
+
+	TEST_METHOD(GameplayTagQuery_WithMatchingTag_MatchesTagAndChildTags)
+	{
+		const FFlecsTestNativeGameplayTags& Tags = FFlecsTestNativeGameplayTags::Get();
+		const FGameplayTag Sub1Tag = Tags.TestSameSubGrandchildTag1.RequestDirectParent();
+		const FGameplayTag RootTag = Sub1Tag.RequestDirectParent();
+		
+		const FFlecsEntityHandle Sub1Entity = World()->CreateEntity().Add(Sub1Tag);
+		const FFlecsEntityHandle Sub1Tag1Entity = World()->CreateEntity().Add(Tags.TestSameSubGrandchildTag1);
+		const FFlecsEntityHandle Sub1Tag2Entity = World()->CreateEntity().Add(Tags.TestSameSubGrandchildTag2);
+		const FFlecsEntityHandle Sub2Tag1Entity = World()->CreateEntity().Add(Tags.TestSameSubTag2);
+		
+		FFlecsQuery ExactQuery = World()->CreateQueryBuilder()
+			.With(Sub1Tag)
+			.Build();
+		ASSERT_THAT(AreEqual(1, ExactQuery.count()));
+		
+		FFlecsQuery MatchingQuery = World()->CreateQueryBuilder()
+			.WithMatchingTag(Sub1Tag)
+			.Build();
+		ASSERT_THAT(AreEqual(3, MatchingQuery.count()));
+		
+		FFlecsQuery MatchingRootQuery = World()->CreateQueryBuilder()
+			.WithMatchingTag(RootTag)
+			.Build();
+		ASSERT_THAT(AreEqual(4, MatchingRootQuery.count()));
+		
+		FFlecsQuery ExcludingQuery = World()->CreateQueryBuilder()
+			.WithMatchingTag(Sub1Tag)
+			.WithoutMatchingTag(Tags.TestSameSubGrandchildTag2)
+			.Build();
+		ASSERT_THAT(AreEqual(2, ExcludingQuery.count()));
+		
+		Sub1Tag1Entity.Remove(Tags.TestSameSubGrandchildTag1);
+		ASSERT_THAT(AreEqual(2, MatchingQuery.count()));
+		ASSERT_THAT(AreEqual(3, MatchingRootQuery.count()));
+		
+		ASSERT_THAT(IsTrue(Sub1Entity.Has(Sub1Tag)));
+		ASSERT_THAT(IsFalse(Sub1Tag2Entity.Has(Sub1Tag)));
+		ASSERT_THAT(IsFalse(Sub2Tag1Entity.Has(Sub1Tag)));
+	}
 	
 }; // UnrealFlecsGameplayTagTests
 
@@ -0,0 +1,146 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsHttpLoadTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Misc/Compression.h"
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsHttpServerTests,
+								   "UnrealFlecs.Rest.HttpServer",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+							   "[Flecs][Rest][Http]")
+{
+	static constexpr uint16 Port = 27850;
+	static constexpr int32 CompressionThreshold = 1024;
+
+	ecs_http_server_t* Server = nullptr;
+
+	virtual void OnWorldSetUp() override
+	{
+		ecs_http_server_desc_t Desc = {};
+		Desc.port = Port;
+		Desc.worker_count = 2;
+		Desc.compression_threshold = CompressionThreshold;
+
+		Server = ecs_rest_server_init(World()->GetNativeFlecsWorld().c_ptr(), &Desc);
+
+		if (Server)
+		{
+			ecs_http_server_start(Server);
+		}
+	}
+
+	virtual void OnWorldTearDown() override
+	{
+		if (Server)
+		{
+			ecs_http_server_stop(Server);
+			ecs_rest_server_fini(Server);
+			Server = nullptr;
+		}
+	}
+
+	static FString BodyToString(const TArray<uint8>& InBody)
+	{
+		return FString::ConstructFromPtrSize(reinterpret_cast<const ANSICHAR*>(InBody.GetData()), InBody.Num());
+	}
+
+	TEST_METHOD(PipelinedRequests_AreAnsweredInOrder)
+	{
+		ASSERT_THAT(IsNotNull(Server));
+
+		const TArray<Unreal::Flecs::Tests::Http::FReply> Replies = SendFlecsHttpRequests(Server,
+			TEXT("GET /entity/flecs HTTP/1.1\r\n\r\n")
+			TEXT("GET /entity/flecs/core HTTP/1.1\r\n\r\n")
+			TEXT("GET /entity/flecs/core/World HTTP/1.1\r\n\r\n"), 3);
+
+		ASSERT_THAT(AreEqual(3, Replies.Num()));
+		ASSERT_THAT(IsTrue(BodyToString(Replies[0].Body).Contains(TEXT("\"name\":\"flecs\""))));
+		ASSERT_THAT(IsTrue(BodyToString(Replies[1].Body).Contains(TEXT("\"name\":\"core\""))));
+		ASSERT_THAT(IsTrue(BodyToString(Replies[2].Body).Contains(TEXT("\"name\":\"World\""))));
+
+		for (const Unreal::Flecs::Tests::Http::FReply& Reply : Replies)
+		{
+			ASSERT_THAT(IsTrue(Reply.Headers.StartsWith(TEXT("http/1.1 200"))));
+			ASSERT_THAT(IsTrue(Reply.Headers.Contains(TEXT("connection: keep-alive"))));
+		}
+	}
+
+	TEST_METHOD(ConnectionClose_IsAcknowledged)
+	{
+		ASSERT_THAT(IsNotNull(Server));
+
+		const TArray<Unreal::Flecs::Tests::Http::FReply> Replies = SendFlecsHttpRequests(Server,
+			TEXT("GET /entity/flecs HTTP/1.1\r\nConnection: close\r\n\r\n"), 1);
+
+		ASSERT_THAT(AreEqual(1, Replies.Num()));
+		ASSERT_THAT(IsTrue(Replies[0].Headers.Contains(TEXT("connection: close"))));
+	}
+
+	TEST_METHOD(LargeReply_IsGzipCompressed)
+	{
+		ASSERT_THAT(IsNotNull(Server));
+
+		for (int32 Index = 0; Index < 256; ++Index)
+		{
+			World()->CreateEntity(FString::Printf(TEXT("HttpServerTestEntity%d"), Index));
+		}
+
+		const TArray<Unreal::Flecs::Tests::Http::FReply> Replies = SendFlecsHttpRequests(Server,
+			TEXT("GET /world HTTP/1.1\r\n\r\n")
+			TEXT("GET /world HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n"), 2);
+
+		ASSERT_THAT(AreEqual(2, Replies.Num()));
+
+		const TArray<uint8>& Identity = Replies[0].Body;
+		const TArray<uint8>& Compressed = Replies[1].Body;
+
+		ASSERT_THAT(IsTrue(Identity.Num() >= CompressionThreshold));
+		ASSERT_THAT(IsFalse(Replies[0].Headers.Contains(TEXT("content-encoding"))));
+		ASSERT_THAT(IsTrue(Replies[1].Headers.Contains(TEXT("content-encoding: gzip"))));
+		ASSERT_THAT(IsTrue(Compressed.Num() < Identity.Num()));
+
+		// The last four bytes of a gzip stream hold the uncompressed size
+		ASSERT_THAT(IsTrue(Compressed.Num() > 18));
+		int32 UncompressedSize = 0;
+		FMemory::Memcpy(&UncompressedSize, Compressed.GetData() + Compressed.Num() - 4, sizeof(int32));
+		ASSERT_THAT(AreEqual(Identity.Num(), UncompressedSize));
+
+		TArray<uint8> Uncompressed;
+		Uncompressed.SetNumUninitialized(UncompressedSize);
+		ASSERT_THAT(IsTrue(FCompression::UncompressMemory(NAME_Gzip, Uncompressed.GetData(), UncompressedSize,
+			Compressed.GetData(), Compressed.Num())));
+		ASSERT_THAT(IsTrue(Uncompressed == Identity));
+	}
+
+	TEST_METHOD(CachedReply_KeepsContentType)
+	{
+		ecs_http_server_desc_t Desc = {};
+		Desc.cache_timeout = 10.0;
+
+		ecs_http_server_t* CachingServer = ecs_rest_server_init(World()->GetNativeFlecsWorld().c_ptr(), &Desc);
+		ASSERT_THAT(IsNotNull(CachingServer));
+
+		// The root endpoint replies with text, the second request is served from the cache
+		for (int32 Index = 0; Index < 2; ++Index)
+		{
+			ecs_http_reply_t Reply = ECS_HTTP_REPLY_INIT;
+			ASSERT_THAT(AreEqual(0, ecs_http_server_request(CachingServer, "GET", "/", nullptr, &Reply)));
+			ASSERT_THAT(IsNotNull(Reply.content_type));
+			ASSERT_THAT(AreEqual(FString(TEXT("text/plain")), FString(UTF8_TO_TCHAR(Reply.content_type))));
+
+			ecs_strbuf_reset(&Reply.body);
+			ecs_strbuf_reset(&Reply.headers);
+		}
+
+		ecs_rest_server_fini(CachingServer);
+	}
+
+}; // UnrealFlecsHttpServerTests
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,136 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsInstrumentationTests,
+								   "UnrealFlecs.Instrumentation",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+							   "[Flecs][Stats]")
+{
+	virtual void OnWorldSetUp() override
+	{
+		flecs::world_t* Native = NativeWorld();
+		ECS_IMPORT(Native, FlecsStats);
+		ECS_IMPORT(Native, FlecsMetrics);
+		ECS_IMPORT(Native, FlecsAlerts);
+	}
+
+	flecs::world_t* NativeWorld() const
+	{
+		return World()->GetNativeFlecsWorld().c_ptr();
+	}
+
+	void Progress(const double InDeltaTime) const
+	{
+		World()->GetNativeFlecsWorld().progress(static_cast<ecs_ftime_t>(InDeltaTime));
+	}
+
+	ecs_entity_t CreateValueMetric(const ecs_metric_kind_t InKind, const bool bInChangeDetection) const
+	{
+		const ecs_entity_t ValueType = World()->GetScriptStructEntity<FFlecsTestStruct_Value>();
+
+		ecs_metric_desc_t Desc = {};
+		Desc.entity = ecs_new(NativeWorld());
+		Desc.member = ecs_lookup_child(NativeWorld(), ValueType, "Value");
+		Desc.kind = InKind;
+		Desc.change_detection = bInChangeDetection;
+		return ecs_metric_init(NativeWorld(), &Desc);
+	}
+
+	double GetMetricValue(const ecs_entity_t InMetric) const
+	{
+		double Result = -1.0;
+
+		ecs_iter_t It = ecs_children(NativeWorld(), InMetric);
+		while (ecs_children_next(&It))
+		{
+			for (int32 Index = 0; Index < It.count; ++Index)
+			{
+				if (const EcsMetricValue* Value = ecs_get(NativeWorld(), It.entities[Index], EcsMetricValue))
+				{
+					Result = Value->value;
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	TEST_METHOD(Metrics_CounterIntegratesOverSampleInterval)
+	{
+		const ecs_entity_t Metric = CreateValueMetric(EcsCounterIncrement, false);
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity();
+		Entity.Set<FFlecsTestStruct_Value>(FFlecsTestStruct_Value{ .Value = 3 });
+
+		Progress(1.0);
+		ASSERT_THAT(AreEqual(3.0, GetMetricValue(Metric)));
+
+		ecs_metrics_set_interval(NativeWorld(), 2.0);
+		ASSERT_THAT(AreEqual(2.0, static_cast<double>(ecs_metrics_get_interval(NativeWorld()))));
+
+		Progress(1.0);
+		ASSERT_THAT(AreEqual(3.0, GetMetricValue(Metric)));
+
+		Progress(1.0);
+		ASSERT_THAT(AreEqual(9.0, GetMetricValue(Metric)));
+	}
+
+	TEST_METHOD(Metrics_ChangeDetectionOnlyResamplesModifiedComponents)
+	{
+		const ecs_entity_t Metric = CreateValueMetric(EcsGauge, true);
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity();
+		Entity.Set<FFlecsTestStruct_Value>(FFlecsTestStruct_Value{ .Value = 5 });
+
+		Progress(1.0);
+		ASSERT_THAT(AreEqual(5.0, GetMetricValue(Metric)));
+
+		Entity.GetMut<FFlecsTestStruct_Value>().Value = 6;
+		Progress(1.0);
+		ASSERT_THAT(AreEqual(5.0, GetMetricValue(Metric)));
+
+		Entity.Modified<FFlecsTestStruct_Value>();
+		Progress(1.0);
+		ASSERT_THAT(AreEqual(6.0, GetMetricValue(Metric)));
+	}
+
+	TEST_METHOD(Stats_SampleIntervalReducesInstrumentationPasses)
+	{
+		const ecs_world_info_t* Info = ecs_get_world_info(NativeWorld());
+
+		ecs_stats_set_interval(NativeWorld(), 10.0);
+		ecs_metrics_set_interval(NativeWorld(), 10.0);
+		ecs_alerts_set_interval(NativeWorld(), 10.0);
+		ASSERT_THAT(AreEqual(10.0, static_cast<double>(ecs_stats_get_interval(NativeWorld()))));
+
+		const int64 SampledStart = Info->instrumentation_count_total;
+		for (int32 Frame = 0; Frame < 10; ++Frame)
+		{
+			Progress(0.1);
+		}
+		const int64 SampledPasses = Info->instrumentation_count_total - SampledStart;
+
+		ecs_stats_set_interval(NativeWorld(), 0.0);
+		ecs_metrics_set_interval(NativeWorld(), 0.0);
+		ecs_alerts_set_interval(NativeWorld(), 0.0);
+
+		const int64 EveryFrameStart = Info->instrumentation_count_total;
+		for (int32 Frame = 0; Frame < 10; ++Frame)
+		{
+			Progress(0.1);
+		}
+		const int64 EveryFramePasses = Info->instrumentation_count_total - EveryFrameStart;
+
+		ASSERT_THAT(IsTrue(EveryFramePasses >= 10));
+		ASSERT_THAT(IsTrue(SampledPasses * 5 < EveryFramePasses));
+	}
+
+}; // UnrealFlecsInstrumentationTests
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,124 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Entities/FlecsInternedName.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsInternedNameTests,
+								   "UnrealFlecs.Entities.InternedNames",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+							   "[Flecs][Entity][Name]")
+{
+	TEST_METHOD(InternedName_SameStringSameEntry)
+	{
+		const FFlecsInternedName NameA(TEXT("InternedTestName"));
+		const FFlecsInternedName NameB = FName(TEXT("InternedTestName"));
+
+		ASSERT_THAT(IsFalse(NameA.IsNone()));
+		ASSERT_THAT(IsTrue(NameA == NameB));
+		ASSERT_THAT(AreEqual(FName(TEXT("InternedTestName")), NameA.ToName()));
+		ASSERT_THAT(AreEqual(static_cast<uint64>(ecs_name_hash("InternedTestName", 16)), NameA.GetNameHash()));
+	}
+
+	TEST_METHOD(InternedName_IsCaseSensitive)
+	{
+		const FFlecsInternedName Lower(TEXT("casedname"));
+		const FFlecsInternedName Upper(TEXT("CasedName"));
+
+		ASSERT_THAT(IsTrue(Lower != Upper));
+		ASSERT_THAT(AreEqual(FString(TEXT("CasedName")), Upper.ToString()));
+	}
+
+	TEST_METHOD(InternedPath_SplitsOnSeparator)
+	{
+		const FFlecsInternedPath Path(TEXT("::My::Interned::Entity"));
+		ASSERT_THAT(AreEqual(3, Path.Num()));
+		ASSERT_THAT(AreEqual(FString(TEXT("Entity")), Path.GetLeaf().ToString()));
+		ASSERT_THAT(AreEqual(FString(TEXT("My::Interned::Entity")), Path.ToString()));
+
+		const FFlecsInternedPath DotPath(TEXT("My.Interned.Entity"), TEXT("."));
+		ASSERT_THAT(IsTrue(Path == DotPath));
+	}
+
+	TEST_METHOD(LookupEntity_InternedPathMatchesStringLookup)
+	{
+		const FFlecsEntityHandle Entity = World()->CreateEntity(TEXT("My::Interned::Lookup"));
+		ASSERT_THAT(IsTrue(Entity.IsValid()));
+
+		const FFlecsInternedPath Path(TEXT("My::Interned::Lookup"));
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(Path)));
+		ASSERT_THAT(AreEqual(World()->LookupEntity(TEXT("My::Interned::Lookup")), World()->LookupEntity(Path)));
+
+		// Second lookup is served from the path cache
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(Path)));
+	}
+
+	TEST_METHOD(LookupEntity_MissingPathReturnsInvalid)
+	{
+		const FFlecsInternedPath Path(TEXT("Does::Not::Exist"));
+		ASSERT_THAT(IsFalse(World()->LookupEntity(Path).IsValid()));
+	}
+
+	TEST_METHOD(CreateEntity_InternedPathCreatesHierarchy)
+	{
+		const FFlecsInternedPath Path(TEXT("Interned::Created::Leaf"));
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity(Path);
+		ASSERT_THAT(IsTrue(Entity.IsValid()));
+		ASSERT_THAT(AreEqual(FString(TEXT("Leaf")), Entity.GetName()));
+		ASSERT_THAT(AreEqual(FString(TEXT("::Interned::Created::Leaf")), Entity.GetPath()));
+
+		ASSERT_THAT(AreEqual(Entity, World()->CreateEntity(Path)));
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(TEXT("Interned::Created::Leaf"))));
+	}
+
+	TEST_METHOD(LookupEntity_CacheInvalidatedOnDestroy)
+	{
+		const FFlecsInternedPath Path(TEXT("Interned::Destroyed"));
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity(Path);
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(Path)));
+
+		Entity.Destroy();
+		ASSERT_THAT(IsFalse(World()->LookupEntity(Path).IsValid()));
+
+		const FFlecsEntityHandle Recreated = World()->CreateEntity(Path);
+		ASSERT_THAT(IsTrue(Recreated.IsValid()));
+		ASSERT_THAT(AreEqual(Recreated, World()->LookupEntity(Path)));
+	}
+
+	TEST_METHOD(LookupEntity_CacheInvalidatedOnRenameAndReparent)
+	{
+		const FFlecsInternedPath Path(TEXT("Interned::Renamed"));
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity(Path);
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(Path)));
+
+		Entity.SetName(FFlecsInternedName(TEXT("RenamedAway")));
+		ASSERT_THAT(IsFalse(World()->LookupEntity(Path).IsValid()));
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(FFlecsInternedPath(TEXT("Interned::RenamedAway")))));
+
+		const FFlecsEntityHandle NewParent = World()->CreateEntity(TEXT("OtherInterned"));
+		Entity.SetChildOf(NewParent);
+		ASSERT_THAT(IsFalse(World()->LookupEntity(FFlecsInternedPath(TEXT("Interned::RenamedAway"))).IsValid()));
+		ASSERT_THAT(AreEqual(Entity, World()->LookupEntity(FFlecsInternedPath(TEXT("OtherInterned::RenamedAway")))));
+	}
+
+	TEST_METHOD(LookupChild_ByInternedName)
+	{
+		const FFlecsEntityHandle Parent = World()->CreateEntity(TEXT("InternedParent"));
+		const FFlecsEntityHandle Child = World()->CreateEntity(TEXT("InternedParent::Child"));
+
+		const FFlecsInternedName ChildName(TEXT("Child"));
+		ASSERT_THAT(AreEqual(Child, Parent.LookupChild<FFlecsEntityHandle>(ChildName)));
+		ASSERT_THAT(AreEqual(Child, World()->LookupChild(Parent, ChildName)));
+		ASSERT_THAT(IsFalse(Parent.LookupChild<FFlecsEntityHandle>(FFlecsInternedName(TEXT("Missing"))).IsValid()));
+	}
+
+}; // UnrealFlecsInternedNameTests
+
+#endif // #if WITH_AUTOMATION_TESTS
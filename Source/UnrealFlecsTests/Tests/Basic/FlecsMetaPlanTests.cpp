@@ -0,0 +1,72 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsMetaPlanTests,
+								   "UnrealFlecs.Meta.Plan",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+							   "[Flecs][Meta]")
+{
+	flecs::world_t* NativeWorld() const
+	{
+		return World()->GetNativeFlecsWorld().c_ptr();
+	}
+
+	TEST_METHOD(Plan_VectorJsonRoundTrip)
+	{
+		const FFlecsEntityHandle VectorType = World()->GetScriptStructEntity<FVector>();
+
+		const FVector Value(1.5, -2.25, 3.0);
+		char* Json = ecs_ptr_to_json(NativeWorld(), VectorType, &Value);
+		ASSERT_THAT(IsNotNull(Json));
+
+		FVector Result = FVector::ZeroVector;
+		const char* End = ecs_ptr_from_json(NativeWorld(), VectorType, &Result, Json, nullptr);
+		ecs_os_free(Json);
+
+		ASSERT_THAT(IsNotNull(End));
+		ASSERT_THAT(AreEqual(Value, Result));
+	}
+
+	TEST_METHOD(Plan_OutOfOrderAndUnknownMembers)
+	{
+		const FFlecsEntityHandle VectorType = World()->GetScriptStructEntity<FVector>();
+
+		FVector Result = FVector::ZeroVector;
+		const char* End = ecs_ptr_from_json(NativeWorld(), VectorType, &Result,
+			"{\"Z\": 3, \"Unknown\": 7, \"X\": 1}", nullptr);
+
+		ASSERT_THAT(IsNotNull(End));
+		ASSERT_THAT(AreEqual(FVector(1.0, 0.0, 3.0), Result));
+
+		ecs_from_json_desc_t Desc = {};
+		Desc.strict = true;
+		ASSERT_THAT(IsNull(ecs_ptr_from_json(NativeWorld(), VectorType, &Result, "{\"Unknown\": 7}", &Desc)));
+	}
+
+	TEST_METHOD(Plan_PackUnpackVectors)
+	{
+		const FFlecsEntityHandle VectorType = World()->GetScriptStructEntity<FVector>();
+		ASSERT_THAT(AreEqual(static_cast<ecs_size_t>(sizeof(double) * 3),
+			ecs_meta_packed_size(NativeWorld(), VectorType)));
+
+		const TArray<FVector> Source = { FVector(1.0, 2.0, 3.0), FVector(4.0, 5.0, 6.0), FVector(-1.0) };
+
+		TArray<uint8> Packed;
+		Packed.SetNumZeroed(ecs_meta_packed_size(NativeWorld(), VectorType) * Source.Num());
+		ASSERT_THAT(AreEqual(0, ecs_meta_pack(NativeWorld(), VectorType, Source.GetData(), Source.Num(), Packed.GetData())));
+
+		TArray<FVector> Result;
+		Result.SetNumZeroed(Source.Num());
+		ASSERT_THAT(AreEqual(0, ecs_meta_unpack(NativeWorld(), VectorType, Result.GetData(), Result.Num(), Packed.GetData())));
+		ASSERT_THAT(IsTrue(Source == Result));
+	}
+
+}; // UnrealFlecsMetaPlanTests
+
+#endif // #if WITH_AUTOMATION_TESTS
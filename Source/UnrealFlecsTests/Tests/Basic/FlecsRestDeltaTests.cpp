@@ -0,0 +1,153 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsRestDeltaTests,
+								   "UnrealFlecs.Rest.Delta",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+							   "[Flecs][Rest]")
+{
+	ecs_http_server_t* Server = nullptr;
+
+	virtual void OnWorldSetUp() override
+	{
+		Server = ecs_rest_server_init(World()->GetNativeFlecsWorld().c_ptr(), nullptr);
+	}
+
+	virtual void OnWorldTearDown() override
+	{
+		if (Server)
+		{
+			ecs_rest_server_fini(Server);
+			Server = nullptr;
+		}
+	}
+
+	TArray<uint8> Request(const FString& InRequest, FString* OutHeaders = nullptr) const
+	{
+		ecs_http_reply_t Reply = ECS_HTTP_REPLY_INIT;
+		ecs_http_server_request(Server, "GET", StringCast<ANSICHAR>(*InRequest).Get(), nullptr, &Reply);
+
+		const int32 Length = ecs_strbuf_written(&Reply.body);
+		char* Body = ecs_strbuf_get(&Reply.body);
+		char* Headers = ecs_strbuf_get(&Reply.headers);
+
+		TArray<uint8> Result(reinterpret_cast<const uint8*>(Body), Body ? Length : 0);
+
+		if (OutHeaders && Headers)
+		{
+			*OutHeaders = UTF8_TO_TCHAR(Headers);
+		}
+
+		ecs_os_free(Body);
+		ecs_os_free(Headers);
+		return Result;
+	}
+
+	FString RequestJson(const FString& InRequest) const
+	{
+		TArray<uint8> Body = Request(InRequest);
+		Body.Add(0);
+		return UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Body.GetData()));
+	}
+
+	static int64 ParseRevision(const FString& InJson)
+	{
+		static const FString RevisionKey = TEXT("\"revision\":");
+
+		const int32 Index = InJson.Find(RevisionKey);
+		return Index == INDEX_NONE ? -1 : FCString::Atoi64(*InJson.Mid(Index + RevisionKey.Len()));
+	}
+
+	TEST_METHOD(Delta_FirstRequestIsFull)
+	{
+		const FFlecsEntityHandle Entity = World()->CreateEntity();
+		Entity.Add<FFlecsTestStruct_Tag>();
+
+		FString Headers;
+		TArray<uint8> Body = Request(TEXT("/delta?session=first&ack=0&sync=true"), &Headers);
+		Body.Add(0);
+		const FString Json = UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Body.GetData()));
+
+		ASSERT_THAT(IsTrue(Json.Contains(TEXT("\"full\":true"))));
+		ASSERT_THAT(IsTrue(Json.Contains(TEXT("\"pending\":false"))));
+		ASSERT_THAT(IsTrue(Json.Contains(FString::Printf(TEXT("%llu"), static_cast<uint64>(Entity.GetFlecsId().GetId())))));
+		ASSERT_THAT(IsTrue(ParseRevision(Json) > 0));
+		ASSERT_THAT(IsTrue(Headers.Contains(TEXT("X-Flecs-Delta-Session: first"))));
+	}
+
+	TEST_METHOD(Delta_AcknowledgedRevisionOnlySendsChanges)
+	{
+		const FString FullJson = RequestJson(TEXT("/delta?session=inc&ack=0&sync=true"));
+		const int64 Revision = ParseRevision(FullJson);
+		ASSERT_THAT(IsTrue(Revision > 0));
+
+		const FString UnchangedJson = RequestJson(
+			FString::Printf(TEXT("/delta?session=inc&ack=%lld&sync=true"), Revision));
+		ASSERT_THAT(IsTrue(UnchangedJson.Contains(TEXT("\"full\":false"))));
+		ASSERT_THAT(IsTrue(UnchangedJson.Contains(TEXT("\"tables\":[]"))));
+		ASSERT_THAT(AreEqual(Revision, ParseRevision(UnchangedJson)));
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity();
+		Entity.Add<FFlecsTestStruct_Tag>();
+
+		const FString ChangedJson = RequestJson(
+			FString::Printf(TEXT("/delta?session=inc&ack=%lld&sync=true"), Revision));
+		ASSERT_THAT(IsTrue(ChangedJson.Contains(TEXT("\"full\":false"))));
+		ASSERT_THAT(IsTrue(ParseRevision(ChangedJson) > Revision));
+		ASSERT_THAT(IsTrue(ChangedJson.Contains(FString::Printf(TEXT("%llu"), static_cast<uint64>(Entity.GetFlecsId().GetId())))));
+		ASSERT_THAT(IsTrue(ChangedJson.Len() < FullJson.Len()));
+	}
+
+	TEST_METHOD(Delta_UnknownRevisionFallsBackToFull)
+	{
+		const FString Json = RequestJson(TEXT("/delta?session=unknown&ack=999999999&sync=true"));
+		ASSERT_THAT(IsTrue(Json.Contains(TEXT("\"full\":true"))));
+		ASSERT_THAT(IsTrue(Json.Contains(TEXT("\"base\":0"))));
+	}
+
+	TEST_METHOD(Delta_BinaryEncodingIsSmallerThanJson)
+	{
+		const FString Json = RequestJson(TEXT("/delta?session=json&ack=0&sync=true"));
+		const TArray<uint8> Binary = Request(TEXT("/delta?session=binary&ack=0&sync=true&encoding=binary"));
+
+		ASSERT_THAT(IsTrue(Binary.Num() > 5));
+		ASSERT_THAT(IsTrue(FMemory::Memcmp(Binary.GetData(), "FLD1", 4) == 0));
+		ASSERT_THAT(AreEqual(static_cast<uint8>(1), Binary[4]));
+		ASSERT_THAT(IsTrue(Binary.Num() < Json.Len()));
+	}
+
+	TEST_METHOD(Delta_IsNeverServedFromTheReplyCache)
+	{
+		// Same reply cache the REST module uses for its servers
+		ecs_rest_server_fini(Server);
+
+		ecs_http_server_desc_t Desc = {};
+		Desc.cache_timeout = 10.0;
+		Server = ecs_rest_server_init(World()->GetNativeFlecsWorld().c_ptr(), &Desc);
+		ASSERT_THAT(IsNotNull(Server));
+
+		const FString FirstJson = RequestJson(TEXT("/delta?session=cached&ack=0&sync=true"));
+		ASSERT_THAT(IsTrue(ParseRevision(FirstJson) > 0));
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity();
+		Entity.Add<FFlecsTestStruct_Tag>();
+
+		FString Headers;
+		TArray<uint8> Body = Request(TEXT("/delta?session=cached&ack=0&sync=true"), &Headers);
+		Body.Add(0);
+		const FString SecondJson = UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Body.GetData()));
+
+		ASSERT_THAT(IsTrue(Headers.Contains(TEXT("X-Flecs-Delta-Session: cached"))));
+		ASSERT_THAT(IsTrue(ParseRevision(SecondJson) > ParseRevision(FirstJson)));
+		ASSERT_THAT(IsTrue(SecondJson.Contains(FString::Printf(TEXT("%llu"), static_cast<uint64>(Entity.GetFlecsId().GetId())))));
+	}
+
+}; // UnrealFlecsRestDeltaTests
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,120 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Tasks/Task.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+
+#include "flecs/Unreal/FlecsTypeMapComponent.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsTypeIdCacheTests,
+								   "UnrealFlecs.Types.TypeIdCache",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+							   "[Flecs][Component]")
+{
+	TEST_METHOD(TypeIdCache_MatchesRegisteredScriptStruct)
+	{
+		const FFlecsEntityHandle StructEntity = World()->RegisterComponentType<FFlecsTestStruct_Value>();
+
+		const FFlecsTypeMapComponent* TypeMap = World()->GetTypeMapComponent();
+		ASSERT_THAT(IsNotNull(TypeMap));
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(StructEntity.GetFlecsId()),
+			TypeMap->FindTypeId(FFlecsTestStruct_Value::StaticStruct())));
+	}
+
+	TEST_METHOD(TypeIdCache_MissesObjectThatReusesIndexOfDestroyedType)
+	{
+		FFlecsTypeIdCache Cache;
+
+		UFlecsUObjectComponentTestObject* Destroyed = NewObject<UFlecsUObjectComponentTestObject>();
+		const UObjectBase* DestroyedAddress = Destroyed;
+		const int32 DestroyedIndex = Destroyed->GetUniqueID();
+
+		Cache.Add(Destroyed, 42);
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(42), Cache.Find(Destroyed)));
+
+		Destroyed->MarkAsGarbage();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+		// Freed indices and memory are handed out again first, so a replacement type usually reuses both
+		TArray<TStrongObjectPtr<UFlecsUObjectComponentTestObject>> Replacements;
+		bool bReusedIndex = false;
+
+		for (int32 Attempt = 0; Attempt < 64; ++Attempt)
+		{
+			UFlecsUObjectComponentTestObject* Replacement = NewObject<UFlecsUObjectComponentTestObject>();
+			Replacements.Emplace(Replacement);
+
+			bReusedIndex |= static_cast<int32>(Replacement->GetUniqueID()) == DestroyedIndex
+				&& static_cast<const UObjectBase*>(Replacement) == DestroyedAddress;
+
+			ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(0), Cache.Find(Replacement)));
+		}
+
+		AddInfo(FString::Printf(TEXT("Index and address of the destroyed type were %s"),
+			bReusedIndex ? TEXT("reused") : TEXT("not reused")));
+	}
+
+	TEST_METHOD(TypeIdCache_LookupsWhileTypesAreAdded_NeverReturnAnotherTypesId)
+	{
+		static constexpr int32 TypeCount = 4096;
+		static constexpr int32 ReaderCount = 4;
+
+		FFlecsTypeIdCache Cache;
+
+		TArray<TStrongObjectPtr<UFlecsUObjectComponentTestObject>> Types;
+		Types.Reserve(TypeCount);
+
+		for (int32 Index = 0; Index < TypeCount; ++Index)
+		{
+			Types.Emplace(NewObject<UFlecsUObjectComponentTestObject>());
+		}
+
+		std::atomic<bool> bWriting = true;
+		std::atomic<int32> WrongIdCount = 0;
+
+		// Readers keep looking up every type while the game thread adds them, new pages are published concurrently
+		TArray<UE::Tasks::FTask> Readers;
+		for (int32 ReaderIndex = 0; ReaderIndex < ReaderCount; ++ReaderIndex)
+		{
+			Readers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Cache, &Types, &bWriting, &WrongIdCount]()
+			{
+				do
+				{
+					for (int32 Index = 0; Index < TypeCount; ++Index)
+					{
+						const flecs::entity_t Id = Cache.Find(Types[Index].Get());
+						if (Id != 0 && Id != static_cast<flecs::entity_t>(Index + 1))
+						{
+							++WrongIdCount;
+						}
+					}
+				}
+				while (bWriting);
+			}));
+		}
+
+		for (int32 Index = 0; Index < TypeCount; ++Index)
+		{
+			Cache.Add(Types[Index].Get(), static_cast<flecs::entity_t>(Index + 1));
+		}
+
+		bWriting = false;
+		UE::Tasks::Wait(Readers);
+
+		ASSERT_THAT(AreEqual(0, WrongIdCount.load()));
+
+		for (int32 Index = 0; Index < TypeCount; ++Index)
+		{
+			ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(Index + 1), Cache.Find(Types[Index].Get())));
+		}
+	}
+
+}; // UnrealFlecsTypeIdCacheTests
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,140 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsComponentIdBenchmarks,
+								   "UnrealFlecs.Benchmarks.ComponentId",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Component]")
+{
+	static constexpr int32 EntityCount = 4096;
+	static constexpr int32 Iterations = 32;
+
+	TArray<FFlecsEntityHandle> Entities;
+
+	virtual void OnWorldSetUp() override
+	{
+		World()->RegisterComponentType<FFlecsTestStruct_Value>();
+
+		Entities.Reset(EntityCount);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			Entities.Add(World()->CreateEntity().Add<FFlecsTestStruct_Value>());
+		}
+	}
+
+	TEST_METHOD(Set_ScriptStruct_Vs_Templated)
+	{
+		const UScriptStruct* ValueStruct = FFlecsTestStruct_Value::StaticStruct();
+
+		const FFlecsBenchmarkResult ReflectedResult = RunFlecsBenchmark(*this, TEXT("Set(UScriptStruct*, void*)"),
+			Iterations, EntityCount, [this, ValueStruct]()
+			{
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					const FFlecsTestStruct_Value Value{ .Value = Index };
+					Entities[Index].Set(ValueStruct, &Value);
+				}
+			});
+
+		const FFlecsBenchmarkResult TemplatedResult = RunFlecsBenchmark(*this, TEXT("Set<T>(const T&)"),
+			Iterations, EntityCount, [this]()
+			{
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					Entities[Index].Set<FFlecsTestStruct_Value>(FFlecsTestStruct_Value{ .Value = Index });
+				}
+			});
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			ASSERT_THAT(AreEqual(Index, Entities[Index].Get<FFlecsTestStruct_Value>().Value));
+		}
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Reflected Set overhead over templated Set: %.2fx"),
+			ReflectedResult.MinSeconds / FMath::Max(TemplatedResult.MinSeconds, UE_SMALL_NUMBER)));
+	}
+
+	TEST_METHOD(Has_ScriptStruct_Vs_Templated)
+	{
+		const UScriptStruct* ValueStruct = FFlecsTestStruct_Value::StaticStruct();
+
+		int32 ReflectedMatches = 0;
+		RunFlecsBenchmark(*this, TEXT("Has(UScriptStruct*)"), Iterations, EntityCount,
+			[this, ValueStruct, &ReflectedMatches]()
+			{
+				for (const FFlecsEntityHandle& Entity : Entities)
+				{
+					ReflectedMatches += Entity.Has(ValueStruct);
+				}
+			});
+
+		int32 TemplatedMatches = 0;
+		RunFlecsBenchmark(*this, TEXT("Has<T>()"), Iterations, EntityCount,
+			[this, &TemplatedMatches]()
+			{
+				for (const FFlecsEntityHandle& Entity : Entities)
+				{
+					TemplatedMatches += Entity.Has<FFlecsTestStruct_Value>();
+				}
+			});
+
+		ASSERT_THAT(AreEqual(EntityCount * (Iterations + 1), ReflectedMatches));
+		ASSERT_THAT(AreEqual(ReflectedMatches, TemplatedMatches));
+	}
+
+	TEST_METHOD(TypeLookup_HashMap_Vs_TypeIdCache)
+	{
+		const FFlecsTypeMapComponent* TypeMap = World()->GetTypeMapComponent();
+		ASSERT_THAT(IsNotNull(TypeMap));
+
+		const TArray<const UScriptStruct*> Structs =
+		{
+			FFlecsTestStruct_Value::StaticStruct(),
+			TBaseStructure<FVector>::Get(),
+			TBaseStructure<FQuat>::Get(),
+			TBaseStructure<FTransform>::Get(),
+		};
+
+		for (const UScriptStruct* Struct : Structs)
+		{
+			World()->RegisterComponentType(Struct);
+			ASSERT_THAT(AreEqual(TypeMap->ScriptStructMap.at(Struct), TypeMap->FindTypeId(Struct)));
+		}
+
+		flecs::entity_t MapSum = 0;
+		const FFlecsBenchmarkResult MapResult = RunFlecsBenchmark(*this, TEXT("ScriptStructMap.at"),
+			Iterations, EntityCount, [&]()
+			{
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					MapSum += TypeMap->ScriptStructMap.at(Structs[Index % Structs.Num()]);
+				}
+			});
+
+		flecs::entity_t CacheSum = 0;
+		const FFlecsBenchmarkResult CacheResult = RunFlecsBenchmark(*this, TEXT("FindTypeId"),
+			Iterations, EntityCount, [&]()
+			{
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					CacheSum += TypeMap->FindTypeId(Structs[Index % Structs.Num()]);
+				}
+			});
+
+		ASSERT_THAT(AreEqual(MapSum, CacheSum));
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Type id cache speedup: %.2fx"),
+			MapResult.MinSeconds / FMath::Max(CacheResult.MinSeconds, UE_SMALL_NUMBER)));
+	}
+
+}; // UnrealFlecsComponentIdBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
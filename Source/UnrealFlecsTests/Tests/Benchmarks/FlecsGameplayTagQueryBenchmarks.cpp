@@ -0,0 +1,103 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Queries/FlecsQuery.h"
+#include "Queries/FlecsQueryBuilder.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsGameplayTagQueryBenchmarks,
+								   "UnrealFlecs.Benchmarks.GameplayTagQuery",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][GameplayTag][Query]")
+{
+	static constexpr int32 EntityCount = 16384;
+	static constexpr int32 Iterations = 32;
+
+	FGameplayTag MatchTag;
+	int32 ExpectedMatches = 0;
+
+	virtual void OnWorldSetUp() override
+	{
+		const FFlecsTestNativeGameplayTags& Tags = FFlecsTestNativeGameplayTags::Get();
+		MatchTag = Tags.TestSameSubGrandchildTag1.RequestDirectParent();
+
+		// Two of the four tags are children of MatchTag
+		const FGameplayTag EntityTags[] =
+		{
+			Tags.TestSameSubGrandchildTag1,
+			Tags.TestSameSubGrandchildTag2,
+			Tags.TestSameSubTag2,
+			Tags.TestTag1,
+		};
+
+		ExpectedMatches = 0;
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const FGameplayTag& Tag = EntityTags[Index % UE_ARRAY_COUNT(EntityTags)];
+			ExpectedMatches += Tag.MatchesTag(MatchTag);
+
+			World()->CreateEntity()
+				.Add(Tag)
+				.Set<FGameplayTagContainer>(FGameplayTagContainer(Tag));
+		}
+	}
+
+	TEST_METHOD(MatchingTagQuery_Vs_TagContainerHasTag)
+	{
+		FFlecsQuery MatchingTagQuery = World()->CreateQueryBuilder()
+			.WithMatchingTag(MatchTag)
+			.Build();
+
+		FFlecsQuery ContainerQuery = World()->CreateQueryBuilder()
+			.With<FGameplayTagContainer>()
+			.Build();
+
+		int32 QueryMatches = 0;
+		const FFlecsBenchmarkResult QueryResult = RunFlecsBenchmark(*this, TEXT("WithMatchingTag query"),
+			Iterations, EntityCount, [&MatchingTagQuery, &QueryMatches]()
+			{
+				QueryMatches = 0;
+				MatchingTagQuery.run([&QueryMatches](flecs::iter& InIterator)
+				{
+					while (InIterator.next())
+					{
+						QueryMatches += static_cast<int32>(InIterator.count());
+					}
+				});
+			});
+
+		int32 ContainerMatches = 0;
+		const FFlecsBenchmarkResult ContainerResult = RunFlecsBenchmark(*this, TEXT("FGameplayTagContainer::HasTag loop"),
+			Iterations, EntityCount, [this, &ContainerQuery, &ContainerMatches]()
+			{
+				ContainerMatches = 0;
+				ContainerQuery.run([this, &ContainerMatches](flecs::iter& InIterator)
+				{
+					while (InIterator.next())
+					{
+						const flecs::field<const FGameplayTagContainer> Containers = InIterator.field<const FGameplayTagContainer>(0);
+
+						for (const size_t Index : InIterator)
+						{
+							ContainerMatches += Containers[Index].HasTag(MatchTag);
+						}
+					}
+				});
+			});
+
+		ASSERT_THAT(AreEqual(ExpectedMatches, QueryMatches));
+		ASSERT_THAT(AreEqual(ExpectedMatches, ContainerMatches));
+
+		TestRunner->AddInfo(FString::Printf(TEXT("HasTag loop overhead over WithMatchingTag query: %.2fx"),
+			ContainerResult.MinSeconds / FMath::Max(QueryResult.MinSeconds, UE_SMALL_NUMBER)));
+	}
+
+}; // UnrealFlecsGameplayTagQueryBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,127 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsHttpLoadTest.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsHttpLoadBenchmarks,
+								   "UnrealFlecs.Benchmarks.HttpLoad",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Http]")
+{
+	static constexpr uint16 Port = 27860;
+	static constexpr int32 EntityCount = 1024;
+
+	TArray<ecs_http_server_t*> Servers;
+
+	virtual void OnWorldSetUp() override
+	{
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			World()->CreateEntity(FString::Printf(TEXT("HttpLoad::Entity%d"), Index));
+		}
+	}
+
+	virtual void OnWorldTearDown() override
+	{
+		for (ecs_http_server_t* Server : Servers)
+		{
+			ecs_http_server_stop(Server);
+			ecs_rest_server_fini(Server);
+		}
+
+		Servers.Reset();
+	}
+
+	ecs_http_server_t* StartServer(const int32 InWorkerCount, const int32 InCompressionThreshold = 0)
+	{
+		ecs_http_server_desc_t Desc = {};
+		Desc.port = Port;
+		Desc.worker_count = InWorkerCount;
+		Desc.compression_threshold = InCompressionThreshold;
+
+		ecs_http_server_t* Server = ecs_rest_server_init(World()->GetNativeFlecsWorld().c_ptr(), &Desc);
+		if (Server && ecs_http_server_start(Server) == 0)
+		{
+			Servers.Add(Server);
+			return Server;
+		}
+
+		if (Server)
+		{
+			ecs_rest_server_fini(Server);
+		}
+
+		return nullptr;
+	}
+
+	TEST_METHOD(Load_SmallRequests_WorkerCount)
+	{
+		FFlecsHttpLoadTestSettings Settings;
+		Settings.Path = TEXT("/entity/flecs/core/World");
+		Settings.ClientCount = 16;
+		Settings.RequestsPerClient = 64;
+
+		for (const int32 WorkerCount : { 1, 4 })
+		{
+			ecs_http_server_t* Server = StartServer(WorkerCount);
+			ASSERT_THAT(IsNotNull(Server));
+
+			const FFlecsHttpLoadTestResult Result = RunFlecsHttpLoadTest(*this,
+				FString::Printf(TEXT("GET /entity (%d workers)"), WorkerCount), Server, Settings);
+
+			ASSERT_THAT(AreEqual(0, Result.Failures));
+			ASSERT_THAT(AreEqual(Settings.ClientCount * Settings.RequestsPerClient, Result.Requests));
+		}
+	}
+
+	TEST_METHOD(Load_SmallRequests_Pipelined)
+	{
+		ecs_http_server_t* Server = StartServer(4);
+		ASSERT_THAT(IsNotNull(Server));
+
+		FFlecsHttpLoadTestSettings Settings;
+		Settings.Path = TEXT("/entity/flecs/core/World");
+		Settings.ClientCount = 16;
+		Settings.RequestsPerClient = 64;
+
+		for (const int32 PipelineDepth : { 1, 8 })
+		{
+			Settings.PipelineDepth = PipelineDepth;
+
+			const FFlecsHttpLoadTestResult Result = RunFlecsHttpLoadTest(*this,
+				FString::Printf(TEXT("GET /entity (pipeline depth %d)"), PipelineDepth), Server, Settings);
+
+			ASSERT_THAT(AreEqual(0, Result.Failures));
+		}
+	}
+
+	TEST_METHOD(Load_LargeReplies_Compression)
+	{
+		ecs_http_server_t* Server = StartServer(4, 16 * 1024);
+		ASSERT_THAT(IsNotNull(Server));
+
+		FFlecsHttpLoadTestSettings Settings;
+		Settings.Path = TEXT("/world");
+		Settings.ClientCount = 8;
+		Settings.RequestsPerClient = 16;
+
+		const FFlecsHttpLoadTestResult Identity = RunFlecsHttpLoadTest(*this,
+			TEXT("GET /world (identity)"), Server, Settings);
+
+		Settings.AcceptEncoding = TEXT("gzip");
+		const FFlecsHttpLoadTestResult Gzip = RunFlecsHttpLoadTest(*this,
+			TEXT("GET /world (gzip)"), Server, Settings);
+
+		ASSERT_THAT(AreEqual(0, Identity.Failures));
+		ASSERT_THAT(AreEqual(0, Gzip.Failures));
+		ASSERT_THAT(IsTrue(Gzip.BytesReceived < Identity.BytesReceived));
+	}
+
+}; // UnrealFlecsHttpLoadBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,109 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Entities/FlecsInternedName.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsNameLookupBenchmarks,
+								   "UnrealFlecs.Benchmarks.NameLookup",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Name]")
+{
+	static constexpr int32 EntityCount = 1024;
+	static constexpr int32 Iterations = 32;
+
+	TArray<FString> StringPaths;
+	TArray<FFlecsInternedPath> InternedPaths;
+	TArray<FFlecsEntityHandle> Entities;
+
+	virtual void OnWorldSetUp() override
+	{
+		StringPaths.Reset(EntityCount);
+		InternedPaths.Reset(EntityCount);
+		Entities.Reset(EntityCount);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const FString Path = FString::Printf(TEXT("Benchmark::Group%d::Entity%d"), Index % 16, Index);
+
+			Entities.Add(World()->CreateEntity(Path));
+			StringPaths.Add(Path);
+			InternedPaths.Emplace(Path);
+		}
+	}
+
+	TEST_METHOD(LookupEntity_StringPath_Vs_InternedPath)
+	{
+		int32 StringMatches = 0;
+		const FFlecsBenchmarkResult StringResult = RunFlecsBenchmark(*this, TEXT("LookupEntity(FString)"),
+			Iterations, EntityCount, [this, &StringMatches]()
+			{
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					StringMatches += World()->LookupEntity(StringPaths[Index]) == Entities[Index];
+				}
+			});
+
+		int32 InternedMatches = 0;
+		const FFlecsBenchmarkResult InternedResult = RunFlecsBenchmark(*this, TEXT("LookupEntity(FFlecsInternedPath)"),
+			Iterations, EntityCount, [this, &InternedMatches]()
+			{
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					InternedMatches += World()->LookupEntity(InternedPaths[Index]) == Entities[Index];
+				}
+			});
+
+		ASSERT_THAT(AreEqual(EntityCount * (Iterations + 1), StringMatches));
+		ASSERT_THAT(AreEqual(EntityCount * (Iterations + 1), InternedMatches));
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Interned path lookup speedup: %.2fx"),
+			StringResult.MinSeconds / FMath::Max(InternedResult.MinSeconds, UE_SMALL_NUMBER)));
+	}
+
+	TEST_METHOD(LookupChild_StringName_Vs_InternedName)
+	{
+		const FFlecsEntityHandle Group = World()->LookupEntity(TEXT("Benchmark::Group0"));
+		ASSERT_THAT(IsTrue(Group.IsValid()));
+
+		TArray<FString> ChildNames;
+		TArray<FFlecsInternedName> InternedChildNames;
+
+		for (int32 Index = 0; Index < EntityCount; Index += 16)
+		{
+			ChildNames.Add(FString::Printf(TEXT("Entity%d"), Index));
+			InternedChildNames.Emplace(ChildNames.Last());
+		}
+
+		int32 StringMatches = 0;
+		RunFlecsBenchmark(*this, TEXT("Lookup(FString)"),
+			Iterations, ChildNames.Num(), [&]()
+			{
+				for (const FString& ChildName : ChildNames)
+				{
+					StringMatches += Group.Lookup<FFlecsEntityHandle>(ChildName).IsValid();
+				}
+			});
+
+		int32 InternedMatches = 0;
+		RunFlecsBenchmark(*this, TEXT("LookupChild(FFlecsInternedName)"),
+			Iterations, InternedChildNames.Num(), [&]()
+			{
+				for (const FFlecsInternedName& ChildName : InternedChildNames)
+				{
+					InternedMatches += Group.LookupChild<FFlecsEntityHandle>(ChildName).IsValid();
+				}
+			});
+
+		ASSERT_THAT(AreEqual(StringMatches, InternedMatches));
+		ASSERT_THAT(AreEqual(ChildNames.Num() * (Iterations + 1), InternedMatches));
+	}
+
+}; // UnrealFlecsNameLookupBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,105 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Async/ParallelFor.h"
+
+#include "Networking/DefaultFlecsNetworkIdGenerator.h"
+
+TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsNetworkIdGeneratorBenchmarks,
+								   "UnrealFlecs.Benchmarks.NetworkIdGenerator",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Networking]")
+{
+	static constexpr int32 TaskCount = 8;
+	static constexpr int32 IdsPerTask = 8192;
+	static constexpr int32 WaveSize = 512;
+	static constexpr int32 Iterations = 16;
+
+	TEST_METHOD(GenerateAndRelease_SingleThread_Vs_Contended)
+	{
+		UDefaultFlecsNetworkIdGenerator* Generator = NewObject<UDefaultFlecsNetworkIdGenerator>();
+
+		TArray<TArray<FFlecsNetworkId>> TaskIds;
+		TaskIds.SetNum(TaskCount);
+
+		for (TArray<FFlecsNetworkId>& Ids : TaskIds)
+		{
+			Ids.Reserve(IdsPerTask);
+		}
+
+		const auto GenerateAndRelease = [Generator, &TaskIds](const int32 TaskIndex)
+		{
+			TArray<FFlecsNetworkId>& Ids = TaskIds[TaskIndex];
+
+			for (int32 Index = 0; Index < IdsPerTask; ++Index)
+			{
+				Ids.Add(Generator->GenerateNetworkId());
+			}
+
+			for (const FFlecsNetworkId& NetworkId : Ids)
+			{
+				Generator->ReleaseNetworkId(NetworkId);
+			}
+
+			Ids.Reset();
+		};
+
+		RunFlecsBenchmark(*this, TEXT("Generate + Release, 1 thread"),
+			Iterations, TaskCount * IdsPerTask, [&GenerateAndRelease]()
+			{
+				for (int32 TaskIndex = 0; TaskIndex < TaskCount; ++TaskIndex)
+				{
+					GenerateAndRelease(TaskIndex);
+				}
+			});
+
+		RunFlecsBenchmark(*this, FString::Printf(TEXT("Generate + Release, %d tasks"), TaskCount),
+			Iterations, TaskCount * IdsPerTask, [&GenerateAndRelease]()
+			{
+				ParallelFor(TaskCount, GenerateAndRelease);
+			});
+
+		// Slots are reused across iterations instead of growing with every one of them
+		ASSERT_THAT(IsTrue(Generator->GetClaimedSlotCount()
+			<= static_cast<uint64>(TaskCount * IdsPerTask + UDefaultFlecsNetworkIdGenerator::ShardCount
+				* (UDefaultFlecsNetworkIdGenerator::FreshSlotBlockSize + UDefaultFlecsNetworkIdGenerator::FreeIdBatchSize * 2))));
+	}
+
+	TEST_METHOD(WaveSpawn_Generate_Vs_ReserveRange)
+	{
+		UDefaultFlecsNetworkIdGenerator* Generator = NewObject<UDefaultFlecsNetworkIdGenerator>();
+
+		TArray<FFlecsNetworkId> NetworkIds;
+		NetworkIds.Reserve(WaveSize);
+
+		RunFlecsBenchmark(*this, TEXT("GenerateNetworkId per entity"),
+			Iterations, WaveSize, [Generator, &NetworkIds]()
+			{
+				Generator->ResetNetworkIdGenerator();
+				NetworkIds.Reset();
+
+				for (int32 Index = 0; Index < WaveSize; ++Index)
+				{
+					NetworkIds.Add(Generator->GenerateNetworkId());
+				}
+			});
+
+		RunFlecsBenchmark(*this, TEXT("ReserveNetworkIdRange"),
+			Iterations, WaveSize, [Generator, &NetworkIds]()
+			{
+				Generator->ResetNetworkIdGenerator();
+				NetworkIds.Reset();
+
+				Generator->ReserveNetworkIdRange(WaveSize, NetworkIds);
+			});
+
+		ASSERT_THAT(AreEqual(WaveSize, NetworkIds.Num()));
+	}
+
+}; // UnrealFlecsNetworkIdGeneratorBenchmarks
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -0,0 +1,133 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Networking/Layout/FlecsReplicationLayoutRegistry.h"
+#include "Networking/Layout/FlecsReplicationSnapshot.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsReplicationApplyBenchmarks,
+								   "UnrealFlecs.Benchmarks.ReplicationApply",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Networking][Replication]")
+{
+	static constexpr int32 EntityCount = 10000;
+	static constexpr int32 Iterations = 16;
+	static constexpr uint32 FirstNetworkId = 1000;
+
+	TEST_METHOD(ApplySnapshots_ToExistingEntities)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 1 })
+			.Set<FFlecsReplicationTestNativeValue>({ 2 })
+			.Add<FFlecsReplicationTestTag>();
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			NetworkSubsystem()->QueueReplicationSnapshot(FFlecsNetworkId(FirstNetworkId + Index, 1), Snapshot);
+		}
+
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+
+		const TOptional<FFlecsEntityHandle> ReceivedEntity =
+			NetworkSubsystem()->GetEntityFromNetworkId(FFlecsNetworkId(FirstNetworkId, 1));
+		ASSERT_THAT(IsTrue(ReceivedEntity.IsSet()));
+		if (!ReceivedEntity.IsSet())
+		{
+			return;
+		}
+
+		const ecs_table_t* InitialTable = ecs_get_table(World()->GetNativeFlecsWorld(), ReceivedEntity.GetValue().GetFlecsId());
+
+		// Every update carries all values of the layout, like a full snapshot received by a client
+		int32 Value = 1;
+		const FFlecsBenchmarkResult Result = RunFlecsBenchmark(*this, TEXT("Apply snapshots to existing entities"),
+			Iterations, EntityCount, [this, &SourceEntity, &Snapshot, &Value]()
+			{
+				SourceEntity.Set<FFlecsReplicationTestValue>({ ++Value });
+				Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					NetworkSubsystem()->QueueReplicationSnapshot(FFlecsNetworkId(FirstNetworkId + Index, 1), Snapshot);
+				}
+
+				NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+			});
+
+		TestRunner->AddInfo(FString::Printf(TEXT("%s: %.0f updates/s per client"), *Result.Name,
+			static_cast<double>(Result.OperationsPerIteration) / Result.MinSeconds));
+
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+		ASSERT_THAT(AreEqual(Value, ReceivedEntity.GetValue().Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(IsTrue(ReceivedEntity.GetValue().Has<FFlecsReplicationTestTag>()));
+
+		// Updates are applied in place, the entity never leaves the table it was created in
+		ASSERT_THAT(IsTrue(ecs_get_table(World()->GetNativeFlecsWorld(), ReceivedEntity.GetValue().GetFlecsId()) == InitialTable));
+	}
+
+	TEST_METHOD(ApplySnapshots_MassSpawnIntoReusedSlots)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 1 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		// Every frame spawns a new generation into the same slots, which replaces the previous generation
+		uint32 Generation = 0;
+		const FFlecsBenchmarkResult Result = RunFlecsBenchmark(*this, TEXT("Mass spawn into reused network ID slots"),
+			Iterations, EntityCount, [this, &Snapshot, &Generation]()
+			{
+				++Generation;
+
+				for (int32 Index = 0; Index < EntityCount; ++Index)
+				{
+					NetworkSubsystem()->QueueReplicationSnapshot(FFlecsNetworkId(FirstNetworkId + Index, Generation), Snapshot);
+				}
+
+				NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+			});
+
+		TestRunner->AddInfo(FString::Printf(TEXT("%s: %.0f spawns/s per client"), *Result.Name,
+			static_cast<double>(Result.OperationsPerIteration) / Result.MinSeconds));
+
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+		ASSERT_THAT(AreEqual(EntityCount, NetworkSubsystem()->GetNetworkEntities().Num()));
+		ASSERT_THAT(IsTrue(NetworkSubsystem()->GetEntityFromNetworkId(FFlecsNetworkId(FirstNetworkId, Generation)).IsSet()));
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->GetEntityFromNetworkId(FFlecsNetworkId(FirstNetworkId, Generation - 1)).IsSet()));
+	}
+
+}; // UnrealFlecsReplicationApplyBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,160 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Entities/FlecsStablePathTag.h"
+
+#include "Networking/Layout/FlecsReplicationLayoutRegistry.h"
+#include "Networking/Layout/FlecsReplicationSnapshot.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsReplicationBaselineBenchmarks,
+								   "UnrealFlecs.Benchmarks.ReplicationBaseline",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Networking][Replication]")
+{
+	static constexpr int32 InstanceCount = 10000;
+	static constexpr int32 OverrideInterval = 10;
+	static constexpr int32 Iterations = 16;
+	static constexpr uint32 FirstNetworkId = 1000;
+
+	/** Instances of the prefab where every OverrideInterval-th instance overrides one of the prefab's values. */
+	TArray<FFlecsEntityHandle> CreateInstances(const FFlecsEntityHandle& InPrefab)
+	{
+		TArray<FFlecsEntityHandle> Instances;
+		Instances.Reserve(InstanceCount);
+
+		for (int32 Index = 0; Index < InstanceCount; ++Index)
+		{
+			const FFlecsEntityHandle Instance = World()->CreateEntity()
+				.AddPrefab(InPrefab.GetFlecsId())
+				.Set<FFlecsReplicationTestValue>(InPrefab.Get<FFlecsReplicationTestValue>())
+				.Set<FFlecsReplicationTestNativeValue>(InPrefab.Get<FFlecsReplicationTestNativeValue>());
+
+			if (Index % OverrideInterval == 0)
+			{
+				Instance.Set<FFlecsReplicationTestValue>({ Index });
+			}
+
+			Instances.Add(Instance);
+		}
+
+		return Instances;
+	}
+
+	/** Fills the snapshots a joining client receives for the instances, returning the bytes they take on the wire. */
+	int64 FillJoinSnapshots(const TConstArrayView<FFlecsEntityHandle> InInstances,
+		OUT TArray<FFlecsEntityReplicationSnapshot>& OutSnapshots)
+	{
+		OutSnapshots.SetNum(InInstances.Num());
+
+		int64 Bytes = 0;
+		for (int32 Index = 0; Index < InInstances.Num(); ++Index)
+		{
+			bool bCreatedNewLayout = false;
+			const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+				NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), InInstances[Index], bCreatedNewLayout);
+			solid_check(!LayoutResult.HasError());
+
+			FFlecsEntityReplicationSnapshot& Snapshot = OutSnapshots[Index];
+			Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+			Snapshot.StateRevision = 0;
+			Snapshot.FillFromEntity(InInstances[Index], NetworkSubsystem()->GetLayoutRegistry());
+
+			Bytes += Snapshot.GetEstimatedNetSize();
+		}
+
+		return Bytes;
+	}
+
+	TEST_METHOD(InitialJoin_PrefabInstances_WithAndWithoutBaseline)
+	{
+		// Without a stable identity the prefab can't be found on the receiver, so its instances are sent in full
+		const FFlecsEntityHandle AnonymousPrefab = World()->CreatePrefab()
+			.Set<FFlecsReplicationTestValue>({ 7 })
+			.Set<FFlecsReplicationTestNativeValue>({ 11 });
+
+		const FFlecsEntityHandle StablePrefab = World()->CreatePrefab(TEXT("ReplicationBaselineBenchmarkPrefab"))
+			.Set<FFlecsReplicationTestValue>({ 7 })
+			.Set<FFlecsReplicationTestNativeValue>({ 11 })
+			.Add<FFlecsStablePathTag>();
+
+		const TArray<FFlecsEntityHandle> FullInstances = CreateInstances(AnonymousPrefab);
+		const TArray<FFlecsEntityHandle> BaselineInstances = CreateInstances(StablePrefab);
+
+		TArray<FFlecsEntityReplicationSnapshot> FullSnapshots;
+		TArray<FFlecsEntityReplicationSnapshot> BaselineSnapshots;
+
+		int64 FullBytes = 0;
+		int64 BaselineBytes = 0;
+
+		RunFlecsBenchmark(*this, TEXT("Fill join snapshots, full values"),
+			Iterations, InstanceCount, [this, &FullInstances, &FullSnapshots, &FullBytes]()
+			{
+				FullBytes = FillJoinSnapshots(FullInstances, FullSnapshots);
+			});
+
+		RunFlecsBenchmark(*this, TEXT("Fill join snapshots, prefab baseline"),
+			Iterations, InstanceCount, [this, &BaselineInstances, &BaselineSnapshots, &BaselineBytes]()
+			{
+				BaselineBytes = FillJoinSnapshots(BaselineInstances, BaselineSnapshots);
+			});
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Initial join of %d instances: %lld bytes full, %lld bytes with baseline (%.1f%%)"),
+			InstanceCount, FullBytes, BaselineBytes, 100.0 * static_cast<double>(BaselineBytes) / static_cast<double>(FullBytes)));
+
+		ASSERT_THAT(IsTrue(BaselineBytes < FullBytes));
+
+		// Every frame spawns a new generation into the same slots, like a client joining over and over
+		uint32 Generation = 0;
+		const auto SpawnSnapshots = [this, &Generation](const TConstArrayView<FFlecsEntityReplicationSnapshot> InSnapshots)
+		{
+			++Generation;
+
+			for (int32 Index = 0; Index < InSnapshots.Num(); ++Index)
+			{
+				NetworkSubsystem()->QueueReplicationSnapshot(FFlecsNetworkId(FirstNetworkId + Index, Generation), InSnapshots[Index]);
+			}
+
+			NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		};
+
+		const FFlecsBenchmarkResult FullResult = RunFlecsBenchmark(*this, TEXT("Apply join snapshots, full values"),
+			Iterations, InstanceCount, [&SpawnSnapshots, &FullSnapshots]()
+			{
+				SpawnSnapshots(FullSnapshots);
+			});
+
+		const FFlecsBenchmarkResult BaselineResult = RunFlecsBenchmark(*this, TEXT("Apply join snapshots, prefab baseline"),
+			Iterations, InstanceCount, [&SpawnSnapshots, &BaselineSnapshots]()
+			{
+				SpawnSnapshots(BaselineSnapshots);
+			});
+
+		for (const FFlecsBenchmarkResult& Result : { FullResult, BaselineResult })
+		{
+			TestRunner->AddInfo(FString::Printf(TEXT("%s: %.0f spawns/s per client"), *Result.Name,
+				static_cast<double>(Result.OperationsPerIteration) / Result.MinSeconds));
+		}
+
+		// Instances that didn't override a value still end up with the prefab's
+		const TOptional<FFlecsEntityHandle> ReceivedInstance =
+			NetworkSubsystem()->GetEntityFromNetworkId(FFlecsNetworkId(FirstNetworkId + 1, Generation));
+		ASSERT_THAT(IsTrue(ReceivedInstance.IsSet()));
+		if (!ReceivedInstance.IsSet())
+		{
+			return;
+		}
+
+		ASSERT_THAT(IsTrue(ReceivedInstance->IsA(StablePrefab.GetFlecsId())));
+		ASSERT_THAT(AreEqual(7, ReceivedInstance->Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(AreEqual(11, ReceivedInstance->Get<FFlecsReplicationTestNativeValue>().Value));
+	}
+
+}; // UnrealFlecsReplicationBaselineBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
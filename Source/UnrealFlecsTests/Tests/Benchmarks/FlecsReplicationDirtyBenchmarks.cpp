@@ -0,0 +1,65 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Networking/FlecsNetDirtyTag.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsReplicationDirtyBenchmarks,
+								   "UnrealFlecs.Benchmarks.ReplicationDirty",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Networking][Replication]")
+{
+	static constexpr int32 EntityCount = 50000;
+	static constexpr int32 ChurnCount = EntityCount / 10;
+	static constexpr int32 Iterations = 16;
+
+	TEST_METHOD(DirtyTracking_TenPercentChurnPerFrame)
+	{
+		TArray<FFlecsEntityHandle> Entities;
+		Entities.Reserve(EntityCount);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			Entities.Add(CreateReplicatedEntity(Index));
+		}
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		TestBridge()->ResetCapturedRecords();
+
+		const ecs_table_t* InitialTable = ecs_get_table(World()->GetNativeFlecsWorld(), Entities[0].GetFlecsId());
+
+		// Every frame writes a different tenth of the entities, then publishes the dirty ones
+		int32 Frame = 0;
+		const FFlecsBenchmarkResult Result = RunFlecsBenchmark(*this, TEXT("Dirty tracking at 10% churn"),
+			Iterations, ChurnCount, [this, &Entities, &Frame]()
+			{
+				TestBridge()->ResetCapturedRecords();
+
+				const int32 FirstIndex = (Frame++ % 10) * ChurnCount;
+				for (int32 Index = FirstIndex; Index < FirstIndex + ChurnCount; ++Index)
+				{
+					Entities[Index].Set<FFlecsReplicationTestValue>({ Index + Frame });
+				}
+
+				NetworkSubsystem()->PublishDirtyReplicatedEntities();
+			});
+
+		TestRunner->AddInfo(FString::Printf(TEXT("%s: %.0f dirty entities/s over %d replicated entities"), *Result.Name,
+			static_cast<double>(Result.OperationsPerIteration) / Result.MinSeconds, EntityCount));
+
+		ASSERT_THAT(AreEqual(ChurnCount, TestBridge()->GetPublishedSnapshots().Num()));
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+
+		// Marking and publishing never moves an entity to another table
+		ASSERT_THAT(IsFalse(Entities[0].Has<FFlecsNetDirtyTag>()));
+		ASSERT_THAT(IsTrue(ecs_get_table(World()->GetNativeFlecsWorld(), Entities[0].GetFlecsId()) == InitialTable));
+	}
+
+}; // UnrealFlecsReplicationDirtyBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
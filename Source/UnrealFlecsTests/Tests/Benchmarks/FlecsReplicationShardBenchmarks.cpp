@@ -0,0 +1,118 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Networking/FlecsNetworkingModuleSettings.h"
+#include "Networking/Bridge/FlecsIrisReplicationBridge.h"
+#include "Networking/Profiles/FlecsReplicationProfileParamTypes.h"
+#include "Worlds/FlecsWorld.h"
+
+// Measured without a net driver, so this is the server cost of placing entities into shards and
+// recycling them, not the cost of registering the shards with Iris. Recycled proxies are registered with Iris
+// again when they're reused, which these numbers don't include.
+// Each operation stops replicating one entity and publishes it again, so ns/op is the CPU cost per churned entity.
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsReplicationShardBenchmarks,
+								   "UnrealFlecs.Benchmarks.ReplicationShards",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Networking][Replication]")
+{
+	static constexpr int32 EntityCount = 10000;
+	static constexpr int32 ChurnCount = EntityCount / 10;
+	static constexpr int32 Iterations = 16;
+
+	UFlecsIrisReplicationBridge* Bridge = nullptr;
+
+	TArray<TPair<FFlecsEntityHandle, FFlecsNetworkId>> CreateReplicatedEntities(const FName& InShardSelector) const
+	{
+		FFlecsReplicationProfileDefinition ProfileDefinition;
+		ProfileDefinition.AddParam<FFlecsReplicationProfileNetShardSelector>(InShardSelector);
+
+		const FFlecsEntityHandle Profile = NetworkSubsystem()->RegisterReplicationProfileDefinition(
+			FName(*FString::Printf(TEXT("%sBenchmarkProfile"), *InShardSelector.ToString())), ProfileDefinition);
+
+		TArray<TPair<FFlecsEntityHandle, FFlecsNetworkId>> Entities;
+		Entities.Reserve(EntityCount);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const FFlecsEntityHandle Entity = CreateReplicatedEntity(Index);
+			NetworkSubsystem()->SetReplicationProfile(Entity, Profile);
+			Entities.Emplace(Entity, Entity.Get<FFlecsNetworkId>());
+		}
+
+		return Entities;
+	}
+
+	FFlecsBenchmarkResult RunShardChurnBenchmark(const FName& InShardSelector, const FString& InName)
+	{
+		Bridge = NewObject<UFlecsIrisReplicationBridge>(NetworkSubsystem());
+		NetworkSubsystem()->SetReplicationBridgeForTesting(Bridge);
+
+		const TArray<TPair<FFlecsEntityHandle, FFlecsNetworkId>> Entities = CreateReplicatedEntities(InShardSelector);
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.StateRevision = 1;
+
+		for (const TPair<FFlecsEntityHandle, FFlecsNetworkId>& Entity : Entities)
+		{
+			Bridge->PublishNetEntity(Entity.Key, Entity.Value, Snapshot);
+		}
+
+		TestRunner->AddInfo(FString::Printf(TEXT("%s: %d shards for %d replicated entities"),
+			*InName, Bridge->GetActiveShardCount(), EntityCount));
+
+		// Every frame a different tenth of the entities stops replicating and starts again
+		int32 Frame = 0;
+		return RunFlecsBenchmark(*this, InName, Iterations, ChurnCount, [this, &Entities, &Snapshot, &Frame]()
+		{
+			const int32 FirstIndex = (Frame++ % 10) * ChurnCount;
+
+			for (int32 Index = FirstIndex; Index < FirstIndex + ChurnCount; ++Index)
+			{
+				Bridge->StopReplicatingEntity(Entities[Index].Key);
+			}
+
+			for (int32 Index = FirstIndex; Index < FirstIndex + ChurnCount; ++Index)
+			{
+				Bridge->PublishNetEntity(Entities[Index].Key, Entities[Index].Value, Snapshot);
+			}
+		});
+	}
+
+	TEST_METHOD(ShardChurn_EntityProxies)
+	{
+		RunShardChurnBenchmark(FName(TEXT("Proxy")), TEXT("Proxy shards at 10% churn, recycled"));
+
+		// Every churned proxy came back out of the recycled list
+		ASSERT_THAT(AreEqual(EntityCount, Bridge->GetActiveShardCount()));
+		ASSERT_THAT(AreEqual(0, Bridge->GetRecycledShardCount()));
+	}
+
+	TEST_METHOD(ShardChurn_EntityProxies_WithoutRecycling)
+	{
+		UFlecsNetworkingModuleSettings* Settings = GetMutableDefault<UFlecsNetworkingModuleSettings>();
+		TGuardValue<int32> RecycledShardPoolSizeGuard(Settings->RecycledShardPoolSize, 0);
+
+		// Every churned entity allocates a new proxy, the baseline for the recycled run above
+		RunShardChurnBenchmark(FName(TEXT("Proxy")), TEXT("Proxy shards at 10% churn, not recycled"));
+
+		ASSERT_THAT(AreEqual(EntityCount, Bridge->GetActiveShardCount()));
+		ASSERT_THAT(AreEqual(0, Bridge->GetRecycledShardCount()));
+	}
+
+	TEST_METHOD(ShardChurn_EntityTables)
+	{
+		RunShardChurnBenchmark(FName(TEXT("Table")), TEXT("Table shards at 10% churn"));
+
+		const int32 MaxEntitiesPerShard = GetDefault<UFlecsNetworkingModuleSettings>()->MaxEntitiesPerTableShard;
+		ASSERT_THAT(AreEqual(FMath::DivideAndRoundUp(EntityCount, MaxEntitiesPerShard), Bridge->GetActiveShardCount()));
+		ASSERT_THAT(AreEqual(0, Bridge->GetRecycledShardCount()));
+	}
+
+}; // UnrealFlecsReplicationShardBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
@@ -0,0 +1,164 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsSerializationBenchmarks,
+								   "UnrealFlecs.Benchmarks.Serialization",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][Meta]")
+{
+	static constexpr int32 ValueCount = 4096;
+	static constexpr int32 Iterations = 16;
+
+	flecs::world_t* NativeWorld() const
+	{
+		return World()->GetNativeFlecsWorld().c_ptr();
+	}
+
+	void ReportThroughput(const FFlecsBenchmarkResult& InResult, const int32 InBytesPerIteration) const
+	{
+		TestRunner->AddInfo(FString::Printf(TEXT("%s: %.2f MB/s"), *InResult.Name,
+			static_cast<double>(InBytesPerIteration) / (InResult.MinSeconds * 1024.0 * 1024.0)));
+	}
+
+	/** Assigns InValue to every leaf member of InType by name, the way a reflection driven setter would. */
+	int32 SetLeafMembers(ecs_meta_cursor_t& InCursor, const flecs::entity_t InType, const double InValue) const
+	{
+		const EcsStruct* Struct = ecs_get(NativeWorld(), InType, EcsStruct);
+		if (!Struct)
+		{
+			return 0;
+		}
+
+		int32 Count = 0;
+		ecs_meta_push(&InCursor);
+
+		for (const ecs_member_t& Member : TArrayView<const ecs_member_t>(
+			ecs_vec_first_t(&Struct->members, ecs_member_t), ecs_vec_count(&Struct->members)))
+		{
+			ecs_meta_member(&InCursor, Member.name);
+
+			if (ecs_has(NativeWorld(), Member.type, EcsStruct))
+			{
+				Count += SetLeafMembers(InCursor, Member.type, InValue);
+			}
+			else
+			{
+				Count += ecs_meta_set_float(&InCursor, InValue) == 0;
+			}
+		}
+
+		ecs_meta_pop(&InCursor);
+		return Count;
+	}
+
+	template<typename T>
+	void BenchmarkType(const TCHAR* InTypeName, const T& InValue)
+	{
+		const flecs::entity_t Type = World()->GetScriptStructEntity<T>();
+
+		TArray<T> Values;
+		Values.Init(InValue, ValueCount);
+
+		ecs_strbuf_t Buffer = ECS_STRBUF_INIT;
+		const FFlecsBenchmarkResult ToJsonResult = RunFlecsBenchmark(*this,
+			FString::Printf(TEXT("%s: ecs_array_to_json_buf"), InTypeName), Iterations, ValueCount,
+			[this, Type, &Values, &Buffer]()
+			{
+				ecs_strbuf_reset(&Buffer);
+				ecs_array_to_json_buf(NativeWorld(), Type, Values.GetData(), ValueCount, &Buffer, nullptr);
+			});
+
+		ReportThroughput(ToJsonResult, ecs_strbuf_written(&Buffer));
+		ecs_strbuf_reset(&Buffer);
+
+		char* Json = ecs_ptr_to_json(NativeWorld(), Type, &InValue);
+		ASSERT_THAT(IsNotNull(Json));
+
+		int32 Parsed = 0;
+		const FFlecsBenchmarkResult FromJsonResult = RunFlecsBenchmark(*this,
+			FString::Printf(TEXT("%s: ecs_ptr_from_json"), InTypeName), Iterations, ValueCount,
+			[this, Type, Json, &Values, &Parsed]()
+			{
+				for (T& Value : Values)
+				{
+					Parsed += ecs_ptr_from_json(NativeWorld(), Type, &Value, Json, nullptr) != nullptr;
+				}
+			});
+
+		ReportThroughput(FromJsonResult, FCStringAnsi::Strlen(Json) * ValueCount);
+		ecs_os_free(Json);
+		ASSERT_THAT(AreEqual((Iterations + 1) * ValueCount, Parsed));
+
+		int32 Assigned = 0;
+		RunFlecsBenchmark(*this,
+			FString::Printf(TEXT("%s: ecs_meta_cursor set members"), InTypeName), Iterations, ValueCount,
+			[this, Type, &Values, &Assigned]()
+			{
+				for (T& Value : Values)
+				{
+					ecs_meta_cursor_t Cursor = ecs_meta_cursor(NativeWorld(), Type, &Value);
+					Assigned += SetLeafMembers(Cursor, Type, 1.0);
+				}
+			});
+
+		ASSERT_THAT(IsTrue(Assigned > 0));
+
+		const ecs_size_t PackedSize = ecs_meta_packed_size(NativeWorld(), Type);
+		if (PackedSize <= 0)
+		{
+			TestRunner->AddInfo(FString::Printf(TEXT("%s: no plain data layout, skipping pack"), InTypeName));
+			return;
+		}
+
+		TArray<uint8> Packed;
+		Packed.SetNumUninitialized(PackedSize * ValueCount);
+
+		const FFlecsBenchmarkResult PackResult = RunFlecsBenchmark(*this,
+			FString::Printf(TEXT("%s: ecs_meta_pack (%d of %d bytes)"), InTypeName, PackedSize,
+				static_cast<int32>(sizeof(T))), Iterations, ValueCount,
+			[this, Type, &Values, &Packed]()
+			{
+				ecs_meta_pack(NativeWorld(), Type, Values.GetData(), ValueCount, Packed.GetData());
+			});
+
+		ReportThroughput(PackResult, PackedSize * ValueCount);
+
+		TArray<T> Unpacked;
+		Unpacked.SetNumZeroed(ValueCount);
+
+		const FFlecsBenchmarkResult UnpackResult = RunFlecsBenchmark(*this,
+			FString::Printf(TEXT("%s: ecs_meta_unpack"), InTypeName), Iterations, ValueCount,
+			[this, Type, &Unpacked, &Packed]()
+			{
+				ecs_meta_unpack(NativeWorld(), Type, Unpacked.GetData(), ValueCount, Packed.GetData());
+			});
+
+		ReportThroughput(UnpackResult, PackedSize * ValueCount);
+	}
+
+	TEST_METHOD(Serialization_Vector)
+	{
+		BenchmarkType<FVector>(TEXT("FVector"), FVector(1.0, 2.5, -3.25));
+	}
+
+	TEST_METHOD(Serialization_Quat)
+	{
+		BenchmarkType<FQuat>(TEXT("FQuat"), FQuat(FRotator(10.0, 20.0, 30.0)));
+	}
+
+	TEST_METHOD(Serialization_Transform)
+	{
+		BenchmarkType<FTransform>(TEXT("FTransform"),
+			FTransform(FQuat(FRotator(10.0, 20.0, 30.0)), FVector(100.0, 200.0, 300.0), FVector(2.0)));
+	}
+
+}; // UnrealFlecsSerializationBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
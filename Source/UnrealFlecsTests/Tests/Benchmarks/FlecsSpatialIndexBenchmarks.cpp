@@ -0,0 +1,172 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Queries/FlecsQuery.h"
+#include "Queries/FlecsQueryBuilder.h"
+#include "Spatial/FlecsSpatialIndex.h"
+#include "Spatial/Systems/FlecsSpatialIndexSystem.h"
+#include "Transforms/FlecsTransformComponent.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsSpatialIndexBenchmarks,
+								   "UnrealFlecs.Benchmarks.SpatialIndex",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][GameFramework][Spatial]")
+{
+	static constexpr int32 EntityCount = 100000;
+	static constexpr int32 Iterations = 16;
+	static constexpr int32 QueryCount = 256;
+	static constexpr double WorldExtent = 100000.0;
+	static constexpr double QueryRadius = 2500.0;
+	static constexpr int32 NearestCount = 16;
+
+	TArray<FVector> QueryCenters;
+
+	virtual void OnWorldSetUp() override
+	{
+		FRandomStream Random(0x5A17);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const FVector Location(Random.FRandRange(-WorldExtent, WorldExtent),
+				Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-1000.0, 1000.0));
+
+			World()->CreateEntity()
+				.Set<FFlecsTransformComponent>(FFlecsTransformComponent(FTransform(Location)));
+		}
+
+		for (int32 Index = 0; Index < QueryCount; ++Index)
+		{
+			QueryCenters.Add(FVector(Random.FRandRange(-WorldExtent, WorldExtent),
+				Random.FRandRange(-WorldExtent, WorldExtent), 0.0));
+		}
+	}
+
+	TEST_METHOD(MoveAndQuery_Index_Vs_BruteForce)
+	{
+		UFlecsSpatialIndexSystem* SpatialSystem = World()->RegisterFlecsObject<UFlecsSpatialIndexSystem>();
+		ASSERT_THAT(IsNotNull(SpatialSystem));
+
+		SpatialSystem->RunSystem();
+		ASSERT_THAT(AreEqual(EntityCount, SpatialSystem->GetIndex().Num()));
+
+		// A small drift keeps most entities inside their cell, like typical movement between two frames
+		FFlecsQuery MoveQuery = World()->CreateQueryBuilder()
+			.With<FFlecsTransformComponent&>()
+			.Build();
+
+		double Drift = 0.0;
+		const auto MoveAll = [&MoveQuery, &Drift]()
+		{
+			Drift = Drift > 0.0 ? -10.0 : 10.0;
+
+			MoveQuery.run([Drift](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					const flecs::field<FFlecsTransformComponent> Transforms = InIterator.field<FFlecsTransformComponent>(0);
+
+					for (const size_t Index : InIterator)
+					{
+						Transforms[Index].Transform.AddToTranslation(FVector(Drift, Drift * 0.5, 0.0));
+					}
+				}
+			});
+		};
+
+		const FFlecsBenchmarkResult MoveResult = RunFlecsBenchmark(*this, TEXT("Move only"),
+			Iterations, EntityCount, MoveAll);
+
+		const FFlecsBenchmarkResult UpdateResult = RunFlecsBenchmark(*this, TEXT("Move + spatial index update"),
+			Iterations, EntityCount, [&MoveAll, SpatialSystem]()
+			{
+				MoveAll();
+				SpatialSystem->RunSystem();
+			});
+
+		const FFlecsSpatialIndex& SpatialIndex = SpatialSystem->GetIndex();
+
+		int32 IndexedResultCount = 0;
+		TArray<flecs::entity_t> Found;
+
+		const FFlecsBenchmarkResult IndexedRadiusResult = RunFlecsBenchmark(*this, TEXT("Radius query (index)"),
+			Iterations, QueryCount, [this, &SpatialIndex, &Found, &IndexedResultCount]()
+			{
+				IndexedResultCount = 0;
+
+				for (const FVector& Center : QueryCenters)
+				{
+					SpatialIndex.QueryRadius(Center, QueryRadius, Found);
+					IndexedResultCount += Found.Num();
+				}
+			});
+
+		FFlecsQuery TransformQuery = World()->CreateQueryBuilder()
+			.With<const FFlecsTransformComponent>()
+			.Build();
+
+		int32 BruteForceResultCount = 0;
+
+		const FFlecsBenchmarkResult BruteForceRadiusResult = RunFlecsBenchmark(*this, TEXT("Radius query (brute force)"),
+			Iterations, QueryCount, [this, &TransformQuery, &Found, &BruteForceResultCount]()
+			{
+				BruteForceResultCount = 0;
+
+				for (const FVector& Center : QueryCenters)
+				{
+					Found.Reset();
+
+					TransformQuery.run([&Center, &Found](flecs::iter& InIterator)
+					{
+						while (InIterator.next())
+						{
+							const flecs::field<const FFlecsTransformComponent> Transforms
+								= InIterator.field<const FFlecsTransformComponent>(0);
+
+							for (const size_t Index : InIterator)
+							{
+								if (FVector::DistSquared(Transforms[Index].Transform.GetLocation(), Center)
+									<= FMath::Square(QueryRadius))
+								{
+									Found.Add(InIterator.entity(Index));
+								}
+							}
+						}
+					});
+
+					BruteForceResultCount += Found.Num();
+				}
+			});
+
+		ASSERT_THAT(AreEqual(BruteForceResultCount, IndexedResultCount));
+
+		const FFlecsBenchmarkResult NearestResult = RunFlecsBenchmark(*this, TEXT("Nearest neighbours (index)"),
+			Iterations, QueryCount, [this, &SpatialIndex, &Found]()
+			{
+				for (const FVector& Center : QueryCenters)
+				{
+					SpatialIndex.QueryNearest(Center, NearestCount, Found);
+				}
+			});
+
+		ASSERT_THAT(AreEqual(NearestCount, Found.Num()));
+
+		const double UpdateSeconds = FMath::Max(UpdateResult.MinSeconds - MoveResult.MinSeconds, UE_SMALL_NUMBER);
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Index update: %.0f entities/ms (%d cell changes in the last frame)"),
+			EntityCount / (UpdateSeconds * 1000.0), SpatialSystem->GetLastCellChangeCount()));
+		TestRunner->AddInfo(FString::Printf(TEXT("Radius query: %.2f us indexed, %.2f us brute force (%d results)"),
+			IndexedRadiusResult.MinSeconds * 1e6 / QueryCount, BruteForceRadiusResult.MinSeconds * 1e6 / QueryCount,
+			IndexedResultCount));
+		TestRunner->AddInfo(FString::Printf(TEXT("Nearest %d: %.2f us"),
+			NearestCount, NearestResult.MinSeconds * 1e6 / QueryCount));
+	}
+
+}; // UnrealFlecsSpatialIndexBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
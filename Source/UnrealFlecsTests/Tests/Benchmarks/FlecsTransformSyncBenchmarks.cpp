@@ -0,0 +1,141 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsBenchmark.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+#include "Queries/FlecsQuery.h"
+#include "Queries/FlecsQueryBuilder.h"
+#include "Transforms/FlecsInstancedMeshInstanceComponent.h"
+#include "Transforms/FlecsTransformComponent.h"
+#include "Transforms/Systems/FlecsInstancedMeshTransformSyncSystem.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsTransformSyncBenchmarks,
+								   "UnrealFlecs.Benchmarks.TransformSync",
+							   EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter,
+							   "[Flecs][Benchmark][GameFramework][Transform]")
+{
+	static constexpr int32 EntityCount = 16384;
+	static constexpr int32 Iterations = 32;
+
+	UInstancedStaticMeshComponent* InstancedMesh = nullptr;
+
+	virtual void OnWorldSetUp() override
+	{
+		AActor* Actor = UnrealWorld()->SpawnActor<AActor>();
+
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		InstancedMesh = NewObject<UInstancedStaticMeshComponent>(Actor, TEXT("Instances"));
+		InstancedMesh->SetupAttachment(Root);
+		InstancedMesh->RegisterComponent();
+
+		TArray<FTransform> InstanceTransforms;
+		InstanceTransforms.Init(FTransform::Identity, EntityCount);
+		InstancedMesh->AddInstances(InstanceTransforms, /* bShouldReturnIndices */ false, /* bWorldSpace */ true);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			World()->CreateEntity()
+				.Set<FFlecsInstancedMeshInstanceComponent>(FFlecsInstancedMeshInstanceComponent(InstancedMesh, Index))
+				.Set<FFlecsTransformComponent>(FFlecsTransformComponent(FTransform::Identity));
+		}
+	}
+
+	static double ToEntitiesPerMillisecond(const FFlecsBenchmarkResult& InResult)
+	{
+		return static_cast<double>(InResult.OperationsPerIteration) / FMath::Max(InResult.MinSeconds * 1000.0, UE_SMALL_NUMBER);
+	}
+
+	TEST_METHOD(BatchedSync_Vs_PerInstanceUpdate)
+	{
+		UFlecsInstancedMeshTransformSyncSystem* SyncSystem =
+			World()->RegisterFlecsObject<UFlecsInstancedMeshTransformSyncSystem>();
+		ASSERT_THAT(IsNotNull(SyncSystem));
+
+		// Writing through a mutable term marks every table as changed, like a movement system would
+		FFlecsQuery MoveQuery = World()->CreateQueryBuilder()
+			.With<FFlecsTransformComponent&>()
+			.Build();
+
+		double Offset = 0.0;
+		const auto MoveAll = [&MoveQuery, &Offset]()
+		{
+			Offset += 1.0;
+
+			MoveQuery.run([Offset](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					const flecs::field<FFlecsTransformComponent> Transforms = InIterator.field<FFlecsTransformComponent>(0);
+
+					for (const size_t Index : InIterator)
+					{
+						Transforms[Index].Transform.SetLocation(FVector(Offset, static_cast<double>(Index), 0.0));
+					}
+				}
+			});
+		};
+
+		const FFlecsBenchmarkResult MoveResult = RunFlecsBenchmark(*this, TEXT("Move only"),
+			Iterations, EntityCount, MoveAll);
+
+		const FFlecsBenchmarkResult BatchedResult = RunFlecsBenchmark(*this, TEXT("Move + batched instance sync"),
+			Iterations, EntityCount, [&MoveAll, SyncSystem]()
+			{
+				MoveAll();
+				SyncSystem->RunSystem();
+			});
+
+		ASSERT_THAT(AreEqual(1, SyncSystem->GetLastBatchCount()));
+
+		FFlecsQuery InstanceQuery = World()->CreateQueryBuilder()
+			.With<const FFlecsTransformComponent>()
+			.With<const FFlecsInstancedMeshInstanceComponent>()
+			.Build();
+
+		const FFlecsBenchmarkResult PerInstanceResult = RunFlecsBenchmark(*this, TEXT("Move + UpdateInstanceTransform per entity"),
+			Iterations, EntityCount, [&MoveAll, &InstanceQuery, this]()
+			{
+				MoveAll();
+
+				InstanceQuery.run([](flecs::iter& InIterator)
+				{
+					while (InIterator.next())
+					{
+						const flecs::field<const FFlecsTransformComponent> Transforms = InIterator.field<const FFlecsTransformComponent>(0);
+						const flecs::field<const FFlecsInstancedMeshInstanceComponent> Instances
+							= InIterator.field<const FFlecsInstancedMeshInstanceComponent>(1);
+
+						for (const size_t Index : InIterator)
+						{
+							Instances[Index].Component->UpdateInstanceTransform(Instances[Index].InstanceIndex,
+								Transforms[Index].Transform, /* bWorldSpace */ true, /* bMarkRenderStateDirty */ false);
+						}
+					}
+				});
+
+				InstancedMesh->MarkRenderStateDirty();
+			});
+
+		const double MoveSeconds = MoveResult.MinSeconds;
+		const double BatchedSyncSeconds = FMath::Max(BatchedResult.MinSeconds - MoveSeconds, UE_SMALL_NUMBER);
+		const double PerInstanceSyncSeconds = FMath::Max(PerInstanceResult.MinSeconds - MoveSeconds, UE_SMALL_NUMBER);
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Batched sync: %.0f entities/ms (%.0f entities/ms including the move)"),
+			EntityCount / (BatchedSyncSeconds * 1000.0), ToEntitiesPerMillisecond(BatchedResult)));
+		TestRunner->AddInfo(FString::Printf(TEXT("Per instance sync: %.0f entities/ms (%.0f entities/ms including the move)"),
+			EntityCount / (PerInstanceSyncSeconds * 1000.0), ToEntitiesPerMillisecond(PerInstanceResult)));
+	}
+
+}; // UnrealFlecsTransformSyncBenchmarks
+
+#endif // #if WITH_AUTOMATION_TESTS
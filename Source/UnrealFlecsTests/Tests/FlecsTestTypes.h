@@ -951,6 +951,35 @@ struct TFlecsReplicationTraits<FFlecsReplicationTestNativeValue>
 	}
 };
 
+struct FFlecsReplicationTestNativePair
+{
+	int32 First = 0;
+	int32 Second = 0;
+};
+
+template<>
+struct TFlecsComponentTraits<FFlecsReplicationTestNativePair> : TFlecsComponentTraitsBase<FFlecsReplicationTestNativePair>
+{
+	static constexpr bool AutoRegister = false;
+	static constexpr bool Replicate = true;
+};
+
+template<>
+struct TFlecsReplicationTraits<FFlecsReplicationTestNativePair>
+{
+	static FString StableSymbolName()
+	{
+		return TEXT("FFlecsReplicationTestNativePair");
+	}
+	
+	static bool Serialize(FArchive& Archive, FFlecsReplicationTestNativePair& Value)
+	{
+		Archive << Value.First;
+		Archive << Value.Second;
+		return !Archive.IsError();
+	}
+};
+
 USTRUCT()
 struct FFlecsReplicationTestTag
 {
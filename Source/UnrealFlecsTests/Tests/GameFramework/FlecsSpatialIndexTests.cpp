@@ -0,0 +1,260 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Math/RandomStream.h"
+
+#include "Queries/FlecsQuery.h"
+#include "Queries/FlecsQueryBuilder.h"
+#include "Spatial/FlecsQuerySpatialCellExpression.h"
+#include "Spatial/FlecsSpatialCellRelationship.h"
+#include "Spatial/FlecsSpatialIndex.h"
+#include "Spatial/Systems/FlecsSpatialIndexSystem.h"
+#include "Transforms/FlecsTransformComponent.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsSpatialIndexTests,
+	"UnrealFlecs.GameFramework.SpatialIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][GameFramework][Spatial]")
+{
+	static constexpr int32 PointCount = 1000;
+	
+	TArray<FVector> Points;
+	
+	void FillIndex(FFlecsSpatialIndex& OutIndex)
+	{
+		FRandomStream Random(1234);
+		
+		Points.Reset(PointCount);
+		for (int32 Index = 0; Index < PointCount; ++Index)
+		{
+			Points.Add(FVector(Random.FRandRange(-5000.0, 5000.0), Random.FRandRange(-5000.0, 5000.0),
+				Random.FRandRange(-500.0, 500.0)));
+			
+			// Entity ids only have to be unique for the index, 0 is reserved
+			OutIndex.Update(Index + 1, Points.Last());
+		}
+	}
+	
+	static TArray<flecs::entity_t> Sorted(TArray<flecs::entity_t> InEntities)
+	{
+		InEntities.Sort();
+		return InEntities;
+	}
+	
+	TEST_METHOD(Index_RadiusAndBox_MatchBruteForce)
+	{
+		FFlecsSpatialIndex SpatialIndex(700.0);
+		FillIndex(SpatialIndex);
+		
+		const FVector Center(250.0, -1200.0, 0.0);
+		const double Radius = 1800.0;
+		const FBox Box(FVector(-3000.0, -100.0, -200.0), FVector(1500.0, 2600.0, 300.0));
+		
+		TArray<flecs::entity_t> ExpectedInRadius;
+		TArray<flecs::entity_t> ExpectedInBox;
+		for (int32 Index = 0; Index < PointCount; ++Index)
+		{
+			if (FVector::DistSquared(Points[Index], Center) <= FMath::Square(Radius))
+			{
+				ExpectedInRadius.Add(Index + 1);
+			}
+			
+			if (Box.IsInsideOrOn(Points[Index]))
+			{
+				ExpectedInBox.Add(Index + 1);
+			}
+		}
+		
+		TArray<flecs::entity_t> InRadius;
+		SpatialIndex.QueryRadius(Center, Radius, InRadius);
+		
+		TArray<flecs::entity_t> InBox;
+		SpatialIndex.QueryBox(Box, InBox);
+		
+		ASSERT_THAT(IsTrue(ExpectedInRadius.Num() > 0));
+		ASSERT_THAT(IsTrue(Sorted(InRadius) == ExpectedInRadius));
+		ASSERT_THAT(IsTrue(ExpectedInBox.Num() > 0));
+		ASSERT_THAT(IsTrue(Sorted(InBox) == ExpectedInBox));
+	}
+	
+	TEST_METHOD(Index_Nearest_ReturnsClosestInOrder)
+	{
+		FFlecsSpatialIndex SpatialIndex(500.0);
+		FillIndex(SpatialIndex);
+		
+		const FVector Center(-4200.0, 3900.0, 100.0);
+		constexpr int32 NearestCount = 16;
+		
+		TArray<int32> ByDistance;
+		for (int32 Index = 0; Index < PointCount; ++Index)
+		{
+			ByDistance.Add(Index);
+		}
+		ByDistance.Sort([this, &Center](const int32 A, const int32 B)
+		{
+			return FVector::DistSquared(Points[A], Center) < FVector::DistSquared(Points[B], Center);
+		});
+		
+		TArray<flecs::entity_t> Nearest;
+		SpatialIndex.QueryNearest(Center, NearestCount, Nearest);
+		
+		ASSERT_THAT(AreEqual(NearestCount, Nearest.Num()));
+		for (int32 Index = 0; Index < NearestCount; ++Index)
+		{
+			ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(ByDistance[Index] + 1), Nearest[Index]));
+		}
+		
+		TArray<flecs::entity_t> NearestWithinRadius;
+		SpatialIndex.QueryNearest(Center, NearestCount, NearestWithinRadius, /* InMaxRadius */ 1.0);
+		ASSERT_THAT(IsTrue(NearestWithinRadius.IsEmpty()));
+	}
+	
+	TEST_METHOD(Index_MoveAndRemove_UpdateCells)
+	{
+		FFlecsSpatialIndex SpatialIndex(100.0);
+		
+		ASSERT_THAT(IsTrue(SpatialIndex.Update(1, FVector(10.0, 10.0, 10.0)) != INDEX_NONE));
+		ASSERT_THAT(IsTrue(SpatialIndex.Update(2, FVector(20.0, 20.0, 20.0)) != INDEX_NONE));
+		
+		// Same cell
+		ASSERT_THAT(AreEqual(INDEX_NONE, SpatialIndex.Update(1, FVector(50.0, 50.0, 50.0))));
+		
+		// Entity 1 leaves the cell, entity 2 takes its slot
+		ASSERT_THAT(IsTrue(SpatialIndex.Update(1, FVector(550.0, 50.0, 50.0)) != INDEX_NONE));
+		
+		TArray<flecs::entity_t> Found;
+		SpatialIndex.QueryRadius(FVector(20.0, 20.0, 20.0), 30.0, Found);
+		ASSERT_THAT(AreEqual(1, Found.Num()));
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(2), Found[0]));
+		
+		ASSERT_THAT(IsTrue(SpatialIndex.Remove(2)));
+		ASSERT_THAT(IsFalse(SpatialIndex.Remove(2)));
+		ASSERT_THAT(AreEqual(1, SpatialIndex.Num()));
+		
+		Found.Reset();
+		SpatialIndex.QueryBox(FBox(FVector(500.0, 0.0, 0.0), FVector(600.0, 100.0, 100.0)), Found);
+		ASSERT_THAT(AreEqual(1, Found.Num()));
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(1), Found[0]));
+	}
+	
+	TEST_METHOD(Index_RemoveEmptyCells_KeepsOccupiedCellsReachable)
+	{
+		FFlecsSpatialIndex SpatialIndex(100.0);
+		
+		const int32 FirstCell = SpatialIndex.Update(1, FVector(10.0, 10.0, 10.0));
+		SpatialIndex.SetCellEntity(FirstCell, 101);
+		SpatialIndex.SetCellEntity(SpatialIndex.Update(2, FVector(550.0, 10.0, 10.0)), 102);
+		SpatialIndex.SetCellEntity(SpatialIndex.Update(3, FVector(1050.0, 10.0, 10.0)), 103);
+		ASSERT_THAT(AreEqual(3, SpatialIndex.NumCells()));
+		
+		// The first cell is emptied twice and the last cell takes its index
+		ASSERT_THAT(IsTrue(SpatialIndex.Update(1, FVector(10.0, 510.0, 10.0)) != INDEX_NONE));
+		ASSERT_THAT(IsTrue(SpatialIndex.Update(4, FVector(20.0, 20.0, 20.0)) == FirstCell));
+		ASSERT_THAT(IsTrue(SpatialIndex.Remove(4)));
+		
+		TArray<flecs::entity_t> RemovedCellEntities;
+		SpatialIndex.RemoveEmptyCells([&RemovedCellEntities](const flecs::entity_t InCellEntity)
+		{
+			RemovedCellEntities.Add(InCellEntity);
+		});
+		
+		ASSERT_THAT(AreEqual(1, RemovedCellEntities.Num()));
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(101), RemovedCellEntities[0]));
+		ASSERT_THAT(AreEqual(3, SpatialIndex.NumCells()));
+		ASSERT_THAT(AreEqual(3, SpatialIndex.Num()));
+		
+		// Moving within the cell that changed index still finds the entity's slot
+		ASSERT_THAT(AreEqual(INDEX_NONE, SpatialIndex.Update(1, FVector(20.0, 520.0, 10.0))));
+		
+		TArray<flecs::entity_t> Found;
+		SpatialIndex.QueryBox(FBox(FVector(0.0, 500.0, 0.0), FVector(100.0, 600.0, 100.0)), Found);
+		ASSERT_THAT(AreEqual(1, Found.Num()));
+		ASSERT_THAT(AreEqual(static_cast<flecs::entity_t>(1), Found[0]));
+		
+		TArray<flecs::entity_t> CellEntities;
+		SpatialIndex.ForEachCellEntityInBox(FBox(FVector(0.0), FVector(1100.0, 600.0, 100.0)),
+			[&CellEntities](const flecs::entity_t InCellEntity)
+			{
+				CellEntities.Add(InCellEntity);
+			});
+		ASSERT_THAT(IsFalse(CellEntities.Contains(static_cast<flecs::entity_t>(101))));
+		ASSERT_THAT(IsTrue(CellEntities.Contains(static_cast<flecs::entity_t>(103))));
+	}
+	
+	TEST_METHOD(System_IndexesTransforms_AndLimitsCellQueries)
+	{
+		UFlecsSpatialIndexSystem* SpatialSystem = World()->RegisterFlecsObject<UFlecsSpatialIndexSystem>();
+		ASSERT_THAT(IsNotNull(SpatialSystem));
+		
+		const double CellSize = SpatialSystem->GetIndex().GetCellSize();
+		
+		const FFlecsEntityHandle Near = World()->CreateEntity()
+			.Set<FFlecsTransformComponent>(FFlecsTransformComponent(FTransform(FVector(0.25 * CellSize))));
+		const FFlecsEntityHandle Far = World()->CreateEntity()
+			.Set<FFlecsTransformComponent>(FFlecsTransformComponent(FTransform(FVector(10.25 * CellSize))));
+		
+		SpatialSystem->RunSystem();
+		
+		ASSERT_THAT(AreEqual(2, SpatialSystem->GetIndex().Num()));
+		ASSERT_THAT(AreEqual(2, SpatialSystem->GetLastCellChangeCount()));
+		ASSERT_THAT(IsTrue(Near.HasPair<FFlecsSpatialCellRelationship>(flecs::Wildcard)));
+		
+		FFlecsQuery CellQuery = World()->CreateQueryBuilder()
+			.With<const FFlecsTransformComponent>()
+			.AddExpression(FFlecsQuerySpatialCellExpression())
+			.Build();
+		
+		const auto CollectInRadius = [SpatialSystem, &CellQuery](const FVector& InCenter)
+		{
+			TArray<flecs::entity_t> Matched;
+			SpatialSystem->RunQueryInRadius(CellQuery, InCenter, 10.0, [&Matched](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						Matched.Add(InIterator.entity(Index));
+					}
+				}
+			});
+			return Matched;
+		};
+		
+		TArray<flecs::entity_t> Matched = CollectInRadius(FVector(0.25 * CellSize));
+		ASSERT_THAT(AreEqual(1, Matched.Num()));
+		ASSERT_THAT(AreEqual(Near.GetEntity().id(), Matched[0]));
+		
+		// Moving within a cell only updates the location, moving to the other cell changes the cell pair
+		Near.Set<FFlecsTransformComponent>(FFlecsTransformComponent(FTransform(FVector(0.75 * CellSize))));
+		SpatialSystem->RunSystem();
+		ASSERT_THAT(AreEqual(0, SpatialSystem->GetLastCellChangeCount()));
+		
+		const flecs::entity_t NearCell = ecs_get_target(World()->GetNativeFlecsWorld(), Near.GetFlecsId(),
+			World()->GetScriptStructEntity<FFlecsSpatialCellRelationship>().GetFlecsId(), 0);
+		ASSERT_THAT(IsTrue(NearCell != 0));
+		
+		Near.Set<FFlecsTransformComponent>(FFlecsTransformComponent(FTransform(FVector(10.5 * CellSize))));
+		SpatialSystem->RunSystem();
+		ASSERT_THAT(AreEqual(1, SpatialSystem->GetLastCellChangeCount()));
+		
+		// The cell that was left empty is freed
+		ASSERT_THAT(IsFalse(ecs_is_alive(World()->GetNativeFlecsWorld(), NearCell)));
+		ASSERT_THAT(AreEqual(1, SpatialSystem->GetIndex().NumCells()));
+		
+		Matched = CollectInRadius(FVector(10.5 * CellSize));
+		ASSERT_THAT(AreEqual(2, Matched.Num()));
+		ASSERT_THAT(IsTrue(CollectInRadius(FVector(0.25 * CellSize)).IsEmpty()));
+		
+		Far.Remove<FFlecsTransformComponent>();
+		ASSERT_THAT(AreEqual(1, SpatialSystem->GetIndex().Num()));
+		ASSERT_THAT(IsFalse(Far.HasPair<FFlecsSpatialCellRelationship>(flecs::Wildcard)));
+	}
+	
+}; // UnrealFlecsSpatialIndexTests
+
+#endif // #if WITH_AUTOMATION_TESTS
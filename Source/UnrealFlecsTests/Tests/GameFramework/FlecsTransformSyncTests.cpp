@@ -0,0 +1,187 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+#include "Components/FlecsUObjectComponent.h"
+#include "Components/ObjectTypes/FlecsActorTag.h"
+#include "Transforms/FlecsActorTransformSyncTag.h"
+#include "Transforms/FlecsInstancedMeshInstanceComponent.h"
+#include "Transforms/FlecsTransformComponent.h"
+#include "Transforms/Systems/FlecsActorTransformSyncSystem.h"
+#include "Transforms/Systems/FlecsInstancedMeshTransformSyncSystem.h"
+#include "Worlds/FlecsWorld.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsTransformSyncTests,
+	"UnrealFlecs.GameFramework.TransformSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][GameFramework][Transform]")
+{
+	static constexpr int32 InstanceCount = 8;
+
+	AActor* SpawnActorWithRoot() const
+	{
+		AActor* Actor = UnrealWorld()->SpawnActor<AActor>();
+
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		return Actor;
+	}
+
+	UInstancedStaticMeshComponent* SpawnInstancedMesh() const
+	{
+		AActor* Actor = SpawnActorWithRoot();
+
+		UInstancedStaticMeshComponent* InstancedMesh = NewObject<UInstancedStaticMeshComponent>(Actor, TEXT("Instances"));
+		InstancedMesh->SetupAttachment(Actor->GetRootComponent());
+		InstancedMesh->RegisterComponent();
+
+		for (int32 Index = 0; Index < InstanceCount; ++Index)
+		{
+			InstancedMesh->AddInstance(FTransform::Identity, /* bWorldSpace */ true);
+		}
+
+		return InstancedMesh;
+	}
+
+	static FTransform MakeTestTransform(const int32 InIndex, const double InOffset = 0.0)
+	{
+		return FTransform(FVector(100.0 * InIndex + InOffset, 0.0, 50.0));
+	}
+
+	static FVector GetInstanceLocation(const UInstancedStaticMeshComponent* InInstancedMesh, const int32 InIndex)
+	{
+		FTransform InstanceTransform;
+		InInstancedMesh->GetInstanceTransform(InIndex, InstanceTransform, /* bWorldSpace */ true);
+		return InstanceTransform.GetLocation();
+	}
+
+	TEST_METHOD(InstancedMeshSync_WritesContiguousInstancesInOneBatch)
+	{
+		UFlecsInstancedMeshTransformSyncSystem* SyncSystem =
+			World()->RegisterFlecsObject<UFlecsInstancedMeshTransformSyncSystem>();
+		ASSERT_THAT(IsNotNull(SyncSystem));
+
+		UInstancedStaticMeshComponent* InstancedMesh = SpawnInstancedMesh();
+
+		// Created in reverse, the batch sorts the writes by instance index
+		for (int32 Index = InstanceCount - 1; Index >= 0; --Index)
+		{
+			World()->CreateEntity()
+				.Set<FFlecsInstancedMeshInstanceComponent>(FFlecsInstancedMeshInstanceComponent(InstancedMesh, Index))
+				.Set<FFlecsTransformComponent>(FFlecsTransformComponent(MakeTestTransform(Index)));
+		}
+
+		SyncSystem->RunSystem();
+
+		ASSERT_THAT(AreEqual(1, SyncSystem->GetLastBatchCount()));
+
+		for (int32 Index = 0; Index < InstanceCount; ++Index)
+		{
+			ASSERT_THAT(IsTrue(GetInstanceLocation(InstancedMesh, Index).Equals(MakeTestTransform(Index).GetLocation())));
+		}
+	}
+
+	TEST_METHOD(InstancedMeshSync_SkipsUnchangedTables)
+	{
+		UFlecsInstancedMeshTransformSyncSystem* SyncSystem =
+			World()->RegisterFlecsObject<UFlecsInstancedMeshTransformSyncSystem>();
+		ASSERT_THAT(IsNotNull(SyncSystem));
+
+		UInstancedStaticMeshComponent* InstancedMesh = SpawnInstancedMesh();
+
+		TArray<FFlecsEntityHandle> Entities;
+		for (int32 Index = 0; Index < InstanceCount; ++Index)
+		{
+			Entities.Add(World()->CreateEntity()
+				.Set<FFlecsInstancedMeshInstanceComponent>(FFlecsInstancedMeshInstanceComponent(InstancedMesh, Index))
+				.Set<FFlecsTransformComponent>(FFlecsTransformComponent(MakeTestTransform(Index))));
+		}
+
+		SyncSystem->RunSystem();
+		ASSERT_THAT(AreEqual(1, SyncSystem->GetLastBatchCount()));
+
+		SyncSystem->RunSystem();
+		ASSERT_THAT(AreEqual(0, SyncSystem->GetLastBatchCount()));
+
+		Entities[3].Set<FFlecsTransformComponent>(FFlecsTransformComponent(MakeTestTransform(3, 25.0)));
+
+		SyncSystem->RunSystem();
+
+		// Change detection is per table, so the whole table is written again as one contiguous batch
+		ASSERT_THAT(AreEqual(1, SyncSystem->GetLastBatchCount()));
+		ASSERT_THAT(IsTrue(GetInstanceLocation(InstancedMesh, 3).Equals(MakeTestTransform(3, 25.0).GetLocation())));
+		ASSERT_THAT(IsTrue(GetInstanceLocation(InstancedMesh, 2).Equals(MakeTestTransform(2).GetLocation())));
+	}
+
+	TEST_METHOD(InstancedMeshSync_SplitsBatchesOnIndexGaps)
+	{
+		UFlecsInstancedMeshTransformSyncSystem* SyncSystem =
+			World()->RegisterFlecsObject<UFlecsInstancedMeshTransformSyncSystem>();
+		ASSERT_THAT(IsNotNull(SyncSystem));
+
+		UInstancedStaticMeshComponent* InstancedMesh = SpawnInstancedMesh();
+
+		// Instances 0, 1 and 5, 6
+		for (const int32 Index : { 0, 1, 5, 6 })
+		{
+			World()->CreateEntity()
+				.Set<FFlecsInstancedMeshInstanceComponent>(FFlecsInstancedMeshInstanceComponent(InstancedMesh, Index))
+				.Set<FFlecsTransformComponent>(FFlecsTransformComponent(MakeTestTransform(Index)));
+		}
+
+		SyncSystem->RunSystem();
+
+		ASSERT_THAT(AreEqual(2, SyncSystem->GetLastBatchCount()));
+		ASSERT_THAT(IsTrue(GetInstanceLocation(InstancedMesh, 6).Equals(MakeTestTransform(6).GetLocation())));
+		ASSERT_THAT(IsTrue(GetInstanceLocation(InstancedMesh, 3).Equals(FVector::ZeroVector)));
+	}
+
+	TEST_METHOD(ActorSync_MovesParentBeforeAttachedChild)
+	{
+		UFlecsActorTransformSyncSystem* SyncSystem =
+			World()->RegisterFlecsObject<UFlecsActorTransformSyncSystem>();
+		ASSERT_THAT(IsNotNull(SyncSystem));
+
+		AActor* ParentActor = SpawnActorWithRoot();
+		AActor* ChildActor = SpawnActorWithRoot();
+		ChildActor->AttachToActor(ParentActor, FAttachmentTransformRules::KeepWorldTransform);
+
+		const FTransform ParentTransform(FVector(1000.0, 0.0, 0.0));
+		const FTransform ChildTransform(FVector(0.0, 500.0, 0.0));
+
+		// The child entity is created first, so without sorting it would be moved first and then dragged by its parent
+		World()->CreateEntity()
+			.SetPair<FFlecsUObjectComponent, FFlecsActorTag>(FFlecsUObjectComponent(ChildActor))
+			.Add<FFlecsActorTransformSyncTag>()
+			.Set<FFlecsTransformComponent>(FFlecsTransformComponent(ChildTransform));
+
+		World()->CreateEntity()
+			.SetPair<FFlecsUObjectComponent, FFlecsActorTag>(FFlecsUObjectComponent(ParentActor))
+			.Add<FFlecsActorTransformSyncTag>()
+			.Set<FFlecsTransformComponent>(FFlecsTransformComponent(ParentTransform));
+
+		// Not opted in
+		AActor* UnsyncedActor = SpawnActorWithRoot();
+		World()->CreateEntity()
+			.SetPair<FFlecsUObjectComponent, FFlecsActorTag>(FFlecsUObjectComponent(UnsyncedActor))
+			.Set<FFlecsTransformComponent>(FFlecsTransformComponent(ParentTransform));
+
+		SyncSystem->RunSystem();
+
+		ASSERT_THAT(AreEqual(2, SyncSystem->GetLastMovedCount()));
+		ASSERT_THAT(IsTrue(ParentActor->GetActorLocation().Equals(ParentTransform.GetLocation())));
+		ASSERT_THAT(IsTrue(ChildActor->GetActorLocation().Equals(ChildTransform.GetLocation())));
+		ASSERT_THAT(IsTrue(UnsyncedActor->GetActorLocation().Equals(FVector::ZeroVector)));
+	}
+
+}; // UnrealFlecsTransformSyncTests
+
+#endif // #if WITH_AUTOMATION_TESTS
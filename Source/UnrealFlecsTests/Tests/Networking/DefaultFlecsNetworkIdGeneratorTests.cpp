@@ -5,6 +5,8 @@
 
 #if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
 
+#include "Async/ParallelFor.h"
+
 #include "Networking/DefaultFlecsNetworkIdGenerator.h"
 
 TEST_CLASS_WITH_FLAGS_AND_TAGS(DefaultFlecsNetworkIdGeneratorTests,
@@ -91,6 +93,98 @@ TEST_CLASS_WITH_FLAGS_AND_TAGS(DefaultFlecsNetworkIdGeneratorTests,
 		ASSERT_THAT(AreEqual(FirstId.GetGeneration(), IdAfterReset.GetGeneration()));
 		ASSERT_THAT(AreEqual(FirstId.GetValue(), IdAfterReset.GetValue()));
 	}
+
+	TEST_METHOD(ReleaseNetworkId_LastGeneration_WrapsAroundToFirstGeneration)
+	{
+		UDefaultFlecsNetworkIdGenerator* Generator = NewObject<UDefaultFlecsNetworkIdGenerator>();
+		const FFlecsNetworkId FirstId = Generator->GenerateNetworkId();
+
+		ASSERT_THAT(IsTrue(Generator->ReleaseNetworkId(FFlecsNetworkId(FirstId.GetSlot(), MAX_uint32))));
+
+		// Generation zero would make slot zero the invalid ID, so it's skipped
+		const FFlecsNetworkId WrappedId = Generator->GenerateNetworkId();
+
+		ASSERT_THAT(IsTrue(WrappedId.IsValid()));
+		ASSERT_THAT(AreEqual(FirstId.GetSlot(), WrappedId.GetSlot()));
+		ASSERT_THAT(AreEqual(static_cast<uint32>(1), WrappedId.GetGeneration()));
+	}
+
+	TEST_METHOD(ReserveNetworkIdRange_ReusesReleasedIds_ThenClaimsFreshSlots)
+	{
+		static constexpr int32 ReservedCount = 200;
+
+		UDefaultFlecsNetworkIdGenerator* Generator = NewObject<UDefaultFlecsNetworkIdGenerator>();
+		const FFlecsNetworkId FirstId = Generator->GenerateNetworkId();
+		const FFlecsNetworkId ReleasedId = Generator->GenerateNetworkId();
+		Generator->ReleaseNetworkId(ReleasedId);
+
+		TArray<FFlecsNetworkId> NetworkIds;
+		Generator->ReserveNetworkIdRange(ReservedCount, NetworkIds);
+
+		ASSERT_THAT(AreEqual(ReservedCount, NetworkIds.Num()));
+		ASSERT_THAT(AreEqual(ReleasedId.GetSlot(), NetworkIds[0].GetSlot()));
+		ASSERT_THAT(AreEqual(ReleasedId.GetGeneration() + 1, NetworkIds[0].GetGeneration()));
+
+		TSet<uint32> Slots;
+		Slots.Add(FirstId.GetSlot());
+
+		for (const FFlecsNetworkId& NetworkId : NetworkIds)
+		{
+			ASSERT_THAT(IsTrue(NetworkId.IsValid()));
+
+			bool bAlreadyInSet = false;
+			Slots.Add(NetworkId.GetSlot(), &bAlreadyInSet);
+			ASSERT_THAT(IsFalse(bAlreadyInSet));
+		}
+
+		// Every reserved slot is either the released one or a fresh slot, nothing is skipped inside the range
+		ASSERT_THAT(AreEqual(static_cast<uint64>(ReservedCount + 1), Generator->GetClaimedSlotCount()));
+	}
+
+	TEST_METHOD(GenerateNetworkId_ConcurrentGenerateAndRelease_NeverHandsOutAnIdTwice)
+	{
+		static constexpr int32 TaskCount = 8;
+		static constexpr int32 IdsPerTask = 4096;
+
+		UDefaultFlecsNetworkIdGenerator* Generator = NewObject<UDefaultFlecsNetworkIdGenerator>();
+		ASSERT_THAT(IsTrue(Generator->IsThreadSafe()));
+
+		TArray<TArray<FFlecsNetworkId>> LiveIds;
+		LiveIds.SetNum(TaskCount);
+
+		ParallelFor(TaskCount, [Generator, &LiveIds](const int32 TaskIndex)
+		{
+			TArray<FFlecsNetworkId>& TaskIds = LiveIds[TaskIndex];
+
+			for (int32 Index = 0; Index < IdsPerTask; ++Index)
+			{
+				TaskIds.Add(Generator->GenerateNetworkId());
+
+				// Churn half of the IDs so released ones are reused, possibly by other tasks
+				if (Index % 2 == 1)
+				{
+					Generator->ReleaseNetworkId(TaskIds.Pop());
+				}
+			}
+
+			Generator->ReserveNetworkIdRange(IdsPerTask / 4, TaskIds);
+		});
+
+		TSet<uint32> Slots;
+		for (const TArray<FFlecsNetworkId>& TaskIds : LiveIds)
+		{
+			for (const FFlecsNetworkId& NetworkId : TaskIds)
+			{
+				ASSERT_THAT(IsTrue(NetworkId.IsValid()));
+
+				bool bAlreadyInSet = false;
+				Slots.Add(NetworkId.GetSlot(), &bAlreadyInSet);
+				ASSERT_THAT(IsFalse(bAlreadyInSet));
+			}
+		}
+
+		ASSERT_THAT(AreEqual(TaskCount * (IdsPerTask / 2 + IdsPerTask / 4), Slots.Num()));
+	}
 }; // TEST_CLASS DefaultFlecsNetworkIdGeneratorTests
 
 #endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -0,0 +1,258 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "UnrealFlecsConfigMacros.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Pipelines/FlecsOutsideMainLoopTag.h"
+#include "Systems/FlecsPhasesType.h"
+#include "Systems/FlecsSystemHandle.h"
+
+#include "Networking/FlecsPredictedEntityTag.h"
+#include "Networking/Layout/FlecsReplicationLayoutRegistry.h"
+#include "Networking/Prediction/FlecsPredictionHistory.h"
+#include "Networking/Prediction/FlecsPredictionResimulatingTag.h"
+#include "Networking/Prediction/FlecsPredictionWorldSubsystem.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsPredictionTests,
+	"UnrealFlecs.Networking.Prediction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Networking][Replication][Prediction]")
+{
+	TEST_METHOD(PredictionHistory_FindsOnlyFramesInsideTheBuffer)
+	{
+		FFlecsPredictionHistory History(4);
+		ASSERT_THAT(IsTrue(History.IsEmpty()));
+		ASSERT_THAT(IsNull(History.Find(0)));
+
+		History.Rewind(10).StateRevision = 10;
+
+		for (uint32 Revision = 11; Revision <= 15; ++Revision)
+		{
+			FFlecsEntityReplicationSnapshot& Frame = History.Advance();
+			ASSERT_THAT(AreEqual(Revision - 1, Frame.StateRevision));
+			++Frame.StateRevision;
+		}
+
+		ASSERT_THAT(AreEqual(15u, History.GetLatestRevision()));
+		ASSERT_THAT(IsNull(History.Find(11)));
+		ASSERT_THAT(IsNotNull(History.Find(12)));
+		ASSERT_THAT(IsNotNull(History.Find(15)));
+		ASSERT_THAT(IsNull(History.Find(16)));
+
+		// Frames after a rewind are gone until they're recorded again
+		History.Rewind(13);
+		ASSERT_THAT(IsNotNull(History.Find(13)));
+		ASSERT_THAT(IsNull(History.Find(14)));
+	}
+
+	TEST_METHOD(Prediction_ConfirmsMatchingSnapshots_AndResimulatesOnlyMispredictions)
+	{
+		static constexpr int32 FrameCount = 12;
+		static constexpr int32 Latency = 3;
+		static constexpr int32 ServerCorrectionFrame = 6;
+		static constexpr double FixedDeltaTime = 1.0 / 60.0;
+
+		UFlecsPredictionWorldSubsystem* Prediction = UnrealWorld()->GetSubsystem<UFlecsPredictionWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Prediction));
+		if (!Prediction)
+		{
+			return;
+		}
+
+		// The client's step, ran for predicted frames and again for resimulated ones
+		const auto Step = [](FFlecsReplicationTestValue& InOutValue)
+		{
+			++InOutValue.Value;
+		};
+
+		const FFlecsSystemHandle ResimulationSystem = World()->CreateSystem<>(TEXT("PredictionTestStep"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.With<FFlecsReplicationTestValue&>() // 0
+			.With<FFlecsPredictionResimulatingTag>() // 1
+			.run([&Step](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						Step(InIterator.field_at<FFlecsReplicationTestValue>(0, Index));
+					}
+				}
+			});
+
+		Prediction->AddResimulationSystem(ResimulationSystem);
+		ASSERT_THAT(IsTrue(ResimulationSystem.Has<FFlecsOutsideMainLoopTag>()));
+
+		// The server runs the same step, except for one frame where something the client couldn't predict happens
+		const FFlecsEntityHandle ServerEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 0 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), ServerEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot ServerSnapshot;
+		ServerSnapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		ServerSnapshot.FillFromEntity(ServerEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		const FFlecsNetworkId NetworkId(91, 1);
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, ServerSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> ClientEntity = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(ClientEntity.IsSet()));
+		if (!ClientEntity.IsSet())
+		{
+			return;
+		}
+
+		ClientEntity->Add<FFlecsPredictedEntityTag>();
+
+		TArray<FFlecsEntityReplicationSnapshot> InFlightSnapshots;
+
+		for (int32 Frame = 1; Frame <= FrameCount; ++Frame)
+		{
+			FFlecsReplicationTestValue& ServerValue = ServerEntity.GetMut<FFlecsReplicationTestValue>();
+			Step(ServerValue);
+			if (Frame == ServerCorrectionFrame)
+			{
+				ServerValue.Value += 10;
+			}
+
+			ServerSnapshot.FillFromEntity(ServerEntity, NetworkSubsystem()->GetLayoutRegistry());
+			InFlightSnapshots.Add(ServerSnapshot);
+
+			Step(ClientEntity->GetMut<FFlecsReplicationTestValue>());
+			Prediction->RecordPredictedEntity(ClientEntity.GetValue());
+
+			if (InFlightSnapshots.Num() > Latency)
+			{
+				NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, InFlightSnapshots[0]);
+				InFlightSnapshots.RemoveAt(0);
+
+				NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+				Prediction->ResimulatePendingRollbacks(FixedDeltaTime);
+			}
+		}
+
+		const FFlecsPredictionStats& Stats = Prediction->GetPredictionStats();
+
+		// Every delivered snapshot but the one of the correction frame was predicted
+		ASSERT_THAT(AreEqual(FrameCount - Latency - 1, Stats.ConfirmedSnapshotCount));
+		ASSERT_THAT(AreEqual(1, Stats.MispredictedSnapshotCount));
+		ASSERT_THAT(AreEqual(1, Stats.RollbackCount));
+		ASSERT_THAT(AreEqual(Latency, Stats.ResimulatedFrameCount));
+		ASSERT_THAT(AreEqual(static_cast<int64>(Latency), Stats.ResimulatedEntityFrameCount));
+		ASSERT_THAT(AreEqual(0, Prediction->GetPendingRollbackCount()));
+
+		// The server entity isn't predicted, so the resimulation system never touched it
+		ASSERT_THAT(AreEqual(ServerEntity.Get<FFlecsReplicationTestValue>().Value,
+			ClientEntity->Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(IsFalse(ClientEntity->Has<FFlecsPredictionResimulatingTag>()));
+
+		const FFlecsPredictionHistory* History = Prediction->FindPredictionHistory(ClientEntity.GetValue());
+		ASSERT_THAT(IsNotNull(History));
+		if (History)
+		{
+			ASSERT_THAT(AreEqual(ServerSnapshot.StateRevision, History->GetLatestRevision()));
+		}
+	}
+
+	TEST_METHOD(Prediction_EntityDestroyedMidRollback_IsDroppedFromResimulation)
+	{
+		static constexpr int32 PredictedFrameCount = 3;
+		static constexpr double FixedDeltaTime = 1.0 / 60.0;
+
+		UFlecsPredictionWorldSubsystem* Prediction = UnrealWorld()->GetSubsystem<UFlecsPredictionWorldSubsystem>();
+		ASSERT_THAT(IsNotNull(Prediction));
+		if (!Prediction)
+		{
+			return;
+		}
+
+		// Destroys whatever it resimulates, like a step that finds the entity died during a predicted frame
+		const FFlecsSystemHandle ResimulationSystem = World()->CreateSystem<>(TEXT("PredictionTestDestroyStep"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.With<FFlecsReplicationTestValue&>() // 0
+			.With<FFlecsPredictionResimulatingTag>() // 1
+			.run([](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						InIterator.entity(Index).destruct();
+					}
+				}
+			});
+
+		Prediction->AddResimulationSystem(ResimulationSystem);
+
+		const FFlecsEntityHandle ServerEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 0 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), ServerEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot ServerSnapshot;
+		ServerSnapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		ServerSnapshot.FillFromEntity(ServerEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		const FFlecsNetworkId NetworkId(92, 1);
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, ServerSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> ClientEntity = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(ClientEntity.IsSet()));
+		if (!ClientEntity.IsSet())
+		{
+			return;
+		}
+
+		ClientEntity->Add<FFlecsPredictedEntityTag>();
+
+		for (int32 Frame = 1; Frame <= PredictedFrameCount; ++Frame)
+		{
+			++ClientEntity->GetMut<FFlecsReplicationTestValue>().Value;
+			Prediction->RecordPredictedEntity(ClientEntity.GetValue());
+		}
+
+		// The first predicted frame disagrees with the server, so every later frame needs resimulating
+		ServerEntity.GetMut<FFlecsReplicationTestValue>().Value = 10;
+		ServerSnapshot.FillFromEntity(ServerEntity, NetworkSubsystem()->GetLayoutRegistry());
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, ServerSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		ASSERT_THAT(AreEqual(1, Prediction->GetPendingRollbackCount()));
+
+		const FFlecsEntityHandle DestroyedEntity = ClientEntity.GetValue();
+		Prediction->ResimulatePendingRollbacks(FixedDeltaTime);
+
+		const FFlecsPredictionStats& Stats = Prediction->GetPredictionStats();
+		ASSERT_THAT(IsFalse(DestroyedEntity.IsAlive()));
+		ASSERT_THAT(AreEqual(1, Stats.RollbackCount));
+		ASSERT_THAT(AreEqual(1, Stats.ResimulatedFrameCount));
+		ASSERT_THAT(AreEqual(static_cast<int64>(0), Stats.ResimulatedEntityFrameCount));
+		ASSERT_THAT(AreEqual(0, Prediction->GetPendingRollbackCount()));
+
+		// Recording the destroyed entity would have recreated its history
+		ASSERT_THAT(IsNull(Prediction->FindPredictionHistory(DestroyedEntity)));
+	}
+
+}; // FlecsPredictionTests
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -6,9 +6,16 @@
 #if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
 
 #include "Iris/ReplicationSystem/NetObjectFactoryRegistry.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
 #include "UObject/UObjectGlobals.h"
 
+#include "Entities/FlecsStablePathTag.h"
+
+#include "Networking/FlecsComponentReplicationDescriptor.h"
 #include "Networking/FlecsNetDirtyTag.h"
+#include "Networking/FlecsNetworkEntityTable.h"
 #include "Networking/Profiles/FlecsReplicationProfile.h"
 #include "Networking/Profiles/FlecsReplicationProfileDataAsset.h"
 #include "Networking/FlecsReplicationShardSelection.h"
@@ -16,6 +23,7 @@
 #include "Networking/FlecsNetworkingModuleSettings.h"
 #include "Networking/FlecsReplicatedEntityComponent.h"
 #include "Networking/Layout/FlecsLayoutReplicatorFastArray.h"
+#include "Networking/Layout/FlecsReplicationLayoutHandle.h"
 #include "Networking/Layout/FlecsReplicationLayoutRegistry.h"
 #include "Networking/Profiles/FlecsReplicationProfileParamTypes.h"
 #include "Networking/Shards/FlecsNetEntityTable.h"
@@ -89,6 +97,53 @@ FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsReplicationBridgeTests,
 		ASSERT_THAT(AreEqual(7u, Updates[0].StateRevision));
 	}
 
+	TEST_METHOD(ReplicationQueue_RequeuesLeftoversBeforeNewerUpdates)
+	{
+		FFlecsReplicationUpdateQueue Queue;
+		const FFlecsNetworkId LeftoverId(23, 1);
+		const FFlecsNetworkId SupersededId(24, 1);
+		const FFlecsNetworkId NewId(25, 1);
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = FFlecsReplicationLayoutId(FGuid::NewGuid());
+		Snapshot.StateRevision = 3;
+
+		Queue.EnqueueSnapshot(LeftoverId, Snapshot);
+		Queue.EnqueueSnapshot(SupersededId, Snapshot);
+		TArray<FFlecsReplicationQueuedUpdate> Leftovers = Queue.Drain();
+
+		FFlecsEntityReplicationSnapshot NewerSnapshot = Snapshot;
+		NewerSnapshot.StateRevision = 5;
+
+		Queue.EnqueueSnapshot(NewId, NewerSnapshot);
+		Queue.EnqueueSnapshot(SupersededId, NewerSnapshot);
+		Queue.Requeue(MoveTemp(Leftovers));
+
+		const TArray<FFlecsReplicationQueuedUpdate> Updates = Queue.Drain();
+		ASSERT_THAT(AreEqual(3, Updates.Num()));
+		if (Updates.Num() != 3)
+		{
+			return;
+		}
+
+		ASSERT_THAT(IsTrue(Updates[0].NetworkId == LeftoverId));
+		ASSERT_THAT(IsTrue(Updates[1].NetworkId == NewId));
+		ASSERT_THAT(IsTrue(Updates[2].NetworkId == SupersededId));
+		ASSERT_THAT(AreEqual(5u, Updates[2].StateRevision));
+
+		// The index follows the requeued order, later updates still coalesce into the right entry
+		Queue.Requeue(CopyTemp(Updates));
+		Queue.EnqueueRemoval(LeftoverId, 6);
+
+		const TArray<FFlecsReplicationQueuedUpdate> CoalescedUpdates = Queue.Drain();
+		ASSERT_THAT(AreEqual(3, CoalescedUpdates.Num()));
+		if (CoalescedUpdates.Num() == 3)
+		{
+			ASSERT_THAT(IsTrue(CoalescedUpdates[0].bRemove));
+			ASSERT_THAT(AreEqual(6u, CoalescedUpdates[0].StateRevision));
+		}
+	}
+
 	TEST_METHOD(ReplicationProfile_AssetCreatesFlecsPrefab)
 	{
 		UFlecsReplicationProfileDataAsset* Asset = NewObject<UFlecsReplicationProfileDataAsset>(NetworkSubsystem());
@@ -353,6 +408,625 @@ FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsReplicationBridgeTests,
 		ASSERT_THAT(AreEqual(91, ReceivedEntity.GetValue().Get<FFlecsReplicationTestValue>().Value));
 	}
 
+	TEST_METHOD(ReplicationQueue_AppliesSnapshotsOfOneLayoutInBatches)
+	{
+		static constexpr int32 EntityCount = 5;
+
+		UFlecsNetworkingModuleSettings* Settings = GetMutableDefault<UFlecsNetworkingModuleSettings>();
+		TGuardValue<int32> BatchSizeGuard(Settings->ReplicationApplyBatchSize, 2);
+		TGuardValue<double> TimeBudgetGuard(Settings->ReplicationApplyTimeBudget, UE_SMALL_NUMBER);
+
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 0 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(
+				World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			SourceEntity.Set<FFlecsReplicationTestValue>({ 100 + Index });
+
+			FFlecsEntityReplicationSnapshot Snapshot;
+			Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+			Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+			NetworkSubsystem()->QueueReplicationSnapshot(FFlecsNetworkId(40 + Index, 1), Snapshot);
+		}
+
+		// The time budget runs out after the first batch, the remaining snapshots stay queued
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		ASSERT_THAT(AreEqual(EntityCount - 2, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+
+		Settings->ReplicationApplyTimeBudget = 0.0;
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+
+		const ecs_table_t* FirstTable = nullptr;
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const TOptional<FFlecsEntityHandle> ReceivedEntity =
+				NetworkSubsystem()->GetEntityFromNetworkId(FFlecsNetworkId(40 + Index, 1));
+			ASSERT_THAT(IsTrue(ReceivedEntity.IsSet()));
+			if (!ReceivedEntity.IsSet())
+			{
+				return;
+			}
+
+			ASSERT_THAT(AreEqual(100 + Index, ReceivedEntity.GetValue().Get<FFlecsReplicationTestValue>().Value));
+			ASSERT_THAT(IsTrue(ReceivedEntity.GetValue().Get<FFlecsNetworkId>() == FFlecsNetworkId(40 + Index, 1)));
+
+			// Every entity of the layout is created directly in the same table
+			const ecs_table_t* Table = ecs_get_table(World()->GetNativeFlecsWorld(), ReceivedEntity.GetValue().GetFlecsId());
+			FirstTable = FirstTable ? FirstTable : Table;
+			ASSERT_THAT(IsTrue(Table == FirstTable));
+		}
+	}
+
+	TEST_METHOD(LayoutRegistry_AssignsCompactHandlesToLocalLayouts)
+	{
+		const FFlecsEntityHandle ValueEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 1 });
+		const FFlecsEntityHandle TaggedEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 2 })
+			.Add<FFlecsReplicationTestTag>();
+
+		FFlecsReplicationLayoutRegistry& Registry = NetworkSubsystem()->GetLayoutRegistry();
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> ValueLayout =
+			Registry.BuildForEntity(World(), ValueEntity, bCreatedNewLayout);
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> TaggedLayout =
+			Registry.BuildForEntity(World(), TaggedEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(ValueLayout.HasError()));
+		ASSERT_THAT(IsFalse(TaggedLayout.HasError()));
+		if (ValueLayout.HasError() || TaggedLayout.HasError())
+		{
+			return;
+		}
+
+		const FFlecsReplicationLayoutHandle ValueHandle = ValueLayout.GetValue()->Handle;
+		const FFlecsReplicationLayoutHandle TaggedHandle = TaggedLayout.GetValue()->Handle;
+
+		ASSERT_THAT(IsTrue(ValueHandle.IsValid()));
+		ASSERT_THAT(IsTrue(TaggedHandle.IsValid()));
+		ASSERT_THAT(IsFalse(ValueHandle == TaggedHandle));
+		ASSERT_THAT(IsTrue(Registry.FindLayoutId(ValueHandle) == ValueLayout.GetValue()->LayoutId));
+		ASSERT_THAT(IsTrue(Registry.FindLayoutId(TaggedHandle) == TaggedLayout.GetValue()->LayoutId));
+
+		// The layout ID stays the content hash of the sorted keys
+		ASSERT_THAT(IsTrue(FFlecsReplicationLayoutRegistry::ComputeLayoutId(ValueLayout.GetValue()->Keys)
+			== ValueLayout.GetValue()->LayoutId));
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = ValueLayout.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(ValueEntity, Registry);
+		ASSERT_THAT(IsTrue(Snapshot.LayoutHandle == ValueHandle));
+	}
+
+	TEST_METHOD(ReplicationQueue_ResolvesLayoutHandle_WhenDictionaryEntryArrives)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 23 });
+
+		// The server registry is separate so the handle is unknown to the receiving subsystem
+		FFlecsReplicationLayoutRegistry ServerRegistry;
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			ServerRegistry.BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		const FFlecsReplicationLayoutDefinition LayoutDefinition = *LayoutResult.GetValue();
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutDefinition.LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, ServerRegistry);
+
+		// Only the handle is replicated
+		Snapshot.LayoutId = FFlecsReplicationLayoutId();
+		ASSERT_THAT(IsTrue(Snapshot.HasLayout()));
+
+		const FFlecsNetworkId NetworkId(61, 1);
+		NetworkSubsystem()->ReceiveNetworkEntitySnapshot(NetworkId, Snapshot);
+
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		ASSERT_THAT(AreEqual(1, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->GetEntityFromNetworkId(NetworkId).IsSet()));
+
+		NetworkSubsystem()->GetReplicationBridge()->ReceiveEntityLayout(LayoutDefinition);
+		ASSERT_THAT(IsTrue(NetworkSubsystem()->GetLayoutRegistry().FindLayoutId(LayoutDefinition.Handle)
+			== LayoutDefinition.LayoutId));
+
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetQueuedReplicationUpdateCount()));
+
+		const TOptional<FFlecsEntityHandle> ReceivedEntity = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(ReceivedEntity.IsSet()));
+		if (!ReceivedEntity.IsSet())
+		{
+			return;
+		}
+
+		ASSERT_THAT(AreEqual(23, ReceivedEntity.GetValue().Get<FFlecsReplicationTestValue>().Value));
+	}
+
+	TEST_METHOD(LayoutHandle_WireSizePerEntity_IsSmallerThanLayoutId)
+	{
+		using namespace UE::Net;
+
+		static constexpr int32 EntityCount = 10000;
+		static constexpr int32 LayoutCount = 200;
+
+		// Most entities of a scene share a few layouts, the rest are spread over the long tail
+		FRandomStream Random(0x1A40);
+
+		TArray<FFlecsReplicationLayoutId> LayoutIds;
+		for (int32 Index = 0; Index < LayoutCount; ++Index)
+		{
+			LayoutIds.Add(FFlecsReplicationLayoutId(FGuid::NewGuid()));
+		}
+
+		TArray<int32> EntityLayouts;
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const int32 LayoutIndex = Random.FRand() < 0.8f
+				? Random.RandRange(0, 15) : Random.RandRange(0, LayoutCount - 1);
+			EntityLayouts.Add(LayoutIndex);
+		}
+
+		TArray<uint32> Buffer;
+		Buffer.SetNumZeroed(EntityCount * 4 + 16);
+
+		// Iris writes an FGuid property as four 32 bit words
+		FNetBitStreamWriter IdWriter;
+		IdWriter.InitBytes(Buffer.GetData(), Buffer.Num() * sizeof(uint32));
+		for (const int32 LayoutIndex : EntityLayouts)
+		{
+			const FGuid& Guid = LayoutIds[LayoutIndex].Value;
+			IdWriter.WriteBits(Guid.A, 32);
+			IdWriter.WriteBits(Guid.B, 32);
+			IdWriter.WriteBits(Guid.C, 32);
+			IdWriter.WriteBits(Guid.D, 32);
+		}
+		IdWriter.CommitWrites();
+		ASSERT_THAT(IsFalse(IdWriter.IsOverflown()));
+
+		const uint32 IdBits = IdWriter.GetPosBits();
+
+		const FNetSerializer& Serializer = UE_NET_GET_SERIALIZER(FFlecsReplicationLayoutHandleNetSerializer);
+
+		FNetBitStreamWriter HandleWriter;
+		HandleWriter.InitBytes(Buffer.GetData(), Buffer.Num() * sizeof(uint32));
+		FNetSerializationContext WriteContext(&HandleWriter);
+
+		for (const int32 LayoutIndex : EntityLayouts)
+		{
+			// Handles are assigned in registration order, starting at 1
+			const FFlecsReplicationLayoutHandle Handle(LayoutIndex + 1);
+			uint32 Quantized = 0;
+
+			FNetQuantizeArgs QuantizeArgs;
+			QuantizeArgs.NetSerializerConfig = Serializer.DefaultConfig;
+			QuantizeArgs.Source = NetSerializerValuePointer(&Handle);
+			QuantizeArgs.Target = NetSerializerValuePointer(&Quantized);
+			Serializer.Quantize(WriteContext, QuantizeArgs);
+
+			FNetSerializeArgs SerializeArgs;
+			SerializeArgs.NetSerializerConfig = Serializer.DefaultConfig;
+			SerializeArgs.Source = NetSerializerValuePointer(&Quantized);
+			Serializer.Serialize(WriteContext, SerializeArgs);
+		}
+		HandleWriter.CommitWrites();
+		ASSERT_THAT(IsFalse(HandleWriter.IsOverflown()));
+
+		const uint32 HandleBits = HandleWriter.GetPosBits();
+
+		FNetBitStreamReader Reader;
+		Reader.InitBits(Buffer.GetData(), HandleBits);
+		FNetSerializationContext ReadContext(&Reader);
+
+		for (const int32 LayoutIndex : EntityLayouts)
+		{
+			uint32 Quantized = 0;
+			FNetDeserializeArgs DeserializeArgs;
+			DeserializeArgs.NetSerializerConfig = Serializer.DefaultConfig;
+			DeserializeArgs.Target = NetSerializerValuePointer(&Quantized);
+			Serializer.Deserialize(ReadContext, DeserializeArgs);
+
+			ASSERT_THAT(AreEqual(static_cast<uint32>(LayoutIndex + 1), Quantized));
+		}
+
+		// The dictionary sends the layout ID and the handle once per layout and connection
+		const double DictionaryBytes = LayoutCount * (sizeof(FGuid) + sizeof(uint32));
+		const double IdBytesPerEntity = IdBits / 8.0 / EntityCount;
+		const double HandleBytesPerEntity = (HandleBits / 8.0 + DictionaryBytes) / EntityCount;
+
+		TestRunner->AddInfo(FString::Printf(
+			TEXT("Layout reference for %d entities over %d layouts: %.2f bytes/entity by ID, %.2f bytes/entity by handle incl. dictionary"),
+			EntityCount, LayoutCount, IdBytesPerEntity, HandleBytesPerEntity));
+
+		ASSERT_THAT(IsTrue(HandleBytesPerEntity * 4.0 < IdBytesPerEntity));
+	}
+
+	TEST_METHOD(ReplicationApply_UpdatesExistingEntityInPlace_AndRemovesDroppedKeys)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 5 })
+			.Add<FFlecsReplicationTestTag>();
+
+		const auto MakeSnapshot = [this, &SourceEntity](const uint32 InStateRevision)
+		{
+			bool bCreatedNewLayout = false;
+			const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+				NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+			FFlecsEntityReplicationSnapshot Snapshot;
+			if (LayoutResult.HasError())
+			{
+				return Snapshot;
+			}
+
+			Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+			Snapshot.StateRevision = InStateRevision - 1;
+			Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+			return Snapshot;
+		};
+
+		const FFlecsNetworkId NetworkId(71, 1);
+
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, MakeSnapshot(1));
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> ReceivedEntity = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(ReceivedEntity.IsSet()));
+		if (!ReceivedEntity.IsSet())
+		{
+			return;
+		}
+
+		const FFlecsEntityHandle Entity = ReceivedEntity.GetValue();
+		ASSERT_THAT(AreEqual(5, Entity.Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(IsTrue(Entity.Has<FFlecsReplicationTestTag>()));
+
+		// Client only data isn't part of any layout and has to survive every update
+		Entity.Add<FFlecsTestStruct_Tag>();
+		const ecs_table_t* InitialTable = ecs_get_table(World()->GetNativeFlecsWorld(), Entity.GetFlecsId());
+
+		SourceEntity.Set<FFlecsReplicationTestValue>({ 6 });
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, MakeSnapshot(2));
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		ASSERT_THAT(AreEqual(6, Entity.Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(IsTrue(ecs_get_table(World()->GetNativeFlecsWorld(), Entity.GetFlecsId()) == InitialTable));
+
+		SourceEntity.Remove<FFlecsReplicationTestTag>();
+		SourceEntity.Set<FFlecsReplicationTestValue>({ 7 });
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, MakeSnapshot(3));
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		ASSERT_THAT(AreEqual(7, Entity.Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(IsFalse(Entity.Has<FFlecsReplicationTestTag>()));
+		ASSERT_THAT(IsTrue(Entity.Has<FFlecsTestStruct_Tag>()));
+	}
+
+	TEST_METHOD(ReplicationApply_ValueThatFailsToDeserialize_LeavesComponentUntouched)
+	{
+		FFlecsReplicationTestNativePair SourceValue;
+		SourceValue.First = 1;
+		SourceValue.Second = 2;
+
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestNativePair>(SourceValue);
+
+		const auto MakeSnapshot = [this, &SourceEntity](const uint32 InStateRevision)
+		{
+			bool bCreatedNewLayout = false;
+			const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+				NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+			FFlecsEntityReplicationSnapshot Snapshot;
+			if (LayoutResult.HasError())
+			{
+				return Snapshot;
+			}
+
+			Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+			Snapshot.StateRevision = InStateRevision - 1;
+			Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+			return Snapshot;
+		};
+
+		const FFlecsNetworkId NetworkId(72, 1);
+
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, MakeSnapshot(1));
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> ReceivedEntity = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(ReceivedEntity.IsSet()));
+		if (!ReceivedEntity.IsSet())
+		{
+			return;
+		}
+
+		const FFlecsEntityHandle Entity = ReceivedEntity.GetValue();
+		ASSERT_THAT(AreEqual(1, Entity.Get<FFlecsReplicationTestNativePair>().First));
+		ASSERT_THAT(AreEqual(2, Entity.Get<FFlecsReplicationTestNativePair>().Second));
+
+		SourceValue.First = 3;
+		SourceValue.Second = 4;
+		SourceEntity.Set<FFlecsReplicationTestNativePair>(SourceValue);
+
+		// Cut the payload of the value after its first member, so only the second member fails to read
+		FFlecsEntityReplicationSnapshot TruncatedSnapshot = MakeSnapshot(2);
+		ASSERT_THAT(AreEqual(1, TruncatedSnapshot.PackedValues.Num()));
+		TruncatedSnapshot.PackedValues[0].Size = sizeof(int32);
+
+		TestRunner->AddExpectedError(TEXT("Cannot deserialize snapshot value"), EAutomationExpectedErrorFlags::Contains, 1);
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, TruncatedSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		ASSERT_THAT(AreEqual(1, Entity.Get<FFlecsReplicationTestNativePair>().First));
+		ASSERT_THAT(AreEqual(2, Entity.Get<FFlecsReplicationTestNativePair>().Second));
+	}
+
+	TEST_METHOD(ReplicationApply_EntityDestroyedOutsideReplication_ForgetsAppliedLayout)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 5 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		const FFlecsNetworkId NetworkId(73, 1);
+		NetworkSubsystem()->QueueReplicationSnapshot(NetworkId, Snapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> ReceivedEntity = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(ReceivedEntity.IsSet()));
+		if (!ReceivedEntity.IsSet())
+		{
+			return;
+		}
+
+		const FFlecsEntityHandle Entity = ReceivedEntity.GetValue();
+		ASSERT_THAT(IsTrue(NetworkSubsystem()->FindAppliedEntityLayout(Entity) != nullptr));
+
+		Entity.Destroy();
+		ASSERT_THAT(IsNull(NetworkSubsystem()->FindAppliedEntityLayout(Entity)));
+	}
+
+	TEST_METHOD(DirtyTracking_SetsComponentBits_WithoutChangingTable)
+	{
+		const FFlecsEntityHandle Entity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 1 })
+			.Set<FFlecsReplicationTestDontFragmentValue>({ 2 })
+			.Add<FFlecsReplicatedEntityComponent>();
+
+		NetworkSubsystem()->BeginReplicatingEntity(Entity);
+
+		const FFlecsReplicatedEntityComponent* ReplicatedEntity = Entity.TryGet<FFlecsReplicatedEntityComponent>();
+		ASSERT_THAT(IsNotNull(ReplicatedEntity));
+		if (!ReplicatedEntity)
+		{
+			return;
+		}
+
+		// Replication start dirties the whole entity
+		ASSERT_THAT(IsTrue((ReplicatedEntity->DirtyComponentMask & FFlecsReplicatedEntityComponent::EntityDirtyMask) != 0));
+		ASSERT_THAT(AreEqual(1, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		ASSERT_THAT(AreEqual(1, TestBridge()->GetPublishedSnapshots().Num()));
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+		ASSERT_THAT(IsTrue(ReplicatedEntity->DirtyComponentMask == 0));
+
+		const uint64 ValueMask = NetworkSubsystem()->GetComponentDirtyMask(
+			World()->GetScriptStructEntity<FFlecsReplicationTestValue>().GetFlecsId());
+		const uint64 DontFragmentValueMask = NetworkSubsystem()->GetComponentDirtyMask(
+			World()->GetScriptStructEntity<FFlecsReplicationTestDontFragmentValue>().GetFlecsId());
+		ASSERT_THAT(IsTrue(ValueMask != 0));
+		ASSERT_THAT(IsTrue(DontFragmentValueMask != 0));
+		ASSERT_THAT(IsTrue(ValueMask != DontFragmentValueMask));
+
+		const ecs_table_t* InitialTable = ecs_get_table(World()->GetNativeFlecsWorld(), Entity.GetFlecsId());
+
+		Entity.Set<FFlecsReplicationTestValue>({ 3 });
+		Entity.Set<FFlecsReplicationTestValue>({ 4 });
+
+		ASSERT_THAT(IsTrue(ReplicatedEntity->DirtyComponentMask == ValueMask));
+		ASSERT_THAT(AreEqual(1, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+		ASSERT_THAT(IsFalse(Entity.Has<FFlecsNetDirtyTag>()));
+		ASSERT_THAT(IsTrue(ecs_get_table(World()->GetNativeFlecsWorld(), Entity.GetFlecsId()) == InitialTable));
+
+		Entity.Set<FFlecsReplicationTestDontFragmentValue>({ 5 });
+		ASSERT_THAT(IsTrue(ReplicatedEntity->DirtyComponentMask == (ValueMask | DontFragmentValueMask)));
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		ASSERT_THAT(AreEqual(2, TestBridge()->GetPublishedSnapshots().Num()));
+		ASSERT_THAT(IsTrue(ReplicatedEntity->DirtyComponentMask == 0));
+		ASSERT_THAT(IsTrue(ecs_get_table(World()->GetNativeFlecsWorld(), Entity.GetFlecsId()) == InitialTable));
+
+		// Only the written component is serialized again, the other one keeps the revision it was last sent with
+		Entity.Set<FFlecsReplicationTestValue>({ 6 });
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		ASSERT_THAT(AreEqual(3, TestBridge()->GetPublishedSnapshots().Num()));
+
+		const FFlecsEntityReplicationSnapshot& BothDirtySnapshot = TestBridge()->GetPublishedSnapshots()[1].Value;
+		const FFlecsEntityReplicationSnapshot& ValueDirtySnapshot = TestBridge()->GetPublishedSnapshots()[2].Value;
+		ASSERT_THAT(AreEqual(BothDirtySnapshot.PackedValues.Num(), ValueDirtySnapshot.PackedValues.Num()));
+
+		int32 ReserializedCount = 0;
+		for (int32 Index = 0; Index < ValueDirtySnapshot.PackedValues.Num(); ++Index)
+		{
+			if (ValueDirtySnapshot.PackedValues[Index].Revision == ValueDirtySnapshot.StateRevision)
+			{
+				++ReserializedCount;
+			}
+			else
+			{
+				ASSERT_THAT(AreEqual(BothDirtySnapshot.PackedValues[Index].Revision, ValueDirtySnapshot.PackedValues[Index].Revision));
+				ASSERT_THAT(AreEqual(BothDirtySnapshot.PackedValues[Index].Size, ValueDirtySnapshot.PackedValues[Index].Size));
+			}
+		}
+
+		ASSERT_THAT(AreEqual(1, ReserializedCount));
+	}
+
+	TEST_METHOD(NetworkEntityTable_ValidatesGenerationOfSlot)
+	{
+		FFlecsNetworkEntityTable Table;
+		const FFlecsNetworkId FirstId(5, 1);
+		const FFlecsNetworkId ReusedId(5, 2);
+		const FFlecsNetworkId FarId(FFlecsNetworkEntityTable::PageSize * 3 + 7, 1);
+
+		FFlecsNetworkEntityRecord& FirstRecord = Table.FindOrAdd(FirstId);
+		FirstRecord.RemovedRevision = 9;
+		FirstRecord.bRemoved = true;
+
+		// Claiming slots on other pages doesn't move existing records
+		Table.FindOrAdd(FarId);
+		ASSERT_THAT(IsTrue(Table.Find(FirstId) == &FirstRecord));
+		ASSERT_THAT(AreEqual(2, Table.Num()));
+
+		ASSERT_THAT(IsNull(Table.Find(ReusedId)));
+		ASSERT_THAT(IsNull(Table.Find(FFlecsNetworkId(6, 1))));
+
+		FFlecsNetworkEntityRecord& ReusedRecord = Table.FindOrAdd(ReusedId);
+		ASSERT_THAT(IsTrue(&ReusedRecord == &FirstRecord));
+		ASSERT_THAT(IsFalse(ReusedRecord.bRemoved));
+		ASSERT_THAT(IsNull(Table.Find(FirstId)));
+		ASSERT_THAT(AreEqual(2, Table.Num()));
+
+		ASSERT_THAT(IsFalse(Table.Remove(FirstId)));
+		ASSERT_THAT(IsTrue(Table.Remove(ReusedId)));
+		ASSERT_THAT(IsNull(Table.FindSlot(ReusedId.GetSlot())));
+		ASSERT_THAT(AreEqual(1, Table.Num()));
+	}
+
+	TEST_METHOD(ReplicationApply_NewGenerationReplacesEntityOfReusedSlot)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 3 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		const FFlecsNetworkId OldNetworkId(81, 1);
+		const FFlecsNetworkId NewNetworkId(81, 2);
+
+		NetworkSubsystem()->QueueReplicationSnapshot(OldNetworkId, Snapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> OldEntity = NetworkSubsystem()->GetEntityFromNetworkId(OldNetworkId);
+		ASSERT_THAT(IsTrue(OldEntity.IsSet()));
+		if (!OldEntity.IsSet())
+		{
+			return;
+		}
+
+		NetworkSubsystem()->QueueReplicationSnapshot(NewNetworkId, Snapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		ASSERT_THAT(IsTrue(NetworkSubsystem()->GetEntityFromNetworkId(NewNetworkId).IsSet()));
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->GetEntityFromNetworkId(OldNetworkId).IsSet()));
+		ASSERT_THAT(IsFalse(OldEntity.GetValue().IsAlive()));
+
+		// A late snapshot of the older generation can't take the slot back
+		FFlecsEntityReplicationSnapshot LateSnapshot = Snapshot;
+		++LateSnapshot.StateRevision;
+		NetworkSubsystem()->QueueReplicationSnapshot(OldNetworkId, LateSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		ASSERT_THAT(IsTrue(NetworkSubsystem()->GetEntityFromNetworkId(NewNetworkId).IsSet()));
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->GetEntityFromNetworkId(OldNetworkId).IsSet()));
+	}
+
+	TEST_METHOD(ReplicationApply_BatchWithTwoGenerationsOfSlot_KeepsNewestGeneration)
+	{
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 3 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		const FFlecsNetworkId OldNetworkId(82, 1);
+		const FFlecsNetworkId NewNetworkId(82, 2);
+
+		NetworkSubsystem()->QueueReplicationSnapshot(OldNetworkId, Snapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> OldEntity = NetworkSubsystem()->GetEntityFromNetworkId(OldNetworkId);
+		ASSERT_THAT(IsTrue(OldEntity.IsSet()));
+		if (!OldEntity.IsSet())
+		{
+			return;
+		}
+
+		// Both generations land in the same batch, the older one is dropped instead of fighting over the slot
+		FFlecsEntityReplicationSnapshot OldSnapshot = Snapshot;
+		++OldSnapshot.StateRevision;
+		NetworkSubsystem()->QueueReplicationSnapshot(OldNetworkId, OldSnapshot);
+		NetworkSubsystem()->QueueReplicationSnapshot(NewNetworkId, Snapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> NewEntity = NetworkSubsystem()->GetEntityFromNetworkId(NewNetworkId);
+		ASSERT_THAT(IsTrue(NewEntity.IsSet()));
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->GetEntityFromNetworkId(OldNetworkId).IsSet()));
+		ASSERT_THAT(IsFalse(OldEntity.GetValue().IsAlive()));
+		ASSERT_THAT(AreEqual(1, NetworkSubsystem()->GetNetworkEntities().Num()));
+
+		if (NewEntity.IsSet())
+		{
+			ASSERT_THAT(AreEqual(3, NewEntity.GetValue().Get<FFlecsReplicationTestValue>().Value));
+		}
+	}
+
 	TEST_METHOD(LayoutFastArray_AddsIdempotently)
 	{
 		FFlecsReplicationLayoutDefinition Layout;
@@ -367,6 +1041,165 @@ FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsReplicationBridgeTests,
 		ASSERT_THAT(IsTrue(Layouts.FindLayout(Layout.LayoutId) != nullptr));
 	}
 
+	TEST_METHOD(BeginReplicatingEntities_RegistersBatch_AndKeepsExistingNetworkIds)
+	{
+		static constexpr int32 EntityCount = 32;
+
+		const FFlecsEntityHandle AlreadyReplicated = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 1 })
+			.Add<FFlecsReplicatedEntityComponent>();
+
+		const FFlecsNetworkId ExistingNetworkId = NetworkSubsystem()->BeginReplicatingEntity(AlreadyReplicated);
+
+		TArray<FFlecsEntityHandle> Entities;
+		Entities.Add(AlreadyReplicated);
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			Entities.Add(World()->CreateEntity()
+				.Set<FFlecsReplicationTestValue>({ Index })
+				.Add<FFlecsReplicatedEntityComponent>());
+		}
+
+		// A handle listed twice is registered once
+		TArray<FFlecsEntityHandle> EntitiesWithDuplicate = Entities;
+		EntitiesWithDuplicate.Add(Entities[1]);
+
+		ASSERT_THAT(AreEqual(EntityCount, NetworkSubsystem()->BeginReplicatingEntities(EntitiesWithDuplicate)));
+		ASSERT_THAT(IsTrue(AlreadyReplicated.Get<FFlecsNetworkId>() == ExistingNetworkId));
+
+		TSet<FFlecsNetworkId> NetworkIds;
+		for (const FFlecsEntityHandle& Entity : Entities)
+		{
+			const FFlecsNetworkId NetworkId = Entity.Get<FFlecsNetworkId>();
+			ASSERT_THAT(IsTrue(NetworkId.IsValid()));
+
+			const TOptional<FFlecsEntityHandle> Registered = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+			ASSERT_THAT(IsTrue(Registered.IsSet() && Registered.GetValue() == Entity));
+
+			NetworkIds.Add(NetworkId);
+		}
+
+		ASSERT_THAT(AreEqual(EntityCount + 1, NetworkIds.Num()));
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		ASSERT_THAT(AreEqual(EntityCount + 1, TestBridge()->GetPublishedSnapshots().Num()));
+	}
+
+	TEST_METHOD(ReplicationDescriptor_ComparesNativeValuesWithoutPaddingByTheirBytes)
+	{
+		const FFlecsComponentReplicationDescriptor* Descriptor = FFlecsComponentReplicationRegistry::Get(World())
+			.Find(World()->ObtainTypedEntity<FFlecsReplicationTestNativeValue>().GetFlecsId());
+		ASSERT_THAT(IsNotNull(Descriptor));
+		if (!Descriptor)
+		{
+			return;
+		}
+
+		ASSERT_THAT(IsTrue(Descriptor->bIsBitwiseComparable));
+
+		const FFlecsReplicationTestNativeValue ValueA{ 4 };
+		const FFlecsReplicationTestNativeValue ValueB{ 4 };
+		const FFlecsReplicationTestNativeValue ValueC{ 5 };
+
+		ASSERT_THAT(IsTrue(Descriptor->AreValuesIdentical(&ValueA, &ValueB)));
+		ASSERT_THAT(IsFalse(Descriptor->AreValuesIdentical(&ValueA, &ValueC)));
+	}
+
+	TEST_METHOD(ReplicationBaseline_SendsOnlyOverrides_AndResetsRevertedValuesToThePrefab)
+	{
+		const FFlecsEntityHandle Prefab = World()->CreatePrefab(TEXT("ReplicationBaselinePrefab"))
+			.Set<FFlecsReplicationTestValue>({ 10 })
+			.Add<FFlecsStablePathTag>();
+
+		const FFlecsEntityHandle MatchingInstance = World()->CreateEntity()
+			.AddPrefab(Prefab.GetFlecsId())
+			.Set<FFlecsReplicationTestValue>({ 10 });
+
+		const FFlecsEntityHandle OverridingInstance = World()->CreateEntity()
+			.AddPrefab(Prefab.GetFlecsId())
+			.Set<FFlecsReplicationTestValue>({ 25 });
+
+		const FFlecsEntityHandle PlainEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 10 });
+
+		const auto MakeSnapshot = [this](const FFlecsEntityHandle& InEntity, const uint32 InStateRevision)
+		{
+			bool bCreatedNewLayout = false;
+			const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+				NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), InEntity, bCreatedNewLayout);
+
+			FFlecsEntityReplicationSnapshot Snapshot;
+			if (LayoutResult.HasError())
+			{
+				return Snapshot;
+			}
+
+			Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+			Snapshot.StateRevision = InStateRevision - 1;
+			Snapshot.FillFromEntity(InEntity, NetworkSubsystem()->GetLayoutRegistry());
+			return Snapshot;
+		};
+
+		const FFlecsEntityReplicationSnapshot MatchingSnapshot = MakeSnapshot(MatchingInstance, 1);
+		const FFlecsEntityReplicationSnapshot OverridingSnapshot = MakeSnapshot(OverridingInstance, 1);
+		const FFlecsEntityReplicationSnapshot PlainSnapshot = MakeSnapshot(PlainEntity, 1);
+
+		const FFlecsReplicationLayoutDefinition* InstanceLayout =
+			NetworkSubsystem()->GetLayoutRegistry().Find(MatchingSnapshot.LayoutId);
+		ASSERT_THAT(IsNotNull(InstanceLayout));
+		if (!InstanceLayout)
+		{
+			return;
+		}
+
+		ASSERT_THAT(IsTrue(InstanceLayout->HasBaseline()));
+		ASSERT_THAT(IsTrue(FFlecsReplicationIndividualKey::ResolveToId(World(), InstanceLayout->Baseline) == Prefab.GetFlecsId()));
+		ASSERT_THAT(IsTrue(MatchingSnapshot.LayoutId == OverridingSnapshot.LayoutId));
+		ASSERT_THAT(IsTrue(MatchingSnapshot.LayoutId != PlainSnapshot.LayoutId));
+
+		// Values equal to the prefab's carry no revision and no payload
+		ASSERT_THAT(IsTrue(MatchingSnapshot.PayloadData.IsEmpty()));
+		for (const FFlecsReplicatedPackedValue& PackedValue : MatchingSnapshot.PackedValues)
+		{
+			ASSERT_THAT(AreEqual(0u, PackedValue.Revision));
+		}
+
+		ASSERT_THAT(IsFalse(OverridingSnapshot.PayloadData.IsEmpty()));
+		ASSERT_THAT(IsTrue(MatchingSnapshot.GetEstimatedNetSize() < PlainSnapshot.GetEstimatedNetSize()));
+
+		const FFlecsNetworkId MatchingNetworkId(81, 1);
+		const FFlecsNetworkId OverridingNetworkId(82, 1);
+
+		NetworkSubsystem()->QueueReplicationSnapshot(MatchingNetworkId, MatchingSnapshot);
+		NetworkSubsystem()->QueueReplicationSnapshot(OverridingNetworkId, OverridingSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const TOptional<FFlecsEntityHandle> ReceivedMatching = NetworkSubsystem()->GetEntityFromNetworkId(MatchingNetworkId);
+		const TOptional<FFlecsEntityHandle> ReceivedOverriding = NetworkSubsystem()->GetEntityFromNetworkId(OverridingNetworkId);
+		ASSERT_THAT(IsTrue(ReceivedMatching.IsSet() && ReceivedOverriding.IsSet()));
+		if (!ReceivedMatching.IsSet() || !ReceivedOverriding.IsSet())
+		{
+			return;
+		}
+
+		ASSERT_THAT(IsTrue(ReceivedMatching->IsA(Prefab.GetFlecsId())));
+		ASSERT_THAT(IsTrue(ReceivedOverriding->IsA(Prefab.GetFlecsId())));
+		ASSERT_THAT(AreEqual(10, ReceivedMatching->Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(AreEqual(25, ReceivedOverriding->Get<FFlecsReplicationTestValue>().Value));
+
+		// Reverting the override leaves the value out again, the receiver resets it from its prefab
+		OverridingInstance.Set<FFlecsReplicationTestValue>({ 10 });
+		const FFlecsEntityReplicationSnapshot RevertedSnapshot = MakeSnapshot(OverridingInstance, 2);
+		ASSERT_THAT(IsTrue(RevertedSnapshot.PayloadData.IsEmpty()));
+
+		NetworkSubsystem()->QueueReplicationSnapshot(OverridingNetworkId, RevertedSnapshot);
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		ASSERT_THAT(AreEqual(10, ReceivedOverriding->Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(AreEqual(10, Prefab.Get<FFlecsReplicationTestValue>().Value));
+	}
+
 	
 }; // FlecsReplicationBridgeTests
 
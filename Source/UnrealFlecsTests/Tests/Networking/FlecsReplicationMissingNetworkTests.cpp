@@ -686,7 +686,7 @@ NETWORK_TEST_CLASS(FlecsReplicationAdditionalRealBridgeNetworkTests,
 				const UFlecsNetworkWorldSubsystem* NetworkSubsystem =
 					State.World->GetSubsystemChecked<UFlecsNetworkWorldSubsystem>();
 				const FFlecsEntityReplicationSnapshot* Snapshot =
-					NetworkSubsystem->GetReplicationSnapshots().Find(OldNetworkId);
+					NetworkSubsystem->FindReplicationSnapshot(OldNetworkId);
 				if (!Snapshot)
 				{
 					return false;
@@ -1236,7 +1236,7 @@ NETWORK_TEST_CLASS(FlecsReplicationPacketSimulationNetworkTests,
 				const UFlecsNetworkWorldSubsystem* NetworkSubsystem =
 					State.World->GetSubsystemChecked<UFlecsNetworkWorldSubsystem>();
 				const FFlecsEntityReplicationSnapshot* Snapshot =
-					NetworkSubsystem->GetReplicationSnapshots().Find(ExpectedNetworkId);
+					NetworkSubsystem->FindReplicationSnapshot(ExpectedNetworkId);
 				if (!Snapshot)
 				{
 					return false;
@@ -1252,7 +1252,7 @@ NETWORK_TEST_CLASS(FlecsReplicationPacketSimulationNetworkTests,
 				const UFlecsNetworkWorldSubsystem* NetworkSubsystem =
 					State.World->GetSubsystemChecked<UFlecsNetworkWorldSubsystem>();
 				const FFlecsEntityReplicationSnapshot* Snapshot =
-					NetworkSubsystem->GetReplicationSnapshots().Find(ExpectedNetworkId);
+					NetworkSubsystem->FindReplicationSnapshot(ExpectedNetworkId);
 				return Snapshot
 					&& Snapshot->StateRevision >= ExpectedStateRevision
 					&& UE::Flecs::Tests::MissingNetwork::HasReplicatedValue(State.FlecsWorld, 127);
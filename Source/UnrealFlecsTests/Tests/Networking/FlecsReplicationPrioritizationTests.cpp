@@ -0,0 +1,159 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "UnrealFlecsConfigMacros.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Networking/FlecsReplicatedEntityComponent.h"
+#include "Networking/FlecsReplicationPrioritization.h"
+#include "Networking/Profiles/FlecsReplicationProfile.h"
+#include "Networking/Profiles/FlecsReplicationProfileParamTypes.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsReplicationPrioritizationTests,
+	"UnrealFlecs.Networking.Prioritization",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Networking][Replication]")
+{
+	FFlecsEntityHandle CreatePublishedEntity(const int32 InValue, const FFlecsEntityHandle& InProfile = FFlecsEntityHandle()) const
+	{
+		const FFlecsEntityHandle Entity = CreateReplicatedEntity(InValue);
+
+		if (InProfile.IsValid())
+		{
+			NetworkSubsystem()->SetReplicationProfile(Entity, InProfile);
+		}
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		return Entity;
+	}
+
+	NO_DISCARD bool WasPublished(const FFlecsEntityHandle& InEntity) const
+	{
+		const FFlecsNetworkId NetworkId = InEntity.Get<FFlecsNetworkId>();
+
+		return TestBridge()->GetPublishedSnapshots().ContainsByPredicate(
+			[&NetworkId](const TPair<FFlecsNetworkId, FFlecsEntityReplicationSnapshot>& Published)
+			{
+				return Published.Key == NetworkId;
+			});
+	}
+
+	TEST_METHOD(Prioritization_PublishesHighestScoreFirst_AndDefersTheRest)
+	{
+		FFlecsReplicationProfileDefinition ImportantDefinition;
+		ImportantDefinition.AddParam(FFlecsReplicationProfilePriority(10.f));
+
+		const FFlecsEntityHandle ImportantProfile = NetworkSubsystem()->RegisterReplicationProfileDefinition(
+			FName(TEXT("ImportantProfile")), ImportantDefinition);
+
+		const FFlecsEntityHandle First = CreatePublishedEntity(1);
+		const FFlecsEntityHandle Second = CreatePublishedEntity(2);
+		const FFlecsEntityHandle Important = CreatePublishedEntity(3, ImportantProfile);
+
+		// A budget smaller than any snapshot fits only the first entity of the publish
+		FFlecsReplicationViewer Viewer;
+		Viewer.ByteBudget = 1;
+		NetworkSubsystem()->SetReplicationViewers(MakeArrayView(&Viewer, 1));
+
+		First.Set<FFlecsReplicationTestValue>({ 10 });
+		Second.Set<FFlecsReplicationTestValue>({ 20 });
+		Important.Set<FFlecsReplicationTestValue>({ 30 });
+		TestBridge()->ResetCapturedRecords();
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		ASSERT_THAT(AreEqual(1, TestBridge()->GetPublishedSnapshots().Num()));
+		ASSERT_THAT(IsTrue(WasPublished(Important)));
+		ASSERT_THAT(AreEqual(2, NetworkSubsystem()->GetLastDeferredReplicatedEntityCount()));
+		ASSERT_THAT(AreEqual(2, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+		ASSERT_THAT(AreEqual(1, static_cast<int32>(First.Get<FFlecsReplicatedEntityComponent>().DeferredPublishCount)));
+
+		// Deferred entities keep their dirty bits and go out over the next publishes without new writes
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		ASSERT_THAT(IsTrue(WasPublished(First)));
+		ASSERT_THAT(IsTrue(WasPublished(Second)));
+		ASSERT_THAT(AreEqual(3, TestBridge()->GetPublishedSnapshots().Num()));
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+		ASSERT_THAT(AreEqual(0, static_cast<int32>(First.Get<FFlecsReplicatedEntityComponent>().DeferredPublishCount)));
+	}
+
+	TEST_METHOD(Prioritization_DeferredEntitiesCatchUpWithAnAlwaysDirtyImportantEntity)
+	{
+		static constexpr int32 PublishCount = 12;
+
+		FFlecsReplicationProfileDefinition ImportantDefinition;
+		ImportantDefinition.AddParam(FFlecsReplicationProfilePriority(4.f));
+
+		const FFlecsEntityHandle ImportantProfile = NetworkSubsystem()->RegisterReplicationProfileDefinition(
+			FName(TEXT("ImportantProfile")), ImportantDefinition);
+
+		const FFlecsEntityHandle Cosmetic = CreatePublishedEntity(1);
+		const FFlecsEntityHandle Important = CreatePublishedEntity(2, ImportantProfile);
+
+		FFlecsReplicationViewer Viewer;
+		Viewer.ByteBudget = 1;
+		NetworkSubsystem()->SetReplicationViewers(MakeArrayView(&Viewer, 1));
+
+		Cosmetic.Set<FFlecsReplicationTestValue>({ 10 });
+		TestBridge()->ResetCapturedRecords();
+
+		// The important entity is written every frame, the cosmetic one's score grows with every publish it misses
+		for (int32 Publish = 0; Publish < PublishCount; ++Publish)
+		{
+			Important.Set<FFlecsReplicationTestValue>({ 100 + Publish });
+			NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		}
+
+		ASSERT_THAT(IsTrue(WasPublished(Cosmetic)));
+		ASSERT_THAT(AreEqual(PublishCount, TestBridge()->GetPublishedSnapshots().Num()));
+	}
+
+	TEST_METHOD(Prioritization_CulledEntitiesWaitUntilAViewerIsInRange)
+	{
+		FFlecsReplicationProfileCullDistance CullDistance;
+		CullDistance.CullDistance = 1000.f;
+
+		FFlecsReplicationProfileDefinition CulledDefinition;
+		CulledDefinition.AddParam(CullDistance);
+
+		const FFlecsEntityHandle CulledProfile = NetworkSubsystem()->RegisterReplicationProfileDefinition(
+			FName(TEXT("CulledProfile")), CulledDefinition);
+
+		const FFlecsEntityHandle Culled = CreatePublishedEntity(1, CulledProfile);
+		const FVector EntityLocation(5000.0, 0.0, 0.0);
+
+		NetworkSubsystem()->SetReplicationLocationProvider(
+			[EntityLocation](const FFlecsEntityHandle&, FVector& OutLocation)
+			{
+				OutLocation = EntityLocation;
+				return true;
+			});
+
+		FFlecsReplicationViewer Viewer;
+		Viewer.ByteBudget = 1024;
+		NetworkSubsystem()->SetReplicationViewers(MakeArrayView(&Viewer, 1));
+
+		Culled.Set<FFlecsReplicationTestValue>({ 10 });
+		TestBridge()->ResetCapturedRecords();
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		ASSERT_THAT(AreEqual(0, TestBridge()->GetPublishedSnapshots().Num()));
+		ASSERT_THAT(AreEqual(1, NetworkSubsystem()->GetLastDeferredReplicatedEntityCount()));
+
+		// Culling isn't a missed publish, the score of the entity doesn't grow while it's out of range
+		ASSERT_THAT(AreEqual(0, static_cast<int32>(Culled.Get<FFlecsReplicatedEntityComponent>().DeferredPublishCount)));
+
+		Viewer.ViewLocation = EntityLocation - FVector(500.0, 0.0, 0.0);
+		NetworkSubsystem()->SetReplicationViewers(MakeArrayView(&Viewer, 1));
+
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		ASSERT_THAT(IsTrue(WasPublished(Culled)));
+		ASSERT_THAT(AreEqual(0, NetworkSubsystem()->GetDirtyReplicatedEntityCount()));
+	}
+
+}; // FlecsReplicationPrioritizationTests
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -0,0 +1,255 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "UnrealFlecsConfigMacros.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#include "Networking/Recording/FlecsReplicationRecording.h"
+#include "Networking/Recording/FlecsReplicationRecordingBridge.h"
+#include "Networking/Recording/FlecsReplicationReplayer.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsReplicationRecordingTests,
+	"UnrealFlecs.Networking.Replication.Recording",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Networking][Replication][Recording]")
+{
+	UFlecsReplicationRecordingBridge* InstallRecordingBridge()
+	{
+		UFlecsReplicationRecordingBridge* RecordingBridge = NewObject<UFlecsReplicationRecordingBridge>(NetworkSubsystem());
+		RecordingBridge->SetRecordedBridge(TestBridge());
+		NetworkSubsystem()->SetReplicationBridgeForTesting(RecordingBridge);
+		return RecordingBridge;
+	}
+
+	FFlecsEntityHandle CreatePublishedEntity(const int32 InValue)
+	{
+		const FFlecsEntityHandle Entity = CreateReplicatedEntity(InValue);
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		return Entity;
+	}
+
+	TEST_METHOD(Recording_RoundTripsThroughAFile)
+	{
+		FFlecsReplicationRecording Recording;
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutHandle = FFlecsReplicationLayoutHandle(3);
+		Snapshot.StateRevision = 12;
+
+		FFlecsReplicatedPackedValue& PackedValue = Snapshot.PackedValues.AddDefaulted_GetRef();
+		PackedValue.Revision = 12;
+		PackedValue.Size = 4;
+		Snapshot.PayloadData = { 1, 2, 3, 4 };
+
+		Recording.RecordSnapshot(0.25, FFlecsNetworkId(7, 2), Snapshot);
+		Recording.RecordRemoval(0.5, FFlecsNetworkId(7, 2), 12);
+
+		const FString Filename = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("FlecsReplicationRecordingTest.bin");
+		ASSERT_THAT(IsTrue(Recording.SaveToFile(Filename)));
+
+		FFlecsReplicationRecording LoadedRecording;
+		ASSERT_THAT(IsTrue(LoadedRecording.LoadFromFile(Filename)));
+		IFileManager::Get().Delete(*Filename);
+
+		ASSERT_THAT(AreEqual(2, LoadedRecording.GetRecordCount()));
+		ASSERT_THAT(IsTrue(LoadedRecording.GetData() == Recording.GetData()));
+
+		FFlecsReplicationRecordingReader Reader(LoadedRecording);
+		FFlecsReplicationRecord Record;
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Snapshot));
+		ASSERT_THAT(IsTrue(FMath::IsNearlyEqual(0.25, Record.Time, 1e-6)));
+		ASSERT_THAT(IsTrue(Record.NetworkId == FFlecsNetworkId(7, 2)));
+		ASSERT_THAT(IsTrue(Record.Snapshot.LayoutHandle == FFlecsReplicationLayoutHandle(3)));
+		ASSERT_THAT(AreEqual(12u, Record.Snapshot.StateRevision));
+		ASSERT_THAT(AreEqual(1, Record.Snapshot.PackedValues.Num()));
+		ASSERT_THAT(IsTrue(Record.Snapshot.PayloadData == Snapshot.PayloadData));
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Removal));
+		ASSERT_THAT(AreEqual(12u, Record.RemovalRevision));
+
+		ASSERT_THAT(IsFalse(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsFalse(Reader.HasError()));
+	}
+
+	TEST_METHOD(RecordingBridge_RecordsPublishesAndRemovals_AndForwardsThem)
+	{
+		UFlecsReplicationRecordingBridge* RecordingBridge = InstallRecordingBridge();
+		RecordingBridge->StartRecording();
+
+		const FFlecsEntityHandle Entity = CreatePublishedEntity(5);
+
+		ASSERT_THAT(AreEqual(1, TestBridge()->GetPublishedLayouts().Num()));
+		ASSERT_THAT(AreEqual(1, TestBridge()->GetPublishedSnapshots().Num()));
+
+		NetworkSubsystem()->StopReplicatingEntity(Entity);
+		RecordingBridge->StopRecording();
+
+		// Layout, snapshot and removal
+		const FFlecsReplicationRecording& Recording = RecordingBridge->GetRecording();
+		ASSERT_THAT(AreEqual(3, Recording.GetRecordCount()));
+
+		FFlecsReplicationRecordingReader Reader(Recording);
+		FFlecsReplicationRecord Record;
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Layout));
+		ASSERT_THAT(IsTrue(Record.Layout.LayoutId == TestBridge()->GetPublishedLayouts()[0].LayoutId));
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Snapshot));
+		ASSERT_THAT(IsTrue(Record.NetworkId == TestBridge()->GetPublishedSnapshots()[0].Key));
+
+		const uint32 PublishedRevision = Record.Snapshot.StateRevision;
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Removal));
+		ASSERT_THAT(AreEqual(PublishedRevision, Record.RemovalRevision));
+	}
+
+	TEST_METHOD(Replayer_RecreatesRecordedEntitiesWithoutAConnection)
+	{
+		static constexpr int32 EntityCount = 8;
+
+		UFlecsReplicationRecordingBridge* RecordingBridge = InstallRecordingBridge();
+		RecordingBridge->StartRecording();
+
+		TArray<FFlecsEntityHandle> Entities;
+		TArray<FFlecsNetworkId> NetworkIds;
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			Entities.Add(CreatePublishedEntity(Index * 10));
+			NetworkIds.Add(Entities.Last().Get<FFlecsNetworkId>());
+		}
+
+		RecordingBridge->StopRecording();
+		ASSERT_THAT(AreEqual(EntityCount + 1, RecordingBridge->GetRecording().GetRecordCount()));
+
+		// Not recorded, the replay has to bring the entities back on its own
+		for (const FFlecsEntityHandle& Entity : Entities)
+		{
+			NetworkSubsystem()->StopReplicatingEntity(Entity);
+			Entity.Destroy();
+		}
+
+		FFlecsReplicationReplayer Replayer(RecordingBridge->GetRecording(), NetworkSubsystem());
+		Replayer.SetPlaybackRate(4.0);
+
+		ASSERT_THAT(AreEqual(EntityCount + 1, Replayer.ReplayToEnd()));
+		ASSERT_THAT(IsTrue(Replayer.IsFinished()));
+		ASSERT_THAT(AreEqual(0, Replayer.Advance(1.0)));
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			const TOptional<FFlecsEntityHandle> Replayed = NetworkSubsystem()->GetEntityFromNetworkId(NetworkIds[Index]);
+			ASSERT_THAT(IsTrue(Replayed.IsSet()));
+			if (!Replayed.IsSet())
+			{
+				return;
+			}
+
+			ASSERT_THAT(IsTrue(Replayed->Has<FFlecsReplicationTestValue>()));
+			ASSERT_THAT(AreEqual(Index * 10, Replayed->Get<FFlecsReplicationTestValue>().Value));
+		}
+	}
+
+	TEST_METHOD(RecordingBridge_StartedAfterTheFirstPublish_RecordsKnownLayoutsFirst)
+	{
+		UFlecsReplicationRecordingBridge* RecordingBridge = InstallRecordingBridge();
+
+		// The layout is published before the recording starts and isn't published again
+		const FFlecsEntityHandle Entity = CreatePublishedEntity(5);
+		const FFlecsNetworkId NetworkId = Entity.Get<FFlecsNetworkId>();
+		ASSERT_THAT(AreEqual(1, TestBridge()->GetPublishedLayouts().Num()));
+
+		RecordingBridge->StartRecording();
+
+		Entity.Set<FFlecsReplicationTestValue>({ 6 });
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		RecordingBridge->StopRecording();
+		ASSERT_THAT(AreEqual(1, TestBridge()->GetPublishedLayouts().Num()));
+
+		const FFlecsReplicationRecording& Recording = RecordingBridge->GetRecording();
+		ASSERT_THAT(AreEqual(2, Recording.GetRecordCount()));
+
+		FFlecsReplicationRecordingReader Reader(Recording);
+		FFlecsReplicationRecord Record;
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Layout));
+		ASSERT_THAT(IsTrue(Record.Layout.LayoutId == TestBridge()->GetPublishedLayouts()[0].LayoutId));
+
+		ASSERT_THAT(IsTrue(Reader.ReadNext(Record)));
+		ASSERT_THAT(IsTrue(Record.Type == EFlecsReplicationRecordType::Snapshot));
+
+		NetworkSubsystem()->StopReplicatingEntity(Entity);
+		Entity.Destroy();
+
+		FFlecsReplicationReplayer Replayer(Recording, NetworkSubsystem());
+		ASSERT_THAT(AreEqual(2, Replayer.ReplayToEnd()));
+
+		const TOptional<FFlecsEntityHandle> Replayed = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(Replayed.IsSet()));
+		if (Replayed.IsSet())
+		{
+			ASSERT_THAT(AreEqual(6, Replayed->Get<FFlecsReplicationTestValue>().Value));
+		}
+	}
+
+	TEST_METHOD(Replayer_Advance_FeedsRecordsByScaledPlaybackTime)
+	{
+		const FFlecsEntityHandle Entity = CreatePublishedEntity(5);
+		const FFlecsNetworkId NetworkId = Entity.Get<FFlecsNetworkId>();
+
+		const FFlecsEntityReplicationSnapshot FirstSnapshot = TestBridge()->GetPublishedSnapshots().Last().Value;
+
+		Entity.Set<FFlecsReplicationTestValue>({ 6 });
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+		const FFlecsEntityReplicationSnapshot SecondSnapshot = TestBridge()->GetPublishedSnapshots().Last().Value;
+
+		FFlecsReplicationRecording Recording;
+		Recording.RecordLayout(0.0, TestBridge()->GetPublishedLayouts()[0]);
+		Recording.RecordSnapshot(1.0, NetworkId, FirstSnapshot);
+		Recording.RecordSnapshot(2.0, NetworkId, SecondSnapshot);
+
+		NetworkSubsystem()->StopReplicatingEntity(Entity);
+		Entity.Destroy();
+
+		FFlecsReplicationReplayer Replayer(Recording, NetworkSubsystem());
+		Replayer.SetPlaybackRate(2.0);
+
+		// Twice as fast, a quarter second of playback reaches the record at half a second
+		ASSERT_THAT(AreEqual(1, Replayer.Advance(0.25)));
+		ASSERT_THAT(IsTrue(FMath::IsNearlyEqual(0.5, Replayer.GetPlaybackTime(), 1e-6)));
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->GetEntityFromNetworkId(NetworkId).IsSet()));
+
+		ASSERT_THAT(AreEqual(1, Replayer.Advance(0.25)));
+
+		const TOptional<FFlecsEntityHandle> Replayed = NetworkSubsystem()->GetEntityFromNetworkId(NetworkId);
+		ASSERT_THAT(IsTrue(Replayed.IsSet()));
+		if (!Replayed.IsSet())
+		{
+			return;
+		}
+
+		ASSERT_THAT(AreEqual(5, Replayed->Get<FFlecsReplicationTestValue>().Value));
+
+		ASSERT_THAT(AreEqual(0, Replayer.Advance(0.25)));
+		ASSERT_THAT(AreEqual(1, Replayer.Advance(0.25)));
+		ASSERT_THAT(AreEqual(6, Replayed->Get<FFlecsReplicationTestValue>().Value));
+		ASSERT_THAT(AreEqual(3, Replayer.GetReplayedRecordCount()));
+
+		ASSERT_THAT(AreEqual(0, Replayer.Advance(1.0)));
+		ASSERT_THAT(IsTrue(Replayer.IsFinished()));
+	}
+
+}; // FlecsReplicationRecordingTests
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -0,0 +1,204 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "UnrealFlecsConfigMacros.h"
+#include "UnrealFlecsTests/Fixtures/FlecsReplicationFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Networking/FlecsComponentReplicationDescriptor.h"
+#include "Networking/FlecsReplicatedEntityComponent.h"
+#include "Networking/Stats/FlecsReplicationStatsCollector.h"
+#include "Networking/Stats/FlecsReplicationStatsComponents.h"
+
+FLECS_REPLICATION_TEST_CLASS_WITH_FLAGS_AND_TAGS(FlecsReplicationStatsTests,
+	"UnrealFlecs.Networking.Replication.Stats",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Networking][Replication][Stats]")
+{
+	TEST_METHOD(ReplicationStats_AreOnlyCollectedWhileEnabled)
+	{
+		ASSERT_THAT(IsFalse(NetworkSubsystem()->IsReplicationStatsEnabled()));
+		ASSERT_THAT(IsNull(NetworkSubsystem()->GetReplicationStats()));
+
+		NetworkSubsystem()->SetReplicationStatsEnabled(true);
+		ASSERT_THAT(IsNotNull(NetworkSubsystem()->GetReplicationStats()));
+
+		NetworkSubsystem()->SetReplicationStatsEnabled(false);
+		ASSERT_THAT(IsNull(NetworkSubsystem()->GetReplicationStats()));
+
+		// The stats entity and its metrics stay in the world, enabling the stats again reuses them
+		NetworkSubsystem()->SetReplicationStatsEnabled(true);
+		ASSERT_THAT(IsNotNull(NetworkSubsystem()->GetReplicationStats()));
+		ASSERT_THAT(IsTrue(NetworkSubsystem()->GetReplicationStats()->GetStatsEntity().IsAlive()));
+	}
+
+	TEST_METHOD(ReplicationStats_CountPublishedEntities_PerComponentAndLayout)
+	{
+		static constexpr int32 EntityCount = 8;
+
+		NetworkSubsystem()->SetReplicationStatsEnabled(true);
+		const FFlecsReplicationStatsCollector* ReplicationStats = NetworkSubsystem()->GetReplicationStats();
+		ASSERT_THAT(IsNotNull(ReplicationStats));
+		if (!ReplicationStats)
+		{
+			return;
+		}
+
+		TArray<FFlecsEntityHandle> Entities;
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			Entities.Add(World()->CreateEntity()
+				.Set<FFlecsReplicationTestValue>({ Index })
+				.Add<FFlecsReplicationTestTag>()
+				.Add<FFlecsReplicatedEntityComponent>());
+		}
+
+		ASSERT_THAT(AreEqual(EntityCount, NetworkSubsystem()->BeginReplicatingEntities(Entities)));
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		const FFlecsReplicationStats& Stats = ReplicationStats->GetStatsEntity().Get<FFlecsReplicationStats>();
+		ASSERT_THAT(AreEqual(EntityCount, Stats.PublishedEntityCount));
+		ASSERT_THAT(IsTrue(Stats.SerializedBytes > 0));
+		ASSERT_THAT(IsTrue(Stats.SnapshotBuildMilliseconds >= 0.0));
+
+		// Every entity has the same layout
+		const FFlecsReplicationLayoutId LayoutId = Entities[0].Get<FFlecsReplicatedEntityComponent>().LayoutId;
+		const FFlecsEntityHandle LayoutStatsEntity = ReplicationStats->FindLayoutStatsEntity(LayoutId);
+		ASSERT_THAT(IsTrue(LayoutStatsEntity.IsValid()));
+
+		const FFlecsReplicationLayoutStats& LayoutStats = LayoutStatsEntity.Get<FFlecsReplicationLayoutStats>();
+		ASSERT_THAT(AreEqual(EntityCount, LayoutStats.DirtiedEntityCount));
+		ASSERT_THAT(AreEqual(Stats.SerializedBytes, LayoutStats.SerializedBytes));
+
+		const FFlecsComponentReplicationDescriptor* Descriptor = FFlecsComponentReplicationRegistry::Get(World())
+			.Find(World()->GetScriptStructEntity<FFlecsReplicationTestValue>().GetFlecsId());
+		ASSERT_THAT(IsNotNull(Descriptor));
+		if (!Descriptor)
+		{
+			return;
+		}
+
+		const FFlecsEntityHandle ComponentStatsEntity = ReplicationStats->FindComponentStatsEntity(Descriptor->GetStableName());
+		ASSERT_THAT(IsTrue(ComponentStatsEntity.IsValid()));
+
+		const FFlecsReplicationComponentStats& ComponentStats = ComponentStatsEntity.Get<FFlecsReplicationComponentStats>();
+		ASSERT_THAT(AreEqual(EntityCount, ComponentStats.SerializedValueCount));
+		ASSERT_THAT(IsTrue(ComponentStats.SerializedBytes > 0));
+
+		// A pass without dirty entities resets the per-pass counters but keeps the totals
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		ASSERT_THAT(AreEqual(0, ReplicationStats->GetStatsEntity().Get<FFlecsReplicationStats>().PublishedEntityCount));
+		ASSERT_THAT(AreEqual(0, LayoutStatsEntity.Get<FFlecsReplicationLayoutStats>().DirtiedEntityCount));
+		ASSERT_THAT(AreEqual(static_cast<int64>(EntityCount), LayoutStatsEntity.Get<FFlecsReplicationLayoutStats>().TotalDirtiedEntityCount));
+		ASSERT_THAT(AreEqual(0, ComponentStatsEntity.Get<FFlecsReplicationComponentStats>().SerializedValueCount));
+		ASSERT_THAT(IsTrue(ComponentStatsEntity.Get<FFlecsReplicationComponentStats>().TotalSerializedBytes > 0));
+
+#ifdef FLECS_METRICS
+
+		ASSERT_THAT(IsTrue(World()->LookupEntity(
+			TEXT("FlecsReplicationStats::Metrics::FlecsReplicationStats::PublishedEntityCount")).IsValid()));
+
+#endif // FLECS_METRICS
+	}
+
+	TEST_METHOD(ReplicationStats_CountOnlyDirtyValues_OfAPartialPublish)
+	{
+		NetworkSubsystem()->SetReplicationStatsEnabled(true);
+		const FFlecsReplicationStatsCollector* ReplicationStats = NetworkSubsystem()->GetReplicationStats();
+		ASSERT_THAT(IsNotNull(ReplicationStats));
+		if (!ReplicationStats)
+		{
+			return;
+		}
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 1 })
+			.Set<FFlecsReplicationTestDontFragmentValue>({ 2 })
+			.Add<FFlecsReplicatedEntityComponent>();
+
+		NetworkSubsystem()->BeginReplicatingEntity(Entity);
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		const FFlecsComponentReplicationRegistry& ComponentRegistry = FFlecsComponentReplicationRegistry::Get(World());
+		const FFlecsComponentReplicationDescriptor* ValueDescriptor = ComponentRegistry
+			.Find(World()->GetScriptStructEntity<FFlecsReplicationTestValue>().GetFlecsId());
+		const FFlecsComponentReplicationDescriptor* CleanDescriptor = ComponentRegistry
+			.Find(World()->GetScriptStructEntity<FFlecsReplicationTestDontFragmentValue>().GetFlecsId());
+		ASSERT_THAT(IsNotNull(ValueDescriptor));
+		ASSERT_THAT(IsNotNull(CleanDescriptor));
+		if (!ValueDescriptor || !CleanDescriptor)
+		{
+			return;
+		}
+
+		const FFlecsEntityHandle ValueStatsEntity = ReplicationStats->FindComponentStatsEntity(ValueDescriptor->GetStableName());
+		const FFlecsEntityHandle CleanStatsEntity = ReplicationStats->FindComponentStatsEntity(CleanDescriptor->GetStableName());
+		ASSERT_THAT(IsTrue(ValueStatsEntity.IsValid()));
+		ASSERT_THAT(IsTrue(CleanStatsEntity.IsValid()));
+
+		const int64 CleanTotalBytes = CleanStatsEntity.Get<FFlecsReplicationComponentStats>().TotalSerializedBytes;
+		ASSERT_THAT(IsTrue(CleanTotalBytes > 0));
+
+		// Only one component is written, the other value is carried over by the snapshot without being serialized
+		Entity.Set<FFlecsReplicationTestValue>({ 3 });
+		NetworkSubsystem()->PublishDirtyReplicatedEntities();
+
+		const FFlecsReplicationComponentStats& ValueStats = ValueStatsEntity.Get<FFlecsReplicationComponentStats>();
+		ASSERT_THAT(AreEqual(1, ValueStats.SerializedValueCount));
+		ASSERT_THAT(IsTrue(ValueStats.SerializedBytes > 0));
+
+		const FFlecsReplicationComponentStats& CleanStats = CleanStatsEntity.Get<FFlecsReplicationComponentStats>();
+		ASSERT_THAT(AreEqual(0, CleanStats.SerializedValueCount));
+		ASSERT_THAT(AreEqual(static_cast<int64>(0), CleanStats.SerializedBytes));
+		ASSERT_THAT(AreEqual(CleanTotalBytes, CleanStats.TotalSerializedBytes));
+
+		// The layout and pass totals only hold the dirty value too
+		const FFlecsEntityHandle LayoutStatsEntity = ReplicationStats->FindLayoutStatsEntity(
+			Entity.Get<FFlecsReplicatedEntityComponent>().LayoutId);
+		ASSERT_THAT(IsTrue(LayoutStatsEntity.IsValid()));
+
+		const FFlecsReplicationStats& Stats = ReplicationStats->GetStatsEntity().Get<FFlecsReplicationStats>();
+		ASSERT_THAT(AreEqual(ValueStats.SerializedBytes, LayoutStatsEntity.Get<FFlecsReplicationLayoutStats>().SerializedBytes));
+		ASSERT_THAT(AreEqual(ValueStats.SerializedBytes, Stats.SerializedBytes));
+	}
+
+	TEST_METHOD(ReplicationStats_CountAppliedUpdates)
+	{
+		static constexpr int32 EntityCount = 4;
+
+		NetworkSubsystem()->SetReplicationStatsEnabled(true);
+
+		const FFlecsEntityHandle SourceEntity = World()->CreateEntity()
+			.Set<FFlecsReplicationTestValue>({ 7 });
+
+		bool bCreatedNewLayout = false;
+		const TValueOrError<const FFlecsReplicationLayoutDefinition*, FString> LayoutResult =
+			NetworkSubsystem()->GetLayoutRegistry().BuildForEntity(World(), SourceEntity, bCreatedNewLayout);
+
+		ASSERT_THAT(IsFalse(LayoutResult.HasError()));
+		if (LayoutResult.HasError())
+		{
+			return;
+		}
+
+		FFlecsEntityReplicationSnapshot Snapshot;
+		Snapshot.LayoutId = LayoutResult.GetValue()->LayoutId;
+		Snapshot.FillFromEntity(SourceEntity, NetworkSubsystem()->GetLayoutRegistry());
+
+		for (int32 Index = 0; Index < EntityCount; ++Index)
+		{
+			NetworkSubsystem()->QueueReplicationSnapshot(FFlecsNetworkId(200 + Index, 1), Snapshot);
+		}
+
+		NetworkSubsystem()->ApplyQueuedReplicationUpdates(World());
+
+		const FFlecsReplicationStats& Stats = NetworkSubsystem()->GetReplicationStats()->GetStats();
+		ASSERT_THAT(AreEqual(EntityCount, Stats.QueuedUpdateCount));
+		ASSERT_THAT(AreEqual(EntityCount, Stats.AppliedUpdateCount));
+		ASSERT_THAT(IsTrue(Stats.ApplyMilliseconds >= 0.0));
+	}
+
+}; // FlecsReplicationStatsTests
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -0,0 +1,206 @@
+// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Components/FlecsDoubleBufferedTrait.h"
+#include "Components/FlecsPreviousFrame.h"
+#include "Systems/FlecsPhasesType.h"
+#include "Systems/FlecsSystemHandle.h"
+#include "Worlds/FlecsWorld.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+namespace UE::Flecs::Test::DoubleBuffer
+{
+	/** Returns the dot graph of the pipeline that contains the system */
+	NO_DISCARD FString FindScheduleDot(const UFlecsWorld* InWorld, const FString& InSystemName)
+	{
+		FString Result;
+		InWorld->GetNativeFlecsWorld().each(flecs::Pipeline, [InWorld, &InSystemName, &Result](const flecs::entity InPipeline)
+		{
+			const FString Dot = InWorld->GetPipelineScheduleDot(InPipeline.id());
+			if (Dot.Contains(InSystemName))
+			{
+				Result = Dot;
+			}
+		});
+		return Result;
+	}
+
+	/** Returns the index of the sync point (cluster_<index>) whose subgraph holds the system, INDEX_NONE if none does */
+	NO_DISCARD int32 FindSyncPoint(const FString& InDot, const FString& InSystemName)
+	{
+		TArray<FString> Lines;
+		InDot.ParseIntoArrayLines(Lines);
+
+		int32 SyncPoint = INDEX_NONE;
+		for (const FString& Line : Lines)
+		{
+			FString ClusterIndex;
+			if (Line.Split(TEXT("subgraph cluster_"), nullptr, &ClusterIndex))
+			{
+				SyncPoint = FCString::Atoi(*ClusterIndex);
+			}
+			else if (Line.Contains(TEXT("[label="")) && Line.Contains(InSystemName))
+			{
+				return SyncPoint;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+
+	/** Returns the node id (s<index>) of a system in a dot graph */
+	NO_DISCARD FString FindNodeId(const FString& InDot, const FString& InSystemName)
+	{
+		TArray<FString> Lines;
+		InDot.ParseIntoArrayLines(Lines);
+
+		for (const FString& Line : Lines)
+		{
+			FString NodeId;
+			if (Line.Contains(TEXT("[label="")) && Line.Contains(InSystemName)
+				&& Line.TrimStart().Split(TEXT(" "), &NodeId, nullptr))
+			{
+				return NodeId;
+			}
+		}
+
+		return FString();
+	}
+
+} // namespace UE::Flecs::Test::DoubleBuffer
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsDoubleBufferTests,
+	"UnrealFlecs.Pipelines.DoubleBuffer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Pipelines][Systems]")
+{
+	virtual void OnWorldSetUp() override
+	{
+		World()->RegisterComponentType<FFlecsTestStruct_Value>()
+			.Add<FFlecsDoubleBufferedTrait>();
+	}
+
+	TEST_METHOD(DoubleBufferedComponent_HasCommitSystem)
+	{
+		const FFlecsId Component = World()->GetScriptStructEntity<FFlecsTestStruct_Value>();
+		const FFlecsEntityHandle CommitSystem = World()->LookupEntity(
+			FString::Printf(TEXT("DoubleBufferCommit_%llu"), Component.GetId()));
+		ASSERT_THAT(IsTrue(CommitSystem.IsValid()));
+
+		const ecs_system_t* CommitSystemData = ecs_system_get(World()->GetNativeFlecsWorld(), CommitSystem.GetFlecsId());
+		ASSERT_THAT(IsNotNull(CommitSystemData));
+		ASSERT_THAT(IsTrue(CommitSystemData->schedule_by_access));
+	}
+
+	TEST_METHOD(PreviousFrame_LagsLiveValue_ByOneFrame)
+	{
+		World()->CreateSystem<>(TEXT("DoubleBufferWriter"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<FFlecsTestStruct_Value&>()
+			.run([](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						++InIterator.field_at<FFlecsTestStruct_Value>(0, Index).Value;
+					}
+				}
+			});
+
+		TArray<int32> ReadValues;
+
+		World()->CreateSystem<>(TEXT("DoubleBufferReader"))
+			.Phase(EFlecsPhaseType::OnStore)
+			.ScheduleByAccess()
+			.WithPair<FFlecsPreviousFrame, FFlecsTestStruct_Value>().In()
+			.run([&ReadValues](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						ReadValues.Add(InIterator.field_at<const FFlecsTestStruct_Value>(0, Index).Value);
+					}
+				}
+			});
+
+		FFlecsTestStruct_Value InitialValue;
+		InitialValue.Value = 0;
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity()
+			.Set<FFlecsTestStruct_Value>(InitialValue);
+
+		// Nothing has been committed before the first frame ends
+		TickWorld();
+		ASSERT_THAT(AreEqual(0, ReadValues.Num()));
+		ASSERT_THAT(AreEqual(1, Entity.Get<FFlecsTestStruct_Value>().Value));
+		ASSERT_THAT(AreEqual(1, (Entity.GetPairSecond<FFlecsPreviousFrame, FFlecsTestStruct_Value>().Value)));
+
+		TickWorld();
+		ASSERT_THAT(AreEqual(1, ReadValues.Num()));
+		ASSERT_THAT(AreEqual(1, ReadValues[0]));
+		ASSERT_THAT(AreEqual(2, Entity.Get<FFlecsTestStruct_Value>().Value));
+		ASSERT_THAT(AreEqual(2, (Entity.GetPairSecond<FFlecsPreviousFrame, FFlecsTestStruct_Value>().Value)));
+
+		TickWorld();
+		ASSERT_THAT(AreEqual(2, ReadValues.Num()));
+		ASSERT_THAT(AreEqual(2, ReadValues[1]));
+	}
+
+	TEST_METHOD(PreviousFrameReader_SharesSyncPointWithLiveWriter)
+	{
+		using namespace UE::Flecs::Test::DoubleBuffer;
+
+		const auto EmptyRun = [](flecs::iter& InIterator)
+		{
+			while (InIterator.next())
+			{
+			}
+		};
+
+		World()->CreateSystem<>(TEXT("DoubleBufferLiveWriter"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<FFlecsTestStruct_Value&>()
+			.run(EmptyRun);
+		World()->CreateSystem<>(TEXT("DoubleBufferPreviousReader"))
+			.Phase(EFlecsPhaseType::OnStore)
+			.ScheduleByAccess()
+			.WithPair<FFlecsPreviousFrame, FFlecsTestStruct_Value>().In()
+			.run(EmptyRun);
+		World()->CreateSystem<>(TEXT("DoubleBufferLiveReader"))
+			.Phase(EFlecsPhaseType::OnStore)
+			.ScheduleByAccess()
+			.With<const FFlecsTestStruct_Value>()
+			.run(EmptyRun);
+
+		World()->CreateEntity()
+			.Set<FFlecsTestStruct_Value>(FFlecsTestStruct_Value());
+
+		TickWorld();
+
+		const FString Dot = FindScheduleDot(World(), TEXT("DoubleBufferLiveWriter"));
+		ASSERT_THAT(IsFalse(Dot.IsEmpty()));
+
+		const int32 WriterSyncPoint = FindSyncPoint(Dot, TEXT("DoubleBufferLiveWriter"));
+		ASSERT_THAT(IsTrue(WriterSyncPoint != INDEX_NONE));
+		ASSERT_THAT(AreEqual(WriterSyncPoint, FindSyncPoint(Dot, TEXT("DoubleBufferPreviousReader"))));
+
+		const FString WriterNode = FindNodeId(Dot, TEXT("DoubleBufferLiveWriter"));
+
+		// The committed copy doesn't conflict with the live column, a reader of the live column waits for the writer
+		ASSERT_THAT(IsFalse(Dot.Contains(FString::Printf(TEXT("%s -> %s;"),
+			*WriterNode, *FindNodeId(Dot, TEXT("DoubleBufferPreviousReader"))))));
+		ASSERT_THAT(IsTrue(Dot.Contains(FString::Printf(TEXT("%s -> %s;"),
+			*WriterNode, *FindNodeId(Dot, TEXT("DoubleBufferLiveReader"))))));
+	}
+
+}; // UnrealFlecsDoubleBufferTests
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
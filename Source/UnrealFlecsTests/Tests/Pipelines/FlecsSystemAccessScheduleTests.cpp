@@ -0,0 +1,198 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include "Systems/FlecsPhasesType.h"
+#include "Systems/FlecsSystemHandle.h"
+#include "Worlds/FlecsWorld.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+namespace UE::Flecs::Test::AccessSchedule
+{
+	/** Returns the dot graph of the pipeline that contains the system */
+	NO_DISCARD FString FindScheduleDot(const UFlecsWorld* InWorld, const FString& InSystemName)
+	{
+		FString Result;
+		InWorld->GetNativeFlecsWorld().each(flecs::Pipeline, [InWorld, &InSystemName, &Result](const flecs::entity InPipeline)
+		{
+			const FString Dot = InWorld->GetPipelineScheduleDot(InPipeline.id());
+			if (Dot.Contains(InSystemName))
+			{
+				Result = Dot;
+			}
+		});
+		return Result;
+	}
+
+	/** Returns the node id (s<index>) of a system in a dot graph */
+	NO_DISCARD FString FindNodeId(const FString& InDot, const FString& InSystemName)
+	{
+		TArray<FString> Lines;
+		InDot.ParseIntoArrayLines(Lines);
+
+		for (const FString& Line : Lines)
+		{
+			FString NodeId;
+			if (Line.Contains(TEXT("[label=\"")) && Line.Contains(InSystemName)
+				&& Line.TrimStart().Split(TEXT(" "), &NodeId, nullptr))
+			{
+				return NodeId;
+			}
+		}
+
+		return FString();
+	}
+
+	NO_DISCARD bool HasEdge(const FString& InDot, const FString& InFrom, const FString& InTo)
+	{
+		return InDot.Contains(FString::Printf(TEXT("%s -> %s;"),
+			*FindNodeId(InDot, InFrom), *FindNodeId(InDot, InTo)));
+	}
+
+} // namespace UE::Flecs::Test::AccessSchedule
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsSystemAccessScheduleTests,
+	"UnrealFlecs.Pipelines.AccessSchedule",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Pipelines][Systems]")
+{
+	virtual void OnWorldSetUp() override
+	{
+		World()->RegisterComponentType<FFlecsTestStruct_Value>();
+		World()->RegisterComponentType<FFlecsTest_CPPStructValue>();
+	}
+
+	TEST_METHOD(ConflictingSystems_AreOrdered_OthersAreNot)
+	{
+		using namespace UE::Flecs::Test::AccessSchedule;
+
+		TArray<FString> RunOrder;
+		const auto RecordRun = [&RunOrder](const FString& InName)
+		{
+			return [&RunOrder, InName](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+				}
+				RunOrder.Add(InName);
+			};
+		};
+
+		World()->CreateSystem<>(TEXT("AccessWriter"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<FFlecsTestStruct_Value&>()
+			.run(RecordRun(TEXT("AccessWriter")));
+		World()->CreateSystem<>(TEXT("AccessUnrelated"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<FFlecsTest_CPPStructValue&>()
+			.run(RecordRun(TEXT("AccessUnrelated")));
+		World()->CreateSystem<>(TEXT("AccessReader"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<const FFlecsTestStruct_Value>()
+			.run(RecordRun(TEXT("AccessReader")));
+		World()->CreateSystem<>(TEXT("AccessOtherReader"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<const FFlecsTestStruct_Value>()
+			.run(RecordRun(TEXT("AccessOtherReader")));
+
+		World()->CreateEntity()
+			.Set<FFlecsTestStruct_Value>(FFlecsTestStruct_Value())
+			.Set<FFlecsTest_CPPStructValue>(FFlecsTest_CPPStructValue());
+
+		TickWorld();
+
+		ASSERT_THAT(AreEqual(4, RunOrder.Num()));
+		ASSERT_THAT(IsTrue(RunOrder.IndexOfByKey(TEXT("AccessWriter")) < RunOrder.IndexOfByKey(TEXT("AccessReader"))));
+		ASSERT_THAT(IsTrue(RunOrder.IndexOfByKey(TEXT("AccessWriter")) < RunOrder.IndexOfByKey(TEXT("AccessOtherReader"))));
+
+		const FString Dot = FindScheduleDot(World(), TEXT("AccessWriter"));
+		ASSERT_THAT(IsFalse(Dot.IsEmpty()));
+		ASSERT_THAT(IsTrue(Dot.Contains(TEXT("by access"))));
+
+		ASSERT_THAT(IsTrue(HasEdge(Dot, TEXT("AccessWriter"), TEXT("AccessReader"))));
+		ASSERT_THAT(IsTrue(HasEdge(Dot, TEXT("AccessWriter"), TEXT("AccessOtherReader"))));
+
+		ASSERT_THAT(IsFalse(HasEdge(Dot, TEXT("AccessWriter"), TEXT("AccessUnrelated"))));
+		ASSERT_THAT(IsFalse(HasEdge(Dot, TEXT("AccessUnrelated"), TEXT("AccessReader"))));
+		ASSERT_THAT(IsFalse(HasEdge(Dot, TEXT("AccessReader"), TEXT("AccessOtherReader"))));
+	}
+
+	TEST_METHOD(SystemWithoutTerms_ConflictsWithEverySystem)
+	{
+		using namespace UE::Flecs::Test::AccessSchedule;
+
+		const auto EmptyRun = [](flecs::iter& InIterator)
+		{
+			while (InIterator.next())
+			{
+			}
+		};
+
+		World()->CreateSystem<>(TEXT("TermlessWriter"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<FFlecsTestStruct_Value&>()
+			.run(EmptyRun);
+		World()->CreateSystem<>(TEXT("TermlessRunOnly"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.run(EmptyRun);
+		World()->CreateSystem<>(TEXT("TermlessReader"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.ScheduleByAccess()
+			.With<const FFlecsTest_CPPStructValue>()
+			.run(EmptyRun);
+
+		TickWorld();
+
+		const FString Dot = FindScheduleDot(World(), TEXT("TermlessRunOnly"));
+		ASSERT_THAT(IsFalse(Dot.IsEmpty()));
+
+		// The run callback may touch anything, so it waits for the writer and is waited for by the reader
+		ASSERT_THAT(IsTrue(HasEdge(Dot, TEXT("TermlessWriter"), TEXT("TermlessRunOnly"))));
+		ASSERT_THAT(IsTrue(HasEdge(Dot, TEXT("TermlessRunOnly"), TEXT("TermlessReader"))));
+		ASSERT_THAT(IsFalse(HasEdge(Dot, TEXT("TermlessWriter"), TEXT("TermlessReader"))));
+	}
+
+	TEST_METHOD(SystemDefinition_ScheduleByAccess_IsAppliedToSystem)
+	{
+		FFlecsSystemDefinition Definition;
+		Definition.bScheduleByAccess = true;
+
+		const FFlecsSystemHandle ScheduledSystem = World()->CreateSystemWithDefinition(Definition, TEXT("ScheduledSystem"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.run([](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+				}
+			});
+
+		const FFlecsSystemHandle OrderedSystem = World()->CreateSystem<>(TEXT("OrderedSystem"))
+			.Phase(EFlecsPhaseType::OnUpdate)
+			.run([](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+				}
+			});
+
+		const ecs_system_t* ScheduledSystemData = ecs_system_get(World()->GetNativeFlecsWorld(), ScheduledSystem.GetSystem().id());
+		const ecs_system_t* OrderedSystemData = ecs_system_get(World()->GetNativeFlecsWorld(), OrderedSystem.GetSystem().id());
+
+		ASSERT_THAT(IsNotNull(ScheduledSystemData));
+		ASSERT_THAT(IsNotNull(OrderedSystemData));
+		ASSERT_THAT(IsTrue(ScheduledSystemData->schedule_by_access));
+		ASSERT_THAT(IsFalse(OrderedSystemData->schedule_by_access));
+	}
+
+}; // UnrealFlecsSystemAccessScheduleTests
+
+#endif // WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
@@ -0,0 +1,294 @@
+﻿// Elie Wiese-Namir © 2026. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UnrealFlecsTests/Fixtures/FlecsWorldFixture.h"
+
+#if WITH_AUTOMATION_TESTS && ENABLE_UNREAL_FLECS_TESTS
+
+#include <atomic>
+
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Tasks/Task.h"
+
+#include "Pipelines/FlecsTickTypeNativeTags.h"
+#include "Pipelines/TickFunctions/FlecsTickFunction.h"
+#include "Worlds/FlecsWorld.h"
+#include "Worlds/FlecsWorldAccessLock.h"
+#include "Worlds/Settings/FlecsWorldInfoSettings.h"
+#include "UnrealFlecsTests/Tests/FlecsTestTypes.h"
+
+FLECS_TEST_CLASS_WITH_FLAGS_AND_TAGS(UnrealFlecsTickFunctionThreadingTests,
+	"UnrealFlecs.Pipelines.TickFunctionThreading",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter,
+	"[Flecs][Pipelines][Threading]")
+{
+	static constexpr int32 IterationCount = 64;
+
+	std::atomic<int32> InFlightCount = 0;
+	std::atomic<int32> MaxInFlightCount = 0;
+
+	/** Deliberately not atomic, overlapping accessors would lose increments */
+	int32 SharedCounter = 0;
+
+	static constexpr double RendezvousTimeoutSeconds = 5.0;
+
+protected:
+	virtual EWorldType::Type WorldType() const override
+	{
+		return EWorldType::Game;
+	}
+
+	virtual void OnWorldSetUp() override
+	{
+		World()->RegisterComponentType<FFlecsTestStruct_Value>();
+	}
+
+	/** Spins until the flag is raised by another thread, false if it wasn't raised in time */
+	static bool WaitForFlag(const std::atomic<bool>& InFlag)
+	{
+		const double TimeoutTime = FPlatformTime::Seconds() + RendezvousTimeoutSeconds;
+		
+		while (!InFlag.load())
+		{
+			if (FPlatformTime::Seconds() > TimeoutTime)
+			{
+				return false;
+			}
+			
+			FPlatformProcess::Yield();
+		}
+
+		return true;
+	}
+
+	/** Read-modify-write of the shared counter with a window wide enough for an overlapping accessor to clobber it */
+	void IncrementSharedCounter()
+	{
+		const int32 InFlight = ++InFlightCount;
+
+		int32 PreviousMax = MaxInFlightCount.load();
+		while (PreviousMax < InFlight && !MaxInFlightCount.compare_exchange_weak(PreviousMax, InFlight))
+		{
+		}
+
+		const int32 Value = SharedCounter;
+		FPlatformProcess::SleepNoStats(0.0002f);
+		SharedCounter = Value + 1;
+
+		--InFlightCount;
+	}
+
+	void CreateCountingSystem(const FGameplayTag& InTickType)
+	{
+		World()->GetNativeFlecsWorld().system<>()
+			.kind(flecs::OnUpdate)
+			.run([this](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+				}
+
+				IncrementSharedCounter();
+			})
+			.add(World()->GetTagEntity(InTickType).GetFlecsId());
+	}
+
+	/** Progresses the game loops of a tick type from a task thread, the way an any-thread tick function does */
+	UE::Tasks::FTask LaunchProgressTask(const FGameplayTag& InTickType,
+		const EFlecsTickFunctionWorldAccess InAccess = EFlecsTickFunctionWorldAccess::ReadWrite,
+		const int32 InIterationCount = IterationCount)
+	{
+		return UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, InTickType, InAccess, InIterationCount]()
+		{
+			for (int32 Iteration = 0; Iteration < InIterationCount; ++Iteration)
+			{
+				World()->ProgressGameLoops(InTickType, 0.0, InAccess);
+			}
+		});
+	}
+
+public:
+	TEST_METHOD(CreateTickFunctionInstance_CopiesThreadingSettings)
+	{
+		FFlecsTickFunctionSettingsInfo Settings
+			= FFlecsTickFunctionSettingsInfo::GetTickFunctionSettingsDefault(FlecsTickType_DuringPhysics);
+		Settings.bRunOnAnyThread = true;
+		Settings.WorldAccess = EFlecsTickFunctionWorldAccess::ReadOnly;
+
+		const TSharedStruct<FFlecsTickFunction> TickFunction = FFlecsTickFunctionSettingsInfo::CreateTickFunctionInstance(Settings);
+
+		ASSERT_THAT(IsTrue(TickFunction.Get().bRunOnAnyThread));
+		ASSERT_THAT(IsTrue(TickFunction.Get().WorldAccess == EFlecsTickFunctionWorldAccess::ReadOnly));
+	}
+
+	TEST_METHOD(ProgressGameLoops_ReadWriteFromTwoThreads_NeverOverlaps)
+	{
+		CreateCountingSystem(FlecsTickType_PrePhysics);
+		CreateCountingSystem(FlecsTickType_DuringPhysics);
+
+		const UE::Tasks::FTask PrePhysicsTask = LaunchProgressTask(FlecsTickType_PrePhysics);
+
+		for (int32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+		{
+			World()->ProgressGameLoops(FlecsTickType_DuringPhysics);
+		}
+
+		PrePhysicsTask.Wait();
+
+		ASSERT_THAT(AreEqual(1, MaxInFlightCount.load()));
+		ASSERT_THAT(AreEqual(IterationCount * 2, SharedCounter));
+	}
+
+	TEST_METHOD(GameThreadReaders_NeverOverlapReadWriteAnyThreadPipelines)
+	{
+		CreateCountingSystem(FlecsTickType_DuringPhysics);
+
+		const UE::Tasks::FTask DuringPhysicsTask = LaunchProgressTask(FlecsTickType_DuringPhysics);
+
+		for (int32 Iteration = 0; Iteration < IterationCount; ++Iteration)
+		{
+			const FFlecsWorldAccessScope AccessScope(World()->GetWorldAccessLock(), EFlecsTickFunctionWorldAccess::ReadOnly);
+			IncrementSharedCounter();
+		}
+
+		DuringPhysicsTask.Wait();
+
+		ASSERT_THAT(AreEqual(1, MaxInFlightCount.load()));
+		ASSERT_THAT(AreEqual(IterationCount * 2, SharedCounter));
+	}
+
+	TEST_METHOD(ReadOnlyAnyThreadPipeline_RunsWhileGameThreadReads)
+	{
+		FFlecsTestStruct_Value InitialValue;
+		InitialValue.Value = 42;
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity()
+			.Set<FFlecsTestStruct_Value>(InitialValue);
+
+		std::atomic<bool> bSystemRunning = false;
+		std::atomic<bool> bGameThreadReading = false;
+		std::atomic<bool> bSystemSawGameThreadReader = false;
+		std::atomic<int32> SystemReadValue = 0;
+
+		World()->GetNativeFlecsWorld().system<const FFlecsTestStruct_Value>()
+			.kind(flecs::OnUpdate)
+			.run([&](flecs::iter& InIterator)
+			{
+				bSystemRunning = true;
+				bSystemSawGameThreadReader = WaitForFlag(bGameThreadReading);
+				
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						SystemReadValue = InIterator.field_at<const FFlecsTestStruct_Value>(0, Index).Value;
+					}
+				}
+			})
+			.add(World()->GetTagEntity(FlecsTickType_DuringPhysics).GetFlecsId());
+
+		const UE::Tasks::FTask DuringPhysicsTask
+			= LaunchProgressTask(FlecsTickType_DuringPhysics, EFlecsTickFunctionWorldAccess::ReadOnly, 1);
+
+		bool bGameThreadSawSystem = false;
+		int32 GameThreadReadValue = 0;
+		
+		{
+			// Exclusive access would keep the pipeline and this scope apart, and both would time out
+			const FFlecsWorldAccessScope AccessScope(World()->GetWorldAccessLock(), EFlecsTickFunctionWorldAccess::ReadOnly);
+			bGameThreadReading = true;
+			bGameThreadSawSystem = WaitForFlag(bSystemRunning);
+			GameThreadReadValue = Entity.Get<FFlecsTestStruct_Value>().Value;
+		}
+
+		DuringPhysicsTask.Wait();
+
+		ASSERT_THAT(IsTrue(bGameThreadSawSystem));
+		ASSERT_THAT(IsTrue(bSystemSawGameThreadReader.load()));
+		ASSERT_THAT(AreEqual(42, GameThreadReadValue));
+		ASSERT_THAT(AreEqual(42, SystemReadValue.load()));
+	}
+
+	TEST_METHOD(ReadOnlyAnyThreadPipelines_FromTwoThreads_RunAlongsideEachOther)
+	{
+		std::atomic<int32> RunningSystemCount = 0;
+		std::atomic<bool> bBothSystemsRunning = false;
+		std::atomic<int32> SawOtherSystemCount = 0;
+
+		auto CreateRendezvousSystem = [&](const FGameplayTag& InTickType)
+		{
+			World()->GetNativeFlecsWorld().system<>()
+				.kind(flecs::OnUpdate)
+				.run([&](flecs::iter& InIterator)
+				{
+					while (InIterator.next())
+					{
+					}
+					
+					if (++RunningSystemCount == 2)
+					{
+						bBothSystemsRunning = true;
+					}
+
+					if (WaitForFlag(bBothSystemsRunning))
+					{
+						++SawOtherSystemCount;
+					}
+				})
+				.add(World()->GetTagEntity(InTickType).GetFlecsId());
+		};
+
+		CreateRendezvousSystem(FlecsTickType_PrePhysics);
+		CreateRendezvousSystem(FlecsTickType_DuringPhysics);
+
+		const UE::Tasks::FTask PrePhysicsTask
+			= LaunchProgressTask(FlecsTickType_PrePhysics, EFlecsTickFunctionWorldAccess::ReadOnly, 1);
+		const UE::Tasks::FTask DuringPhysicsTask
+			= LaunchProgressTask(FlecsTickType_DuringPhysics, EFlecsTickFunctionWorldAccess::ReadOnly, 1);
+
+		PrePhysicsTask.Wait();
+		DuringPhysicsTask.Wait();
+
+		ASSERT_THAT(AreEqual(2, SawOtherSystemCount.load()));
+	}
+
+	TEST_METHOD(ReadOnlyPipeline_CommandsAreMergedWhenTheLastReaderLeaves)
+	{
+		FFlecsTestStruct_Value InitialValue;
+		InitialValue.Value = 1;
+
+		const FFlecsEntityHandle Entity = World()->CreateEntity()
+			.Set<FFlecsTestStruct_Value>(InitialValue);
+
+		World()->GetNativeFlecsWorld().system<const FFlecsTestStruct_Value>()
+			.kind(flecs::OnUpdate)
+			.run([](flecs::iter& InIterator)
+			{
+				while (InIterator.next())
+				{
+					for (const size_t Index : InIterator)
+					{
+						FFlecsTestStruct_Value NextValue;
+						NextValue.Value = InIterator.field_at<const FFlecsTestStruct_Value>(0, Index).Value + 1;
+						
+						// Enqueued on the stage of the ReadOnly pipeline
+						InIterator.entity(Index).set<FFlecsTestStruct_Value>(NextValue);
+					}
+				}
+			})
+			.add(World()->GetTagEntity(FlecsTickType_DuringPhysics).GetFlecsId());
+
+		{
+			const FFlecsWorldAccessScope AccessScope(World()->GetWorldAccessLock(), EFlecsTickFunctionWorldAccess::ReadOnly);
+			
+			World()->ProgressGameLoops(FlecsTickType_DuringPhysics, 0.0, EFlecsTickFunctionWorldAccess::ReadOnly);
+			ASSERT_THAT(AreEqual(1, Entity.Get<FFlecsTestStruct_Value>().Value));
+		}
+
+		ASSERT_THAT(AreEqual(2, Entity.Get<FFlecsTestStruct_Value>().Value));
+	}
+
+}; // UnrealFlecsTickFunctionThreadingTests
+
+#endif // #if WITH_AUTOMATION_TESTS
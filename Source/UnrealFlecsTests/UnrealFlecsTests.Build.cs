@@ -36,6 +36,7 @@ public class UnrealFlecsTests : ModuleRules
                 "AutomationUtils",
                 "FunctionalTesting",
                 "CQTest",
+                "Sockets",
                 "SolidMacros",
                 "FlecsLibrary",
 				"UnrealFlecs",